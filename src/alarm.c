@@ -35,6 +35,9 @@
 #include "log.h"
 #include "types.h"
 
+#ifdef VICE_PROFILE
+alarm_trace_func_t alarm_trace_func = NULL;
+#endif
 
 alarm_context_t *alarm_context_new(const char *name)
 {
@@ -54,6 +57,9 @@ void alarm_context_init(alarm_context_t *context, const char *name)
 
     context->num_pending_alarms = 0;
     context->next_pending_alarm_clk = (CLOCK) ~0L;
+    context->next_pending_alarm = NULL;
+
+    context->profile_counter = PROFILE_COUNT_ALARMS;
 }
 
 void alarm_context_destroy(alarm_context_t *context)
@@ -85,6 +91,9 @@ void alarm_context_time_warp(alarm_context_t *context, CLOCK warp_amount,
         return;
     }
 
+    ALARM_TRACE(context, NULL, ALARM_TRACE_WARP,
+                warp_direction > 0 ? warp_amount : (CLOCK)-warp_amount);
+
     for (i = 0; i < context->num_pending_alarms; i++) {
         if (warp_direction > 0) {
             context->pending_alarms[i].clk += warp_amount;
@@ -93,10 +102,15 @@ void alarm_context_time_warp(alarm_context_t *context, CLOCK warp_amount,
         }
     }
 
-    if (warp_direction > 0) {
-        context->next_pending_alarm_clk += warp_amount;
-    } else {
-        context->next_pending_alarm_clk -= warp_amount;
+    /* Shifting every alarm keeps the heap ordered unless a clock wrapped
+       around, so rebuild it to be safe; warps are rare.  */
+    for (i = context->num_pending_alarms / 2; i > 0; i--) {
+        alarm_context_heap_down(context, i - 1);
+    }
+
+    if (context->next_pending_alarm != NULL) {
+        context->next_pending_alarm_clk
+            = context->pending_alarms[context->next_pending_alarm->pending_idx].clk;
     }
 }
 
@@ -167,6 +181,8 @@ void alarm_destroy(alarm_t *alarm)
 void alarm_unset(alarm_t *alarm)
 {
     alarm_context_t *context;
+    alarm_t *moved;
+    unsigned int last, list_idx;
     int idx;
 
     idx = alarm->pending_idx;
@@ -176,34 +192,38 @@ void alarm_unset(alarm_t *alarm)
     }
     context = alarm->context;
 
-    if (context->num_pending_alarms > 1) {
-        int last;
-
-        last = --context->num_pending_alarms;
+    ALARM_TRACE(context, alarm, ALARM_TRACE_UNSET, 0);
 
-        if (last != idx) {
-            /* Let's copy the struct by hand to make sure stupid compilers
-               don't do stupid things.  */
-            context->pending_alarms[idx].alarm
-                = context->pending_alarms[last].alarm;
-            context->pending_alarms[idx].clk
-                = context->pending_alarms[last].clk;
+    list_idx = context->pending_alarms[idx].list_idx;
+    last = --context->num_pending_alarms;
 
-            context->pending_alarms[idx].alarm->pending_idx = idx;
+    if ((unsigned int)idx != last) {
+        /* Fill the hole with the last heap entry and restore the order.  */
+        alarm_context_heap_place(context, (unsigned int)idx,
+                                 &context->pending_alarms[last]);
+        if (idx > 0
+            && alarm_context_heap_before(&context->pending_alarms[idx],
+                                         &context->pending_alarms[(idx - 1) >> 1])) {
+            alarm_context_heap_up(context, (unsigned int)idx);
+        } else {
+            alarm_context_heap_down(context, (unsigned int)idx);
         }
+    }
 
-        if (context->next_pending_alarm_idx == idx) {
-            alarm_context_update_next_pending(context);
-        } else if (context->next_pending_alarm_idx == last) {
-            context->next_pending_alarm_idx = idx;
-        }
-    } else {
-        context->num_pending_alarms = 0;
-        context->next_pending_alarm_clk = (CLOCK) ~0L;
-        context->next_pending_alarm_idx = -1;
+    /* The last alarm of the list takes the place of this one, which can
+       only make it come later among alarms due on the same clock.  */
+    if (list_idx != last) {
+        moved = context->pending_list[last];
+        context->pending_list[list_idx] = moved;
+        context->pending_alarms[moved->pending_idx].list_idx = list_idx;
+        alarm_context_heap_down(context, (unsigned int)moved->pending_idx);
     }
 
     alarm->pending_idx = -1;
+
+    if (alarm == context->next_pending_alarm) {
+        alarm_context_update_next_pending(context);
+    }
 }
 
 void alarm_log_too_many_alarms(void)
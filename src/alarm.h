@@ -28,6 +28,9 @@
 #ifndef VICE_ALARM_H
 #define VICE_ALARM_H
 
+#include <stddef.h>
+
+#include "profile.h"
 #include "types.h"
 
 #define ALARM_CONTEXT_MAX_PENDING_ALARMS 0x100
@@ -45,7 +48,7 @@ struct alarm_s {
     /* Callback to be called when the alarm is dispatched.  */
     alarm_callback_t callback;
 
-    /* Index into the pending alarm list.  If < 0, the alarm is not
+    /* Index into the pending alarm heap.  If < 0, the alarm is not
        pending.  */
     int pending_idx;
 
@@ -63,6 +66,10 @@ struct pending_alarms_s {
 
     /* Clock tick at which this alarm should be activated.  */
     CLOCK clk;
+
+    /* Place of the alarm in the order alarms were set, see
+       `pending_list' below.  */
+    unsigned int list_idx;
 };
 typedef struct pending_alarms_s pending_alarms_t;
 
@@ -74,16 +81,26 @@ struct alarm_context_s {
     /* Alarm list.  */
     struct alarm_s *alarms;
 
-    /* Pending alarm array.  Statically allocated because it's slightly
-       faster this way.  */
+    /* Pending alarm heap, earliest alarm first.  Statically allocated
+       because it's slightly faster this way.  */
     pending_alarms_t pending_alarms[ALARM_CONTEXT_MAX_PENDING_ALARMS];
     unsigned int num_pending_alarms;
 
+    /* The pending alarms in the order of the unsorted list that was used
+       before the heap: new alarms go to the end and the last one fills
+       the place of an alarm that is unset.  Alarms due on the same clock
+       are dispatched in the order this list gave them.  */
+    struct alarm_s *pending_list[ALARM_CONTEXT_MAX_PENDING_ALARMS];
+
     /* Clock tick for the next pending alarm.  */
     CLOCK next_pending_alarm_clk;
 
-    /* Pending alarm number.  */
-    int next_pending_alarm_idx;
+    /* The next pending alarm, or NULL when there is nothing pending.  */
+    struct alarm_s *next_pending_alarm;
+
+    /* Profile counter dispatches are counted in, PROFILE_COUNT_ALARMS
+       unless the owner of the context changes it.  */
+    profile_counter_t profile_counter;
 };
 typedef struct alarm_context_s alarm_context_t;
 
@@ -102,6 +119,32 @@ extern void alarm_log_too_many_alarms(void);
 
 /* ------------------------------------------------------------------------- */
 
+/* Alarm tracing, used by the benchmark runner to capture the alarm traffic
+   of a real program and replay it against the scheduler.  */
+
+#define ALARM_TRACE_SET      0
+#define ALARM_TRACE_UNSET    1
+#define ALARM_TRACE_DISPATCH 2
+#define ALARM_TRACE_WARP     3
+
+#ifdef VICE_PROFILE
+typedef void (*alarm_trace_func_t)(alarm_context_t *context, alarm_t *alarm,
+                                   int op, CLOCK clk);
+
+extern alarm_trace_func_t alarm_trace_func;
+
+#define ALARM_TRACE(context, alarm, op, clk)                   \
+    do {                                                       \
+        if (alarm_trace_func) {                                \
+            alarm_trace_func((context), (alarm), (op), (clk)); \
+        }                                                      \
+    } while (0)
+#else
+#define ALARM_TRACE(context, alarm, op, clk)
+#endif
+
+/* ------------------------------------------------------------------------- */
+
 /* Inline functions.  */
 
 inline static CLOCK alarm_context_next_pending_clk(alarm_context_t *context)
@@ -109,38 +152,100 @@ inline static CLOCK alarm_context_next_pending_clk(alarm_context_t *context)
     return context->next_pending_alarm_clk;
 }
 
-inline static void alarm_context_update_next_pending(alarm_context_t *context)
+/* The pending alarms are kept in a binary min-heap ordered by clock, so
+   `pending_alarms[0]' is always the next alarm to dispatch and the children
+   of entry `i' live at `2 * i + 1' and `2 * i + 2'.  The `pending_idx' of
+   an alarm is its slot in the heap.
+
+   Of the alarms due on the same clock the one latest in `pending_list'
+   comes first, as the old list scan picked it.  The scan only ran when the
+   next alarm was unset, moved or overtaken, so `next_pending_alarm' is
+   kept until then too, even if another alarm due on the same clock is set
+   meanwhile.  */
+
+inline static int alarm_context_heap_before(const pending_alarms_t *a,
+                                            const pending_alarms_t *b)
+{
+    return a->clk < b->clk || (a->clk == b->clk && a->list_idx > b->list_idx);
+}
+
+inline static void alarm_context_heap_place(alarm_context_t *context,
+                                            unsigned int idx,
+                                            const pending_alarms_t *entry)
 {
-    CLOCK next_pending_alarm_clk = (CLOCK)~0L;
-    int next_pending_alarm_idx;
-    unsigned int i;
+    context->pending_alarms[idx] = *entry;
+    entry->alarm->pending_idx = (int)idx;
+}
 
-    next_pending_alarm_idx = context->next_pending_alarm_idx;
+/* Move the entry at `idx' towards the root until its parent comes first. */
+inline static void alarm_context_heap_up(alarm_context_t *context,
+                                         unsigned int idx)
+{
+    pending_alarms_t *heap = context->pending_alarms;
+    pending_alarms_t entry = heap[idx];
 
-    for (i = 0; i < context->num_pending_alarms; i++) {
-        CLOCK pending_clk = context->pending_alarms[i].clk;
+    while (idx > 0) {
+        unsigned int parent = (idx - 1) >> 1;
 
-        if (pending_clk <= next_pending_alarm_clk) {
-            next_pending_alarm_clk = pending_clk;
-            next_pending_alarm_idx = (int)i;
+        if (!alarm_context_heap_before(&entry, &heap[parent])) {
+            break;
         }
+        alarm_context_heap_place(context, idx, &heap[parent]);
+        idx = parent;
     }
+    alarm_context_heap_place(context, idx, &entry);
+}
 
-    context->next_pending_alarm_clk = next_pending_alarm_clk;
-    context->next_pending_alarm_idx = next_pending_alarm_idx;
+/* Move the entry at `idx' towards the leaves until it comes before both
+   children.  */
+inline static void alarm_context_heap_down(alarm_context_t *context,
+                                           unsigned int idx)
+{
+    pending_alarms_t *heap = context->pending_alarms;
+    unsigned int num = context->num_pending_alarms;
+    pending_alarms_t entry = heap[idx];
+
+    for (;;) {
+        unsigned int child = 2 * idx + 1;
+
+        if (child >= num) {
+            break;
+        }
+        if (child + 1 < num && alarm_context_heap_before(&heap[child + 1], &heap[child])) {
+            child++;
+        }
+        if (!alarm_context_heap_before(&heap[child], &entry)) {
+            break;
+        }
+        alarm_context_heap_place(context, idx, &heap[child]);
+        idx = child;
+    }
+    alarm_context_heap_place(context, idx, &entry);
+}
+
+inline static void alarm_context_update_next_pending(alarm_context_t *context)
+{
+    if (context->num_pending_alarms > 0) {
+        context->next_pending_alarm_clk = context->pending_alarms[0].clk;
+        context->next_pending_alarm = context->pending_alarms[0].alarm;
+    } else {
+        context->next_pending_alarm_clk = (CLOCK)~0L;
+        context->next_pending_alarm = NULL;
+    }
 }
 
 inline static void alarm_context_dispatch(alarm_context_t *context,
                                           CLOCK cpu_clk)
 {
     CLOCK offset;
-    int idx;
     alarm_t *alarm;
 
     offset = (CLOCK)(cpu_clk - context->next_pending_alarm_clk);
 
-    idx = context->next_pending_alarm_idx;
-    alarm = context->pending_alarms[idx].alarm;
+    alarm = context->next_pending_alarm;
+
+    ALARM_TRACE(context, alarm, ALARM_TRACE_DISPATCH, context->next_pending_alarm_clk);
+    PROFILE_COUNT(context->profile_counter, 1);
 
     (alarm->callback)(offset, alarm->data);
 }
@@ -153,34 +258,48 @@ inline static void alarm_set(alarm_t *alarm, CLOCK cpu_clk)
     context = alarm->context;
     idx = alarm->pending_idx;
 
+    ALARM_TRACE(context, alarm, ALARM_TRACE_SET, cpu_clk);
+
     if (idx < 0) {
-        int new_idx;
+        pending_alarms_t entry;
+        unsigned int new_idx;
 
-        /* Not pending yet: add.  */
+        /* Not pending yet: add at the bottom of the heap and the end of
+           the list.  */
 
-        new_idx = (int)(context->num_pending_alarms);
-        if (new_idx >= (int)ALARM_CONTEXT_MAX_PENDING_ALARMS) {
+        new_idx = context->num_pending_alarms;
+        if (new_idx >= ALARM_CONTEXT_MAX_PENDING_ALARMS) {
             alarm_log_too_many_alarms();
             return;
         }
 
-        context->pending_alarms[new_idx].alarm = alarm;
-        context->pending_alarms[new_idx].clk = cpu_clk;
+        entry.alarm = alarm;
+        entry.clk = cpu_clk;
+        entry.list_idx = new_idx;
 
+        context->pending_list[new_idx] = alarm;
         context->num_pending_alarms++;
+        alarm_context_heap_place(context, new_idx, &entry);
+        alarm_context_heap_up(context, new_idx);
 
         if (cpu_clk < context->next_pending_alarm_clk) {
             context->next_pending_alarm_clk = cpu_clk;
-            context->next_pending_alarm_idx = new_idx;
+            context->next_pending_alarm = alarm;
         }
-
-        alarm->pending_idx = new_idx;
     } else {
+        CLOCK old_clk = context->pending_alarms[idx].clk;
+
         /* Already pending: modify.  */
 
         context->pending_alarms[idx].clk = cpu_clk;
-        if (context->next_pending_alarm_clk > cpu_clk
-            || idx == context->next_pending_alarm_idx) {
+        if (cpu_clk < old_clk) {
+            alarm_context_heap_up(context, (unsigned int)idx);
+        } else {
+            alarm_context_heap_down(context, (unsigned int)idx);
+        }
+
+        if (cpu_clk < context->next_pending_alarm_clk
+            || alarm == context->next_pending_alarm) {
             alarm_context_update_next_pending(context);
         }
     }
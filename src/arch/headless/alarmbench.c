@@ -0,0 +1,335 @@
+/*
+ * alarmbench.c - Alarm scheduler trace capture and replay.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * While recording, every alarm_set(), alarm_unset(), dispatch and time
+ * warp of the main CPU and drive alarm contexts is written to a file.
+ * The alarms that are already pending when recording starts are written
+ * first, so a replay starts from the same scheduler state.
+ *
+ * Replaying feeds the same operations to fresh alarm contexts whose
+ * callbacks do nothing; the state changes the real callbacks made are in
+ * the trace anyway.  What is left is the cost of the scheduler itself.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "alarm.h"
+#include "alarmbench.h"
+#include "drive.h"
+#include "drivetypes.h"
+#include "lib.h"
+#include "maincpu.h"
+#include "profile.h"
+#include "types.h"
+
+#define ALARMBENCH_MAGIC         "VICEALRM"
+#define ALARMBENCH_MAGIC_LEN     8
+#define ALARMBENCH_MAX_CONTEXTS  (1 + DRIVE_NUM)
+#define ALARMBENCH_MAX_ALARMS    0x400
+
+/* One scheduler operation, 8 bytes on disk in host byte order.  */
+typedef struct alarm_trace_rec_s {
+    uint8_t op;
+    uint8_t context;
+    uint16_t alarm;
+    uint32_t clk;
+} alarm_trace_rec_t;
+
+#ifdef VICE_PROFILE
+
+static FILE *trace_file = NULL;
+static unsigned long trace_records;
+
+static alarm_context_t *contexts[ALARMBENCH_MAX_CONTEXTS];
+static int num_contexts;
+static alarm_t *alarms[ALARMBENCH_MAX_ALARMS];
+static int num_alarms;
+
+static int context_index(alarm_context_t *context)
+{
+    int i;
+
+    for (i = 0; i < num_contexts; i++) {
+        if (contexts[i] == context) {
+            return i;
+        }
+    }
+    if (num_contexts == ALARMBENCH_MAX_CONTEXTS) {
+        return -1;
+    }
+    contexts[num_contexts] = context;
+    return num_contexts++;
+}
+
+static int alarm_index(alarm_t *alarm)
+{
+    int i;
+
+    if (alarm == NULL) {
+        return 0;
+    }
+    for (i = 0; i < num_alarms; i++) {
+        if (alarms[i] == alarm) {
+            return i;
+        }
+    }
+    if (num_alarms == ALARMBENCH_MAX_ALARMS) {
+        return -1;
+    }
+    alarms[num_alarms] = alarm;
+    return num_alarms++;
+}
+
+static void trace_func(alarm_context_t *context, alarm_t *alarm, int op, CLOCK clk)
+{
+    alarm_trace_rec_t rec;
+    int c, a;
+
+    c = context_index(context);
+    a = alarm_index(alarm);
+    if (c < 0 || a < 0) {
+        return;
+    }
+
+    rec.op = (uint8_t)op;
+    rec.context = (uint8_t)c;
+    rec.alarm = (uint16_t)a;
+    rec.clk = (uint32_t)clk;
+
+    fwrite(&rec, sizeof(rec), 1, trace_file);
+    trace_records++;
+}
+
+/* In list order, so the replay dispatches alarms due on the same clock in
+   the same order.  */
+static void record_pending(alarm_context_t *context)
+{
+    alarm_t *alarm;
+    unsigned int i;
+
+    for (i = 0; i < context->num_pending_alarms; i++) {
+        alarm = context->pending_list[i];
+        trace_func(context, alarm, ALARM_TRACE_SET,
+                   context->pending_alarms[alarm->pending_idx].clk);
+    }
+}
+
+int alarmbench_record_start(const char *filename)
+{
+    int dnr;
+
+    trace_file = fopen(filename, "wb");
+    if (trace_file == NULL) {
+        fprintf(stderr, "vicebench: cannot create alarm trace '%s'\n", filename);
+        return -1;
+    }
+    fwrite(ALARMBENCH_MAGIC, ALARMBENCH_MAGIC_LEN, 1, trace_file);
+
+    num_contexts = 0;
+    num_alarms = 0;
+    trace_records = 0;
+
+    record_pending(maincpu_alarm_context);
+    for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
+        if (drive_context[dnr] != NULL && drive_context[dnr]->cpu != NULL) {
+            record_pending(drive_context[dnr]->cpu->alarm_context);
+        }
+    }
+
+    alarm_trace_func = trace_func;
+
+    return 0;
+}
+
+void alarmbench_record_stop(void)
+{
+    if (trace_file == NULL) {
+        return;
+    }
+
+    alarm_trace_func = NULL;
+    fclose(trace_file);
+    trace_file = NULL;
+
+    printf("alarm trace:    %lu operations, %d alarms in %d contexts\n",
+           trace_records, num_alarms, num_contexts);
+}
+
+#else
+
+int alarmbench_record_start(const char *filename)
+{
+    fprintf(stderr, "vicebench: alarm tracing needs a VICE_PROFILE build\n");
+    return -1;
+}
+
+void alarmbench_record_stop(void)
+{
+}
+
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+static void replay_callback(CLOCK offset, void *data)
+{
+}
+
+static alarm_trace_rec_t *load_trace(const char *filename, size_t *count)
+{
+    FILE *f;
+    char magic[ALARMBENCH_MAGIC_LEN];
+    alarm_trace_rec_t *recs;
+    long size;
+
+    f = fopen(filename, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "vicebench: cannot open alarm trace '%s'\n", filename);
+        return NULL;
+    }
+
+    if (fread(magic, ALARMBENCH_MAGIC_LEN, 1, f) != 1
+        || memcmp(magic, ALARMBENCH_MAGIC, ALARMBENCH_MAGIC_LEN) != 0) {
+        fprintf(stderr, "vicebench: '%s' is not an alarm trace\n", filename);
+        fclose(f);
+        return NULL;
+    }
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f) - ALARMBENCH_MAGIC_LEN;
+    fseek(f, ALARMBENCH_MAGIC_LEN, SEEK_SET);
+
+    *count = (size_t)size / sizeof(alarm_trace_rec_t);
+    if (*count == 0) {
+        fprintf(stderr, "vicebench: alarm trace '%s' is empty\n", filename);
+        fclose(f);
+        return NULL;
+    }
+
+    recs = lib_malloc(*count * sizeof(alarm_trace_rec_t));
+    if (fread(recs, sizeof(alarm_trace_rec_t), *count, f) != *count) {
+        fprintf(stderr, "vicebench: short read on alarm trace '%s'\n", filename);
+        lib_free(recs);
+        fclose(f);
+        return NULL;
+    }
+
+    fclose(f);
+    return recs;
+}
+
+int alarmbench_replay(const char *filename, int passes)
+{
+    alarm_trace_rec_t *recs;
+    size_t count, i;
+    alarm_context_t *replay_contexts[ALARMBENCH_MAX_CONTEXTS];
+    alarm_t *replay_alarms[ALARMBENCH_MAX_ALARMS];
+    unsigned long mismatches = 0;
+    uint64_t start_ns, elapsed_ns;
+    int pass, n;
+
+    recs = load_trace(filename, &count);
+    if (recs == NULL) {
+        return -1;
+    }
+
+    memset(replay_contexts, 0, sizeof(replay_contexts));
+    memset(replay_alarms, 0, sizeof(replay_alarms));
+
+    for (i = 0; i < count; i++) {
+        alarm_trace_rec_t *rec = &recs[i];
+
+        if (rec->context >= ALARMBENCH_MAX_CONTEXTS || rec->alarm >= ALARMBENCH_MAX_ALARMS) {
+            fprintf(stderr, "vicebench: corrupt alarm trace '%s'\n", filename);
+            lib_free(recs);
+            return -1;
+        }
+        if (replay_contexts[rec->context] == NULL) {
+            replay_contexts[rec->context] = alarm_context_new("replay");
+        }
+        if (rec->op != ALARM_TRACE_WARP && replay_alarms[rec->alarm] == NULL) {
+            replay_alarms[rec->alarm] = alarm_new(replay_contexts[rec->context],
+                                                  "replay", replay_callback, NULL);
+        }
+    }
+
+    start_ns = profile_now_ns();
+
+    for (pass = 0; pass < passes; pass++) {
+        for (n = 0; n < ALARMBENCH_MAX_ALARMS; n++) {
+            if (replay_alarms[n] != NULL) {
+                alarm_unset(replay_alarms[n]);
+            }
+        }
+
+        for (i = 0; i < count; i++) {
+            alarm_trace_rec_t *rec = &recs[i];
+            alarm_context_t *context = replay_contexts[rec->context];
+
+            switch (rec->op) {
+                case ALARM_TRACE_SET:
+                    alarm_set(replay_alarms[rec->alarm], (CLOCK)rec->clk);
+                    break;
+                case ALARM_TRACE_UNSET:
+                    alarm_unset(replay_alarms[rec->alarm]);
+                    break;
+                case ALARM_TRACE_DISPATCH:
+                    if (alarm_context_next_pending_clk(context) != (CLOCK)rec->clk
+                        || context->next_pending_alarm != replay_alarms[rec->alarm]) {
+                        mismatches++;
+                    }
+                    alarm_context_dispatch(context, (CLOCK)rec->clk);
+                    break;
+                case ALARM_TRACE_WARP:
+                    if ((int32_t)rec->clk < 0) {
+                        alarm_context_time_warp(context, (CLOCK)-(int32_t)rec->clk, -1);
+                    } else {
+                        alarm_context_time_warp(context, (CLOCK)rec->clk, 1);
+                    }
+                    break;
+            }
+        }
+    }
+
+    elapsed_ns = profile_now_ns() - start_ns;
+
+    printf("alarm trace:    %s\n", filename);
+    printf("operations:     %lu x %d passes\n", (unsigned long)count, passes);
+    printf("seconds:        %.3f\n", elapsed_ns / 1e9);
+    printf("ns/operation:   %.2f\n", (double)elapsed_ns / ((double)count * passes));
+    printf("mismatches:     %lu\n", mismatches);
+
+    for (n = 0; n < ALARMBENCH_MAX_CONTEXTS; n++) {
+        if (replay_contexts[n] != NULL) {
+            alarm_context_destroy(replay_contexts[n]);
+        }
+    }
+    lib_free(recs);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * alarmbench.h - Alarm scheduler trace capture and replay.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_ALARMBENCH_H
+#define VICE_ALARMBENCH_H
+
+extern int alarmbench_record_start(const char *filename);
+extern void alarmbench_record_stop(void);
+
+/* Replay a recorded trace <passes> times and print the timing.  Returns
+   -1 on error, 1 if the scheduler disagreed with the recording.  */
+extern int alarmbench_replay(const char *filename, int passes);
+
+#endif
@@ -0,0 +1,508 @@
+/*
+ * archdep.c - Miscellaneous system-specific stuff for the headless backend.
+ *
+ * Based on the PSVITA and Unix ports by
+ *  Amnon-Dan Meir <ammeir71@yahoo.com>
+ *  Marco van den Heuvel <blackystardust68@yahoo.com>
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+
+#include "archdep.h"
+#include "ioutil.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "util.h"
+#include "keyboard.h"
+#include "joy.h"
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <signal.h>
+
+/* Directory holding the C64/DRIVES/PRINTER ROM sets, set by the build. */
+#ifndef HEADLESS_RESOURCE_DIR
+#define HEADLESS_RESOURCE_DIR "resources"
+#endif
+
+static char *argv0 = NULL;
+static char *home_dir = NULL;
+static char *program_name = NULL;
+static char *vice_resource_dir = NULL;
+static char *sysfile_path = NULL;
+
+/* alternate storage of preferences */
+const char *archdep_pref_path = NULL;
+
+
+int archdep_init(int *argc, char **argv)
+{
+    argv0 = lib_stralloc(argv[0]);
+    return 0;
+}
+
+const char *archdep_home_path(void)
+{
+    /* Keep resource and fliplist files out of the user's real VICE config,
+       benchmark runs must not depend on whatever is stored there. */
+    if (home_dir == NULL) {
+        home_dir = lib_stralloc(".");
+    }
+
+    return home_dir;
+}
+
+char *archdep_default_autostart_disk_image_file_name(void)
+{
+    return util_concat(archdep_home_path(), "/",
+                       ARCHDEP_AUTOSTART_DISKIMAGE_PREFIX,
+                       machine_get_name(),
+                       ARCHDEP_AUTOSTART_DISKIMAGE_SUFFIX,
+                       NULL);
+}
+
+char *archdep_default_sysfile_pathlist(const char *emu_id)
+{
+    const char *resource_path = archdep_vice_resource_path();
+    const char *paths[4];
+    char *machine_roms;
+    char *drive_roms;
+    char *printer_roms;
+
+    if (sysfile_path != NULL) {
+        /* sysfile.c appears to free() this */
+        return lib_stralloc(sysfile_path);
+    }
+
+    machine_roms = archdep_join_paths(resource_path, emu_id, NULL);
+    drive_roms = archdep_join_paths(resource_path, "DRIVES", NULL);
+    printer_roms = archdep_join_paths(resource_path, "PRINTER", NULL);
+
+    paths[0] = machine_roms;
+    paths[1] = drive_roms;
+    paths[2] = printer_roms;
+    paths[3] = NULL;
+    sysfile_path = util_strjoin(paths, ARCHDEP_FINDPATH_SEPARATOR_STRING);
+
+    lib_free(machine_roms);
+    lib_free(drive_roms);
+    lib_free(printer_roms);
+
+    return lib_stralloc(sysfile_path);
+}
+
+void archdep_default_sysfile_pathlist_free(void)
+{
+    if (sysfile_path != NULL) {
+        lib_free(sysfile_path);
+        sysfile_path = NULL;
+    }
+}
+
+/* Return a malloc'ed backup file name for file `fname'.  */
+char *archdep_make_backup_filename(const char *fname)
+{
+    return util_concat(fname, "~", NULL);
+}
+
+char *archdep_default_resource_file_name(void)
+{
+    return archdep_join_paths(archdep_home_path(), ARCHDEP_VICERC_NAME, NULL);
+}
+
+char *archdep_default_fliplist_file_name(void)
+{
+    char *name;
+    char *path;
+
+    name = util_concat("fliplist-", machine_get_name(), ".vfl", NULL);
+    path = archdep_join_paths(archdep_home_path(), name, NULL);
+    lib_free(name);
+
+    return path;
+}
+
+char *archdep_default_rtc_file_name(void)
+{
+    return archdep_join_paths(archdep_home_path(), "vice.rtc", NULL);
+}
+
+/* The benchmark report goes to stdout, so keep the emulator log on stderr. */
+int archdep_default_logger(const char *level_string, const char *txt)
+{
+    if (fputs(level_string, stderr) == EOF
+        || fprintf(stderr, "%s", txt) < 0
+        || fputc('\n', stderr) == EOF) {
+        return -1;
+    }
+    return 0;
+}
+
+FILE *archdep_open_default_log_file(void)
+{
+    return NULL;
+}
+
+int archdep_path_is_relative(const char *path)
+{
+    if (path == NULL) {
+        return 0;
+    }
+
+    return *path != '/';
+}
+
+int archdep_spawn(const char *name, char **argv,
+                  char **pstdout_redir, const char *stderr_redir)
+{
+    return -1;
+}
+
+/* return malloc'd version of full pathname of orig_name */
+int archdep_expand_path(char **return_path, const char *orig_name)
+{
+    if (*orig_name == '/') {
+        *return_path = lib_stralloc(orig_name);
+    } else {
+        char *cwd;
+
+        cwd = ioutil_current_dir();
+        *return_path = util_concat(cwd, "/", orig_name, NULL);
+        lib_free(cwd);
+    }
+    return 0;
+}
+
+void archdep_startup_log_error(const char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    vfprintf(stderr, format, ap);
+    va_end(ap);
+}
+
+char *archdep_filename_parameter(const char *name)
+{
+    return lib_stralloc(name);
+}
+
+char *archdep_quote_parameter(const char *name)
+{
+    return lib_stralloc(name);
+}
+
+char *archdep_tmpnam(void)
+{
+    char *tmp_name;
+    const char *tmp_dir;
+    int fd;
+
+    tmp_dir = getenv("TMPDIR");
+    if (tmp_dir == NULL) {
+        tmp_dir = "/tmp";
+    }
+
+    tmp_name = util_concat(tmp_dir, "/vice.XXXXXX", NULL);
+    fd = mkstemp(tmp_name);
+    if (fd < 0) {
+        tmp_name[0] = '\0';
+    } else {
+        close(fd);
+    }
+
+    return tmp_name;
+}
+
+FILE *archdep_mkstemp_fd(char **filename, const char *mode)
+{
+    char *tmp;
+    FILE *fd;
+
+    tmp = archdep_tmpnam();
+    if (*tmp == '\0') {
+        lib_free(tmp);
+        return NULL;
+    }
+
+    fd = fopen(tmp, mode);
+    if (fd == NULL) {
+        lib_free(tmp);
+        return NULL;
+    }
+
+    *filename = tmp;
+
+    return fd;
+}
+
+int archdep_file_is_gzip(const char *name)
+{
+    size_t l = strlen(name);
+
+    if ((l < 4 || strcasecmp(name + l - 3, ".gz"))
+        && (l < 3 || strcasecmp(name + l - 2, ".z"))
+        && (l < 4 || toupper(name[l - 1]) != 'Z' || name[l - 4] != '.')) {
+        return 0;
+    }
+    return 1;
+}
+
+int archdep_file_set_gzip(const char *name)
+{
+    return 0;
+}
+
+int archdep_mkdir(const char *pathname, int mode)
+{
+    return mkdir(pathname, (mode_t)mode);
+}
+
+int archdep_rmdir(const char *pathname)
+{
+    return rmdir(pathname);
+}
+
+int archdep_stat(const char *file_name, unsigned int *len, unsigned int *isdir)
+{
+    struct stat statbuf;
+
+    if (stat(file_name, &statbuf) < 0) {
+        return -1;
+    }
+
+    *len = (unsigned int)statbuf.st_size;
+    *isdir = S_ISDIR(statbuf.st_mode);
+
+    return 0;
+}
+
+int archdep_rename(const char *oldpath, const char *newpath)
+{
+    return rename(oldpath, newpath);
+}
+
+void archdep_shutdown(void)
+{
+    lib_free(argv0);
+    argv0 = NULL;
+    lib_free(home_dir);
+    home_dir = NULL;
+    archdep_program_name_free();
+    archdep_vice_resource_path_free();
+    archdep_default_sysfile_pathlist_free();
+}
+
+signed long kbd_arch_keyname_to_keynum(char *keyname)
+{
+    return (signed long)atoi(keyname);
+}
+
+const char *kbd_arch_keynum_to_keyname(signed long keynum)
+{
+    static char keyname[20];
+
+    sprintf(keyname, "%li", keynum);
+    return keyname;
+}
+
+void kbd_arch_init(void)
+{
+    keyboard_clear_keymatrix();
+}
+
+int kbd_arch_get_host_mapping(void)
+{
+    return KBD_MAPPING_US;
+}
+
+int joy_arch_init(void)
+{
+    return 0;
+}
+
+void joystick_close(void)
+{
+}
+
+void kbd_initialize_numpad_joykeys(int *joykeys)
+{
+}
+
+int joy_arch_cmdline_options_init(void)
+{
+    return 0;
+}
+
+int joy_arch_set_device(int port_idx, int joy_dev)
+{
+    return 0;
+}
+
+int joy_arch_resources_init(void)
+{
+    return 0;
+}
+
+char *archdep_extra_title_text(void)
+{
+    return NULL;
+}
+
+int archdep_vice_atexit(void (*function)(void))
+{
+    return atexit(function);
+}
+
+void archdep_vice_exit(int excode)
+{
+    exit(excode);
+}
+
+int archdep_register_cbmfont(void)
+{
+    return 0;
+}
+
+void archdep_unregister_cbmfont(void)
+{
+}
+
+/** \brief  Join multiple paths into a single path
+ *
+ * \param   [in]    path    list of paths to join, NULL-terminated
+ *
+ * \return  heap-allocated string, free with lib_free()
+ */
+char *archdep_join_paths(const char *path, ...)
+{
+    const char *arg;
+    char *result;
+    char *endptr;
+    size_t result_len;
+    size_t len;
+    va_list ap;
+
+    if (path == NULL) {
+        return NULL;
+    }
+
+    /* determine size of result string */
+    va_start(ap, path);
+    result_len = strlen(path);
+    while ((arg = va_arg(ap, const char *)) != NULL) {
+        result_len += (strlen(arg) + 1);
+    }
+    va_end(ap);
+
+    result = lib_calloc(result_len + 1, 1);
+    strcpy(result, path);
+    endptr = result + strlen(path);
+
+    /* now concatenate arguments into a pathname */
+    va_start(ap, path);
+    while ((arg = va_arg(ap, const char *)) != NULL) {
+        len = strlen(arg);
+        *endptr++ = ARCHDEP_DIR_SEPARATOR;
+        memcpy(endptr, arg, len + 1);
+        endptr += len;
+    }
+    va_end(ap);
+
+    return result;
+}
+
+const char *archdep_program_name(void)
+{
+    if (program_name == NULL) {
+        char *p;
+
+        p = strrchr(argv0, '/');
+        if (p == NULL) {
+            program_name = lib_stralloc(argv0);
+        } else {
+            program_name = lib_stralloc(p + 1);
+        }
+    }
+
+    return program_name;
+}
+
+void archdep_program_name_free(void)
+{
+    if (program_name != NULL) {
+        lib_free(program_name);
+        program_name = NULL;
+    }
+}
+
+char *archdep_vice_resource_path(void)
+{
+    if (vice_resource_dir == NULL) {
+        const char *env = getenv("VICE_RESOURCES");
+
+        vice_resource_dir = lib_stralloc(env != NULL ? env : HEADLESS_RESOURCE_DIR);
+    }
+
+    return vice_resource_dir;
+}
+
+void archdep_vice_resource_path_free(void)
+{
+    if (vice_resource_dir != NULL) {
+        lib_free(vice_resource_dir);
+        vice_resource_dir = NULL;
+    }
+}
+
+static RETSIGTYPE break64(int sig)
+{
+    log_message(LOG_DEFAULT, "Received signal %d, exiting.", sig);
+    exit(-1);
+}
+
+void archdep_signals_init(int do_core_dumps)
+{
+    if (!do_core_dumps) {
+        signal(SIGINT, break64);
+        signal(SIGTERM, break64);
+    }
+}
+
+typedef void (*signal_handler_t)(int);
+static signal_handler_t old_pipe_handler;
+
+void archdep_signals_pipe_set(void)
+{
+    old_pipe_handler = signal(SIGPIPE, SIG_IGN);
+}
+
+void archdep_signals_pipe_unset(void)
+{
+    signal(SIGPIPE, old_pipe_handler);
+}
@@ -0,0 +1,379 @@
+/*
+ * archivebench.c - Measure attaching a gzip compressed disk image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -archivebench gzips a copy of a disk image (or copies it if it already
+ * is gzipped) and opens it the way the virtual drive does <n> times: with
+ * zfile uncompressing into a temporary file as before, for the first time
+ * into memory and again from memory.  Then it checks that all three see
+ * the same image, that a sector written in memory makes it back into the
+ * .gz file of a .d64, that an image replaced by one of the same length
+ * is read again, and that files handed over with zfile_memory_add() are
+ * kept even when they take more than the limit, they are the only copy.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <utime.h>
+#include <zlib.h>
+
+#include "archdep.h"
+#include "archivebench.h"
+#include "diskimage.h"
+#include "fsimage.h"
+#include "imagebench.h"
+#include "ioutil.h"
+#include "lib.h"
+#include "profile.h"
+#include "types.h"
+#include "util.h"
+#include "zfile.h"
+
+#define ARCHIVEBENCH_NAMES 3
+
+static int make_gzip(const char *from, const char *to)
+{
+    FILE *in;
+    gzFile out;
+    uint8_t buf[0x4000];
+    size_t len;
+    int retval = 0, gzipped;
+
+    in = fopen(from, MODE_READ);
+    if (in == NULL) {
+        return -1;
+    }
+    len = fread(buf, 1, sizeof(buf), in);
+    gzipped = len >= 2 && buf[0] == 0x1f && buf[1] == 0x8b;
+
+    if (gzipped) {
+        FILE *f = fopen(to, MODE_WRITE);
+
+        if (f == NULL) {
+            fclose(in);
+            return -1;
+        }
+        do {
+            if (fwrite(buf, 1, len, f) != len) {
+                retval = -1;
+                break;
+            }
+        } while ((len = fread(buf, 1, sizeof(buf), in)) > 0);
+        if (fclose(f) == EOF) {
+            retval = -1;
+        }
+    } else {
+        out = gzopen(to, MODE_WRITE "9");
+        if (out == NULL) {
+            fclose(in);
+            return -1;
+        }
+        do {
+            if (gzwrite(out, buf, (unsigned int)len) != (int)len) {
+                retval = -1;
+                break;
+            }
+        } while ((len = fread(buf, 1, sizeof(buf), in)) > 0);
+        if (gzclose(out) != Z_OK) {
+            retval = -1;
+        }
+    }
+    fclose(in);
+
+    return retval;
+}
+
+/* Open and close `name', returning the time it took to open and a copy of
+   what fsimage read.  */
+static uint64_t attach(const char *name, uint8_t **data, size_t *size)
+{
+    disk_image_t *image;
+    fsimage_t *fsimage;
+    uint64_t start, ns;
+
+    start = profile_now_ns();
+    image = imagebench_open(name);
+    ns = profile_now_ns() - start;
+    if (image == NULL) {
+        return 0;
+    }
+    fsimage = image->media.fsimage;
+    if (data != NULL) {
+        *size = fsimage->buffer.size;
+        *data = lib_malloc(*size);
+        memcpy(*data, fsimage->buffer.data, *size);
+    }
+    imagebench_close(image);
+
+    return ns ? ns : 1;
+}
+
+static uint64_t attach_passes(const char *name, int passes)
+{
+    uint64_t ns, total = 0;
+    int pass;
+
+    for (pass = 0; pass < passes; pass++) {
+        ns = attach(name, NULL, NULL);
+        if (ns == 0) {
+            return 0;
+        }
+        total += ns;
+    }
+    return total / passes;
+}
+
+static int same(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size)
+{
+    return a != NULL && b != NULL && a_size == b_size && memcmp(a, b, a_size) == 0;
+}
+
+/* Write track 18 sector 1 from memory, then look for it through a
+   temporary file.  */
+static int check_write_back(const char *name, const uint8_t *data, size_t size)
+{
+    disk_image_t *image;
+    disk_addr_t dadr;
+    uint8_t sector[256], *file_data = NULL;
+    size_t file_size = 0;
+    unsigned int i;
+    int failed = 0;
+
+    image = imagebench_open(name);
+    if (image == NULL || image->read_only) {
+        printf("archive check:  cannot open the .gz file for writing\n");
+        if (image != NULL) {
+            imagebench_close(image);
+        }
+        return 1;
+    }
+    for (i = 0; i < 256; i++) {
+        sector[i] = (uint8_t)(i * 13 + 5);
+    }
+    dadr.track = 18;
+    dadr.sector = 1;
+    if (disk_image_write_sector(image, sector, &dadr) < 0) {
+        failed++;
+    }
+    imagebench_close(image);
+
+    zfile_memory_set_limit(0);
+    attach(name, &file_data, &file_size);
+    zfile_memory_set_limit(ZFILE_MEMORY_LIMIT_DEFAULT);
+
+    if (file_data == NULL || file_size != size
+        || memcmp(file_data + 358 * 256, sector, 256) != 0) {
+        printf("archive check:  the written sector did not make it into the .gz file\n");
+        failed++;
+    }
+    lib_free(file_data);
+
+    return failed;
+}
+
+/* Stored without compression, so any `size' bytes give the same length.  */
+static int write_stored(const char *to, const uint8_t *data, size_t size, time_t mtime)
+{
+    gzFile out;
+    struct utimbuf times;
+
+    out = gzopen(to, MODE_WRITE "0");
+    if (out == NULL) {
+        return -1;
+    }
+    if (gzwrite(out, data, (unsigned int)size) != (int)size) {
+        gzclose(out);
+        return -1;
+    }
+    if (gzclose(out) != Z_OK) {
+        return -1;
+    }
+    times.actime = mtime;
+    times.modtime = mtime;
+    return utime(to, &times);
+}
+
+/* Replace a .gz file that is in memory by another one of the same length,
+   the new contents have to show up.  */
+static int check_replaced(const char *name, const uint8_t *data, size_t size)
+{
+    char *replaced;
+    uint8_t *changed, *seen = NULL;
+    size_t seen_size = 0;
+    time_t now = time(NULL);
+    int failed = 0;
+
+    replaced = util_concat(name, "-replaced.d64.gz", NULL);
+    changed = lib_malloc(size);
+    memcpy(changed, data, size);
+    changed[0] ^= 0xff;
+
+    if (write_stored(replaced, data, size, now - 10) < 0
+        || attach(replaced, NULL, NULL) == 0
+        || write_stored(replaced, changed, size, now) < 0) {
+        printf("archive check:  cannot write `%s'\n", replaced);
+        failed++;
+    } else {
+        attach(replaced, &seen, &seen_size);
+        if (!same(changed, size, seen, seen_size)) {
+            printf("archive check:  a replaced file still reads the old contents\n");
+            failed++;
+        }
+    }
+
+    zfile_memory_remove(replaced);
+    remove(replaced);
+    lib_free(replaced);
+    lib_free(changed);
+    lib_free(seen);
+
+    return failed;
+}
+
+/* Three files that only fit two at a time, all of them stay.  */
+static int check_limit(const char *name, const uint8_t *data, size_t size)
+{
+    char *names[ARCHIVEBENCH_NAMES];
+    zfile_memory_stats_t before, after;
+    uint8_t *copy;
+    int i, failed = 0;
+    FILE *f;
+
+    zfile_memory_set_limit(size * 5 / 2);
+    zfile_memory_get_stats(&before);
+    for (i = 0; i < ARCHIVEBENCH_NAMES; i++) {
+        names[i] = lib_msprintf("%s-%d.d64", name, i);
+        copy = lib_malloc(size);
+        memcpy(copy, data, size);
+        if (zfile_memory_add(names[i], copy, size) < 0) {
+            lib_free(copy);
+            failed++;
+        }
+    }
+    zfile_memory_get_stats(&after);
+
+    if (!util_file_exists(names[0]) || !util_file_exists(names[1])
+        || !util_file_exists(names[2]) || after.evicted != before.evicted) {
+        printf("archive check:  a file handed over was let go\n");
+        failed++;
+    }
+    f = zfile_fopen(names[0], MODE_READ);
+    copy = lib_malloc(size);
+    if (f == NULL || fread(copy, 1, size, f) != size || memcmp(copy, data, size) != 0) {
+        printf("archive check:  a file handed over does not read back\n");
+        failed++;
+    }
+    if (f != NULL) {
+        zfile_fclose(f);
+    }
+    lib_free(copy);
+
+    for (i = 0; i < ARCHIVEBENCH_NAMES; i++) {
+        zfile_memory_remove(names[i]);
+        lib_free(names[i]);
+    }
+    zfile_memory_set_limit(ZFILE_MEMORY_LIMIT_DEFAULT);
+
+    return failed;
+}
+
+int archivebench_run(const char *filename, int passes)
+{
+    char *tmp, *name;
+    uint8_t *tmp_data = NULL, *cold_data = NULL, *cached_data = NULL;
+    size_t tmp_size = 0, cold_size = 0, cached_size = 0;
+    uint64_t tmp_ns, cold_ns, cached_ns;
+    zfile_memory_stats_t stats;
+    unsigned int len, isdir;
+    int failed = 0;
+
+    disk_image_init();
+
+    tmp = archdep_tmpnam();
+    name = util_concat(tmp, ".d64.gz", NULL);
+    remove(tmp);
+    lib_free(tmp);
+    if (make_gzip(filename, name) < 0 || ioutil_stat(name, &len, &isdir) < 0) {
+        fprintf(stderr, "vicebench: cannot gzip '%s'\n", filename);
+        lib_free(name);
+        return -1;
+    }
+
+    /* As before.  */
+    zfile_memory_set_limit(0);
+    attach(name, &tmp_data, &tmp_size);
+    tmp_ns = attach_passes(name, passes);
+    zfile_memory_set_limit(ZFILE_MEMORY_LIMIT_DEFAULT);
+
+    cold_ns = attach(name, &cold_data, &cold_size);
+    cached_ns = attach_passes(name, passes);
+    attach(name, &cached_data, &cached_size);
+
+    if (tmp_ns == 0 || cold_ns == 0 || cached_ns == 0) {
+        fprintf(stderr, "vicebench: '%s' is not a disk image\n", filename);
+        zfile_memory_remove(name);
+        remove(name);
+        lib_free(name);
+        lib_free(tmp_data);
+        lib_free(cold_data);
+        lib_free(cached_data);
+        return -1;
+    }
+    zfile_memory_get_stats(&stats);
+
+    if (!same(tmp_data, tmp_size, cold_data, cold_size)
+        || !same(tmp_data, tmp_size, cached_data, cached_size)) {
+        printf("archive check:  memory and temporary file give different images\n");
+        failed++;
+    }
+    if (stats.misses != 1) {
+        printf("archive check:  uncompressed %lu times instead of once\n", stats.misses);
+        failed++;
+    }
+    if (tmp_size == D64_FILE_SIZE_35 || tmp_size == D64_FILE_SIZE_35E) {
+        failed += check_write_back(name, tmp_data, tmp_size);
+    }
+    failed += check_replaced(name, tmp_data, tmp_size);
+    failed += check_limit(name, tmp_data, tmp_size);
+
+    printf("archive:        %s, %u bytes gzipped, %lu bytes, %d passes\n",
+           filename, len, (unsigned long)tmp_size, passes);
+    printf("archive attach: %8.3f ms through a temporary file\n", tmp_ns / 1e6);
+    printf("archive attach: %8.3f ms into memory\n", cold_ns / 1e6);
+    printf("archive attach: %8.3f ms again from memory\n", cached_ns / 1e6);
+    printf("archive memory: %lu opened from memory, %lu uncompressed\n",
+           stats.hits, stats.misses);
+    printf("archive check:  %s\n", failed ? "FAILED" : "ok");
+
+    zfile_memory_remove(name);
+    remove(name);
+    lib_free(name);
+    lib_free(tmp_data);
+    lib_free(cold_data);
+    lib_free(cached_data);
+
+    return failed ? 1 : 0;
+}
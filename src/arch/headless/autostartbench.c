@@ -0,0 +1,163 @@
+/*
+ * autostartbench.c - Check the autostart cache.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -autostartcheck autostarts an image four times in the measured frames:
+ * with nothing cached, so the machine resets and boots as before; from the
+ * booted machine the first run left in the autostart cache; then with
+ * AutostartLoadCache on, which keeps the machine with the program loaded;
+ * and from that machine.  Each run waits for the autostart to be done and
+ * AUTOSTARTBENCH_RUN_FRAMES more frames for the program, and the screen
+ * then has to be the same as after the first run.  The random autostart
+ * delay is turned off, it would only make the frame counts wander.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+#include "autostart.h"
+#include "autostart-cache.h"
+#include "autostartbench.h"
+#include "crc32.h"
+#include "mem.h"
+#include "profile.h"
+#include "resources.h"
+#include "types.h"
+
+#define AUTOSTARTBENCH_RUNS 4
+#define AUTOSTARTBENCH_RUN_FRAMES 150
+#define AUTOSTARTBENCH_TIMEOUT_FRAMES 3000
+#define AUTOSTARTBENCH_SCREEN_SIZE 1000
+
+static const char * const run_names[AUTOSTARTBENCH_RUNS] = {
+    "reset", "booted", "booted, keep", "loaded"
+};
+
+static const char *image_name = NULL;
+static int run = 0;
+static int started = 0;
+static int failed_run = -1;
+static int frames = 0;
+static int done_frames[AUTOSTARTBENCH_RUNS];
+static uint64_t start_ns;
+static uint64_t run_ns[AUTOSTARTBENCH_RUNS];
+static uint32_t screens[AUTOSTARTBENCH_RUNS];
+
+/* The text on the screen, without the cursor.  Keeping a machine in the
+   cache takes a frame, so the cursor does not always blink in step.  */
+static uint32_t screen_crc(void)
+{
+    char text[AUTOSTARTBENCH_SCREEN_SIZE];
+    int i;
+
+    for (i = 0; i < AUTOSTARTBENCH_SCREEN_SIZE; i++) {
+        text[i] = (char)(mem_ram[0x0400 + i] & 0x7f);
+    }
+    return crc32_buf(text, AUTOSTARTBENCH_SCREEN_SIZE);
+}
+
+void autostartbench_frame(const char *filename)
+{
+    if (run >= AUTOSTARTBENCH_RUNS || failed_run >= 0) {
+        return;
+    }
+
+    if (!started) {
+        if (run == 0) {
+            image_name = filename;
+            resources_set_int("AutostartDelayRandom", 0);
+            resources_set_int("AutostartBootCache", 1);
+            resources_set_int("AutostartLoadCache", 0);
+        } else if (run == 2) {
+            resources_set_int("AutostartLoadCache", 1);
+        }
+        start_ns = profile_now_ns();
+        if (autostart_autodetect(filename, NULL, 0, AUTOSTART_MODE_RUN) < 0) {
+            printf("autostart:      cannot autostart '%s'\n", filename);
+            failed_run = run;
+            return;
+        }
+        started = 1;
+        frames = 0;
+        done_frames[run] = -1;
+        return;
+    }
+
+    frames++;
+    if (done_frames[run] < 0) {
+        if (!autostart_in_progress()) {
+            done_frames[run] = frames;
+            run_ns[run] = profile_now_ns() - start_ns;
+        } else if (frames > AUTOSTARTBENCH_TIMEOUT_FRAMES) {
+            printf("autostart:      run %d did not get done\n", run + 1);
+            failed_run = run;
+        }
+        return;
+    }
+
+    if (frames - done_frames[run] == AUTOSTARTBENCH_RUN_FRAMES) {
+        screens[run] = screen_crc();
+        run++;
+        started = 0;
+    }
+}
+
+unsigned long autostartbench_report(void)
+{
+    autostart_cache_stats_t s;
+    unsigned long failed = 0;
+    int i;
+
+    if (failed_run >= 0 || run < AUTOSTARTBENCH_RUNS) {
+        printf("autostart:      got through %d of %d runs\n", run, AUTOSTARTBENCH_RUNS);
+        failed++;
+    } else {
+        printf("autostart:      %s\n", image_name);
+        for (i = 0; i < AUTOSTARTBENCH_RUNS; i++) {
+            printf("autostart run:  %-12s %5d frames %8.3f ms, screen %s\n",
+                   run_names[i], done_frames[i], run_ns[i] / 1e6,
+                   screens[i] == screens[0] ? "same" : "DIFFERS");
+            if (screens[i] != screens[0]) {
+                failed++;
+            }
+        }
+        autostart_cache_get_stats(&s);
+        printf("autostart kept: %lu booted and %lu loaded kept, %lu and %lu restored, %.1f KiB\n",
+               s.stores[AUTOSTART_CACHE_BOOT], s.stores[AUTOSTART_CACHE_LOAD],
+               s.hits[AUTOSTART_CACHE_BOOT], s.hits[AUTOSTART_CACHE_LOAD],
+               s.bytes / 1024.0);
+        if (s.stores[AUTOSTART_CACHE_BOOT] != 1
+            || s.hits[AUTOSTART_CACHE_BOOT] + s.hits[AUTOSTART_CACHE_LOAD] != AUTOSTARTBENCH_RUNS - 1) {
+            printf("autostart check: the booted machine was not kept and restored\n");
+            failed++;
+        }
+        if (s.hits[AUTOSTART_CACHE_LOAD] + s.stores[AUTOSTART_CACHE_LOAD] == 1) {
+            printf("autostart check: the loaded machine was kept but not restored\n");
+            failed++;
+        }
+    }
+    printf("autostart check: %s\n", failed ? "FAILED" : "ok");
+
+    return failed;
+}
@@ -0,0 +1,59 @@
+/*
+ * console.c - Console access interface.
+ *
+ * Written by
+ *  Andreas Boose <viceteam@t-online.de>
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+#include "console.h"
+
+int console_init(void)
+{
+    return 0;
+}
+
+console_t *console_open(const char *id)
+{
+    return 0;
+}
+
+int console_close(console_t *log)
+{
+    return 0;
+}
+
+int console_out(console_t *log, const char *format, ...)
+{
+    return 0;
+}
+
+char *console_in(console_t *log, const char *prompt)
+{
+    return 0;
+}
+
+int console_close_all(void)
+{
+    return 0;
+}
+
@@ -0,0 +1,248 @@
+/*
+ * drawbench.c - Check and count the whole-line fast path of the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -drawstats prints what vicii_draw_get_stats() collected for each video
+ * mode during the measured frames: how many lines the raster cache found
+ * unchanged, how many whole lines were drawn and how many of those were
+ * copied from the frame before, and how long the drawing took.
+ *
+ * -drawcheck turns the raster cache off, points the screen at $0400 and
+ * the characters or bitmap at $2000, fills them with random bytes and
+ * then changes a few of them every frame.  Every DRAWBENCH_SCENE_FRAMES
+ * frames it switches to another video mode.  The draw_line functions of
+ * the raster modes are wrapped: each line is drawn in full first, then
+ * the line and the foreground mask are put back the way they were and
+ * the line is drawn again with the fast path.  Both have to come out the
+ * same.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "drawbench.h"
+#include "interrupt.h"
+#include "lib.h"
+#include "mem.h"
+#include "profile.h"
+#include "raster-line.h"
+#include "raster-modes.h"
+#include "raster.h"
+#include "resources.h"
+#include "types.h"
+#include "vicii-draw.h"
+#include "viciitypes.h"
+#include "viewport.h"
+
+#define DRAWBENCH_SCENE_FRAMES 20
+#define DRAWBENCH_CHANGES 3
+
+static int fed = 0;
+static unsigned int frames = 0;
+static uint32_t seed = 1;
+static raster_modes_draw_line_function_t draw_line[VICII_NUM_VMODES];
+static uint8_t *line_before = NULL, *line_full = NULL;
+static uint8_t msk_before[RASTER_GFX_MSK_SIZE], msk_full[RASTER_GFX_MSK_SIZE];
+static unsigned int line_size = 0;
+static unsigned long scenes = 0;
+static unsigned long lines = 0;
+static unsigned long reused = 0;
+static unsigned long mismatches = 0;
+static uint64_t full_ns = 0, fast_ns = 0;
+
+static uint8_t next_random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (uint8_t)(seed >> 16);
+}
+
+void drawbench_stats_start(void)
+{
+    vicii_draw_stats_reset();
+    vicii_draw_stats_timing(1);
+}
+
+void drawbench_stats_report(void)
+{
+    vicii_draw_stats_t s;
+    unsigned int mode;
+    const char *name;
+
+    printf("\n%-16s %8s %7s %8s %7s %8s %10s\n",
+           "vicii mode", "lines", "copied", "cached", "same", "redrawn", "ms");
+    for (mode = 0; mode < VICII_NUM_VMODES; mode++) {
+        name = vicii_draw_mode_name(mode);
+        vicii_draw_get_stats(mode, &s);
+        if (name == NULL || (s.lines == 0 && s.cache_lines == 0)) {
+            continue;
+        }
+        printf("%-16s %8lu %6.1f%% %8lu %6.1f%% %8lu %10.3f\n",
+               name, s.lines, s.lines ? 100.0 * s.lines_reused / s.lines : 0.0,
+               s.cache_lines, s.cache_lines ? 100.0 * s.cache_hits / s.cache_lines : 0.0,
+               s.cache_draws, s.ns / 1e6);
+    }
+}
+
+/* A few screen, colour and character or bitmap bytes, and now and then
+   a new mode and background colour.  */
+static void drawbench_scene(uint16_t addr, void *data)
+{
+    unsigned int i, mode;
+    uint16_t a;
+
+    if (frames++ % DRAWBENCH_SCENE_FRAMES == 0) {
+        mode = next_random() & 7;
+        mem_store(0xd011, (uint8_t)(0x1b | ((mode & 4) << 4) | ((mode & 2) << 4)));
+        mem_store(0xd016, (uint8_t)(0xc8 | ((mode & 1) << 4)));
+        for (i = 0xd021; i <= 0xd024; i++) {
+            mem_store((uint16_t)i, next_random() & 0x0f);
+        }
+        scenes++;
+    }
+    for (i = 0; i < DRAWBENCH_CHANGES; i++) {
+        a = (uint16_t)(next_random() | (next_random() << 8));
+        switch (i % 3) {
+            case 0:
+                mem_store((uint16_t)(0x0400 + a % 1000), next_random());
+                break;
+            case 1:
+                mem_store((uint16_t)(0xd800 + a % 1000), next_random() & 0x0f);
+                break;
+            default:
+                mem_store((uint16_t)(0x2000 + (a & 0x1fff)), next_random());
+                break;
+        }
+    }
+}
+
+/* Put everything on the screen, in the characters and the bitmap.  */
+static void drawbench_fill(uint16_t addr, void *data)
+{
+    unsigned int i;
+
+    mem_store(0xd018, 0x18);
+    for (i = 0; i < 1000; i++) {
+        mem_store((uint16_t)(0x0400 + i), next_random());
+        mem_store((uint16_t)(0xd800 + i), next_random() & 0x0f);
+    }
+    for (i = 0x2000; i < 0x4000; i++) {
+        mem_store((uint16_t)i, next_random());
+    }
+}
+
+static void drawbench_draw_line(void)
+{
+    unsigned int mode = raster_line_get_real_mode(&vicii.raster);
+    unsigned int len = vicii.raster.geometry->screen_size.width;
+    uint8_t *line = vicii.raster.draw_buffer_ptr;
+    vicii_draw_stats_t before, after;
+    uint64_t start;
+
+    if (len > line_size) {
+        line_size = len;
+        line_before = lib_realloc(line_before, len);
+        line_full = lib_realloc(line_full, len);
+    }
+    memcpy(line_before, line, len);
+    memcpy(msk_before, vicii.raster.gfx_msk, RASTER_GFX_MSK_SIZE);
+
+    vicii_draw_set_line_reuse(0);
+    start = profile_now_ns();
+    draw_line[mode]();
+    full_ns += profile_now_ns() - start;
+    memcpy(line_full, line, len);
+    memcpy(msk_full, vicii.raster.gfx_msk, RASTER_GFX_MSK_SIZE);
+
+    memcpy(line, line_before, len);
+    memcpy(vicii.raster.gfx_msk, msk_before, RASTER_GFX_MSK_SIZE);
+    vicii_draw_set_line_reuse(1);
+    vicii_draw_get_stats(mode, &before);
+    start = profile_now_ns();
+    draw_line[mode]();
+    fast_ns += profile_now_ns() - start;
+    vicii_draw_get_stats(mode, &after);
+
+    lines++;
+    reused += after.lines_reused - before.lines_reused;
+    if (memcmp(line, line_full, len) != 0
+        || memcmp(vicii.raster.gfx_msk, msk_full, RASTER_GFX_MSK_SIZE) != 0) {
+        if (mismatches++ == 0) {
+            printf("draw check:     line %u, %s, scene %lu differs\n",
+                   vicii.raster.current_line, vicii_draw_mode_name(mode), scenes);
+        }
+    }
+}
+
+void drawbench_frame(void)
+{
+    raster_modes_t *modes = vicii.raster.modes;
+    unsigned int mode;
+
+    if (!fed) {
+        resources_set_int("VICIIVideoCache", 0);
+        for (mode = 0; mode < VICII_NUM_VMODES && mode < modes->num_modes; mode++) {
+            draw_line[mode] = modes->modes[mode].draw_line;
+            if (draw_line[mode] != NULL) {
+                modes->modes[mode].draw_line = drawbench_draw_line;
+            }
+        }
+        interrupt_maincpu_trigger_trap(drawbench_fill, NULL);
+        fed = 1;
+    }
+    interrupt_maincpu_trigger_trap(drawbench_scene, NULL);
+}
+
+unsigned long drawbench_report(void)
+{
+    raster_modes_t *modes = vicii.raster.modes;
+    unsigned long failed = mismatches;
+    unsigned int mode;
+
+    if (fed) {
+        for (mode = 0; mode < VICII_NUM_VMODES && mode < modes->num_modes; mode++) {
+            if (draw_line[mode] != NULL) {
+                modes->modes[mode].draw_line = draw_line[mode];
+            }
+        }
+    }
+    vicii_draw_set_line_reuse(1);
+
+    if (lines == 0) {
+        printf("draw check:     no whole line got drawn\n");
+        failed++;
+    } else {
+        printf("draw:           %lu scenes, %lu lines, %lu copied (%.1f%%)\n",
+               scenes, lines, reused, 100.0 * reused / lines);
+        printf("draw lines:     %8.3f ms drawn in full, %8.3f ms with the fast path, %.2fx\n",
+               full_ns / 1e6, fast_ns / 1e6, fast_ns ? (double)full_ns / fast_ns : 0.0);
+        printf("draw check:     %lu lines, %lu differed\n", lines, mismatches);
+    }
+    printf("draw check:     %s\n", failed ? "FAILED" : "ok");
+
+    lib_free(line_before);
+    lib_free(line_full);
+
+    return failed;
+}
@@ -0,0 +1,40 @@
+/*
+ * drawbench.h - Check and count the whole-line fast path of the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_DRAWBENCH_H
+#define VICE_DRAWBENCH_H
+
+/* Clear the draw statistics and time the drawing from now on.  */
+extern void drawbench_stats_start(void);
+
+/* Print the draw statistics of each video mode.  */
+extern void drawbench_stats_report(void);
+
+/* Change the screen a little every frame and the video mode now and
+   then.  Every whole line is drawn in full and with the fast path.  */
+extern void drawbench_frame(void);
+
+/* Print the times, returns the number of lines that did not match.  */
+extern unsigned long drawbench_report(void);
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * gcrbench.c - Time the GCR codec on a whole disk image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -gcrbench does what attaching a .d64 to a true emulation drive does
+ * with it, without starting the emulator: every sector is converted to
+ * GCR into the track layout of fsimage-dxx.c.  Then it reads every
+ * sector back with gcr_read_sector(), which has to find the header and
+ * data SYNC marks and decode the block, like the vdrive code does on an
+ * attached image.  Both are timed over all passes and given in MB of
+ * sector data per second.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cbmdos.h"
+#include "diskconstants.h"
+#include "diskimage.h"
+#include "gcr.h"
+#include "gcrbench.h"
+#include "lib.h"
+#include "profile.h"
+#include "types.h"
+
+#define GCRBENCH_TRACKS 35
+#define GCRBENCH_SECTORS 683
+
+/* the BAM, T:18 S:0 */
+#define GCRBENCH_BAM (357 * 256)
+
+static double mb_per_s(uint64_t bytes, uint64_t ns)
+{
+    return ns ? bytes * 1000.0 / ns : 0.0;
+}
+
+int gcrbench_run(const char *filename, int passes)
+{
+    uint8_t *image, *tracks[GCRBENCH_TRACKS], *ptr;
+    disk_track_t raw[GCRBENCH_TRACKS];
+    uint8_t sector_data[256];
+    unsigned int track, sector, max_sector;
+    uint64_t encode_ns = 0, decode_ns = 0, start_ns;
+    gcr_header_t header;
+    int pass, failed = 0, offset;
+    fdc_err_t rf;
+    FILE *f;
+
+    f = fopen(filename, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "vicebench: cannot open '%s'\n", filename);
+        return -1;
+    }
+    image = lib_malloc(GCRBENCH_SECTORS * 256);
+    if (fread(image, 256, GCRBENCH_SECTORS, f) != GCRBENCH_SECTORS) {
+        fprintf(stderr, "vicebench: '%s' is not a 35 track .d64 image\n", filename);
+        fclose(f);
+        lib_free(image);
+        return -1;
+    }
+    fclose(f);
+
+    for (track = 1; track <= GCRBENCH_TRACKS; track++) {
+        raw[track - 1].size = disk_image_raw_track_size(DISK_IMAGE_TYPE_D64, track);
+        tracks[track - 1] = lib_malloc(raw[track - 1].size);
+        raw[track - 1].data = tracks[track - 1];
+    }
+
+    header.id1 = image[GCRBENCH_BAM + BAM_ID_1541];
+    header.id2 = image[GCRBENCH_BAM + BAM_ID_1541 + 1];
+
+    for (pass = 0; pass < passes; pass++) {
+        start_ns = profile_now_ns();
+        offset = 0;
+        for (track = 1; track <= GCRBENCH_TRACKS; track++) {
+            ptr = tracks[track - 1];
+            memset(ptr, 0x55, raw[track - 1].size);
+            max_sector = disk_image_sector_per_track(DISK_IMAGE_TYPE_D64, track);
+            header.track = track;
+            for (sector = 0; sector < max_sector; sector++, offset += 256) {
+                header.sector = sector;
+                gcr_convert_sector_to_GCR(image + offset, ptr, &header, 9, 5, CBMDOS_FDC_ERR_OK);
+                ptr += SECTOR_GCR_SIZE_WITH_HEADER + 9
+                       + disk_image_gap_size(DISK_IMAGE_TYPE_D64, track) + 5;
+            }
+        }
+        encode_ns += profile_now_ns() - start_ns;
+
+        start_ns = profile_now_ns();
+        offset = 0;
+        for (track = 1; track <= GCRBENCH_TRACKS; track++) {
+            max_sector = disk_image_sector_per_track(DISK_IMAGE_TYPE_D64, track);
+            for (sector = 0; sector < max_sector; sector++, offset += 256) {
+                rf = gcr_read_sector(&raw[track - 1], sector_data, (uint8_t)sector);
+                if (rf != CBMDOS_FDC_ERR_OK || memcmp(sector_data, image + offset, 256)) {
+                    if (failed++ == 0) {
+                        fprintf(stderr, "vicebench: T:%u S:%u did not decode (%d)\n",
+                                track, sector, (int)rf);
+                    }
+                }
+            }
+        }
+        decode_ns += profile_now_ns() - start_ns;
+    }
+
+    printf("GCR image:      %s, %d passes\n", filename, passes);
+    printf("GCR encode:     %8.1f ms %8.1f MB/s\n", encode_ns / 1e6,
+           mb_per_s((uint64_t)passes * GCRBENCH_SECTORS * 256, encode_ns));
+    printf("GCR decode:     %8.1f ms %8.1f MB/s\n", decode_ns / 1e6,
+           mb_per_s((uint64_t)passes * GCRBENCH_SECTORS * 256, decode_ns));
+    if (failed) {
+        printf("GCR sectors:    %d failed to decode\n", failed);
+    }
+
+    for (track = 0; track < GCRBENCH_TRACKS; track++) {
+        lib_free(tracks[track]);
+    }
+    lib_free(image);
+
+    return failed ? 1 : 0;
+}
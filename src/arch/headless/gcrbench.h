@@ -0,0 +1,32 @@
+/*
+ * gcrbench.h - Time the GCR codec on a whole disk image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_GCRBENCH_H
+#define VICE_GCRBENCH_H
+
+/* Encode the 35 tracks of a .d64 file to GCR and decode them again
+   <passes> times, print the throughput and return -1 on error, 1 if a
+   sector did not come back as it was.  */
+extern int gcrbench_run(const char *filename, int passes);
+
+#endif
@@ -0,0 +1,286 @@
+/*
+ * imagebench.c - Measure sector access on an attached disk image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -imagebench opens a copy of a disk image the way the virtual drive
+ * does and reads every sector <n> times, from the copy fsimage keeps in
+ * memory and, for comparison, with a seek and a read of the file for
+ * each one as before.  Then it writes every sector, flushes, closes the
+ * image and opens it again to check that all of them made it into the
+ * file.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "archdep.h"
+#include "diskconstants.h"
+#include "diskimage.h"
+#include "fsimage.h"
+#include "imagebench.h"
+#include "lib.h"
+#include "p64.h"
+#include "profile.h"
+#include "types.h"
+
+typedef struct imagebench_sector_s {
+    unsigned int track;
+    unsigned int sector;
+} imagebench_sector_t;
+
+static double mb_per_s(uint64_t bytes, uint64_t ns)
+{
+    return ns ? bytes * 1000.0 / ns : 0.0;
+}
+
+static int copy_file(const char *from, const char *to)
+{
+    FILE *in, *out;
+    uint8_t buf[0x4000];
+    size_t len;
+    int retval = 0;
+
+    in = fopen(from, MODE_READ);
+    if (in == NULL) {
+        return -1;
+    }
+    out = fopen(to, MODE_WRITE);
+    if (out == NULL) {
+        fclose(in);
+        return -1;
+    }
+    while ((len = fread(buf, 1, sizeof(buf), in)) > 0) {
+        if (fwrite(buf, 1, len, out) != len) {
+            retval = -1;
+            break;
+        }
+    }
+    fclose(in);
+    if (fclose(out) == EOF) {
+        retval = -1;
+    }
+    return retval;
+}
+
+disk_image_t *imagebench_open(const char *name)
+{
+    disk_image_t *image = lib_calloc(1, sizeof(disk_image_t));
+
+    image->p64 = lib_calloc(1, sizeof(TP64Image));
+    P64ImageCreate((void *)image->p64);
+    image->device = DISK_IMAGE_DEVICE_FS;
+    disk_image_media_create(image);
+    disk_image_name_set(image, name);
+    if (disk_image_open(image) < 0) {
+        disk_image_media_destroy(image);
+        P64ImageDestroy((void *)image->p64);
+        lib_free(image->p64);
+        lib_free(image);
+        return NULL;
+    }
+    if (image->type == DISK_IMAGE_TYPE_P64) {
+        disk_image_read_image(image);
+    }
+    return image;
+}
+
+void imagebench_close(disk_image_t *image)
+{
+    if (image->type == DISK_IMAGE_TYPE_P64) {
+        disk_image_write_p64_image(image);
+    }
+    disk_image_close(image);
+    disk_image_media_destroy(image);
+    P64ImageDestroy((void *)image->p64);
+    lib_free(image->p64);
+    lib_free(image);
+}
+
+/* Formatted GCR images usually come with empty tracks past the last one
+   DOS knows about.  */
+static unsigned int image_tracks(const disk_image_t *image)
+{
+    switch (image->type) {
+        case DISK_IMAGE_TYPE_G64:
+        case DISK_IMAGE_TYPE_P64:
+            return image->tracks < NUM_TRACKS_1541 ? image->tracks : NUM_TRACKS_1541;
+        case DISK_IMAGE_TYPE_G71:
+            return image->tracks < NUM_TRACKS_1571 ? image->tracks : NUM_TRACKS_1571;
+        default:
+            return image->tracks;
+    }
+}
+
+static unsigned int image_sectors(const disk_image_t *image, imagebench_sector_t **list)
+{
+    unsigned int track, sector, n = 0, max_sector;
+
+    *list = lib_malloc((image->tracks + 1) * 256 * sizeof(imagebench_sector_t));
+    for (track = 1; track <= image_tracks(image); track++) {
+        switch (image->type) {
+            case DISK_IMAGE_TYPE_G64:
+            case DISK_IMAGE_TYPE_G71:
+            case DISK_IMAGE_TYPE_P64:
+                max_sector = disk_image_sector_per_track(image->type, track);
+                break;
+            default:
+                for (max_sector = 0; max_sector < 256; max_sector++) {
+                    if (disk_image_check_sector(image, track, max_sector) < 0) {
+                        break;
+                    }
+                }
+        }
+        for (sector = 0; sector < max_sector; sector++, n++) {
+            (*list)[n].track = track;
+            (*list)[n].sector = sector;
+        }
+    }
+    return n;
+}
+
+static uint64_t read_all(disk_image_t *image, const imagebench_sector_t *list,
+                         unsigned int n, uint8_t *data)
+{
+    disk_addr_t dadr;
+    uint64_t start = profile_now_ns();
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+        dadr.track = list[i].track;
+        dadr.sector = list[i].sector;
+        disk_image_read_sector(image, data + i * 256, &dadr);
+    }
+    return profile_now_ns() - start;
+}
+
+int imagebench_run(const char *filename, int passes)
+{
+    disk_image_t *image;
+    fsimage_t *fsimage;
+    imagebench_sector_t *list;
+    disk_addr_t dadr;
+    uint8_t *data, *written, *buffer;
+    uint64_t start, open_ns, memory_ns = 0, stdio_ns = 0, write_ns, flush_ns, close_ns;
+    unsigned int n, i, dirty_blocks;
+    long size;
+    int pass, failed = 0;
+    char *name;
+
+    disk_image_init();
+
+    name = archdep_tmpnam();
+    if (copy_file(filename, name) < 0) {
+        fprintf(stderr, "vicebench: cannot copy '%s'\n", filename);
+        lib_free(name);
+        return -1;
+    }
+
+    start = profile_now_ns();
+    image = imagebench_open(name);
+    open_ns = profile_now_ns() - start;
+    if (image == NULL) {
+        fprintf(stderr, "vicebench: '%s' is not a disk image\n", filename);
+        remove(name);
+        lib_free(name);
+        return -1;
+    }
+    fsimage = image->media.fsimage;
+    size = fsimage_length(image);
+
+    n = image_sectors(image, &list);
+    data = lib_malloc(n * 256);
+    written = lib_malloc(n * 256);
+
+    for (pass = 0; pass < passes; pass++) {
+        memory_ns += read_all(image, list, n, data);
+
+        /* Without the copy in memory fsimage seeks and reads.  */
+        buffer = fsimage->buffer.data;
+        fsimage->buffer.data = NULL;
+        stdio_ns += read_all(image, list, n, written);
+        fsimage->buffer.data = buffer;
+    }
+    if (memcmp(data, written, n * 256) != 0) {
+        printf("image check:    memory and file reads differ\n");
+        failed++;
+    }
+
+    for (i = 0; i < n * 256; i++) {
+        written[i] = data[i] ^ (uint8_t)(i / 256 * 7 + i);
+    }
+    start = profile_now_ns();
+    for (i = 0; i < n; i++) {
+        dadr.track = list[i].track;
+        dadr.sector = list[i].sector;
+        if (disk_image_write_sector(image, written + i * 256, &dadr) < 0) {
+            failed++;
+        }
+    }
+    write_ns = profile_now_ns() - start;
+    dirty_blocks = fsimage->buffer.dirty_blocks;
+    start = profile_now_ns();
+    if (disk_image_flush(image) < 0) {
+        failed++;
+    }
+    flush_ns = profile_now_ns() - start;
+    start = profile_now_ns();
+    imagebench_close(image);
+    close_ns = profile_now_ns() - start;
+
+    image = imagebench_open(name);
+    if (image == NULL) {
+        printf("image check:    cannot open the image again\n");
+        failed++;
+    } else {
+        read_all(image, list, n, data);
+        for (i = 0; i < n; i++) {
+            if (memcmp(data + i * 256, written + i * 256, 256) != 0) {
+                if (failed++ == 0) {
+                    printf("image check:    T:%u S:%u did not make it into the file\n",
+                           list[i].track, list[i].sector);
+                }
+            }
+        }
+        imagebench_close(image);
+    }
+
+    printf("image:          %s, %u sectors, %ld bytes, %d passes\n", filename, n, size, passes);
+    printf("image open:     %8.3f ms\n", open_ns / 1e6);
+    printf("image read:     %8.3f ms %8.1f MB/s from memory\n", memory_ns / 1e6,
+           mb_per_s((uint64_t)passes * n * 256, memory_ns));
+    printf("image read:     %8.3f ms %8.1f MB/s seeking and reading the file\n", stdio_ns / 1e6,
+           mb_per_s((uint64_t)passes * n * 256, stdio_ns));
+    printf("image write:    %8.3f ms, %u blocks dirty, %.3f ms flush, %.3f ms close\n",
+           write_ns / 1e6, dirty_blocks, flush_ns / 1e6, close_ns / 1e6);
+    printf("image check:    %s\n", failed ? "FAILED" : "ok");
+
+    remove(name);
+    lib_free(name);
+    lib_free(list);
+    lib_free(data);
+    lib_free(written);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,38 @@
+/*
+ * imagebench.h - Measure sector access on an attached disk image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_IMAGEBENCH_H
+#define VICE_IMAGEBENCH_H
+
+struct disk_image_s;
+
+/* Read every sector of a copy of a disk image <passes> times, write them
+   all and check the file.  Returns -1 on error, 1 if a sector did not
+   make it into the file.  */
+extern int imagebench_run(const char *filename, int passes);
+
+/* Open and close a disk image the way the virtual drive does.  */
+extern struct disk_image_s *imagebench_open(const char *name);
+extern void imagebench_close(struct disk_image_s *image);
+
+#endif
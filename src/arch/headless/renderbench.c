@@ -0,0 +1,237 @@
+/*
+ * renderbench.c - Check the SIMD renderers against the scalar ones.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * The headless canvas is 8 bit, so the 16 and 32 bit PAL and CRT
+ * renderers never run on their own.  With -rendercheck every measured
+ * frame is pushed through each of them, once with the scalar stores and
+ * once for every instruction set render_simd_set() accepts, and the
+ * outputs are compared byte for byte.  The target offset and the width
+ * change from frame to frame so the odd first and last pixels and the
+ * scalar tails of the vector loops get their share.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lib.h"
+#include "profile.h"
+#include "render-simd.h"
+#include "render1x1crt.h"
+#include "render2x2crt.h"
+#include "render2x2pal.h"
+#include "renderbench.h"
+#include "types.h"
+#include "video.h"
+#include "videoarch.h"
+#include "viewport.h"
+
+#define RENDERBENCH_LEVELS (RENDER_SIMD_NEON + 1)
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+typedef void (*render_2x2_func_t)(video_render_color_tables_t *colortab,
+                                  const uint8_t *src, uint8_t *trg,
+                                  unsigned int width, const unsigned int height,
+                                  const unsigned int xs, const unsigned int ys,
+                                  const unsigned int xt, const unsigned int yt,
+                                  const unsigned int pitchs, const unsigned int pitcht,
+                                  viewport_t *viewport, video_render_config_t *config);
+
+typedef void (*render_1x1_func_t)(video_render_color_tables_t *colortab,
+                                  const uint8_t *src, uint8_t *trg,
+                                  const unsigned int width, const unsigned int height,
+                                  const unsigned int xs, const unsigned int ys,
+                                  const unsigned int xt, const unsigned int yt,
+                                  const unsigned int pitchs, const unsigned int pitcht);
+
+typedef struct renderbench_case_s {
+    const char *name;
+    render_2x2_func_t func_2x2;
+    render_1x1_func_t func_1x1;
+    unsigned int depth;
+    uint64_t ns[RENDERBENCH_LEVELS];
+    unsigned long mismatches[RENDERBENCH_LEVELS];
+} renderbench_case_t;
+
+static renderbench_case_t cases[] = {
+    { "pal 2x2 16bpp", render_16_2x2_pal, NULL, 16 },
+    { "pal 2x2 32bpp", render_32_2x2_pal, NULL, 32 },
+    { "crt 2x2 16bpp", render_16_2x2_crt, NULL, 16 },
+    { "crt 2x2 32bpp", render_32_2x2_crt, NULL, 32 },
+    { "crt 1x1 16bpp", NULL, render_16_1x1_crt, 16 },
+    { "crt 1x1 32bpp", NULL, render_32_1x1_crt, 32 },
+};
+
+#define RENDERBENCH_NUM_CASES (sizeof(cases) / sizeof(cases[0]))
+
+static unsigned long checked_frames = 0;
+static int levels_checked[RENDERBENCH_LEVELS];
+
+static uint8_t *ref_buffer = NULL;
+static uint8_t *test_buffer = NULL;
+static size_t buffer_size = 0;
+
+/* Load the gamma tables for a 16 bit 565 or a 32 bit ARGB target, the
+   way an arch with such a canvas would.  */
+static void set_depth(video_canvas_t *canvas, unsigned int depth)
+{
+    unsigned int i;
+
+    for (i = 0; i < 256; i++) {
+        if (depth == 16) {
+            video_render_setrawrgb(i, (i >> 3) << 11, (i >> 2) << 5, i >> 3);
+        } else {
+            video_render_setrawrgb(i, i << 16, i << 8, i);
+        }
+    }
+    video_render_setrawalpha(depth == 32 ? 0xff000000 : 0);
+    video_color_update_palette(canvas);
+}
+
+static void render_case(video_canvas_t *canvas, renderbench_case_t *c, uint8_t *trg,
+                        unsigned int w, unsigned int h,
+                        unsigned int xs, unsigned int ys,
+                        unsigned int xt, unsigned int yt, unsigned int pitcht)
+{
+    const uint8_t *src = canvas->draw_buffer->draw_buffer;
+    unsigned int pitchs = canvas->draw_buffer->draw_buffer_width;
+
+    if (c->func_2x2 != NULL) {
+        c->func_2x2(&canvas->videoconfig->color_tables, src, trg, w, h,
+                    xs, ys, xt, yt, pitchs, pitcht,
+                    canvas->viewport, canvas->videoconfig);
+    } else {
+        c->func_1x1(&canvas->videoconfig->color_tables, src, trg, w, h,
+                    xs, ys, xt, yt, pitchs, pitcht);
+    }
+}
+
+void renderbench_frame(void)
+{
+    video_canvas_t *canvas = video_headless_get_canvas();
+    viewport_t *viewport;
+    geometry_t *geometry;
+    unsigned int xs, ys, xt, yt, w, h, scale, width, height, pitcht;
+    int saved_level, level;
+    size_t i, size;
+    uint64_t start_ns;
+
+    if (canvas == NULL || canvas->draw_buffer == NULL || canvas->draw_buffer->draw_buffer == NULL) {
+        return;
+    }
+
+    viewport = canvas->viewport;
+    geometry = canvas->geometry;
+
+    /* the area video_canvas_refresh_all() would hand to the arch */
+    xs = viewport->first_x + geometry->extra_offscreen_border_left;
+    ys = viewport->first_line;
+    w = MIN(canvas->draw_buffer->canvas_width, geometry->screen_size.width - viewport->first_x);
+    h = MIN(canvas->draw_buffer->canvas_height, viewport->last_line - viewport->first_line + 1);
+    if (w * 2 + 2 > VIDEO_MAX_OUTPUT_WIDTH || w < 8 || h == 0) {
+        return;
+    }
+
+    xt = checked_frames & 1;
+    yt = (checked_frames >> 1) & 1;
+
+    size = (size_t)(w * 2 + 2) * 4 * (h * 2 + 2);
+    if (size > buffer_size) {
+        lib_free(ref_buffer);
+        lib_free(test_buffer);
+        ref_buffer = lib_malloc(size);
+        test_buffer = lib_malloc(size);
+        buffer_size = size;
+    }
+
+    saved_level = render_simd_get();
+
+    for (i = 0; i < RENDERBENCH_NUM_CASES; i++) {
+        renderbench_case_t *c = &cases[i];
+
+        if (i == 0 || c->depth != cases[i - 1].depth) {
+            set_depth(canvas, c->depth);
+        }
+
+        scale = c->func_2x2 != NULL ? 2 : 1;
+        width = w * scale - (unsigned int)(checked_frames % 7);
+        height = h * scale;
+        pitcht = (w * scale + 2) * (c->depth / 8);
+
+        for (level = RENDER_SIMD_NONE; level < RENDERBENCH_LEVELS; level++) {
+            uint8_t *trg = level == RENDER_SIMD_NONE ? ref_buffer : test_buffer;
+
+            if (render_simd_set(level) < 0) {
+                continue;
+            }
+            levels_checked[level] = 1;
+
+            memset(trg, 0x5a, size);
+            start_ns = profile_now_ns();
+            render_case(canvas, c, trg, width, height, xs, ys, xt, yt, pitcht);
+            c->ns[level] += profile_now_ns() - start_ns;
+
+            if (level != RENDER_SIMD_NONE && memcmp(ref_buffer, test_buffer, size) != 0) {
+                c->mismatches[level]++;
+            }
+        }
+    }
+
+    render_simd_set(saved_level);
+    checked_frames++;
+}
+
+unsigned long renderbench_report(void)
+{
+    unsigned long total = 0;
+    size_t i;
+    int level;
+
+    if (checked_frames == 0) {
+        return 0;
+    }
+
+    printf("\nrender check:   %lu frames\n", checked_frames);
+    printf("%-14s %-6s %10s %10s\n", "renderer", "simd", "ms", "mismatches");
+    for (i = 0; i < RENDERBENCH_NUM_CASES; i++) {
+        for (level = RENDER_SIMD_NONE; level < RENDERBENCH_LEVELS; level++) {
+            if (!levels_checked[level]) {
+                continue;
+            }
+            printf("%-14s %-6s %10.1f %10lu\n", cases[i].name,
+                   render_simd_name(level), cases[i].ns[level] / 1e6,
+                   cases[i].mismatches[level]);
+            total += cases[i].mismatches[level];
+        }
+    }
+
+    lib_free(ref_buffer);
+    lib_free(test_buffer);
+    ref_buffer = test_buffer = NULL;
+    buffer_size = 0;
+
+    return total;
+}
@@ -0,0 +1,34 @@
+/*
+ * renderbench.h - Check the SIMD renderers against the scalar ones.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_RENDERBENCH_H
+#define VICE_RENDERBENCH_H
+
+/* Render the current frame with every renderer and instruction set.  */
+extern void renderbench_frame(void);
+
+/* Print the timings, returns the number of frames that differed from
+   the scalar output.  */
+extern unsigned long renderbench_report(void);
+
+#endif
@@ -0,0 +1,336 @@
+/*
+ * residbench.cc - Check the reSID fast paths against the plain ones.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * reSID can compute its resampling convolutions with SSE2 or NEON and
+ * clock the chip a block of cycles at a time (SidResidFastAccurate).
+ * Both are meant to give exactly the samples of the plain code.  With
+ * -residcheck vicebench does not start the emulator but feeds the same
+ * register writes to one SID clocked the plain way and one for each fast
+ * path, for both chip models and both resampling methods, and compares
+ * the samples.
+ *
+ * The writes come from a made up play routine that rewrites all
+ * registers once per PAL frame.  Most voices get one of the plain
+ * waveforms; now and then sync, ring modulation, the test bit, noise or
+ * a combined waveform shows up, which send the block clocking back to
+ * the cycle by cycle code for a while.
+ *
+ * clock_silent(), used when the samples would be thrown away, has to
+ * leave the chip in the state clock() does, filters aside, so the CPU
+ * reads the same OSC3 and ENV3.  That is checked after every frame.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+extern "C" {
+#include "lib.h"
+#include "profile.h"
+#include "residbench.h"
+#include "types.h"
+}
+
+#include "resid/sid.h"
+
+using namespace reSID;
+
+#define RESIDBENCH_CLOCK        985248.0
+#define RESIDBENCH_SAMPLE_RATE  44100.0
+#define RESIDBENCH_FRAME_CYCLES (63 * 312)
+#define RESIDBENCH_FRAME_WRITES 26
+#define RESIDBENCH_BUFFER       4096
+
+enum {
+    MODE_PLAIN = 0,
+    MODE_SIMD,
+    MODE_BLOCK,
+    MODE_BOTH,
+    NUM_MODES
+};
+
+static const char *mode_names[NUM_MODES] = {
+    "plain", "simd fir", "block", "simd+block"
+};
+
+static uint32_t random_state;
+
+static unsigned int random_next(void)
+{
+    random_state = random_state * 1103515245 + 12345;
+    return random_state >> 16;
+}
+
+static reg8 random_control(void)
+{
+    static const reg8 waveforms[8] = {
+        0x10, 0x20, 0x40, 0x80, 0x10, 0x20, 0x40, 0x30
+    };
+    unsigned int r = random_next();
+    reg8 control = waveforms[r & 7] | ((r >> 3) & 1);
+
+    if ((r & 0x0300) == 0x0100) {
+        control |= 0x02;        /* sync */
+    } else if ((r & 0x0300) == 0x0200) {
+        control |= 0x04;        /* ring modulation */
+    }
+    if ((r & 0x7c00) == 0x0400) {
+        control |= 0x08;        /* test */
+    } else if ((r & 0x7c00) == 0x0800) {
+        control |= 0x40;        /* combined with pulse */
+    } else if ((r & 0x7c00) == 0x0c00) {
+        control &= 0x0f;        /* no waveform */
+    }
+
+    return control;
+}
+
+/* One frame of writes: the play routine stores all registers from $18
+   down to $00, then the volume is changed once more somewhere later.  */
+static int make_frame(SID::RegWrite *writes)
+{
+    cycle_count t = random_next() % 200;
+    int n = 0;
+    int reg;
+
+    for (reg = 0x18; reg >= 0; reg--) {
+        reg8 value;
+
+        switch (reg) {
+            case 0x04:
+            case 0x0b:
+            case 0x12:
+                value = random_control();
+                break;
+            case 0x18:
+                value = 0x0f | (random_next() & 0xf0);
+                break;
+            default:
+                value = random_next() & 0xff;
+                break;
+        }
+        t += 8 + random_next() % 8;
+        writes[n].delta_t = t;
+        writes[n].offset = reg;
+        writes[n].value = value;
+        n++;
+    }
+
+    writes[n].delta_t = t + random_next() % (RESIDBENCH_FRAME_CYCLES - t);
+    writes[n].offset = 0x18;
+    writes[n].value = 0x0f | (random_next() & 0x70);
+    n++;
+
+    return n;
+}
+
+/* NULL if the build has no SIMD convolutions for the mode.  */
+static SID *new_sid(chip_model model, sampling_method method, int mode)
+{
+    SID *sid = new SID();
+
+    sid->set_chip_model(model);
+    sid->set_sampling_parameters(RESIDBENCH_CLOCK, method, RESIDBENCH_SAMPLE_RATE,
+                                 RESIDBENCH_SAMPLE_RATE * 0.45);
+    if (!sid->enable_fir_simd(mode == MODE_SIMD || mode == MODE_BOTH)) {
+        delete sid;
+        return NULL;
+    }
+    sid->enable_fast_accurate(mode == MODE_BLOCK || mode == MODE_BOTH);
+    sid->reset();
+
+    return sid;
+}
+
+/* Render <frames> frames with <sid>, returns the time it took.  The
+   samples go to <out>, which has room for all of them.  */
+static uint64_t render(SID *sid, int frames, short *out, int *num_samples)
+{
+    SID::RegWrite writes[RESIDBENCH_FRAME_WRITES];
+    uint64_t ns = 0;
+    int n = 0;
+    int i;
+
+    random_state = 1;
+
+    for (i = 0; i < frames; i++) {
+        int num_writes = make_frame(writes);
+        cycle_count delta_t = RESIDBENCH_FRAME_CYCLES;
+        uint64_t start_ns = profile_now_ns();
+
+        n += sid->clock(delta_t, writes, num_writes, out + n, RESIDBENCH_BUFFER);
+        ns += profile_now_ns() - start_ns;
+    }
+
+    *num_samples = n;
+    return ns;
+}
+
+/* What clock_silent() has to get right: everything but the filters.  */
+static int same_state(SID *a, SID *b)
+{
+    SID::State sa = a->read_state();
+    SID::State sb = b->read_state();
+    int i;
+
+    if (a->read(0x1b) != b->read(0x1b) || a->read(0x1c) != b->read(0x1c)
+        || sa.bus_value != sb.bus_value || sa.bus_value_ttl != sb.bus_value_ttl
+        || sa.write_pipeline != sb.write_pipeline) {
+        return 0;
+    }
+    for (i = 0; i < 3; i++) {
+        if (sa.accumulator[i] != sb.accumulator[i]
+            || sa.shift_register[i] != sb.shift_register[i]
+            || sa.shift_register_reset[i] != sb.shift_register_reset[i]
+            || sa.shift_pipeline[i] != sb.shift_pipeline[i]
+            || sa.pulse_output[i] != sb.pulse_output[i]
+            || sa.floating_output_ttl[i] != sb.floating_output_ttl[i]
+            || sa.rate_counter[i] != sb.rate_counter[i]
+            || sa.exponential_counter[i] != sb.exponential_counter[i]
+            || sa.envelope_counter[i] != sb.envelope_counter[i]
+            || sa.envelope_state[i] != sb.envelope_state[i]
+            || sa.hold_zero[i] != sb.hold_zero[i]
+            || sa.envelope_pipeline[i] != sb.envelope_pipeline[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Clock one SID with samples and one silently through the same writes.
+   Returns the number of frames after which they differed.  */
+static int check_silent(chip_model model, int frames, short *out,
+                        uint64_t *sampled_ns, uint64_t *silent_ns)
+{
+    SID::RegWrite writes[RESIDBENCH_FRAME_WRITES];
+    SID *sampled = new_sid(model, SAMPLE_RESAMPLE, MODE_PLAIN);
+    SID *silent = new_sid(model, SAMPLE_RESAMPLE, MODE_PLAIN);
+    int differed = 0;
+    int i;
+
+    random_state = 1;
+    *sampled_ns = *silent_ns = 0;
+
+    for (i = 0; i < frames; i++) {
+        int num_writes = make_frame(writes);
+        cycle_count delta_t = RESIDBENCH_FRAME_CYCLES;
+        uint64_t start_ns = profile_now_ns();
+
+        sampled->clock(delta_t, writes, num_writes, out, RESIDBENCH_BUFFER);
+        *sampled_ns += profile_now_ns() - start_ns;
+
+        start_ns = profile_now_ns();
+        silent->clock_silent(RESIDBENCH_FRAME_CYCLES, writes, num_writes);
+        *silent_ns += profile_now_ns() - start_ns;
+
+        if (!same_state(sampled, silent)) {
+            differed++;
+        }
+    }
+
+    delete sampled;
+    delete silent;
+
+    return differed;
+}
+
+extern "C" int residbench_run(int seconds)
+{
+    static const chip_model models[] = { MOS6581, MOS8580 };
+    static const char *model_names[] = { "6581", "8580" };
+    static const sampling_method methods[] = { SAMPLE_RESAMPLE, SAMPLE_RESAMPLE_FASTMEM };
+    static const char *method_names[] = { "resample", "fastmem" };
+    int frames = (int)(seconds * RESIDBENCH_CLOCK / RESIDBENCH_FRAME_CYCLES) + 1;
+    size_t size = (size_t)frames * RESIDBENCH_BUFFER;
+    short *ref = (short *)lib_malloc(size * sizeof(short));
+    short *test = (short *)lib_malloc(size * sizeof(short));
+    int failed = 0;
+    int m, s, mode;
+
+    printf("reSID check:    %d s per case\n", seconds);
+    printf("%-5s %-9s %-11s %10s %10s %10s\n",
+           "model", "method", "mode", "ms", "samples", "max diff");
+
+    for (m = 0; m < 2; m++) {
+        for (s = 0; s < 2; s++) {
+            int ref_samples = 0;
+
+            for (mode = MODE_PLAIN; mode < NUM_MODES; mode++) {
+                SID *sid = new_sid(models[m], methods[s], mode);
+                short *out = mode == MODE_PLAIN ? ref : test;
+                int num_samples;
+                int max_diff = 0;
+                uint64_t ns;
+                int i;
+
+                if (sid == NULL) {
+                    continue;
+                }
+
+                ns = render(sid, frames, out, &num_samples);
+                delete sid;
+
+                if (mode == MODE_PLAIN) {
+                    ref_samples = num_samples;
+                } else {
+                    if (num_samples != ref_samples) {
+                        max_diff = 0xffff;
+                    }
+                    for (i = 0; i < num_samples && i < ref_samples; i++) {
+                        int diff = test[i] - ref[i];
+
+                        if (diff < 0) {
+                            diff = -diff;
+                        }
+                        if (diff > max_diff) {
+                            max_diff = diff;
+                        }
+                    }
+                    if (max_diff > 0) {
+                        failed++;
+                    }
+                }
+
+                printf("%-5s %-9s %-11s %10.1f %10d %10d\n",
+                       model_names[m], method_names[s], mode_names[mode],
+                       ns / 1e6, num_samples, max_diff);
+            }
+        }
+    }
+
+    printf("\n%-5s %-21s %10s %10s\n", "model", "silent clocking", "ms", "differed");
+    for (m = 0; m < 2; m++) {
+        uint64_t sampled_ns, silent_ns;
+        int differed = check_silent(models[m], frames, ref, &sampled_ns, &silent_ns);
+
+        printf("%-5s %-21s %10.1f\n", model_names[m], "resample", sampled_ns / 1e6);
+        printf("%-5s %-21s %10.1f %10d\n", model_names[m], "clock_silent", silent_ns / 1e6, differed);
+        failed += differed;
+    }
+
+    lib_free(ref);
+    lib_free(test);
+
+    return failed;
+}
@@ -0,0 +1,32 @@
+/*
+ * residbench.h - Check the reSID fast paths against the plain ones.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_RESIDBENCH_H
+#define VICE_RESIDBENCH_H
+
+/* Render <seconds> of generated SID music per chip model, resampling
+   method and fast path, print the timings and return the number of cases
+   whose samples differed from the plain reSID code.  */
+extern int residbench_run(int seconds);
+
+#endif
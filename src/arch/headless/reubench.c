@@ -0,0 +1,153 @@
+/*
+ * reubench.c - Check the bulk DMA path of the REU.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -reucheck turns the REU on and starts REUBENCH_DMAS transfers every
+ * frame, writing the REC registers like a program would: copies both
+ * ways, swaps and verifies of random lengths, with fixed addresses now
+ * and then, between $0400 and $CFFF and anywhere in the REU.  A verify
+ * mostly follows a copy of the same bytes with one of them changed, so
+ * it finds equal runs and a difference.
+ *
+ * reu.c is told to move each span it would move in one go one byte at a
+ * time first, then to put everything back and move it in one go.  Both
+ * have to leave the same RAM, REU, addresses and clock behind.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+#include "interrupt.h"
+#include "mem.h"
+#include "resources.h"
+#include "reu.h"
+#include "reubench.h"
+#include "types.h"
+
+#define REUBENCH_DMAS 8
+#define REUBENCH_MAX_LEN 0x1000
+
+#define REUBENCH_HOST_START 0x0400
+#define REUBENCH_HOST_END 0xd000
+
+static int started = 0;
+static uint32_t seed = 1;
+static unsigned long dmas = 0;
+static unsigned long verifies = 0;
+static unsigned long verify_errors = 0;
+
+static unsigned int next_random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7fff;
+}
+
+static void reubench_dma(uint16_t host_addr, unsigned int reu_addr, unsigned int len,
+                         uint8_t type, uint8_t fixed)
+{
+    mem_store(0xdf02, host_addr & 0xff);
+    mem_store(0xdf03, host_addr >> 8);
+    mem_store(0xdf04, reu_addr & 0xff);
+    mem_store(0xdf05, (reu_addr >> 8) & 0xff);
+    mem_store(0xdf06, (reu_addr >> 16) & 0xff);
+    mem_store(0xdf07, len & 0xff);
+    mem_store(0xdf08, (len >> 8) & 0xff);
+    mem_store(0xdf09, 0x00);
+    mem_store(0xdf0a, fixed);
+    /* execute right away, no autoload */
+    mem_store(0xdf01, 0x90 | type);
+    dmas++;
+}
+
+static void reubench_run(uint16_t addr, void *data)
+{
+    unsigned int i, len, reu_addr;
+    uint16_t host_addr;
+    uint8_t type, fixed;
+
+    for (i = 0; i < REUBENCH_DMAS; i++) {
+        len = 1 + next_random() % REUBENCH_MAX_LEN;
+        host_addr = (uint16_t)(REUBENCH_HOST_START
+                               + next_random() % (REUBENCH_HOST_END - REUBENCH_HOST_START - len));
+        reu_addr = ((next_random() << 4) ^ next_random()) & 0x7ffff;
+        type = next_random() & 3;
+        fixed = (next_random() % 8 == 0) ? (next_random() & 0xc0) : 0;
+
+        if (type == 3 && fixed == 0) {
+            reubench_dma(host_addr, reu_addr, len, 0, 0);
+            if (next_random() & 1) {
+                mem_store((uint16_t)(host_addr + next_random() % len), (uint8_t)next_random());
+            }
+        }
+        reubench_dma(host_addr, reu_addr, len, type, fixed);
+        if (type == 3) {
+            verifies++;
+            if (mem_read(0xdf00) & 0x20) {
+                verify_errors++;
+            }
+        }
+    }
+}
+
+void reubench_frame(void)
+{
+    if (!started) {
+        if (resources_set_int("REU", 1) < 0) {
+            printf("reu check:      cannot enable the REU\n");
+        }
+        reu_dma_set_check(1);
+        reu_dma_stats_reset();
+        started = 1;
+    }
+    interrupt_maincpu_trigger_trap(reubench_run, NULL);
+}
+
+unsigned long reubench_report(void)
+{
+    reu_dma_stats_t s;
+    unsigned long failed;
+    uint64_t bytes;
+
+    reu_dma_get_stats(&s);
+    reu_dma_set_check(0);
+    failed = s.mismatches;
+    bytes = (uint64_t)s.fast_bytes + s.slow_bytes;
+
+    if (s.checked == 0) {
+        printf("reu check:      no span got moved in one go\n");
+        failed++;
+    } else {
+        printf("reu:            %lu transfers, %lu verifies (%lu failed)\n",
+               dmas, verifies, verify_errors);
+        printf("reu bytes:      %lu in one go (%.1f%%), %lu one at a time\n",
+               s.fast_bytes, 100.0 * s.fast_bytes / bytes, s.slow_bytes);
+        printf("reu spans:      %8.3f ms one byte at a time, %8.3f ms in one go, %.2fx\n",
+               s.slow_ns / 1e6, s.fast_ns / 1e6,
+               s.fast_ns ? (double)s.slow_ns / s.fast_ns : 0.0);
+        printf("reu check:      %lu spans, %lu differed\n", s.checked, s.mismatches);
+    }
+    printf("reu check:      %s\n", failed ? "FAILED" : "ok");
+
+    return failed;
+}
@@ -0,0 +1,35 @@
+/*
+ * reubench.h - Check the bulk DMA path of the REU.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_REUBENCH_H
+#define VICE_REUBENCH_H
+
+/* Run a few REU transfers every frame, each span that goes in one go
+   also one byte at a time.  */
+extern void reubench_frame(void);
+
+/* Print the counts and times, returns the number of spans that did not
+   match.  */
+extern unsigned long reubench_report(void);
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * rewindbench.c - Step back during the measured frames and check the replay.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * With -rewindcheck vicebench switches rewind on for the measured
+ * frames and moves joystick 2 around like a player would, so there is
+ * input to record.  Every REWINDBENCH_PERIOD frames it steps back, by a different
+ * number of frames each time.
+ *
+ * A checksum of RAM and the CPU clock is kept for every emulated frame.
+ * While the replay runs towards the target, the frames it passes through
+ * have to come out with the checksums they had the first time.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "crc32.h"
+#include "joystick.h"
+#include "lib.h"
+#include "maincpu.h"
+#include "mem.h"
+#include "resources.h"
+#include "rewind.h"
+#include "rewindbench.h"
+#include "types.h"
+
+#define REWINDBENCH_PERIOD 150
+
+static uint32_t *checksums = NULL;
+static unsigned long num_checksums = 0;
+static unsigned long calls = 0;
+static unsigned long checked = 0;
+static unsigned long mismatches = 0;
+
+static uint32_t checksum(void)
+{
+    return crc32_buf((const char *)mem_ram, 0x10000) ^ maincpu_clk;
+}
+
+void rewindbench_frame(void)
+{
+    rewind_stats_t stats;
+    uint32_t sum;
+
+    if (calls++ == 0) {
+        resources_set_int("Rewind", 1);
+        return;
+    }
+
+    rewind_get_stats(&stats);
+    sum = checksum();
+
+    if (stats.frame >= num_checksums) {
+        num_checksums = stats.frame + 1024;
+        checksums = lib_realloc(checksums, num_checksums * sizeof(uint32_t));
+    }
+
+    if (rewind_replay_active()) {
+        checked++;
+        if (checksums[stats.frame] != sum) {
+            mismatches++;
+        }
+    } else {
+        checksums[stats.frame] = sum;
+    }
+
+    /* Ignored during the replay.  */
+    joystick_set_value_absolute(2, (uint8_t)((calls / 7) * 5 % 31));
+
+    if (calls % REWINDBENCH_PERIOD == 0) {
+        rewind_step_back((unsigned int)((calls / REWINDBENCH_PERIOD) * 37 % 120 + 1));
+    }
+}
+
+unsigned long rewindbench_report(void)
+{
+    rewind_stats_t stats;
+    int interval;
+
+    rewind_get_stats(&stats);
+    resources_get_int("RewindInterval", &interval);
+
+    printf("rewind:         keyframe every %d frames, %u kept for %lu frames, %lu bytes\n",
+           interval, stats.keyframes, stats.frames, stats.memory);
+    printf("keyframes:      %lu taken, %lu dropped, %.3f ms avg\n",
+           stats.keyframes_taken, stats.keyframes_dropped, stats.keyframe_avg_ms);
+    printf("rewinds:        %lu, %lu frames replayed\n", stats.rewinds, stats.replayed_frames);
+    printf("rewind latency: %.3f ms avg, %.3f ms max\n",
+           stats.latency_avg_ms, stats.latency_max_ms);
+    printf("replay check:   %lu frames, %lu differed\n", checked, mismatches);
+
+    lib_free(checksums);
+    checksums = NULL;
+
+    return mismatches;
+}
@@ -0,0 +1,34 @@
+/*
+ * rewindbench.h - Step back during the measured frames and check the replay.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_REWINDBENCH_H
+#define VICE_REWINDBENCH_H
+
+/* Record, move the joystick and step back now and then.  */
+extern void rewindbench_frame(void);
+
+/* Print the rewind statistics, returns the number of replayed frames
+   that did not match.  */
+extern unsigned long rewindbench_report(void);
+
+#endif
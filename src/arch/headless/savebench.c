@@ -0,0 +1,420 @@
+/*
+ * savebench.c - Measure how long saving a snapshot stops the emulation.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * With -savestates every SAVEBENCH_PERIOD measured frames a snapshot is
+ * saved twice from a CPU trap: once the old way, straight into a file,
+ * and once into memory together with a PNG thumbnail module and handed to
+ * the snapshot writer, which compresses and writes it in the background.
+ * Only what the emulation waits for is counted as the stall.
+ *
+ * The first one goes to a file of its own and is checked at the end: it
+ * has to inflate to the bytes that were handed over and its thumbnail
+ * has to come back through snapshot_open().  Then a save that cannot be
+ * written over it has to be reported and leave it as it was.  The last
+ * one is loaded.
+ */
+
+#include "vice.h"
+
+#include <png.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "archdep.h"
+#include "interrupt.h"
+#include "ioutil.h"
+#include "lib.h"
+#include "machine.h"
+#include "palette.h"
+#include "profile.h"
+#include "savebench.h"
+#include "snapshot.h"
+#include "snapshot-writer.h"
+#include "types.h"
+#include "util.h"
+#include "video.h"
+#include "videoarch.h"
+
+#define SAVEBENCH_PERIOD 50
+
+#define SAVEBENCH_THUMB_MODULE "THUMBNAIL"
+
+typedef struct savebench_time_s {
+    uint64_t total_ns;
+    uint64_t max_ns;
+} savebench_time_t;
+
+typedef struct png_buffer_s {
+    uint8_t *data;
+    size_t len;
+    size_t size;
+} png_buffer_t;
+
+static unsigned long calls = 0;
+static unsigned long saves = 0;
+static unsigned long mismatches = 0;
+static savebench_time_t file_time, memory_time, thumb_time;
+static uint64_t file_bytes = 0;
+static char *file_name = NULL;
+static char *gz_name = NULL;
+static char *check_name = NULL;
+
+/* The first snapshot as it was handed over, and its thumbnail.  */
+static uint8_t *check_bytes = NULL;
+static size_t check_size = 0;
+static png_buffer_t check_thumb;
+
+static void time_add(savebench_time_t *t, uint64_t ns)
+{
+    t->total_ns += ns;
+    if (ns > t->max_ns) {
+        t->max_ns = ns;
+    }
+}
+
+static void png_buffer_write(png_structp png, png_bytep data, png_size_t len)
+{
+    png_buffer_t *buf = png_get_io_ptr(png);
+
+    if (buf->len + len > buf->size) {
+        while (buf->len + len > buf->size) {
+            buf->size = buf->size ? buf->size * 2 : 0x4000;
+        }
+        buf->data = lib_realloc(buf->data, buf->size);
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+}
+
+static void png_buffer_flush(png_structp png)
+{
+}
+
+/* A half size RGB thumbnail of the last frame, as a PNG in memory, like
+   the Vita save slots keep with each snapshot.  */
+static int thumbnail_encode(png_buffer_t *out)
+{
+    video_canvas_t *canvas = video_headless_get_canvas();
+    draw_buffer_t *db;
+    png_structp png;
+    png_infop info;
+    uint8_t *row = NULL;
+    unsigned int width, height, x, y;
+
+    memset(out, 0, sizeof(png_buffer_t));
+    if (canvas == NULL || canvas->draw_buffer == NULL || canvas->palette == NULL) {
+        return -1;
+    }
+    db = canvas->draw_buffer;
+    width = db->canvas_width / 2;
+    height = db->canvas_height / 2;
+
+    png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png == NULL) {
+        return -1;
+    }
+    info = png_create_info_struct(png);
+    if (info == NULL || setjmp(png_jmpbuf(png))) {
+        png_destroy_write_struct(&png, &info);
+        lib_free(row);
+        lib_free(out->data);
+        return -1;
+    }
+
+    png_set_write_fn(png, out, png_buffer_write, png_buffer_flush);
+    png_set_IHDR(png, info, width, height, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_set_compression_level(png, 1);
+    png_set_filter(png, 0, PNG_FILTER_NONE);
+    png_write_info(png, info);
+
+    row = lib_malloc(width * 3);
+    for (y = 0; y < height; y++) {
+        const uint8_t *src = db->draw_buffer + y * 2 * db->draw_buffer_width;
+
+        for (x = 0; x < width; x++) {
+            const palette_entry_t *c = &canvas->palette->entries[src[x * 2] % canvas->palette->num_entries];
+
+            row[x * 3] = c->red;
+            row[x * 3 + 1] = c->green;
+            row[x * 3 + 2] = c->blue;
+        }
+        png_write_row(png, row);
+    }
+    png_write_end(png, NULL);
+    png_destroy_write_struct(&png, &info);
+    lib_free(row);
+
+    return 0;
+}
+
+static int thumbnail_append(snapshot_memory_t *mem, const png_buffer_t *thumb)
+{
+    snapshot_t *s = snapshot_memory_append_modules(mem);
+    snapshot_module_t *m;
+    int retval = -1;
+
+    m = snapshot_module_create(s, SAVEBENCH_THUMB_MODULE, 1, 0);
+    if (m != NULL) {
+        if (SMW_DW(m, (uint32_t)thumb->len) >= 0
+            && SMW_BA(m, thumb->data, (unsigned int)thumb->len) >= 0) {
+            retval = 0;
+        }
+        if (snapshot_module_close(m) < 0) {
+            retval = -1;
+        }
+    }
+    snapshot_close(s);
+
+    return retval;
+}
+
+static void savebench_trap(uint16_t addr, void *data)
+{
+    snapshot_memory_t *mem;
+    png_buffer_t thumb;
+    uint64_t start, thumb_ns;
+    FILE *f;
+
+    /* The old way.  */
+    start = profile_now_ns();
+    if (machine_write_snapshot(file_name, 0, 0, 0) < 0) {
+        mismatches++;
+        return;
+    }
+    time_add(&file_time, profile_now_ns() - start);
+    f = fopen(file_name, MODE_READ);
+    if (f != NULL) {
+        fseek(f, 0, SEEK_END);
+        file_bytes = (uint64_t)ftell(f);
+        fclose(f);
+    }
+
+    /* Into memory, the writer does the rest.  */
+    start = profile_now_ns();
+    mem = snapshot_memory_new();
+    if (machine_write_snapshot_memory(mem, NULL) < 0) {
+        snapshot_memory_destroy(mem);
+        mismatches++;
+        return;
+    }
+    thumb_ns = profile_now_ns();
+    if (thumbnail_encode(&thumb) < 0 || thumbnail_append(mem, &thumb) < 0) {
+        printf("save check:     cannot add the thumbnail\n");
+        mismatches++;
+    }
+    thumb_ns = profile_now_ns() - thumb_ns;
+
+    /* Not part of saving.  */
+    if (saves == 0) {
+        uint64_t copy_start = profile_now_ns();
+
+        check_size = snapshot_memory_size(mem);
+        check_bytes = lib_malloc(check_size);
+        snapshot_memory_flatten(mem, check_bytes);
+        check_thumb = thumb;
+        thumb.data = NULL;
+        start += profile_now_ns() - copy_start;
+    }
+    if (snapshot_writer_save(mem, saves == 0 ? check_name : gz_name, 1) < 0) {
+        mismatches++;
+    }
+    time_add(&memory_time, profile_now_ns() - start);
+    time_add(&thumb_time, thumb_ns);
+    lib_free(thumb.data);
+    saves++;
+}
+
+void savebench_frame(void)
+{
+    if (calls++ == 0) {
+        file_name = archdep_tmpnam();
+        gz_name = archdep_tmpnam();
+        check_name = archdep_tmpnam();
+        return;
+    }
+    if (calls % SAVEBENCH_PERIOD == 0) {
+        interrupt_maincpu_trigger_trap(savebench_trap, NULL);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void check_compressed(void)
+{
+    gzFile gz;
+    uint8_t *buf = lib_malloc(check_size + 1);
+    int len = -1;
+    snapshot_t *s;
+    snapshot_module_t *m;
+    uint8_t major, minor;
+    uint32_t thumb_len = 0;
+    uint8_t *thumb = NULL;
+
+    gz = gzopen(check_name, "rb");
+    if (gz != NULL) {
+        len = gzread(gz, buf, (unsigned int)check_size + 1);
+        gzclose(gz);
+    }
+    if (len < 0 || (size_t)len != check_size || memcmp(buf, check_bytes, check_size) != 0) {
+        printf("save check:     the compressed file does not inflate to the snapshot\n");
+        mismatches++;
+    }
+    lib_free(buf);
+
+    s = snapshot_open(check_name, &major, &minor, machine_get_name());
+    if (s == NULL) {
+        printf("save check:     snapshot_open() does not take the compressed file\n");
+        mismatches++;
+        return;
+    }
+    m = snapshot_module_open(s, SAVEBENCH_THUMB_MODULE, &major, &minor);
+    if (m != NULL && SMR_DW(m, &thumb_len) >= 0) {
+        thumb = lib_malloc(thumb_len + 1);
+        if (SMR_BA(m, thumb, thumb_len) < 0) {
+            thumb_len = 0;
+        }
+    }
+    if (m != NULL) {
+        snapshot_module_close(m);
+    }
+    snapshot_close(s);
+
+    if (thumb == NULL || thumb_len != check_thumb.len
+        || memcmp(thumb, check_thumb.data, thumb_len) != 0) {
+        printf("save check:     the thumbnail does not come back\n");
+        mismatches++;
+    }
+    lib_free(thumb);
+}
+
+static uint8_t *read_file(const char *name, size_t *size)
+{
+    FILE *f;
+    uint8_t *buf;
+
+    f = fopen(name, MODE_READ);
+    if (f == NULL) {
+        return NULL;
+    }
+    *size = util_file_length(f);
+    buf = lib_malloc(*size + 1);
+    if (fread(buf, 1, *size, f) != *size) {
+        lib_free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+/* Block `<file>.tmp' with a directory, so the writer cannot create it.  */
+static void check_failed_save(void)
+{
+    char *tmp_name = util_concat(check_name, ".tmp", NULL);
+    snapshot_memory_t *mem = snapshot_memory_new();
+    uint8_t *before, *after = NULL;
+    size_t before_size = 0, after_size = 0;
+    int result = -1;
+
+    before = read_file(check_name, &before_size);
+    if (ioutil_mkdir(tmp_name, IOUTIL_MKDIR_RWXU) == 0) {
+        if (thumbnail_append(mem, &check_thumb) == 0) {
+            /* the writer owns it from here on */
+            result = snapshot_writer_save(mem, check_name, 1);
+            mem = NULL;
+            if (result == 0) {
+                result = snapshot_writer_wait_last();
+            }
+        }
+        ioutil_rmdir(tmp_name);
+    }
+    snapshot_memory_destroy(mem);
+    /* take the expected failure off the count */
+    snapshot_writer_wait();
+    after = read_file(check_name, &after_size);
+
+    if (result == 0) {
+        printf("save check:     a save that could not be written was not reported\n");
+        mismatches++;
+    }
+    if (before == NULL || after == NULL || before_size != after_size
+        || memcmp(before, after, before_size) != 0) {
+        printf("save check:     a failed save damaged the file it was to replace\n");
+        mismatches++;
+    }
+    lib_free(before);
+    lib_free(after);
+    lib_free(tmp_name);
+}
+
+unsigned long savebench_report(void)
+{
+    snapshot_writer_stats_t stats;
+
+    if (snapshot_writer_wait() > 0) {
+        mismatches++;
+    }
+    snapshot_writer_get_stats(&stats);
+
+    printf("savestates:     %lu, %lu bytes as a file\n", saves, (unsigned long)file_bytes);
+    if (saves > 0) {
+        printf("save stall:     %.3f ms avg, %.3f ms max to a file\n",
+               file_time.total_ns / 1e6 / saves, file_time.max_ns / 1e6);
+        printf("save stall:     %.3f ms avg, %.3f ms max to memory (%.3f ms of it thumbnail)\n",
+               memory_time.total_ns / 1e6 / saves, memory_time.max_ns / 1e6,
+               thumb_time.total_ns / 1e6 / saves);
+    }
+    if (stats.saved > 0) {
+        printf("save writer:    %.3f ms avg, %lu bytes compressed to %lu (%.0f%%)\n",
+               stats.writer_ns / 1e6 / (stats.saved + stats.failed),
+               (unsigned long)(stats.bytes / stats.saved),
+               (unsigned long)(stats.file_bytes / stats.saved),
+               100.0 * stats.file_bytes / stats.bytes);
+    }
+
+    if (saves > 0) {
+        check_compressed();
+        check_failed_save();
+        if (machine_read_snapshot(saves > 1 ? gz_name : check_name, 0) < 0) {
+            printf("save check:     cannot load the compressed file\n");
+            mismatches++;
+        }
+    }
+    printf("save check:     %s\n", mismatches ? "FAILED" : "ok");
+
+    if (file_name != NULL) {
+        remove(file_name);
+        remove(gz_name);
+        remove(check_name);
+    }
+    lib_free(check_bytes);
+    lib_free(check_thumb.data);
+    lib_free(file_name);
+    lib_free(gz_name);
+    lib_free(check_name);
+
+    return mismatches + stats.failed;
+}
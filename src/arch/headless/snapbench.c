@@ -0,0 +1,192 @@
+/*
+ * snapbench.c - Measure memory snapshots taken every frame.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * With -snapshots every measured frame ends with a memory snapshot,
+ * taken from a CPU trap like the UI does it, on top of the one of the
+ * frame before.  Only the newest two are kept.
+ *
+ * The first one is checked: it has to be byte for byte the file
+ * snapshot taken right after it, and restoring it has to leave the
+ * machine the way restoring that file does.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "archdep.h"
+#include "interrupt.h"
+#include "lib.h"
+#include "machine.h"
+#include "profile.h"
+#include "snapbench.h"
+#include "snapshot.h"
+#include "types.h"
+#include "util.h"
+
+static snapshot_memory_t *newest = NULL;
+static unsigned long taken = 0;
+static unsigned long failed = 0;
+static unsigned long mismatches = 0;
+static uint64_t total_ns = 0;
+static uint64_t max_ns = 0;
+static uint64_t total_new_bytes = 0;
+
+static uint8_t *flatten(const snapshot_memory_t *mem)
+{
+    uint8_t *buf = lib_malloc(snapshot_memory_size(mem));
+
+    snapshot_memory_flatten(mem, buf);
+    return buf;
+}
+
+static uint8_t *load(const char *name, size_t *size)
+{
+    FILE *f = fopen(name, "rb");
+    uint8_t *buf;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    *size = util_file_length(f);
+    buf = lib_malloc(*size + 1);
+    if (fread(buf, 1, *size, f) != *size) {
+        lib_free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+static int same(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size)
+{
+    return a != NULL && b != NULL && a_size == b_size && memcmp(a, b, a_size) == 0;
+}
+
+/* Not everything comes back exactly as it was written (reSID keeps some
+   of what it had before), so restoring is compared with doing the same
+   through a file.  */
+static void check(const snapshot_memory_t *mem)
+{
+    snapshot_memory_t *again;
+    char *name = archdep_tmpnam();
+    uint8_t *bytes, *file_bytes = NULL, *again_bytes = NULL, *file_again_bytes = NULL;
+    size_t size = snapshot_memory_size(mem), file_size = 0, file_again_size = 0;
+
+    bytes = flatten(mem);
+
+    if (machine_write_snapshot(name, 0, 0, 0) == 0) {
+        file_bytes = load(name, &file_size);
+    }
+    if (!same(bytes, size, file_bytes, file_size)) {
+        printf("snapshot check: memory and file snapshot differ\n");
+        mismatches++;
+    }
+
+    /* Going through both once first lets that settle.  */
+    again = snapshot_memory_new();
+    if (machine_read_snapshot_memory((snapshot_memory_t *)mem) < 0
+        || machine_write_snapshot_memory(again, NULL) < 0
+        || machine_read_snapshot(name, 0) < 0
+        || machine_write_snapshot(name, 0, 0, 0) < 0
+        || machine_read_snapshot_memory((snapshot_memory_t *)mem) < 0
+        || machine_write_snapshot_memory(again, NULL) < 0) {
+        printf("snapshot check: cannot restore the memory snapshot\n");
+        mismatches++;
+    } else {
+        again_bytes = flatten(again);
+        file_again_bytes = load(name, &file_again_size);
+        if (!same(again_bytes, snapshot_memory_size(again), file_again_bytes, file_again_size)) {
+            printf("snapshot check: restoring from memory and from a file differ\n");
+            mismatches++;
+        }
+    }
+
+    remove(name);
+    snapshot_memory_destroy(again);
+    lib_free(file_again_bytes);
+    lib_free(again_bytes);
+    lib_free(file_bytes);
+    lib_free(bytes);
+    lib_free(name);
+}
+
+static void snapbench_trap(uint16_t addr, void *data)
+{
+    snapshot_memory_t *mem = snapshot_memory_new();
+    size_t in_use = snapshot_memory_in_use();
+    uint64_t start = profile_now_ns();
+    uint64_t ns;
+
+    if (machine_write_snapshot_memory(mem, newest) < 0) {
+        snapshot_memory_destroy(mem);
+        failed++;
+        return;
+    }
+    ns = profile_now_ns() - start;
+
+    if (taken++ == 0) {
+        check(mem);
+    } else {
+        total_ns += ns;
+        if (ns > max_ns) {
+            max_ns = ns;
+        }
+        total_new_bytes += snapshot_memory_in_use() - in_use;
+    }
+
+    snapshot_memory_destroy(newest);
+    newest = mem;
+}
+
+void snapbench_frame(void)
+{
+    interrupt_maincpu_trigger_trap(snapbench_trap, NULL);
+}
+
+unsigned long snapbench_report(void)
+{
+    unsigned long deltas = taken > 1 ? taken - 1 : 0;
+
+    printf("snapshots:      %lu", taken);
+    if (failed) {
+        printf(" (%lu failed)", failed);
+    }
+    printf("\n");
+    if (newest != NULL) {
+        printf("snapshot size:  %lu bytes\n", (unsigned long)snapshot_memory_size(newest));
+    }
+    if (deltas) {
+        printf("snapshot time:  %.3f ms avg, %.3f ms max\n",
+               total_ns / 1e6 / deltas, max_ns / 1e6);
+        printf("snapshot delta: %.0f bytes avg\n", (double)total_new_bytes / deltas);
+    }
+    printf("snapshot RAM:   %lu bytes for the last two\n",
+           (unsigned long)snapshot_memory_in_use());
+    printf("snapshot check: %s\n", mismatches ? "FAILED" : "ok");
+
+    return mismatches + failed;
+}
@@ -0,0 +1,317 @@
+/*
+ * spritebench.c - Check the vectorized sprite compositing of the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -spritecheck starts a small program with SYS that sets the Y position
+ * of all eight sprites to the raster line over and over, so every line
+ * has eight sprites, and keeps changing the priority and multicolor
+ * registers while the raster is in the middle of them.  Every
+ * SPRITEBENCH_SCENE_FRAMES measured frames the sprites get new X
+ * positions, expansion, colours and data, and the screen new characters,
+ * colours and mode.
+ *
+ * The sprite draw functions of the raster are wrapped: each call draws
+ * the sprites pixel by pixel first, then puts the line, the collision
+ * line and the collision state back the way they were and draws them
+ * again with vicii_sprites_composite().  Both have to leave the same
+ * behind.  The video cache is off, so every line gets drawn.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "interrupt.h"
+#include "kbdbuf.h"
+#include "lib.h"
+#include "maincpu.h"
+#include "mem.h"
+#include "profile.h"
+#include "raster-sprite-status.h"
+#include "raster-sprite.h"
+#include "resources.h"
+#include "spritebench.h"
+#include "types.h"
+#include "vicii-sprites-simd.h"
+#include "vicii-sprites.h"
+#include "viciitypes.h"
+#include "viewport.h"
+
+#define SPRITEBENCH_PROGRAM 0xc000
+#define SPRITEBENCH_SCENE_FRAMES 25
+
+/* lda $d012, sta $d001 ... sta $d00f, inc $d01b, inc $d01c, jmp $c000 */
+static const uint8_t program[] = {
+    0xad, 0x12, 0xd0,
+    0x8d, 0x01, 0xd0, 0x8d, 0x03, 0xd0, 0x8d, 0x05, 0xd0, 0x8d, 0x07, 0xd0,
+    0x8d, 0x09, 0xd0, 0x8d, 0x0b, 0xd0, 0x8d, 0x0d, 0xd0, 0x8d, 0x0f, 0xd0,
+    0xee, 0x1b, 0xd0,
+    0xee, 0x1c, 0xd0,
+    0x4c, 0x00, 0xc0
+};
+
+/* What drawing the sprites of a line changes.  */
+typedef struct spritebench_state_s {
+    uint8_t *line;
+    uint8_t *sprline;
+    uint8_t status_sprite_collisions;
+    uint8_t status_background_collisions;
+    uint8_t sprite_collisions;
+    uint8_t background_collisions;
+    int mc_bug[8];
+} spritebench_state_t;
+
+static int fed = 0;
+static int started = 0;
+static unsigned int frames = 0;
+static int level = VICII_SPRITES_SIMD_NONE;
+static uint32_t seed = 1;
+static raster_sprite_status_draw_function_t draw_function;
+static raster_sprite_status_draw_partial_function_t draw_partial_function;
+static spritebench_state_t before, scalar, vector;
+static int line_size = 0;
+static unsigned long scenes = 0;
+static unsigned long calls = 0;
+static unsigned long collision_calls = 0;
+static unsigned long mismatches = 0;
+static uint64_t scalar_ns = 0, vector_ns = 0;
+
+static uint8_t next_random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (uint8_t)(seed >> 16);
+}
+
+static void save_state(spritebench_state_t *s, const uint8_t *line, int len)
+{
+    raster_sprite_status_t *status = vicii.raster.sprite_status;
+    int n;
+
+    memcpy(s->line, line, len);
+    memcpy(s->sprline, vicii_sprites_get_sprline(), vicii.sprite_wrap_x);
+    s->status_sprite_collisions = status->sprite_sprite_collisions;
+    s->status_background_collisions = status->sprite_background_collisions;
+    s->sprite_collisions = vicii.sprite_sprite_collisions;
+    s->background_collisions = vicii.sprite_background_collisions;
+    for (n = 0; n < 8; n++) {
+        s->mc_bug[n] = status->sprites[n].mc_bug;
+    }
+}
+
+static void load_state(const spritebench_state_t *s, uint8_t *line, int len)
+{
+    raster_sprite_status_t *status = vicii.raster.sprite_status;
+    int n;
+
+    memcpy(line, s->line, len);
+    memcpy(vicii_sprites_get_sprline(), s->sprline, vicii.sprite_wrap_x);
+    status->sprite_sprite_collisions = s->status_sprite_collisions;
+    status->sprite_background_collisions = s->status_background_collisions;
+    vicii.sprite_sprite_collisions = s->sprite_collisions;
+    vicii.sprite_background_collisions = s->background_collisions;
+    for (n = 0; n < 8; n++) {
+        status->sprites[n].mc_bug = s->mc_bug[n];
+    }
+}
+
+static int same_state(const spritebench_state_t *a, const spritebench_state_t *b, int len)
+{
+    return memcmp(a->line, b->line, len) == 0
+           && memcmp(a->sprline, b->sprline, vicii.sprite_wrap_x) == 0
+           && a->status_sprite_collisions == b->status_sprite_collisions
+           && a->status_background_collisions == b->status_background_collisions
+           && a->sprite_collisions == b->sprite_collisions
+           && a->background_collisions == b->background_collisions
+           && memcmp(a->mc_bug, b->mc_bug, sizeof(a->mc_bug)) == 0;
+}
+
+static void draw(uint8_t *line_ptr, uint8_t *gfx_msk_ptr, int xs, int xe, int partial)
+{
+    if (partial) {
+        draw_partial_function(line_ptr, gfx_msk_ptr, xs, xe);
+    } else {
+        draw_function(line_ptr, gfx_msk_ptr);
+    }
+}
+
+/* The sprites only draw between `xs' and `xe' of the line.  */
+static void check_draw(uint8_t *line_ptr, uint8_t *gfx_msk_ptr, int xs, int xe, int partial)
+{
+    uint8_t *line = line_ptr + xs;
+    int len = xe - xs + 1;
+    uint64_t start;
+
+    if (len <= 0) {
+        draw(line_ptr, gfx_msk_ptr, xs, xe, partial);
+        return;
+    }
+    if (len > line_size) {
+        line_size = len;
+        before.line = lib_realloc(before.line, len);
+        scalar.line = lib_realloc(scalar.line, len);
+        vector.line = lib_realloc(vector.line, len);
+    }
+    save_state(&before, line, len);
+
+    vicii_sprites_simd_set(VICII_SPRITES_SIMD_NONE);
+    start = profile_now_ns();
+    draw(line_ptr, gfx_msk_ptr, xs, xe, partial);
+    scalar_ns += profile_now_ns() - start;
+    save_state(&scalar, line, len);
+
+    load_state(&before, line, len);
+    vicii_sprites_simd_set(level);
+    start = profile_now_ns();
+    draw(line_ptr, gfx_msk_ptr, xs, xe, partial);
+    vector_ns += profile_now_ns() - start;
+    save_state(&vector, line, len);
+
+    calls++;
+    if (scalar.status_sprite_collisions && scalar.status_background_collisions) {
+        collision_calls++;
+    }
+    if (!same_state(&scalar, &vector, len)) {
+        if (mismatches++ == 0) {
+            printf("sprite check:   line %u, scene %lu: ss %02x/%02x, sb %02x/%02x\n",
+                   vicii.raster.current_line, scenes,
+                   scalar.status_sprite_collisions, vector.status_sprite_collisions,
+                   scalar.status_background_collisions, vector.status_background_collisions);
+        }
+    }
+}
+
+static void spritebench_draw(uint8_t *line_ptr, uint8_t *gfx_msk_ptr)
+{
+    int xs = VICII_RASTER_X(0) + vicii.raster.geometry->extra_offscreen_border_left;
+
+    check_draw(line_ptr, gfx_msk_ptr,
+               xs, xs + (int)vicii.raster.geometry->screen_size.width - 1, 0);
+}
+
+static void spritebench_draw_partial(uint8_t *line_ptr, uint8_t *gfx_msk_ptr,
+                                     int xs, int xe)
+{
+    check_draw(line_ptr, gfx_msk_ptr, xs, xe, 1);
+}
+
+/* New sprites and a new screen.  */
+static void spritebench_scene(uint16_t addr, void *data)
+{
+    unsigned int i;
+    uint8_t r;
+
+    if (!started) {
+        kbdbuf_flush();
+        if (kbdbuf_queue_is_pending() || reg_pc < SPRITEBENCH_PROGRAM
+            || reg_pc >= SPRITEBENCH_PROGRAM + sizeof(program)) {
+            return;
+        }
+        started = 1;
+    }
+
+    for (i = 0; i < 16; i += 2) {
+        mem_store((uint16_t)(0xd000 + i), next_random());
+        mem_store((uint16_t)(0x07f8 + i / 2), (uint8_t)(0x80 + i / 2));
+    }
+    mem_store(0xd010, next_random());
+    mem_store(0xd015, 0xff);
+    mem_store(0xd017, next_random());
+    mem_store(0xd01d, next_random());
+    for (i = 0xd025; i <= 0xd02e; i++) {
+        mem_store((uint16_t)i, next_random() & 0x0f);
+    }
+    r = next_random();
+    mem_store(0xd011, (uint8_t)(0x18 | (r & 0x27)));
+    r = next_random();
+    mem_store(0xd016, (uint8_t)(0xc8 | (r & 0x17)));
+    for (i = 0; i < 1000; i++) {
+        mem_store((uint16_t)(0x0400 + i), next_random());
+        mem_store((uint16_t)(0xd800 + i), next_random() & 0x0f);
+    }
+    for (i = 0x2000; i < 0x2200; i++) {
+        mem_store((uint16_t)i, next_random());
+    }
+    scenes++;
+}
+
+void spritebench_frame(void)
+{
+    raster_sprite_status_t *status = vicii.raster.sprite_status;
+    unsigned int i;
+
+    if (!fed) {
+        level = vicii_sprites_simd_get();
+        resources_set_int("VICIIVideoCache", 0);
+        for (i = 0; i < sizeof(program); i++) {
+            mem_store((uint16_t)(SPRITEBENCH_PROGRAM + i), program[i]);
+        }
+        kbdbuf_feed("SYS49152\r");
+
+        before.sprline = lib_malloc(vicii.sprite_wrap_x);
+        scalar.sprline = lib_malloc(vicii.sprite_wrap_x);
+        vector.sprline = lib_malloc(vicii.sprite_wrap_x);
+        draw_function = status->draw_function;
+        draw_partial_function = status->draw_partial_function;
+        raster_sprite_status_set_draw_function(status, spritebench_draw);
+        raster_sprite_status_set_draw_partial_function(status, spritebench_draw_partial);
+        fed = 1;
+    }
+    if (!started || frames++ % SPRITEBENCH_SCENE_FRAMES == 0) {
+        interrupt_maincpu_trigger_trap(spritebench_scene, NULL);
+    }
+}
+
+unsigned long spritebench_report(void)
+{
+    raster_sprite_status_t *status = vicii.raster.sprite_status;
+    unsigned long failed = mismatches;
+
+    if (fed) {
+        raster_sprite_status_set_draw_function(status, draw_function);
+        raster_sprite_status_set_draw_partial_function(status, draw_partial_function);
+    }
+    vicii_sprites_simd_set(level);
+
+    if (scenes == 0 || calls == 0) {
+        printf("sprite check:   the sprite program did not get to run\n");
+        failed++;
+    } else {
+        printf("sprites:        %lu scenes, %lu lines, %lu of them with both kinds of collisions, SIMD %s\n",
+               scenes, calls, collision_calls, vicii_sprites_simd_name(level));
+        printf("sprite draw:    %8.3f ms pixel by pixel, %8.3f ms with SIMD, %.2fx\n",
+               scalar_ns / 1e6, vector_ns / 1e6,
+               vector_ns ? (double)scalar_ns / vector_ns : 0.0);
+        printf("sprite check:   %lu lines, %lu differed\n", calls, mismatches);
+    }
+    printf("sprite check:   %s\n", failed ? "FAILED" : "ok");
+
+    lib_free(before.line);
+    lib_free(scalar.line);
+    lib_free(vector.line);
+    lib_free(before.sprline);
+    lib_free(scalar.sprline);
+    lib_free(vector.sprline);
+
+    return failed;
+}
@@ -0,0 +1,34 @@
+/*
+ * spritebench.h - Check the vectorized sprite compositing of the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_SPRITEBENCH_H
+#define VICE_SPRITEBENCH_H
+
+/* Start the sprite program and put up a new sprite scene now and then.
+   The sprites of every line are drawn pixel by pixel and with SIMD.  */
+extern void spritebench_frame(void);
+
+/* Print the times, returns the number of lines that did not match.  */
+extern unsigned long spritebench_report(void);
+
+#endif
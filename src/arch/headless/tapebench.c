@@ -0,0 +1,475 @@
+/*
+ * tapebench.c - Measure seeking on a TAP image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -tapebench takes a TAP image, or a program it writes to a TAP image of
+ * its own as TAPEBENCH_FILES files the way the KERNAL saves them, and
+ * goes to each file on it <n> times: with the index tap_open() builds,
+ * and scanning the pulses from the start of the tape as before.  It checks
+ * that both end up at the same place with the same header and read the
+ * same data, then writes a few pulses at the end of the tape and checks
+ * that they reach the file.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "archdep.h"
+#include "lib.h"
+#include "profile.h"
+#include "tap.h"
+#include "tape.h"
+#include "tapebench.h"
+#include "types.h"
+#include "util.h"
+
+#define TAPEBENCH_FILES 12
+
+/* Pulse lengths in cycles / 8 */
+#define PULSE_SHORT  0x30
+#define PULSE_MEDIUM 0x42
+#define PULSE_LONG   0x56
+
+typedef struct tapebench_buffer_s {
+    uint8_t *data;
+    size_t len;
+    size_t size;
+} tapebench_buffer_t;
+
+typedef struct tapebench_place_s {
+    int number;
+    int seek_position;
+    long data_pos;
+    tape_file_record_t record;
+} tapebench_place_t;
+
+/* ------------------------------------------------------------------------- */
+
+static void put_pulse(tapebench_buffer_t *buf, uint8_t pulse)
+{
+    if (buf->len == buf->size) {
+        buf->size = buf->size ? buf->size * 2 : 0x10000;
+        buf->data = lib_realloc(buf->data, buf->size);
+    }
+    buf->data[buf->len++] = pulse;
+}
+
+static void put_pulses(tapebench_buffer_t *buf, uint8_t pulse, int count)
+{
+    while (count-- > 0) {
+        put_pulse(buf, pulse);
+    }
+}
+
+/* Silence, as a version 1 long pulse */
+static void put_gap(tapebench_buffer_t *buf, uint32_t cycles)
+{
+    put_pulse(buf, 0);
+    put_pulse(buf, (uint8_t)(cycles & 0xff));
+    put_pulse(buf, (uint8_t)((cycles >> 8) & 0xff));
+    put_pulse(buf, (uint8_t)((cycles >> 16) & 0xff));
+}
+
+static void put_bit(tapebench_buffer_t *buf, int bit)
+{
+    put_pulse(buf, bit ? PULSE_MEDIUM : PULSE_SHORT);
+    put_pulse(buf, bit ? PULSE_SHORT : PULSE_MEDIUM);
+}
+
+static void put_byte(tapebench_buffer_t *buf, uint8_t value)
+{
+    int i, parity = 1;
+
+    put_pulse(buf, PULSE_LONG);
+    put_pulse(buf, PULSE_MEDIUM);
+    for (i = 0; i < 8; i++) {
+        put_bit(buf, (value >> i) & 1);
+        parity ^= (value >> i) & 1;
+    }
+    put_bit(buf, parity);
+}
+
+/* Sync countdown, data, checksum and end-of-data marker.  */
+static void put_block(tapebench_buffer_t *buf, const uint8_t *data, size_t len, int repeat)
+{
+    uint8_t checksum = 0;
+    size_t i;
+
+    for (i = 9; i > 0; i--) {
+        put_byte(buf, (uint8_t)(repeat ? i : i | 0x80));
+    }
+    for (i = 0; i < len; i++) {
+        put_byte(buf, data[i]);
+        checksum ^= data[i];
+    }
+    put_byte(buf, checksum);
+    put_pulse(buf, PULSE_LONG);
+    put_pulse(buf, PULSE_SHORT);
+}
+
+/* A block with its pilot in front and its repeat.  The KERNAL writes a
+   trailer after the repeat, which tap_read() takes for the pilot of the
+   next block, so there is none.  */
+static void put_blocks(tapebench_buffer_t *buf, int pilot, const uint8_t *data, size_t len)
+{
+    put_pulses(buf, PULSE_SHORT, pilot);
+    put_block(buf, data, len, 0);
+    put_pulses(buf, PULSE_SHORT, 0x4f);
+    put_block(buf, data, len, 1);
+}
+
+static void put_file(tapebench_buffer_t *buf, const char *name, const uint8_t *prg, size_t len)
+{
+    uint8_t header[192];
+    uint16_t start = (uint16_t)(prg[0] + prg[1] * 256);
+    uint16_t end = (uint16_t)(start + len - 2);
+
+    memset(header, ' ', sizeof(header));
+    header[0] = 3;
+    header[1] = (uint8_t)(start & 0xff);
+    header[2] = (uint8_t)(start >> 8);
+    header[3] = (uint8_t)(end & 0xff);
+    header[4] = (uint8_t)(end >> 8);
+    memcpy(header + 5, name, strlen(name));
+
+    put_blocks(buf, 0x6a00, header, sizeof(header));
+    put_gap(buf, 300000);
+    put_blocks(buf, 0x1a00, prg + 2, len - 2);
+    put_gap(buf, 500000);
+}
+
+static int make_tap(const char *name, const uint8_t *prg, size_t len)
+{
+    tapebench_buffer_t buf;
+    uint8_t header[TAP_HDR_SIZE];
+    char file_name[17];
+    FILE *f;
+    int i, retval = 0;
+
+    memset(&buf, 0, sizeof(buf));
+    for (i = 0; i < TAPEBENCH_FILES; i++) {
+        sprintf(file_name, "FILE %d", i);
+        put_file(&buf, file_name, prg, len);
+    }
+
+    memset(header, 0, sizeof(header));
+    memcpy(header + TAP_HDR_MAGIC_OFFSET, "C64-TAPE-RAW", 12);
+    header[TAP_HDR_VERSION] = 1;
+    util_dword_to_le_buf(header + TAP_HDR_LEN, (uint32_t)buf.len);
+
+    f = fopen(name, MODE_WRITE);
+    if (f == NULL) {
+        lib_free(buf.data);
+        return -1;
+    }
+    if (fwrite(header, 1, sizeof(header), f) != sizeof(header)
+        || fwrite(buf.data, 1, buf.len, f) != buf.len) {
+        retval = -1;
+    }
+    if (fclose(f) == EOF) {
+        retval = -1;
+    }
+    lib_free(buf.data);
+
+    return retval;
+}
+
+static uint8_t *load_file(const char *name, size_t *len)
+{
+    FILE *f;
+    uint8_t *data;
+
+    f = fopen(name, MODE_READ);
+    if (f == NULL) {
+        return NULL;
+    }
+    *len = util_file_length(f);
+    data = lib_malloc(*len + 1);
+    if (fread(data, 1, *len, f) != *len) {
+        lib_free(data);
+        data = NULL;
+    }
+    fclose(f);
+
+    return data;
+}
+
+static int copy_tap(const char *from, const char *to)
+{
+    uint8_t *data;
+    size_t len;
+    int retval;
+
+    data = load_file(from, &len);
+    if (data == NULL) {
+        return -1;
+    }
+    retval = util_file_save(to, data, (int)len);
+    lib_free(data);
+
+    return retval;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void place_get(tap_t *tap, tapebench_place_t *place)
+{
+    place->number = tap->current_file_number;
+    place->seek_position = tap->current_file_seek_position;
+    place->data_pos = tap->data_pos;
+    place->record = *tap->tap_file_record;
+}
+
+static int place_same(const tapebench_place_t *a, const tapebench_place_t *b)
+{
+    return a->number == b->number
+           && a->seek_position == b->seek_position
+           && a->data_pos == b->data_pos
+           && a->record.type == b->record.type
+           && a->record.encoding == b->record.encoding
+           && a->record.start_addr == b->record.start_addr
+           && a->record.end_addr == b->record.end_addr
+           && memcmp(a->record.name, b->record.name, 16) == 0;
+}
+
+/* Go to every file, returning how long it took.  */
+static uint64_t seek_all(tap_t *tap, int count, tapebench_place_t *places)
+{
+    uint64_t start = profile_now_ns();
+    int n;
+
+    for (n = 0; n < count; n++) {
+        tap_seek_to_file(tap, (unsigned int)n);
+        place_get(tap, &places[n]);
+    }
+    return profile_now_ns() - start;
+}
+
+/* Step through the tape file by file and round to the first one.  */
+static uint64_t next_all(tap_t *tap, int count, tapebench_place_t *places)
+{
+    uint64_t start = profile_now_ns();
+    int n;
+
+    tap_seek_start(tap);
+    for (n = 0; n <= count; n++) {
+        tap_seek_to_next_file(tap, 1);
+        place_get(tap, &places[n]);
+    }
+    return profile_now_ns() - start;
+}
+
+static uint8_t *read_file(tap_t *tap, int n, int *len)
+{
+    uint8_t *data = lib_malloc(0x10000);
+
+    *len = -1;
+    if (tap_seek_to_file(tap, (unsigned int)n) == 0) {
+        *len = tap_read(tap, data, 0x10000);
+    }
+    return data;
+}
+
+static int check_files(tap_t *tap, int count, const uint8_t *prg, size_t prg_len)
+{
+    struct tap_index_s *index = tap->index;
+    uint8_t *indexed, *scanned;
+    int n, indexed_len, scanned_len, failed = 0;
+
+    for (n = 0; n < count; n++) {
+        indexed = read_file(tap, n, &indexed_len);
+        tap->index = NULL;
+        scanned = read_file(tap, n, &scanned_len);
+        tap->index = index;
+
+        if (indexed_len < 0 || indexed_len != scanned_len
+            || memcmp(indexed, scanned, indexed_len) != 0) {
+            printf("tape check:     file %d reads differently with the index\n", n);
+            failed++;
+        } else if (prg != NULL && ((size_t)indexed_len != prg_len - 2
+                                   || memcmp(indexed, prg + 2, indexed_len) != 0)) {
+            printf("tape check:     file %d does not read back\n", n);
+            failed++;
+        }
+        lib_free(indexed);
+        lib_free(scanned);
+    }
+    return failed;
+}
+
+/* Record a few pulses past the end of the tape and look for them in the
+   file.  */
+static int check_write(const char *name, tap_t *tap, int count)
+{
+    uint8_t pulses[16], *data;
+    size_t size;
+    unsigned int read_only = 0;
+    int failed = 0;
+
+    memset(pulses, PULSE_SHORT, sizeof(pulses));
+    tap->current_file_seek_position = tap->size;
+    if (tap_write(tap, pulses, sizeof(pulses)) != sizeof(pulses)
+        || tap->index != NULL) {
+        failed++;
+    }
+    if (tap_seek_to_file(tap, (unsigned int)count - 1) < 0) {
+        printf("tape check:     no more seeking after writing\n");
+        failed++;
+    }
+    size = tap->data_size;
+    data = lib_malloc(size);
+    memcpy(data, tap->data, size);
+    tap_close(tap);
+
+    tap = tap_open(name, &read_only);
+    if (tap == NULL || tap->data_size != size
+        || memcmp(tap->data + TAP_HDR_SIZE, data + TAP_HDR_SIZE, size - TAP_HDR_SIZE) != 0
+        || tap->index_count != count) {
+        printf("tape check:     the written pulses did not make it into the file\n");
+        failed++;
+    }
+    if (tap != NULL) {
+        tap_close(tap);
+    }
+    lib_free(data);
+
+    return failed;
+}
+
+int tapebench_run(const char *filename, int passes)
+{
+    tap_t *tap;
+    struct tap_index_s *index;
+    tapebench_place_t *indexed, *scanned;
+    uint8_t *prg = NULL;
+    size_t prg_len = 0;
+    uint64_t start, open_ns, indexed_ns = 0, scanned_ns = 0, next_ns = 0, next_scan_ns = 0;
+    unsigned int read_only = 1;
+    char *name;
+    int count, n, pass, failed = 0;
+
+    name = archdep_tmpnam();
+
+    tap = tap_open(filename, &read_only);
+    if (tap != NULL) {
+        tap_close(tap);
+        if (copy_tap(filename, name) < 0) {
+            fprintf(stderr, "vicebench: cannot copy '%s'\n", filename);
+            lib_free(name);
+            return -1;
+        }
+    } else {
+        prg = load_file(filename, &prg_len);
+        if (prg == NULL || prg_len < 3 || prg_len > 0x10000
+            || make_tap(name, prg, prg_len) < 0) {
+            fprintf(stderr, "vicebench: '%s' is neither a TAP image nor a program\n", filename);
+            lib_free(prg);
+            remove(name);
+            lib_free(name);
+            return -1;
+        }
+    }
+
+    read_only = 0;
+    start = profile_now_ns();
+    tap = tap_open(name, &read_only);
+    open_ns = profile_now_ns() - start;
+    if (tap == NULL || tap->index == NULL) {
+        fprintf(stderr, "vicebench: cannot open '%s'\n", filename);
+        if (tap != NULL) {
+            tap_close(tap);
+        }
+        lib_free(prg);
+        remove(name);
+        lib_free(name);
+        return -1;
+    }
+    count = tap->index_count;
+    index = tap->index;
+    if (prg != NULL && count != TAPEBENCH_FILES) {
+        printf("tape check:     found %d of %d files\n", count, TAPEBENCH_FILES);
+        failed++;
+    }
+
+    indexed = lib_malloc((count + 1) * sizeof(tapebench_place_t));
+    scanned = lib_malloc((count + 1) * sizeof(tapebench_place_t));
+    for (pass = 0; pass < passes; pass++) {
+        indexed_ns += seek_all(tap, count, indexed);
+        next_ns += next_all(tap, count, indexed);
+
+        /* Without the index tap.c scans the pulses as before.  */
+        tap->index = NULL;
+        scanned_ns += seek_all(tap, count, scanned);
+        tap->index = index;
+    }
+    seek_all(tap, count, indexed);
+    tap->index = NULL;
+    seek_all(tap, count, scanned);
+    tap->index = index;
+    for (n = 0; n < count; n++) {
+        if (!place_same(&indexed[n], &scanned[n])) {
+            printf("tape check:     file %d is somewhere else with the index\n", n);
+            failed++;
+        }
+    }
+    next_all(tap, count, indexed);
+    tap->index = NULL;
+    start = profile_now_ns();
+    next_all(tap, count, scanned);
+    next_scan_ns = profile_now_ns() - start;
+    tap->index = index;
+    for (n = 0; n <= count; n++) {
+        if (!place_same(&indexed[n], &scanned[n])) {
+            printf("tape check:     stepping to file %d ends up somewhere else with the index\n", n);
+            failed++;
+        }
+    }
+
+    failed += check_files(tap, count, prg, prg_len);
+
+    printf("tape:           %s, %d files, %lu bytes, %d passes\n",
+           filename, count, (unsigned long)tap->data_size, passes);
+    printf("tape open:      %8.3f ms with the index\n", open_ns / 1e6);
+    if (count > 0) {
+        printf("tape seek:      %8.3f ms avg to a file with the index\n",
+               indexed_ns / 1e6 / passes / count);
+        printf("tape seek:      %8.3f ms avg to a file scanning from the start\n",
+               scanned_ns / 1e6 / passes / count);
+        printf("tape next:      %8.3f ms through the tape with the index\n",
+               next_ns / 1e6 / passes);
+        printf("tape next:      %8.3f ms through the tape scanning\n", next_scan_ns / 1e6);
+    }
+
+    failed += check_write(name, tap, count);
+    printf("tape check:     %s\n", failed ? "FAILED" : "ok");
+
+    remove(name);
+    lib_free(name);
+    lib_free(prg);
+    lib_free(indexed);
+    lib_free(scanned);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+/*
+ * tapebench.h - Measure seeking on a TAP image.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_TAPEBENCH_H
+#define VICE_TAPEBENCH_H
+
+/* Seek to every file of a TAP image, or of one made from a program,
+   <passes> times with and without the index and check both.  Returns -1
+   on error, 1 if a check failed.  */
+extern int tapebench_run(const char *filename, int passes);
+
+#endif
@@ -0,0 +1,290 @@
+/*
+ * turbotapebench.c - Check that turbo tape loads the same as plain loading.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * -turbotapecheck attaches a TAP image once the machine is up, types LOAD
+ * and RUN, presses play and takes a memory snapshot.  The first half of
+ * the frames of that tape loads the usual way; then the snapshot is loaded
+ * again and the second half loads with DatasetteTurbo.  A checksum of RAM,
+ * the CPU clock and the readable SID voice 3 registers is kept for every
+ * frame of the first half, and the second half has to come out the same.
+ * The tape wobble is turned off: it comes from rand(), and the CIA TOD
+ * draws from it too, at a point that snapshots do not keep.
+ *
+ * With several images the measured frames are shared out between them.
+ * The machine as it was before the first one was attached is kept in a
+ * second snapshot, and each of the others starts from there.  The report
+ * adds up the times of all of them.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+#include "crc32.h"
+#include "datasette.h"
+#include "interrupt.h"
+#include "kbdbuf.h"
+#include "lib.h"
+#include "machine.h"
+#include "maincpu.h"
+#include "mem.h"
+#include "profile.h"
+#include "resources.h"
+#include "snapshot.h"
+#include "sound.h"
+#include "tape.h"
+#include "turbotapebench.h"
+#include "types.h"
+#include "vsync.h"
+
+#define TURBOTAPE_MAX_TAPES 16
+
+enum {
+    TURBOTAPE_BOOT = 0,
+    TURBOTAPE_WAITING,          /* for the KERNAL to take keys */
+    TURBOTAPE_PLAIN,
+    TURBOTAPE_TURBO,
+    TURBOTAPE_NEXT,             /* for the machine to go back */
+    TURBOTAPE_DONE,
+    TURBOTAPE_FAILED
+};
+
+typedef struct turbotape_result_s {
+    const char *name;
+    int frames;                 /* in each half */
+    int turbo_frames;           /* in warp mode */
+    unsigned long mismatches;
+    uint64_t plain_ns;
+    uint64_t turbo_ns;
+} turbotape_result_t;
+
+static turbotape_result_t tapes[TURBOTAPE_MAX_TAPES];
+static int num_tapes = 0;
+static int tape = 0;            /* the one that loads */
+
+static int state = TURBOTAPE_BOOT;
+static snapshot_memory_t *boot = NULL;
+static snapshot_memory_t *start = NULL;
+static uint32_t *checksums = NULL;
+static int budget = 0;          /* measured frames for each tape */
+static int waited = 0;          /* of them before play was pressed */
+static int frame = 0;
+static uint64_t start_ns;
+
+static uint32_t checksum(void)
+{
+    uint32_t voice3 = (uint32_t)(sound_read(0x1b, 0) << 8 | sound_read(0x1c, 0));
+
+    return crc32_buf((const char *)mem_ram, 0x10000) ^ maincpu_clk ^ (voice3 << 16);
+}
+
+int turbotapebench_add(const char *filename)
+{
+    if (num_tapes == TURBOTAPE_MAX_TAPES) {
+        return -1;
+    }
+    tapes[num_tapes++].name = filename;
+    return 0;
+}
+
+static int attach(void)
+{
+    resources_set_int("DatasetteTurbo", 0);
+    resources_set_int("DatasetteTapeWobble", 0);
+    if (tape_image_attach(1, tapes[tape].name) < 0) {
+        printf("turbo tape:     cannot attach '%s'\n", tapes[tape].name);
+        state = TURBOTAPE_FAILED;
+        return -1;
+    }
+    kbdbuf_feed("LOAD\rRUN\r");
+    waited = 0;
+    state = TURBOTAPE_WAITING;
+    return 0;
+}
+
+/* Once LOAD and RUN are in the keyboard buffer.  */
+static void turbotapebench_start(uint16_t addr, void *data)
+{
+    kbdbuf_flush();
+    if (kbdbuf_queue_is_pending()) {
+        return;
+    }
+
+    datasette_control(DATASETTE_CONTROL_START);
+    if (start != NULL) {
+        snapshot_memory_destroy(start);
+    }
+    start = snapshot_memory_new();
+    if (machine_write_snapshot_memory(start, NULL) < 0) {
+        printf("turbo tape:     cannot take the snapshot\n");
+        state = TURBOTAPE_FAILED;
+        return;
+    }
+
+    tapes[tape].frames = (budget - waited) / 2;
+    if (tapes[tape].frames <= 0) {
+        printf("turbo tape:     no frames left for '%s'\n", tapes[tape].name);
+        state = TURBOTAPE_FAILED;
+        return;
+    }
+    lib_free(checksums);
+    checksums = lib_malloc((tapes[tape].frames + 1) * sizeof(uint32_t));
+    frame = 0;
+    state = TURBOTAPE_PLAIN;
+    start_ns = profile_now_ns();
+}
+
+static void turbotapebench_restart(uint16_t addr, void *data)
+{
+    tapes[tape].plain_ns = profile_now_ns() - start_ns;
+
+    if (machine_read_snapshot_memory(start) < 0) {
+        printf("turbo tape:     cannot load the snapshot\n");
+        state = TURBOTAPE_FAILED;
+        return;
+    }
+    resources_set_int("DatasetteTurbo", 1);
+
+    frame = 0;
+    state = TURBOTAPE_TURBO;
+    start_ns = profile_now_ns();
+}
+
+/* The machine before the first tape.  */
+static void turbotapebench_boot(uint16_t addr, void *data)
+{
+    resources_set_int("WarpMode", 0);
+    boot = snapshot_memory_new();
+    if (machine_write_snapshot_memory(boot, NULL) < 0) {
+        printf("turbo tape:     cannot take the snapshot\n");
+        state = TURBOTAPE_FAILED;
+        return;
+    }
+    attach();
+}
+
+/* Back to before the first tape, for the next one.  */
+static void turbotapebench_next(uint16_t addr, void *data)
+{
+    datasette_control(DATASETTE_CONTROL_STOP);
+    resources_set_int("DatasetteTurbo", 0);
+
+    if (machine_read_snapshot_memory(boot) < 0) {
+        printf("turbo tape:     cannot load the snapshot\n");
+        state = TURBOTAPE_FAILED;
+        return;
+    }
+    attach();
+}
+
+void turbotapebench_frame(int num_frames)
+{
+    turbotape_result_t *t = &tapes[tape];
+
+    switch (state) {
+        case TURBOTAPE_BOOT:
+            budget = num_frames / num_tapes;
+            interrupt_maincpu_trigger_trap(turbotapebench_boot, NULL);
+            break;
+        case TURBOTAPE_WAITING:
+            waited++;
+            interrupt_maincpu_trigger_trap(turbotapebench_start, NULL);
+            break;
+        case TURBOTAPE_PLAIN:
+            checksums[frame++] = checksum();
+            if (frame == t->frames) {
+                interrupt_maincpu_trigger_trap(turbotapebench_restart, NULL);
+            }
+            break;
+        case TURBOTAPE_TURBO:
+            if (frame < t->frames) {
+                if (checksums[frame] != checksum()) {
+                    t->mismatches++;
+                }
+                t->turbo_frames += vsync_warp_active();
+                if (++frame == t->frames) {
+                    t->turbo_ns = profile_now_ns() - start_ns;
+                    if (++tape == num_tapes) {
+                        state = TURBOTAPE_DONE;
+                    } else {
+                        state = TURBOTAPE_NEXT;
+                        interrupt_maincpu_trigger_trap(turbotapebench_next, NULL);
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+unsigned long turbotapebench_report(void)
+{
+    unsigned long failed = 0, mismatches = 0;
+    uint64_t plain_ns = 0, turbo_ns = 0;
+    int i, frames = 0, turbo_frames = 0;
+
+    for (i = 0; i < num_tapes && i < tape; i++) {
+        turbotape_result_t *t = &tapes[i];
+
+        printf("turbo tape:     %s, %d frames each way, %d of them in warp mode\n",
+               t->name, t->frames, t->turbo_frames);
+        printf("turbo time:     %8.3f ms as usual, %8.3f ms with the turbo, %.2fx\n",
+               t->plain_ns / 1e6, t->turbo_ns / 1e6,
+               t->turbo_ns ? (double)t->plain_ns / t->turbo_ns : 0.0);
+        frames += t->frames;
+        turbo_frames += t->turbo_frames;
+        mismatches += t->mismatches;
+        plain_ns += t->plain_ns;
+        turbo_ns += t->turbo_ns;
+    }
+
+    if (state != TURBOTAPE_DONE) {
+        printf("turbo tape:     did not get to load %s twice\n",
+               tape < num_tapes ? tapes[tape].name : "every tape");
+        failed++;
+    }
+    if (tape > 1) {
+        printf("turbo corpus:   %d tapes, %d frames each way, %d of them in warp mode\n",
+               tape, frames, turbo_frames);
+        printf("turbo corpus:   %8.3f ms as usual, %8.3f ms with the turbo, %.2fx\n",
+               plain_ns / 1e6, turbo_ns / 1e6, turbo_ns ? (double)plain_ns / turbo_ns : 0.0);
+    }
+    printf("turbo check:    %d frames, %lu differed\n", frames, mismatches);
+    failed += mismatches;
+    printf("turbo check:    %s\n", failed ? "FAILED" : "ok");
+
+    if (boot != NULL) {
+        snapshot_memory_destroy(boot);
+        boot = NULL;
+    }
+    if (start != NULL) {
+        snapshot_memory_destroy(start);
+        start = NULL;
+    }
+    lib_free(checksums);
+    checksums = NULL;
+
+    return failed;
+}
@@ -0,0 +1,40 @@
+/*
+ * turbotapebench.h - Check that turbo tape loads the same as plain loading.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_TURBOTAPEBENCH_H
+#define VICE_TURBOTAPEBENCH_H
+
+/* Add <filename> to the tapes to load, returns -1 if there are too many.  */
+extern int turbotapebench_add(const char *filename);
+
+/* Load each tape in turn from the machine as it was at the first call,
+   first as usual for half of its share of the <num_frames> measured
+   frames, then again with the turbo.  */
+extern void turbotapebench_frame(int num_frames);
+
+/* Print how long both took for each tape and for all of them, returns
+   the number of frames that did not match plus one if not every tape
+   was loaded both ways.  */
+extern unsigned long turbotapebench_report(void);
+
+#endif
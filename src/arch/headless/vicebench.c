@@ -0,0 +1,659 @@
+/*
+ * vicebench.c - Frame-accurate benchmark runner for the headless backend.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * Usage: vicebench [-frames <n>] [-warmup <n>] [-alarmtrace-record <file>]
+ *                  [-rendercheck] [-present] [-presentthread]
+ *                  [-psid <file>] [-snapshots] [-rewindcheck] [-savestates]
+ *                  [-turbotapecheck <image.tap>]... [-spritecheck]
+ *                  [-drawstats] [-drawcheck] [-reucheck]
+ *                  [-autostartcheck <image>] [-memcrc]
+ *                  [-profilecsv <file>] [-profileoverlay] [VICE options...]
+ *        vicebench -alarmtrace <file> [-passes <n>]
+ *        vicebench -residcheck [-passes <n>]
+ *        vicebench -gcrbench <image.d64> [-passes <n>]
+ *        vicebench -imagebench <image> [-passes <n>]
+ *        vicebench -archivebench <image> [-passes <n>]
+ *        vicebench -tapebench <image.tap|program.prg> [-passes <n>]
+ *
+ * Boots the emulated machine with the speed limit off and every frame
+ * drawn, lets it run for <warmup> frames (KERNAL init, autostart, ...)
+ * and then measures <frames> frames.  Everything that is not a vicebench
+ * option is handed to the normal VICE command line parser, so images can
+ * be attached with -autostart, -8 and friends.
+ *
+ * -alarmtrace-record writes the alarm traffic of the measured frames to a
+ * file, -alarmtrace replays such a file against the alarm scheduler
+ * without starting the emulator.
+ *
+ * -rendercheck runs every measured frame through the 16 and 32 bit PAL
+ * and CRT renderers with each SIMD level and compares the results with
+ * the scalar code.
+ *
+ * -present converts the lines the raster changed into a 32 bit host frame
+ * buffer, like a port drawing to an RGB surface.  The report shows how
+ * many bytes that took per frame.  -presentthread leaves the conversion
+ * to a presenter thread and adds how many frames it dropped and how long
+ * they took from the emulation to the host frame buffer.
+ *
+ * -residcheck compares the samples of the reSID fast paths with those of
+ * the plain code for <n> seconds of generated music each, again without
+ * starting the emulator.
+ *
+ * -gcrbench converts all sectors of a .d64 to GCR tracks and reads them
+ * back <n> times, again without starting the emulator, and shows how many
+ * MB per second the GCR codec gets through each way.
+ *
+ * -imagebench reads every sector of a copy of a disk image <n> times,
+ * from memory and by seeking in the file as before, then writes them all
+ * and checks that they reached the file once it is closed.
+ *
+ * -archivebench opens a gzipped copy of a disk image <n> times through a
+ * temporary file as before and from memory, and checks that both give the
+ * same image, that writes reach the .gz file and that the memory limit
+ * holds.
+ *
+ * -tapebench goes to every file of a TAP image (or of one it writes from
+ * a program) <n> times with the index and by scanning the tape, checks
+ * that both agree and that pulses written to the tape reach the file.
+ *
+ * -snapshots takes a memory snapshot at the end of every measured frame,
+ * each one sharing the unchanged parts of RAM with the one before, and
+ * shows how long they took and how much memory each one added.
+ *
+ * -rewindcheck records for rewinding during the measured frames, steps back
+ * every now and then and checks that the replay comes out the same.
+ * Together with -rewindinterval it shows what keyframes cost and how long
+ * stepping back takes.
+ *
+ * -savestates saves a snapshot every 50 measured frames, once straight
+ * into a file and once into memory with a PNG thumbnail for the snapshot
+ * writer to compress and write in the background, and shows how long the
+ * emulation stood still for each.
+ *
+ * -turbotapecheck loads a TAP image from the first half of the measured
+ * frames on, then loads it again from the same point with DatasetteTurbo
+ * for the second half and checks that every frame comes out the same.
+ * It shows how much quicker the second time was.  Given more than once,
+ * the tapes share the frames and the times are added up as well.
+ *
+ * -spritecheck runs a program that keeps all eight sprites on every line
+ * and draws the sprites of each line twice from the same state, pixel by
+ * pixel and with SIMD, and checks that the pixels and collisions are the
+ * same.
+ *
+ * -drawstats shows per video mode how many lines the raster cache found
+ * unchanged, how many whole lines were copied from the frame before
+ * instead of drawn, and how long drawing the graphics took.  -drawcheck
+ * runs with the raster cache off, changes the screen a little every
+ * frame and draws every whole line both in full and with the fast path,
+ * and checks that they are the same.
+ *
+ * -reucheck turns the REU on and starts a few transfers every frame.
+ * Every span the REU moves in one go is also moved one byte at a time
+ * from the same state, and both have to come out the same.  The report
+ * shows how many bytes went in one go and how much time that saved.
+ *
+ * -autostartcheck autostarts an image from a reset, from the booted
+ * machine in the autostart cache and from the machine with the program
+ * loaded, and checks that the program puts the same screen up each time.
+ * The report shows how many frames and how long each autostart took.
+ *
+ * -memcrc adds up a CRC of the computer's RAM every measured frame and
+ * prints it, so two runs that should emulate the same, like -drivethread
+ * and +drivethread, can be compared.  The drive's RAM is left out, a
+ * drive on its own thread is ahead of the computer at the end of a frame.
+ * Autostart with +autostart-delay-random, the delay is drawn before the
+ * first frame reseeds rand().
+ *
+ * In VICE_PROFILE builds the report shows the host time of each part of
+ * the emulator and, from the ring of frame records, the average and the
+ * slowest of the last frames.  -profilecsv writes those frame records to
+ * a file, -profileoverlay prints the text a port would put on screen
+ * every PROFILE_OVERLAY_FRAMES frames.  The time a drive on its own
+ * thread takes is shown next to the drivecpu calls and left out of the
+ * shares; "alarms" counts the computer's alarms only, so it comes out the
+ * same with and without the drive thread, "drive-alarms" and
+ * "drive-cycles" run up to wherever the drive stopped.
+ *
+ * -psid plays the default tune of a PSID file, installed by c64/psid.c
+ * the way VSID does it, during warmup and measurement.  Music routines
+ * write the SID all the time; comparing runs with -soundbatch and
+ * +soundbatch shows what clocking reSID up to every single write costs.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "alarmbench.h"
+#include "archdep.h"
+#include "archivebench.h"
+#include "autostartbench.h"
+#include "crc32.h"
+#include "drawbench.h"
+#include "drive-thread.h"
+#include "gcrbench.h"
+#include "imagebench.h"
+#include "lib.h"
+#include "machine.h"
+#include "main.h"
+#include "mem.h"
+#include "profile.h"
+#include "psid.h"
+#include "render-simd.h"
+#include "renderbench.h"
+#include "residbench.h"
+#include "resources.h"
+#include "reubench.h"
+#include "rewindbench.h"
+#include "savebench.h"
+#include "snapbench.h"
+#include "spritebench.h"
+#include "tapebench.h"
+#include "turbotapebench.h"
+#include "types.h"
+#include "vicebench.h"
+#include "vicii-sprites-simd.h"
+#include "video.h"
+#include "video-present.h"
+#include "videoarch.h"
+
+#define VICEBENCH_DEFAULT_FRAMES 1000
+#define VICEBENCH_DEFAULT_WARMUP 150
+#define VICEBENCH_DEFAULT_PASSES 20
+
+/* Run flat out, draw every frame and keep reSID busy without a device. */
+static char *forced_args[] = {
+    "-speed", "0",
+    "-refresh", "1",
+    "+warp",
+    "-sound",
+    "-sounddev", "dummy",
+};
+
+static int bench_frames = VICEBENCH_DEFAULT_FRAMES;
+static int bench_warmup = VICEBENCH_DEFAULT_WARMUP;
+static int bench_passes = VICEBENCH_DEFAULT_PASSES;
+static const char *alarm_record_file = NULL;
+static const char *alarm_replay_file = NULL;
+static int render_check = 0;
+static int present = VIDEO_HEADLESS_PRESENT_OFF;
+static const char *psid_file = NULL;
+static int resid_check = 0;
+static const char *gcr_bench_file = NULL;
+static const char *image_bench_file = NULL;
+static const char *archive_bench_file = NULL;
+static const char *tape_bench_file = NULL;
+static int snapshots = 0;
+static int rewind_check = 0;
+static int save_states = 0;
+static int turbo_tape = 0;
+static int sprite_check = 0;
+static int draw_stats = 0;
+static int draw_check = 0;
+static int reu_check = 0;
+static const char *autostart_file = NULL;
+static int mem_crc = 0;
+static uint32_t mem_crc_value;
+static const char *profile_csv_file = NULL;
+static int profile_overlay = 0;
+
+static int frame_count = 0;
+static int measuring = 0;
+static uint64_t total_cycles;
+static uint64_t start_ns;
+static unsigned long start_refreshes;
+static uint64_t start_render_bytes;
+
+static void mem_crc_frame(void)
+{
+    mem_crc_value = mem_crc_value * 31 + crc32_buf((const char *)mem_ram, 0x10000);
+}
+
+/* The average and the slowest of the frames still in the ring.  */
+static void report_frames(void)
+{
+    profile_frame_t total, frame, slowest;
+    unsigned int frames, age, i, most = PROFILE_MAINCPU;
+
+    frames = profile_frames_sum(PROFILE_FRAMES, &total);
+    if (frames == 0) {
+        return;
+    }
+
+    memset(&slowest, 0, sizeof(slowest));
+    for (age = 0; profile_frame_get(age, &frame) == 0; age++) {
+        if (frame.wall_ns > slowest.wall_ns) {
+            slowest = frame;
+        }
+    }
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        if (slowest.ns[i] > slowest.ns[most]) {
+            most = i;
+        }
+    }
+
+    printf("\nlast frames:    %u, %.3f ms avg, slowest %.3f ms (frame %lu, %.3f ms %s)\n",
+           frames, total.wall_ns / 1e6 / frames, slowest.wall_ns / 1e6, slowest.frame,
+           slowest.ns[most] / 1e6, profile_section_name((profile_section_t)most));
+}
+
+static void print_overlay(const char *text)
+{
+    printf("overlay:        %s\n", text);
+}
+
+static void report(uint64_t elapsed_ns)
+{
+    double secs = (double)elapsed_ns / 1e9;
+    double real_cps = (double)machine_get_cycles_per_second();
+    uint64_t accounted = 0;
+    int i;
+    int sound_batch;
+#ifdef USE_SOUND_THREAD
+    int sound_thread;
+#endif
+#ifdef USE_DRIVE_THREAD
+    drive_thread_stats_t drive_stats;
+#endif
+
+    printf("machine:        %s\n", machine_get_name());
+#ifdef USE_6510_COMPUTED_GOTO
+    printf("6510 dispatch:  computed goto\n");
+#else
+    printf("6510 dispatch:  switch\n");
+#endif
+    printf("render SIMD:    %s\n", render_simd_name(render_simd_get()));
+    printf("sprite SIMD:    %s\n", vicii_sprites_simd_name(vicii_sprites_simd_get()));
+#ifdef USE_SOUND_THREAD
+    if (resources_get_int("SoundThread", &sound_thread) == 0 && sound_thread) {
+        printf("sound:          own thread\n");
+    } else {
+        printf("sound:          emulation thread\n");
+    }
+#endif
+#ifdef USE_DRIVE_THREAD
+    drive_thread_get_stats(&drive_stats);
+    if (drive_stats.starts) {
+        printf("drive:          own thread (%lu starts, %lu events, %lu late, %lu waits, %lu stalls)\n",
+               drive_stats.starts, drive_stats.events, drive_stats.late,
+               drive_stats.waits, drive_stats.stalls);
+    } else {
+        printf("drive:          emulation thread\n");
+    }
+#endif
+    if (resources_get_int("SoundBatch", &sound_batch) == 0) {
+        printf("SID stores:     %s\n", sound_batch ? "batched" : "rendered up to each");
+    }
+    if (psid_file != NULL) {
+        printf("PSID:           %s\n", psid_file);
+    }
+    printf("frames:         %d\n", bench_frames);
+    printf("cycles:         %llu\n", (unsigned long long)total_cycles);
+    printf("seconds:        %.3f\n", secs);
+    printf("cycles/sec:     %.0f\n", total_cycles / secs);
+    printf("frames/sec:     %.2f\n", bench_frames / secs);
+    printf("speed:          %.1f%%\n", 100.0 * total_cycles / secs / real_cps);
+    if (present == VIDEO_HEADLESS_PRESENT_THREAD) {
+        video_present_stats_t stats;
+
+        video_headless_present_flush(&stats);
+        printf("published:      %lu\n", stats.published);
+        printf("dropped:        %lu\n", stats.dropped);
+        printf("latency:        %.3f ms avg, %.3f ms max\n",
+               stats.latency_avg_ms, stats.latency_max_ms);
+    }
+    printf("refreshes:      %lu\n", video_headless_refresh_count() - start_refreshes);
+    if (present) {
+        printf("converted:      %.0f bytes/frame\n",
+               (double)(video_canvas_render_bytes() - start_render_bytes) / bench_frames);
+        printf("stale pixels:   %lu\n", video_headless_present_check());
+    }
+    if (mem_crc) {
+        printf("memory crc:     %08x\n", (unsigned int)mem_crc_value);
+    }
+
+    if (!profile_enabled()) {
+        printf("(built without VICE_PROFILE, no per-subsystem times)\n");
+        return;
+    }
+
+    printf("\n%-14s %10s %7s %10s\n", "section", "ms", "share", "calls");
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        accounted += profile_section_ns((profile_section_t)i)
+                     - profile_section_thread_ns((profile_section_t)i);
+    }
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        uint64_t ns = profile_section_ns((profile_section_t)i);
+        uint64_t thread_ns = profile_section_thread_ns((profile_section_t)i);
+
+        printf("%-14s %10.1f %6.1f%% ",
+               profile_section_name((profile_section_t)i),
+               ns / 1e6,
+               accounted ? 100.0 * (ns - thread_ns) / accounted : 0.0);
+        /* the CPU is the root section, it is never entered */
+        if (i == PROFILE_MAINCPU) {
+            printf("%10s\n", "-");
+        } else {
+            printf("%10lu", profile_section_calls((profile_section_t)i));
+            /* time of other threads overlaps the emulation thread */
+            if (thread_ns) {
+                printf("  (%.1f ms on its own thread)", thread_ns / 1e6);
+            }
+            printf("\n");
+        }
+    }
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        printf("%-14s %10lu\n", profile_counter_name((profile_counter_t)i),
+               profile_counter_value((profile_counter_t)i));
+    }
+    report_frames();
+}
+
+void vicebench_frame_done(void)
+{
+    /* Drive wobble, TOD jitter and friends use rand(), which main_program()
+       seeded from the time of day.  Reseed so runs are repeatable.  */
+    if (frame_count++ == 0 && !measuring) {
+        srand(1);
+
+        /* Like VSID: put the driver and the tune into memory and reset,
+           the KERNAL then starts the driver through the CBM80 vector.  */
+        if (psid_file != NULL) {
+            if (psid_load_file(psid_file) < 0) {
+                fprintf(stderr, "vicebench: cannot load PSID file '%s'\n", psid_file);
+                archdep_vice_exit(1);
+            }
+            psid_init_driver();
+            psid_init_tune(1);
+            machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+        }
+    }
+
+    if (!measuring) {
+        if (frame_count < bench_warmup) {
+            return;
+        }
+        measuring = 1;
+        frame_count = 0;
+        total_cycles = 0;
+        if (alarm_record_file != NULL && alarmbench_record_start(alarm_record_file) < 0) {
+            archdep_vice_exit(1);
+        }
+        profile_reset();
+        if (profile_overlay) {
+            profile_set_overlay(print_overlay);
+        }
+        if (draw_stats) {
+            drawbench_stats_start();
+        }
+        start_refreshes = video_headless_refresh_count();
+        start_render_bytes = video_canvas_render_bytes();
+        start_ns = profile_now_ns();
+        return;
+    }
+
+    /* Snapshot restores and rewinds move maincpu_clk back, count whole
+       frames instead.  */
+    total_cycles += (uint64_t)machine_get_cycles_per_frame();
+
+    if (render_check) {
+        renderbench_frame();
+    }
+    if (snapshots) {
+        snapbench_frame();
+    }
+    if (rewind_check) {
+        rewindbench_frame();
+    }
+    if (save_states) {
+        savebench_frame();
+    }
+    if (turbo_tape) {
+        turbotapebench_frame(bench_frames);
+    }
+    if (sprite_check) {
+        spritebench_frame();
+    }
+    if (draw_check) {
+        drawbench_frame();
+    }
+    if (reu_check) {
+        reubench_frame();
+    }
+    if (autostart_file != NULL) {
+        autostartbench_frame(autostart_file);
+    }
+    if (mem_crc) {
+        mem_crc_frame();
+    }
+
+    if (frame_count >= bench_frames) {
+        uint64_t elapsed_ns = profile_now_ns() - start_ns;
+
+        alarmbench_record_stop();
+        profile_set_overlay(NULL);
+        report(elapsed_ns);
+        if (profile_csv_file != NULL) {
+            if (profile_dump_csv(profile_csv_file) < 0) {
+                fprintf(stderr, "vicebench: cannot write '%s'\n", profile_csv_file);
+                fflush(stdout);
+                archdep_vice_exit(1);
+            }
+            printf("profile csv:    %u frames written to %s\n",
+                   profile_frames(), profile_csv_file);
+        }
+        if (draw_stats) {
+            drawbench_stats_report();
+        }
+        if (render_check && renderbench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (snapshots && snapbench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (rewind_check && rewindbench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (save_states && savebench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (turbo_tape && turbotapebench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (sprite_check && spritebench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (draw_check && drawbench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (reu_check && reubench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        if (autostart_file != NULL && autostartbench_report() > 0) {
+            fflush(stdout);
+            archdep_vice_exit(1);
+        }
+        fflush(stdout);
+        archdep_vice_exit(0);
+    }
+}
+
+static int parse_count(const char *option, const char *value, int *result)
+{
+    char *end;
+    long n;
+
+    if (value == NULL) {
+        fprintf(stderr, "vicebench: option %s needs an argument\n", option);
+        return -1;
+    }
+    n = strtol(value, &end, 10);
+    if (*end != '\0' || n < 0 || n > 10000000) {
+        fprintf(stderr, "vicebench: invalid value '%s' for %s\n", value, option);
+        return -1;
+    }
+    *result = (int)n;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    char **vice_argv;
+    int vice_argc = 0;
+    int i;
+    size_t j;
+
+    vice_argv = lib_malloc((argc + sizeof(forced_args) / sizeof(forced_args[0]) + 1) * sizeof(char *));
+    vice_argv[vice_argc++] = argv[0];
+    for (j = 0; j < sizeof(forced_args) / sizeof(forced_args[0]); j++) {
+        vice_argv[vice_argc++] = forced_args[j];
+    }
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-frames")) {
+            if (parse_count(argv[i], argv[i + 1], &bench_frames) < 0) {
+                return 1;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "-warmup")) {
+            if (parse_count(argv[i], argv[i + 1], &bench_warmup) < 0) {
+                return 1;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "-passes")) {
+            if (parse_count(argv[i], argv[i + 1], &bench_passes) < 0) {
+                return 1;
+            }
+            i++;
+        } else if (!strcmp(argv[i], "-alarmtrace-record") && i + 1 < argc) {
+            alarm_record_file = argv[++i];
+        } else if (!strcmp(argv[i], "-alarmtrace") && i + 1 < argc) {
+            alarm_replay_file = argv[++i];
+        } else if (!strcmp(argv[i], "-residcheck")) {
+            resid_check = 1;
+        } else if (!strcmp(argv[i], "-gcrbench") && i + 1 < argc) {
+            gcr_bench_file = argv[++i];
+        } else if (!strcmp(argv[i], "-imagebench") && i + 1 < argc) {
+            image_bench_file = argv[++i];
+        } else if (!strcmp(argv[i], "-archivebench") && i + 1 < argc) {
+            archive_bench_file = argv[++i];
+        } else if (!strcmp(argv[i], "-tapebench") && i + 1 < argc) {
+            tape_bench_file = argv[++i];
+        } else if (!strcmp(argv[i], "-rendercheck")) {
+            render_check = 1;
+        } else if (!strcmp(argv[i], "-present")) {
+            present = VIDEO_HEADLESS_PRESENT_SYNC;
+        } else if (!strcmp(argv[i], "-presentthread")) {
+            present = VIDEO_HEADLESS_PRESENT_THREAD;
+        } else if (!strcmp(argv[i], "-snapshots")) {
+            snapshots = 1;
+        } else if (!strcmp(argv[i], "-rewindcheck")) {
+            rewind_check = 1;
+        } else if (!strcmp(argv[i], "-savestates")) {
+            save_states = 1;
+        } else if (!strcmp(argv[i], "-turbotapecheck") && i + 1 < argc) {
+            if (turbotapebench_add(argv[++i]) < 0) {
+                fprintf(stderr, "vicebench: too many tapes for -turbotapecheck\n");
+                return 1;
+            }
+            turbo_tape = 1;
+        } else if (!strcmp(argv[i], "-spritecheck")) {
+            sprite_check = 1;
+        } else if (!strcmp(argv[i], "-drawstats")) {
+            draw_stats = 1;
+        } else if (!strcmp(argv[i], "-drawcheck")) {
+            draw_check = 1;
+        } else if (!strcmp(argv[i], "-memcrc")) {
+            mem_crc = 1;
+        } else if (!strcmp(argv[i], "-reucheck")) {
+            reu_check = 1;
+        } else if (!strcmp(argv[i], "-autostartcheck") && i + 1 < argc) {
+            autostart_file = argv[++i];
+        } else if (!strcmp(argv[i], "-profilecsv") && i + 1 < argc) {
+            profile_csv_file = argv[++i];
+        } else if (!strcmp(argv[i], "-profileoverlay")) {
+            profile_overlay = 1;
+        } else if (!strcmp(argv[i], "-psid") && i + 1 < argc) {
+            psid_file = argv[++i];
+        } else {
+            vice_argv[vice_argc++] = argv[i];
+        }
+    }
+    vice_argv[vice_argc] = NULL;
+
+    if (bench_frames < 1) {
+        bench_frames = 1;
+    }
+
+    if (alarm_replay_file != NULL) {
+        lib_free(vice_argv);
+        return alarmbench_replay(alarm_replay_file, bench_passes < 1 ? 1 : bench_passes) ? 1 : 0;
+    }
+
+    if (resid_check) {
+        lib_free(vice_argv);
+        return residbench_run(bench_passes < 1 ? 1 : bench_passes) > 0 ? 1 : 0;
+    }
+
+    if (gcr_bench_file != NULL) {
+        lib_free(vice_argv);
+        return gcrbench_run(gcr_bench_file, bench_passes < 1 ? 1 : bench_passes) ? 1 : 0;
+    }
+
+    if (image_bench_file != NULL) {
+        lib_free(vice_argv);
+        return imagebench_run(image_bench_file, bench_passes < 1 ? 1 : bench_passes) ? 1 : 0;
+    }
+
+    if (archive_bench_file != NULL) {
+        lib_free(vice_argv);
+        return archivebench_run(archive_bench_file, bench_passes < 1 ? 1 : bench_passes) ? 1 : 0;
+    }
+
+    if (tape_bench_file != NULL) {
+        lib_free(vice_argv);
+        return tapebench_run(tape_bench_file, bench_passes < 1 ? 1 : bench_passes) ? 1 : 0;
+    }
+
+    video_headless_set_present(present);
+
+    return main_program(vice_argc, vice_argv) < 0 ? 1 : 0;
+}
+
+void main_exit(void)
+{
+    /* This function will be called at program exit */
+    machine_shutdown();
+}
@@ -0,0 +1,376 @@
+/*
+ * video_headless.c - Null implementation of the video interface.
+ *
+ * Based on the PSVITA port by
+ *  Amnon-Dan Meir <ammeir71@yahoo.com>
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * The raster code draws into its own 8 bit indexed draw buffer exactly
+ * like on the Vita, where the View consumes that buffer directly.  Nothing
+ * is presented here, so a benchmark run measures the emulation alone.
+ *
+ * With video_headless_set_present() the refreshed lines are converted into
+ * a 32 bit host frame buffer instead, the way a port with an RGB surface
+ * would do it, so the cost of that conversion can be measured too.  In
+ * VIDEO_HEADLESS_PRESENT_THREAD mode the refresh only publishes the frame
+ * and a presenter thread does the conversion, see video-present.c.
+ */
+
+#include "vice.h"
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <string.h>
+
+#include "video.h"
+#include "videoarch.h"
+#include "palette.h"
+#include "lib.h"
+#include "cmdline.h"
+#include "profile.h"
+#include "resources.h"
+#include "uiapi.h"
+#include "ui.h"
+#include "video-present.h"
+#include "viewport.h"
+#include "vsyncapi.h"
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+
+static video_canvas_t *active_canvas = NULL;
+
+static int present_enabled = 0;
+static unsigned long refresh_count = 0;
+static uint8_t *host_buffer = NULL;
+static unsigned int host_width = 0;
+static unsigned int host_height = 0;
+
+/* presenter thread, and the area it converts */
+static video_present_t *present = NULL;
+static pthread_t present_thread;
+static sem_t present_sem;
+static int present_quit = 0;
+static uint8_t *present_map = NULL;
+static unsigned int present_xs, present_ys, present_xt, present_yt;
+static unsigned int present_w, present_h;
+static video_present_stats_t present_totals;
+
+static const cmdline_option_t cmdline_options[] = {
+    CMDLINE_LIST_END
+};
+
+static const resource_int_t resources_int[] = {
+    RESOURCE_INT_LIST_END
+};
+
+void video_canvas_resize(struct video_canvas_s *canvas, char resize_canvas)
+{
+    unsigned int width, height;
+
+    if (!(canvas && canvas->draw_buffer && canvas->videoconfig)) {
+        return;
+    }
+
+    width = canvas->draw_buffer->canvas_width;
+    height = canvas->draw_buffer->canvas_height;
+
+    /* Ignore bad values, or values that don't change anything */
+    if (width == 0 || height == 0 || (canvas->width && height == canvas->height)) {
+        return;
+    }
+
+    canvas->width = canvas->actual_width = width;
+    canvas->height = canvas->actual_height = height;
+
+    if (!canvas->videoconfig->color_tables.updated) {
+        /* update colors as necessary */
+        video_color_update_palette(canvas);
+    }
+}
+
+video_canvas_t *video_canvas_create(video_canvas_t *canvas, unsigned int *width, unsigned int *height, int mapped)
+{
+    canvas->depth = 8;
+    canvas->width = canvas->actual_width = *width;
+    canvas->height = canvas->actual_height = *height;
+    active_canvas = canvas;
+
+    return canvas;
+}
+
+void video_canvas_destroy(struct video_canvas_s *canvas)
+{
+    if (canvas == active_canvas) {
+        active_canvas = NULL;
+    }
+}
+
+void video_arch_canvas_init(struct video_canvas_s *canvas)
+{
+    unsigned int i;
+
+    /* Let the raster code allocate its default draw buffer. */
+    canvas->video_draw_buffer_callback = NULL;
+
+    /* 32 bit ARGB for the host frame buffer */
+    for (i = 0; i < 256; i++) {
+        video_render_setrawrgb(i, i << 16, i << 8, i);
+    }
+    video_render_setrawalpha(0xff000000);
+}
+
+int video_canvas_set_palette(struct video_canvas_s *canvas, struct palette_s *palette)
+{
+    unsigned int i;
+
+    if (palette == NULL) {
+        return 0;
+    }
+
+    canvas->palette = palette;
+
+    for (i = 0; i < palette->num_entries; i++) {
+        video_render_setphysicalcolor(canvas->videoconfig, i,
+                                      0xff000000
+                                      | (palette->entries[i].red << 16)
+                                      | (palette->entries[i].green << 8)
+                                      | palette->entries[i].blue, 32);
+    }
+
+    return 0;
+}
+
+static void *present_main(void *arg)
+{
+    video_canvas_t *canvas = arg;
+    video_present_frame_t *frame;
+    unsigned int scalex = canvas->videoconfig->scalex;
+    unsigned int scaley = canvas->videoconfig->scaley;
+    int quit;
+
+    do {
+        sem_wait(&present_sem);
+        quit = __atomic_load_n(&present_quit, __ATOMIC_ACQUIRE);
+
+        frame = video_present_acquire(present);
+        if (frame == NULL) {
+            continue;
+        }
+
+        __atomic_add_fetch(&refresh_count, 1, __ATOMIC_RELAXED);
+        video_canvas_render_frame(canvas, frame->pixels,
+                                  video_present_changed_lines(present, frame, present_map) < 0
+                                  ? NULL : present_map,
+                                  host_buffer, present_w * scalex, present_h * scaley,
+                                  present_xs, present_ys,
+                                  present_xt * scalex, present_yt * scaley,
+                                  host_width * 4, 32);
+        video_present_done(present, frame, vsyncarch_gettime());
+    } while (!quit);
+
+    return NULL;
+}
+
+static void present_start(video_canvas_t *canvas)
+{
+    viewport_t *viewport = canvas->viewport;
+    geometry_t *geometry = canvas->geometry;
+    draw_buffer_t *draw_buffer = canvas->draw_buffer;
+
+    /* the area video_canvas_refresh_all() covers */
+    present_xs = viewport->first_x + geometry->extra_offscreen_border_left;
+    present_ys = viewport->first_line;
+    present_xt = viewport->x_offset;
+    present_yt = viewport->y_offset;
+    present_w = MIN(draw_buffer->canvas_width, geometry->screen_size.width - viewport->first_x);
+    present_h = MIN(draw_buffer->canvas_height, viewport->last_line - viewport->first_line + 1);
+
+    present = video_present_new(NULL, draw_buffer->draw_buffer_width,
+                                draw_buffer->draw_buffer_height);
+    present_map = lib_malloc(draw_buffer->draw_buffer_height);
+    present_quit = 0;
+    sem_init(&present_sem, 0, 0);
+    pthread_create(&present_thread, NULL, present_main, canvas);
+}
+
+/* Let the presenter convert what was published last and wait for it.  */
+static void present_stop(void)
+{
+    if (present == NULL) {
+        return;
+    }
+
+    __atomic_store_n(&present_quit, 1, __ATOMIC_RELEASE);
+    sem_post(&present_sem);
+    pthread_join(present_thread, NULL);
+    sem_destroy(&present_sem);
+
+    video_present_get_totals(&present_totals);
+    video_present_destroy(present);
+    present = NULL;
+    lib_free(present_map);
+    present_map = NULL;
+}
+
+static void canvas_refresh(struct video_canvas_s *canvas,
+                           unsigned int xs, unsigned int ys,
+                           unsigned int xi, unsigned int yi,
+                           unsigned int w, unsigned int h)
+{
+    unsigned int scalex, scaley, width, height;
+
+    if (!present_enabled || canvas->draw_buffer == NULL) {
+        refresh_count++;
+        return;
+    }
+
+    scalex = canvas->videoconfig->scalex;
+    scaley = canvas->videoconfig->scaley;
+    width = canvas->draw_buffer->canvas_width * scalex;
+    height = canvas->draw_buffer->canvas_height * scaley;
+
+    if (width != host_width || height != host_height) {
+        present_stop();
+        lib_free(host_buffer);
+        host_buffer = lib_calloc(width * height, 4);
+        host_width = width;
+        host_height = height;
+        /* a new surface has to be filled completely */
+        canvas->draw_buffer->dirty_lines = NULL;
+        video_canvas_refresh_all(canvas);
+        return;
+    }
+
+    if (present_enabled == VIDEO_HEADLESS_PRESENT_THREAD) {
+        if (present == NULL) {
+            present_start(canvas);
+        }
+        video_present_publish(present, canvas->draw_buffer->draw_buffer,
+                              canvas->draw_buffer->dirty_lines, ys, h,
+                              vsyncarch_gettime());
+        sem_post(&present_sem);
+        return;
+    }
+
+    refresh_count++;
+    video_canvas_render_dirty(canvas, host_buffer, w * scalex, h * scaley,
+                              xs, ys, xi * scalex, yi * scaley,
+                              host_width * 4, 32);
+}
+
+void video_canvas_refresh(struct video_canvas_s *canvas,
+                          unsigned int xs, unsigned int ys,
+                          unsigned int xi, unsigned int yi,
+                          unsigned int w, unsigned int h)
+{
+    PROFILE_ENTER(PROFILE_PRESENT);
+    canvas_refresh(canvas, xs, ys, xi, yi, w, h);
+    PROFILE_LEAVE();
+}
+
+char video_canvas_can_resize(struct video_canvas_s *canvas)
+{
+    return 1;
+}
+
+int video_init(void)
+{
+    return 0;
+}
+
+void video_shutdown(void)
+{
+    present_stop();
+}
+
+int video_arch_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
+
+int video_arch_resources_init(void)
+{
+    return resources_register_int(resources_int);
+}
+
+void video_arch_resources_shutdown(void)
+{
+}
+
+struct video_canvas_s *video_headless_get_canvas(void)
+{
+    return active_canvas;
+}
+
+void video_headless_set_present(int enable)
+{
+    present_enabled = enable;
+}
+
+unsigned long video_headless_refresh_count(void)
+{
+    return __atomic_load_n(&refresh_count, __ATOMIC_RELAXED);
+}
+
+/* Wait for the presenter thread to convert the last frame and stop it.  */
+void video_headless_present_flush(video_present_stats_t *stats)
+{
+    present_stop();
+    *stats = present_totals;
+}
+
+/* Convert the whole visible frame again and count the pixels that differ
+   from what the refreshes left in the host frame buffer.  This stops the
+   presenter thread.  */
+unsigned long video_headless_present_check(void)
+{
+    video_canvas_t *canvas = active_canvas;
+    uint8_t *saved;
+    unsigned long diff = 0;
+    size_t i, size = (size_t)host_width * host_height;
+
+    present_stop();
+
+    if (canvas == NULL || host_buffer == NULL) {
+        return 0;
+    }
+
+    present_enabled = VIDEO_HEADLESS_PRESENT_SYNC;
+    saved = host_buffer;
+    host_buffer = lib_calloc(size, 4);
+    video_canvas_refresh_all(canvas);
+
+    for (i = 0; i < size; i++) {
+        if (((uint32_t *)saved)[i] != ((uint32_t *)host_buffer)[i]) {
+            diff++;
+        }
+    }
+
+    lib_free(host_buffer);
+    host_buffer = saved;
+
+    return diff;
+}
@@ -62,9 +62,14 @@ extern "C" {
 #include "mousedrv.h"
 #include "raster.h"
 #include "snapshot.h"
+#include "snapshot-writer.h"
 #include "kbdbuf.h"
 #include "maincpu.h"
 #include "t64.h"
+#ifdef USE_PRESENT_THREAD
+#include "video-present.h"
+#include "vsyncapi.h"
+#endif
 }
 
 #include <cstring>
@@ -75,9 +80,70 @@ extern "C" {
 
 static View* gs_view;
 
+#ifdef USE_PRESENT_THREAD
+// Frames the emulation finished are published here and shown by a presenter
+// thread, so the emulation does not wait for vita2d and the vblank.
+static video_present_t*	gs_present = NULL;
+static bool				gs_presentStarted = false;
+static bool				gs_presentPending = false;
+static pthread_mutex_t	gs_presentLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	gs_presentCond = PTHREAD_COND_INITIALIZER;
+
+static void* presentThread(void* arg)
+{
+	for (;;){
+		pthread_mutex_lock(&gs_presentLock);
+		while (!gs_presentPending)
+			pthread_cond_wait(&gs_presentCond, &gs_presentLock);
+		gs_presentPending = false;
+		pthread_mutex_unlock(&gs_presentLock);
+
+		// The view's draw lock also keeps PSV_CreateView() from replacing
+		// the present textures under us.
+		gs_view->lockDraw();
+		video_present_frame_t* frame = gs_present? video_present_acquire(gs_present): NULL;
+		if (frame){
+			gs_view->presentFrame(frame->pixels);
+			video_present_done(gs_present, frame, vsyncarch_gettime());
+		}
+		gs_view->unlockDraw();
+	}
+
+	return NULL;
+}
+#endif
+
 extern "C" int PSV_CreateView(int width, int height, int depth)
 {
+#ifdef USE_PRESENT_THREAD
+	gs_view->lockDraw();
+
+	int ret = gs_view->createView(width, height, depth);
+
+	if (gs_present){
+		video_present_destroy(gs_present);
+		gs_present = NULL;
+	}
+
+	if (depth == 8){
+		unsigned char* buffers[VIDEO_PRESENT_BUFFERS];
+		gs_view->getPresentBuffers(buffers);
+		gs_present = video_present_new(buffers, width, height);
+	}
+
+	gs_view->unlockDraw();
+
+	if (!gs_presentStarted){
+		pthread_t thread;
+		pthread_create(&thread, NULL, presentThread, NULL);
+		pthread_detach(thread);
+		gs_presentStarted = true;
+	}
+
+	return ret;
+#else
 	return gs_view->createView(width, height, depth);
+#endif
 }
 
 extern "C" void PSV_UpdateView()
@@ -87,6 +153,44 @@ extern "C" void PSV_UpdateView()
 	gs_frameDrawn = true;
 }
 
+extern "C" void PSV_UpdateViewArea(int x, int y, int width, int height)
+{
+	// Skip the redraw when VICE only changed parts of the frame that are not on screen,
+	// e.g. the border in borderless mode.
+	if (!gs_view->isAreaShown(x, y, width, height))
+		return;
+
+	PSV_UpdateView();
+}
+
+#ifdef USE_PRESENT_THREAD
+extern "C" void PSV_PublishViewArea(const struct video_dirty_span_s* dirty, int x, int y, int width, int height)
+{
+	if (!gs_present){
+		PSV_UpdateViewArea(x, y, width, height);
+		return;
+	}
+
+	// Always publish, so the lines are copied to every buffer the presenter
+	// may show later, e.g. once the viewport or the keyboard changes.
+	unsigned char* pixels;
+	gs_view->getViewInfo(NULL, NULL, &pixels, NULL, NULL);
+	video_present_publish(gs_present, pixels, dirty, y, height, vsyncarch_gettime());
+
+	// Only wake the presenter when something on screen changed.
+	if (!gs_view->isAreaShown(x, y, width, height))
+		return;
+
+	pthread_mutex_lock(&gs_presentLock);
+	gs_presentPending = true;
+	pthread_cond_signal(&gs_presentCond);
+	pthread_mutex_unlock(&gs_presentLock);
+
+	// The presenter draws the frame, don't redraw it in PSV_ScanControls().
+	gs_frameDrawn = true;
+}
+#endif
+
 extern "C" void PSV_SetViewport(int x, int y, int width, int height)
 {
 	// Make sure we stay borderless when e.g. changing video standard.
@@ -272,6 +376,11 @@ extern "C" void PSV_NotifyFPS(int fps, float percent, int warp_flag)
 	gs_view->setFPSCount(fps, (int)percent, warp_flag);
 }
 
+extern "C" void PSV_NotifyProfile(const char* text)
+{
+	gs_view->setProfileText(text);
+}
+
 extern "C" void	PSV_NotifyTapeCounter(int counter)
 {
 	gs_view->setTapeCounter(counter);
@@ -556,7 +665,51 @@ int Controller::loadState(const char* file)
 	return ret;
 }
 
-int Controller::saveState(const char* file_name)
+static int addPatchModules(snapshot_memory_t* mem, const patch_data_s* patches, int num_patches)
+{
+	// Our own modules go after the ones Vice wrote. Vice skips modules it doesn't know.
+	// Format: data size (dword) followed by the data (byte array).
+
+	snapshot_t* s = snapshot_memory_append_modules(mem);
+	int ret = 0;
+
+	for (int i = 0; i < num_patches && ret == 0; i++){
+		const patch_data_s* patch = &patches[i];
+		snapshot_module_t* m = snapshot_module_create(s, patch->module_name, patch->major, patch->minor);
+
+		if (!m){
+			ret = -1;
+			break;
+		}
+
+		if (SMW_DW(m, patch->data_size) < 0
+			|| SMW_BA(m, (uint8_t*)patch->data, patch->data_size) < 0)
+			ret = -1;
+
+		if (snapshot_module_close(m) < 0)
+			ret = -1;
+	}
+
+	snapshot_close(s);
+	return ret;
+}
+
+static int writeSnapshot(const char* file_name, const patch_data_s* patches, int num_patches)
+{
+	// The snapshot and our modules are taken into memory in one go. The snapshot writer
+	// compresses it and writes the file on its own thread, loading takes both formats.
+	snapshot_memory_t* mem = snapshot_memory_new();
+
+	if (machine_write_snapshot_memory(mem, NULL) < 0
+		|| addPatchModules(mem, patches, num_patches) < 0){
+		snapshot_memory_destroy(mem);
+		return -1;
+	}
+
+	return snapshot_writer_save(mem, file_name, 1);
+}
+
+int Controller::saveState(const char* file_name, const patch_data_s* patches, int num_patches)
 {
 	// Saving a state when a tap file is attached to the datasette can be problematic.
 	// The snapshot sometimes "remembers" the tape and won't start without it.
@@ -584,70 +737,20 @@ int Controller::saveState(const char* file_name)
 		goto case_exception; // Disk or cartridge
 
 case_normal:
-	return machine_write_snapshot(file_name, 0, 0, 0);
+	return writeSnapshot(file_name, patches, num_patches);
 
 case_exception:
 	tape_image_detach(1);
-	int ret = machine_write_snapshot(file_name, 0, 0, 0);
+	int ret = writeSnapshot(file_name, patches, num_patches);
 	tape_image_attach(1, attached_image_file.c_str());
 	return ret;
 }
 
-int Controller::patchSaveState(patch_data_s* patch)
+int Controller::waitSaveState()
 {
-	if (!patch || !patch->snapshot_file || !patch->data)
-		return -1;
-	
-	FILE *fp;
-
-	if (!(fp = fopen(patch->snapshot_file, "a+"))){
-		return -1;
-	}
-
-	// We can't add a module to a snapshot without changing code in Vice.
-	// Workaround is to append a byte chunk to the snapshot file that is in right format.
-	// Vice will happily accept it.
-	
-	// Vice snapshot module format:
-	// Header:                 
-	// Name (16 bytes)        
-	// Major version (1 byte) 
-	// Minor version (1 byte1)	  
-	// Size of module (4 bytes)   
-	// Data: (Any number of fields. We use two, dword and byte array)
-	// Data size (4 bytes)		 
-	// Data  (n bytes)           
-
-	int module_size = 16 + 1 + 1 + 4 + 4 + patch->data_size;
-	char* buf = new char[module_size];
-
-	char name[16] = {0};
-
-	if (patch->module_name)
-		strncpy(name, patch->module_name, 16);
-
-	// Header
-	memcpy(buf, name, 16);
-	buf[16] = patch->major;
-	buf[17] = patch->minor;
-	buf[18] = module_size;
-	buf[19] = module_size >> 8;
-	buf[20] = module_size >> 16;
-	buf[21] = module_size >> 24;
-	// Data
-	buf[22] = patch->data_size;
-	buf[23] = patch->data_size >> 8;
-	buf[24] = patch->data_size >> 16;
-	buf[25] = patch->data_size >> 24;
-	memcpy(&buf[26], patch->data, patch->data_size);
-	
-	if (fwrite(buf, 1, module_size, fp) < 1) {
-		fclose(fp);
-        return -1;
-    }
-
-	fclose(fp);
-	return 0;
+	// saveState() only queues the snapshot. This waits for the writer and tells
+	// whether the last one made it into its file.
+	return snapshot_writer_wait_last();
 }
 
 int	Controller::getSaveStatePatch(patch_data_s* pinfo)
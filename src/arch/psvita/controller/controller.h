@@ -28,6 +28,11 @@
 // for gcc
 void		PSV_CreateView(int width, int height, int depth);
 void		PSV_UpdateView();
+void		PSV_UpdateViewArea(int x, int y, int width, int height);
+#ifdef USE_PRESENT_THREAD
+struct video_dirty_span_s;
+void		PSV_PublishViewArea(const struct video_dirty_span_s* dirty, int x, int y, int width, int height);
+#endif
 void		PSV_SetViewport(int x, int y, int width, int height);
 void		PSV_GetViewInfo(int* width, int* height, unsigned char** ppixels, int* pitch, int* bpp);
 void		PSV_ScanControls();
@@ -36,6 +41,7 @@ void		PSV_ActivateMenu();
 int			PSV_RGBToPixel(uint8_t r, uint8_t g, uint8_t b);
 void		PSV_NotifyPalette(unsigned char* palette, int size);
 void		PSV_NotifyFPS(int fps, float percent, int warp_flag);
+void		PSV_NotifyProfile(const char* text);
 void		PSV_NotifyTapeCounter(int count);
 void		PSV_NotifyTapeControl(int control);
 void		PSV_NotifyDriveStatus(int drive, int led);
@@ -132,8 +138,8 @@ public:
 	void			resetComputer();
 	int				loadFile(int load_type, const char* file_path, int index = 0);
 	int				loadState(const char* file);
-	int				saveState(const char* file_name);
-	int				patchSaveState(patch_data_s* patch);
+	int				saveState(const char* file_name, const patch_data_s* patches = NULL, int num_patches = 0);
+	int				waitSaveState();
 	int				getSaveStatePatch(patch_data_s* patch_info);
 	int				getSaveStatePatchInfo(patch_data_s* patch_info);
 	int				getViewport(ViewPort* vp, bool borders);
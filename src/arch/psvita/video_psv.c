@@ -40,6 +40,7 @@
 #include "resources.h"
 #include "controller.h"
 #include "debug_psv.h"
+#include "profile.h"
 #include <string.h>
 
 
@@ -198,7 +199,18 @@ void video_canvas_refresh(struct video_canvas_s *canvas,
                           unsigned int xi, unsigned int yi,
                           unsigned int w, unsigned int h)
 {
-	PSV_UpdateView();
+	// The draw buffer is the 8 bit view texture itself, so there is nothing to
+	// convert or upload. xs, ys, w and h bound the lines the raster changed;
+	// the present is skipped when none of them is on screen.
+	PROFILE_ENTER(PROFILE_PRESENT);
+#ifdef USE_PRESENT_THREAD
+	// With the presenter thread the changed lines are copied into the next
+	// present texture and the thread draws it.
+	PSV_PublishViewArea(canvas->draw_buffer->dirty_lines, xs, ys, w, h);
+#else
+	PSV_UpdateViewArea(xs, ys, w, h);
+#endif
+	PROFILE_LEAVE();
 }
 
 int video_init()
@@ -260,6 +272,11 @@ void video_psv_ui_init_finalize(void)
 {
 	video_canvas_resize(active_canvas, 1);
 	PSV_ApplySettings();
+
+#ifdef VICE_PROFILE
+	// Show where the host time of a frame goes above the statusbar.
+	profile_set_overlay(PSV_NotifyProfile);
+#endif
 }
 
 static void show_menu_trap(uint16_t unused_addr, void *data)
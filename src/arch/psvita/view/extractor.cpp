@@ -28,6 +28,11 @@
 #include <cstring>
 #include <algorithm> // std::find
 
+extern "C" {
+#include "lib.h"
+#include "zfile.h"
+}
+
 
 Extractor::Extractor()
 {
@@ -105,7 +110,8 @@ const char* Extractor::extract(const char* archive_file, int drive)
 					goto error;
 				}
 
-				file_buffer = new char[file_size];
+				// Allocated with lib_malloc() so it can be handed over to zfile.
+				file_buffer = (char*)lib_malloc(file_size);
 				
 				// We read the file in one go.
 				// Perhaps this should be read in a loop with smaller buffer size.
@@ -121,26 +127,37 @@ const char* Extractor::extract(const char* archive_file, int drive)
 
 				tmp_files.push_back(image_save_path);
 
-				// Create image file from the buffer data.
-				FILE* fd = fopen(image_save_path.c_str(), "w");
-				if (!fd){
-					goto error;
-				}
+				// Disk, tape and cartridge images are kept in memory under this name. 
+				// VICE opens them through zfile, which looks there first.
+				// Programs are loaded from the host file system, so they still go to a file.
+				if (image_type != IMAGE_PROGRAM && 
+					zfile_memory_add(image_save_path.c_str(), (uint8_t*)file_buffer, file_size) == 0){
+					// zfile owns the buffer now.
+					file_buffer = NULL;
+				}else{
+					// Create image file from the buffer data.
+					FILE* fd = fopen(image_save_path.c_str(), "w");
+					if (!fd){
+						goto error;
+					}
+				
+					if (fwrite(file_buffer, 1, file_size, fd) < file_size){
+						fclose(fd);
+						goto error;
+					}
 				
-				if (fwrite(file_buffer, 1, file_size, fd) < file_size){
 					fclose(fd);
-					goto error;
 				}
-				
-				fclose(fd);
 			
 				// Close archived file for reading.
 				if(unzCloseCurrentFile(zipfile) != UNZ_OK){
 					goto error;
 				}
 
-				delete[] file_buffer;
-				file_buffer = NULL;
+				if (file_buffer){
+					lib_free(file_buffer);
+					file_buffer = NULL;
+				}
 			}
 	
 			// Go to the next file in the archive
@@ -185,7 +202,7 @@ error:
 		unzClose(zipfile);
 
 	if (file_buffer)
-		delete[] file_buffer;
+		lib_free(file_buffer);
 
 	// All or nothing approach used here. Function fails on single error.
 	// Delete the files that succeeded to extract.
@@ -306,6 +323,8 @@ void Extractor::deleteTrackedFiles(vector<string>& old_files, vector<string>* ne
 				continue;
 		}
 
-		FileExplorer::getInst()->deleteFile((*it).c_str());
+		// The file is either in memory or on the memory card.
+		if (zfile_memory_remove((*it).c_str()) < 0)
+			FileExplorer::getInst()->deleteFile((*it).c_str());
 	}
 }
\ No newline at end of file
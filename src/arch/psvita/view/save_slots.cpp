@@ -43,6 +43,16 @@
 #define THUMBNAIL_HEIGHT 200
 
 
+static void setPatch(patch_data_s* patch, const char* module_name, const string &data)
+{
+	patch->snapshot_file = NULL;
+	patch->module_name = module_name;
+	patch->major = 1;
+	patch->minor = 1;
+	patch->data = data.data();
+	patch->data_size = data.size();
+}
+
 SaveSlots::SaveSlots()
 {
 	for (int i=0; i<2; ++i){
@@ -182,13 +192,15 @@ void SaveSlots::buttonReleased(int button)
 			if (g_game_file.empty())
 				return;
 
-			// Ask user confirmation if this is overwrite
+			// Ask user confirmation if this is overwrite.
+			// The old save is only deleted once the new one is written.
+			string old_file;
 			if (isSlotOccupied(m_highlightSlot)){
 				if (!confirmUser("Overwrite existing save?")){
 					show();
 					return;
 				}
-				emptySaveSlot(m_highlightSlot);
+				old_file = getfilePath(m_highlightSlot);
 			}
 
 			char buf[64];
@@ -210,14 +222,26 @@ void SaveSlots::buttonReleased(int button)
 
 			gtShowMsgBoxNoBtn("Saving...", this);
 			
-			// Save snaphot and patch it with thumbnail and settings.
-			if (m_controller->saveState(snap_file.c_str()) < 0){
+			// Save snaphot together with thumbnail and settings modules.
+			// The file is written in the background, waitSaveState() waits for it.
+			string thumb;
+			string settings = getSettingsString();
+			patch_data_s patches[2];
+			int num_patches = 0;
+
+			if (getThumbnailPng(thumb) == 0)
+				setPatch(&patches[num_patches++], SNAP_MOD_THUMB, thumb);
+			setPatch(&patches[num_patches++], SNAP_MOD_SETTINGS, settings);
+
+			if (m_controller->saveState(snap_file.c_str(), patches, num_patches) < 0
+				|| m_controller->waitSaveState() < 0){
 				gtShowMsgBoxOk("Save failed");
 				show();
 				break;
 			}
-			addThumbToSnap(snap_file.c_str());
-			addSettingsToSnap(snap_file.c_str());
+			// A save in the same second has replaced the old file already.
+			if (!old_file.empty())
+				emptySaveSlot(m_highlightSlot, old_file != snap_file);
 			populateGrid();
 			setState();
 			show();
@@ -269,49 +293,26 @@ string SaveSlots::getSnapshotFromDirContent(vector<DirEntry> &dir, int save_slot
 	// Subtract by 48 to get the integer number. E.g. char '1' is ascii 49, char '2' is 50...
 	string ret;
 	for (vector<DirEntry>::iterator it = dir.begin(); it != dir.end(); ++it){
-		if ((*it).isFile && save_slot == ((*it).name[1] - 48) && (*it).name[0] == 's')
+		// Skip what the snapshot writer has not finished yet (<file>.tmp).
+		if ((*it).isFile && save_slot == ((*it).name[1] - 48) && (*it).name[0] == 's'
+			&& (*it).name.find('.') == string::npos)
 			ret = (*it).path;
 	}	
 
 	return ret;
 }
 
-int SaveSlots::addThumbToSnap(const char* snap_file)
+int SaveSlots::getThumbnailPng(string &png)
 {
-	// Creates a png thumbnail image and patches it to the snapshot file.
-	
-	// TODO: Find a way how to create the png image straight to memory buffer.
-	// Currently the png is written to a file and then read to buffer.
+	// Creates a png thumbnail image straight to memory for the snapshot module.
 
-	if (!snap_file)
-		return -1;
-		
-	int ret = 0;
-	string thumb_file = m_path + "tmp_thumb";
-
-	if (saveViewToThumbnail(thumb_file.c_str()) < 0){
+	unsigned char* thumb = m_view->getThumbnail();
+	if (!thumb){
 		return -1;
 	}
 
-	long file_size = 0;
-	char* file_buf = readFileToBuf(thumb_file.c_str(), &file_size);
-
-	if (file_buf && file_size > 0){
-		patch_data_s patch;
-		patch.snapshot_file = snap_file;
-		patch.module_name = SNAP_MOD_THUMB;
-		patch.major = 1;
-		patch.minor = 1;
-		patch.data = file_buf;
-		patch.data_size = file_size;
-		if (m_controller->patchSaveState(&patch) < 0)
-			ret = -1;
-	}
-	
-	if (file_buf)
-		delete[] file_buf;
-
-	FileExplorer::getInst()->deleteFile(thumb_file.c_str());
+	int ret = encodePng(thumb, THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT, png);
+	delete[] thumb;
 
 	return ret;
 }
@@ -353,15 +354,11 @@ int	SaveSlots::getSettingsFromSnap(const char* file, char** data)
 	return 0;
 }
 
-int	SaveSlots::addSettingsToSnap(const char* snap_file)
+string SaveSlots::getSettingsString()
 {
-	// Combine control keymaps and view settings into a patch module and patch the snap.
+	// Combine control keymaps and view settings for a patch module.
 	// Format: keymaps^value|setting1^value|...|settingn^value
 
-	if (!snap_file)
-		return -1;
-		
-	int ret = 0;
 	string settings = m_controls->toString();
 	settings.append(SNAP_MOD_DELIM_ENTRY);
 	settings.append(m_settings->toString(SETTINGS_VIEW).c_str());
@@ -369,18 +366,7 @@ int	SaveSlots::addSettingsToSnap(const char* snap_file)
 	settings.append(SNAP_MOD_DELIM_ENTRY);
 	settings.append(m_settings->toString(SETTINGS_MODEL_NOT_IN_SNAP).c_str());
 
-	patch_data_s patch;
-	patch.snapshot_file = snap_file;
-	patch.module_name = SNAP_MOD_SETTINGS;
-	patch.major = 1;
-	patch.minor = 1;
-	patch.data = settings.c_str();
-	patch.data_size = settings.size();
-	
-	if (m_controller->patchSaveState(&patch) < 0)
-		ret = -1;
-	
-	return ret;
+	return settings;
 }
 
 string SaveSlots::getTimeStampFromDirContent(vector<DirEntry> &dir, int save_slot)
@@ -390,7 +376,8 @@ string SaveSlots::getTimeStampFromDirContent(vector<DirEntry> &dir, int save_slo
 	// Timestamp is after the slot number.
 	string ret, seconds;
 	for (vector<DirEntry>::iterator it = dir.begin(); it != dir.end(); ++it){
-		if ((*it).isFile && save_slot == ((*it).name[1] - 48)){
+		if ((*it).isFile && save_slot == ((*it).name[1] - 48)
+			&& (*it).name.find('.') == string::npos){
 			seconds = (*it).name.substr(2, string::npos);
 			ret = formatTimeStamp(seconds);
 		}
@@ -428,7 +415,7 @@ bool SaveSlots::isGridEmpty()
 	return true;
 }
 
-void SaveSlots::emptySaveSlot(int slot)
+void SaveSlots::emptySaveSlot(int slot, bool delete_file)
 {
 	FileExplorer fileExp;
 
@@ -437,7 +424,8 @@ void SaveSlots::emptySaveSlot(int slot)
 			int grid_number = (j+i*3);
 			GridEntry* grid_entry = &m_grid[i][j];
 			if (grid_number == slot-1 && !grid_entry->file_path.empty()){
-				fileExp.deleteFile(grid_entry->file_path.c_str());
+				if (delete_file)
+					fileExp.deleteFile(grid_entry->file_path.c_str());
 				grid_entry->file_path.clear();
 				grid_entry->time_stamp.clear();
 				grid_entry->text = "Empty";
@@ -794,31 +782,22 @@ void SaveSlots::waitTillButtonsReleased()
 	}
 }
 
-int SaveSlots::saveViewToThumbnail(const char* fname)
+static void pngWriteToString(png_structp png_ptr, png_bytep data, png_size_t length)
 {
-	if (!fname)
-		return -1;
-
-	unsigned char* thumb = m_view->getThumbnail();
-	if (!thumb){
-		return -1;
-	}
-
-	saveAsPng(thumb, fname, THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT);
+	string* out = (string*)png_get_io_ptr(png_ptr);
+	out->append((const char*)data, length);
+}
 
-	delete[] thumb;
-	return 0;
+static void pngFlushString(png_structp png_ptr)
+{
 }
 
-int SaveSlots::saveAsPng(unsigned char *img, const char *filename, int width, int height)
+int SaveSlots::encodePng(unsigned char *img, int width, int height, string &png)
 {
-	// Saves the thumbnail as a png file.
+	// Encodes the thumbnail as png into a memory buffer.
+
+	png.clear();
 
-	FILE* fp = fopen(filename, "wb");
-	if (fp == NULL) {
-		return -1;
-	}
-	
 	png_structp pngStruct = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 	if (pngStruct == NULL) {
 		return -1;
@@ -829,31 +808,28 @@ int SaveSlots::saveAsPng(unsigned char *img, const char *filename, int width, in
 		png_destroy_write_struct(&pngStruct, NULL);
 		return -1;
 	}
+
+	png_bytep* rows = (png_bytep*)new char[height * sizeof(png_bytep)];
 	
 	if (setjmp(png_jmpbuf(pngStruct))) {    
 		png_destroy_write_struct(&pngStruct, &pngInfo);
-		fclose(fp);
+		delete[] rows;
 		return -1;
 	}
 	
-	png_init_io(pngStruct, fp);
+	png_set_write_fn(pngStruct, &png, pngWriteToString, pngFlushString);
 	png_set_IHDR(pngStruct, pngInfo, width, height, 8, 
 					PNG_COLOR_TYPE_RGB,
 					PNG_INTERLACE_NONE, 
 					PNG_COMPRESSION_TYPE_DEFAULT, 
 					PNG_FILTER_TYPE_DEFAULT);
+	// Quick is what counts here, the writer compresses the whole snapshot again.
+	png_set_compression_level(pngStruct, 1);
+	png_set_filter(pngStruct, 0, PNG_FILTER_NONE);
 
 	png_write_info(pngStruct, pngInfo);
-	png_write_flush(pngStruct);
 	
 	png_uint_32 bytesInRow = width * 3;
-	png_bytep* rows = (png_bytep*)new char[height * sizeof(png_bytep)];
-
-	if (rows == NULL) {
-		fclose(fp);
-		png_destroy_write_struct(&pngStruct, &pngInfo);
-		return -1;
-	}
 
 	for (int i = 0; i < height; i++) {
 		rows[i] = img;
@@ -864,7 +840,6 @@ int SaveSlots::saveAsPng(unsigned char *img, const char *filename, int width, in
 	png_write_end(pngStruct, NULL);
 	png_destroy_write_struct(&pngStruct, &pngInfo);
 
-	fclose(fp);
 	delete[] rows;
 	return 0;
 }
@@ -905,31 +880,6 @@ void SaveSlots::cleanUp()
 	}
 }
 
-char* SaveSlots::readFileToBuf(const char* file, long* file_size)
-{
-	// Important: This function allocates memory from heap. Caller must deallocate (delete[]) after use.
-	FILE *fp = fopen(file, "r");
-	
-	if (fp == NULL)
-		return NULL;
-
-	// Get the file size in bytes
-	fseek(fp, 0L, SEEK_END);
-	long numbytes = ftell(fp);
- 
-	char* buffer = new char[numbytes];
-	memset(buffer, 0, numbytes);
-	// Reset the file position indicator to the beginning of the file
-	fseek(fp, 0L, SEEK_SET);	
-	// Copy all the text into the buffer
-	fread(buffer, sizeof(char), numbytes, fp);
-	fclose(fp);
-
-	*file_size = numbytes;
-
-	return buffer;
-}
-
 int SaveSlots::applyPatchModuleSettings(const char* snapshot)
 {
 	char* settings; 
@@ -91,16 +91,15 @@ private:
 	void				drawInstructions();
 	void				waitTillButtonsReleased();
 	void				setState();
-	int					saveViewToThumbnail(const char* fname);
-	int					saveAsPng(unsigned char* image, const char* filename, int width, int height);
+	int					encodePng(unsigned char* image, int width, int height, string &png);
 	int					touchCoordinatesToSaveSlot(int x, int y);
 	bool				isSlotOccupied(int slot);
 	bool				isGridEmpty();
 	bool				confirmUser(const char* msg);
-	void				emptySaveSlot(int slot);
+	void				emptySaveSlot(int slot, bool delete_file = true);
 	void				addTimeStamp(int slot, char* time_stamp);
-	int					addThumbToSnap(const char* snap_file);
-	int					addSettingsToSnap(const char* snap_file);
+	int					getThumbnailPng(string &png);
+	string				getSettingsString();
 	void				changeHighlightSquare(int button);
 	string				getfilePath(int slot);
 	string				formatTimeStamp(string seconds);
@@ -110,7 +109,6 @@ private:
 	string				getTimeStampFromDirContent(vector<DirEntry> &dir, int save_slot);
 	string				getDisplayFitString(const char* str, int limit, float font_size = 1);
 	void				cleanUp();
-	char*				readFileToBuf(const char* file, long* file_size);
 	int					applyPatchModuleSettings(const char* snapshot);
 
 	// Navigator interface implementations
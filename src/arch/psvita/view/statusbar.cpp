@@ -64,6 +64,7 @@ void Statusbar::init(View* view)
 	sprintf(m_counter, "000");
 	sprintf(m_cpu, "000%%");
 	sprintf(m_fps, "00");
+	m_profile[0] = 0;
 
 	for (int i=0; i<4; ++i){
 		m_drives[i].number = i+8;
@@ -151,6 +152,10 @@ int Statusbar::render()
 	if (m_warpFlag)
 		vita2d_draw_texture(m_bitmaps[IMG_SB_LED_ON_GREEN], 811, 522);
 
+	// Host time per frame, only in VICE_PROFILE builds.
+	if (m_profile[0])
+		txtr_draw_text(10, 508, YELLOW, m_profile);
+
 	m_updated = false;
 	return 1;
 }
@@ -173,6 +178,12 @@ void Statusbar::setSpeedData(int fps, int cpu, int warp_flag)
 	m_updated = true;
 }
 
+void Statusbar::setProfileText(const char* text)
+{
+	snprintf(m_profile, sizeof(m_profile), "%s", text);
+	m_updated = true;
+}
+
 void Statusbar::setDriveLed(int drive, int led)
 {
 	if (drive > 3)
@@ -65,6 +65,7 @@ private:
 	char			m_fps[8];
 	char			m_cpu[8];
 	char			m_counter[8];
+	char			m_profile[128];
 	int				m_warpFlag;
 	int				m_tapeControl;
 	int				m_tapeMotor;
@@ -84,6 +85,7 @@ public:
 	void			show();
 	int				render();
 	void			setSpeedData(int fps, int percent, int warp_flag);
+	void			setProfileText(const char* text);
 	void			setTapeCounter(int counter);
 	void			setTapeControl(int control);
 	void			setDriveLed(int drive, int led);
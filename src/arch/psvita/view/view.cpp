@@ -70,6 +70,7 @@ View::View()
 	m_statusbar			= NULL;
 	m_keyboard			= NULL;
 	m_view_tex			= NULL;
+	m_shown_tex			= NULL;
 	m_posXNormalView	= 0;
 	m_posYNormalView	= 0;
 	m_scaleXNormalView  = 1;
@@ -79,6 +80,20 @@ View::View()
 	m_inGame			= false;
 	m_pendingDraw		= false;
 	m_displayPause		= false;
+
+#ifdef USE_PRESENT_THREAD
+	// vita2d is not thread safe. The presenter thread and the menus, which run on
+	// the emulation thread, take turns through this lock. It is recursive because
+	// the menus call updateView() too.
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&m_drawMutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i)
+		m_present_tex[i] = NULL;
+#endif
 }
 
 View::~View()
@@ -103,6 +118,13 @@ View::~View()
 		delete m_keyboard;
 	if (m_view_tex)
 		vita2d_free_texture(m_view_tex);
+#ifdef USE_PRESENT_THREAD
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+		if (m_present_tex[i])
+			vita2d_free_texture(m_present_tex[i]);
+	}
+	pthread_mutex_destroy(&m_drawMutex);
+#endif
 
 	for (int i=0; i<gs_instructionBitmapsSize; ++i){
 		vita2d_free_texture(g_instructionBitmaps[i]);
@@ -150,6 +172,8 @@ void View::doModal()
 {
 	string selection;
 
+	lockDraw();
+
 	m_uiActive = true;
 	m_inGame = false;
 
@@ -157,6 +181,8 @@ void View::doModal()
 		selection = showMainMenu();
 		handleMainMenuSelection(selection);	
 	}
+
+	unlockDraw();
 }
 
 void View::handleMainMenuSelection(string& selection)
@@ -225,6 +251,18 @@ int	View::createView(int width, int height, int bpp)
 		break;
 	}
 
+#ifdef USE_PRESENT_THREAD
+	// The frames the presenter thread shows are copies of the view texture.
+	// Only the 8 bit view is published.
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+		if (m_present_tex[i])
+			vita2d_free_texture(m_present_tex[i]);
+		m_present_tex[i] = (bpp == 8)? 
+			vita2d_create_empty_texture_format(m_width, m_height, (SceGxmTextureFormat)SCE_GXM_TEXTURE_BASE_FORMAT_P8): NULL;
+	}
+#endif
+
+	m_shown_tex = m_view_tex;
 	m_settings->applySetting(TEXTURE_FILTER);
     m_view_tex_data = (unsigned char*) vita2d_texture_get_datap(m_view_tex);
 	
@@ -236,6 +274,8 @@ void View::updateView()
 	if (!m_inGame)
 		return;
 
+	lockDraw();
+
 	vita2d_start_drawing();
 	vita2d_clear_screen();
 
@@ -243,7 +283,7 @@ void View::updateView()
 		// Normal view.
 
 		vita2d_draw_texture_part_scale(
-			m_view_tex, 
+			m_shown_tex, 
 			m_posXNormalView, 
 			m_posYNormalView, 
 			m_viewport.x, 
@@ -261,7 +301,7 @@ void View::updateView()
 			// Get borderless view for bigger screen.
 			if (m_controller->getViewport(&vp, false) == 0){
 				vita2d_draw_texture_part_scale(
-					m_view_tex, 
+					m_shown_tex, 
 					m_posXSplitView, 
 					m_posYSplitView, 
 					vp.x,
@@ -287,6 +327,71 @@ void View::updateView()
 
     vita2d_end_drawing();
     vita2d_swap_buffers();
+
+	unlockDraw();
+}
+
+void View::lockDraw()
+{
+#ifdef USE_PRESENT_THREAD
+	pthread_mutex_lock(&m_drawMutex);
+#endif
+}
+
+void View::unlockDraw()
+{
+#ifdef USE_PRESENT_THREAD
+	pthread_mutex_unlock(&m_drawMutex);
+#endif
+}
+
+#ifdef USE_PRESENT_THREAD
+void View::getPresentBuffers(unsigned char** buffers)
+{
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i)
+		buffers[i] = m_present_tex[i]? (unsigned char*)vita2d_texture_get_datap(m_present_tex[i]): NULL;
+}
+
+void View::presentFrame(unsigned char* pixels)
+{
+	// Called by the presenter thread. Show the present texture holding the frame.
+
+	lockDraw();
+
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+		if (m_present_tex[i] && vita2d_texture_get_datap(m_present_tex[i]) == pixels)
+			m_shown_tex = m_present_tex[i];
+	}
+
+	updateView();
+
+	unlockDraw();
+}
+#endif
+
+bool View::isAreaShown(int x, int y, int width, int height)
+{
+	// Returns true if any part of the given texture area is drawn by updateView().
+	// Nothing of the texture is visible behind the full screen keyboard.
+
+	ViewPort vp;
+
+	if (!m_inGame)
+		return false;
+
+	if (!m_keyboardOnView){
+		vp = m_viewport;
+	}
+	else if (g_keyboardMode != KEYBOARD_FULL_SCREEN){
+		if (m_controller->getViewport(&vp, false) != 0)
+			return true;
+	}
+	else{
+		return false;
+	}
+
+	return x < vp.x + vp.width && x + width > vp.x && 
+		   y < vp.y + vp.height && y + height > vp.y;
 }
 
 void View::updateViewport(int x, int y, int width, int height)
@@ -343,6 +448,13 @@ void View::setPalette(unsigned char* palette, int size)
 		palette_tbl[i] = r | (g << 8) | (b << 16) | (0xFF << 24);
 		palette += 3;
 	}
+
+#ifdef USE_PRESENT_THREAD
+	for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+		if (m_present_tex[i])
+			memcpy(vita2d_texture_get_palette(m_present_tex[i]), palette_tbl, size * sizeof(uint32_t));
+	}
+#endif
 }
 
 void View::setFPSCount(int fps, int percent, int warp_flag)
@@ -350,6 +462,11 @@ void View::setFPSCount(int fps, int percent, int warp_flag)
 	m_statusbar->setSpeedData(fps, percent, warp_flag);
 }
 
+void View::setProfileText(const char* text)
+{
+	m_statusbar->setProfileText(text);
+}
+
 void View::setTapeCounter(int counter)
 {
 	m_statusbar->setTapeCounter(counter);
@@ -388,11 +505,16 @@ void View::setDriveStatus(int drive, int active)
 int View::showMessage(const char* msg, int msg_type)
 {
 	int ret = 0;
+
+	lockDraw();
+
 	if (msg_type == 0)
 		gtShowMsgBoxOk(msg);
 	else
 		ret = gtShowMsgBoxOkCancel(msg);
 
+	unlockDraw();
+
 	return ret;
 }
 
@@ -657,10 +779,22 @@ void View::changeTextureFilter(TextureFilter value)
 	case TEXTURE_FILTER_POINT:
 		m_textureFilter = value;
 		vita2d_texture_set_filters(m_view_tex, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_POINT, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_POINT);
+#ifdef USE_PRESENT_THREAD
+		for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+			if (m_present_tex[i])
+				vita2d_texture_set_filters(m_present_tex[i], (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_POINT, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_POINT);
+		}
+#endif
 		break;
 	case TEXTURE_FILTER_LINEAR:
 		m_textureFilter = value;
 		vita2d_texture_set_filters(m_view_tex, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_LINEAR, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_LINEAR);
+#ifdef USE_PRESENT_THREAD
+		for (int i=0; i<VIDEO_PRESENT_BUFFERS; ++i){
+			if (m_present_tex[i])
+				vita2d_texture_set_filters(m_present_tex[i], (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_LINEAR, (SceGxmTextureFilter)SCE_GXM_TEXTURE_FILTER_LINEAR);
+		}
+#endif
 		break;
 	default:
 		break;
@@ -26,6 +26,12 @@
 #include "vkeyboard.h"
 #include <string>
 #include <psp2/types.h>
+#ifdef USE_PRESENT_THREAD
+#include <pthread.h>
+extern "C" {
+#include "video-present.h"
+}
+#endif
 
 
 using std::string;
@@ -81,6 +87,11 @@ private:
 
 	vita2d_texture*	m_view_tex;
 	unsigned char*	m_view_tex_data;
+	vita2d_texture*	m_shown_tex;
+#ifdef USE_PRESENT_THREAD
+	vita2d_texture*	m_present_tex[VIDEO_PRESENT_BUFFERS];
+	pthread_mutex_t	m_drawMutex;
+#endif
 	int				m_width;
 	int				m_height;
 	ViewPort		m_viewport;
@@ -149,11 +160,13 @@ public:
 	void			scanControls(ControlPadMap** maps, int* size, bool scan_mouse);
 	int				createView(int width, int height, int bpp);
 	void			updateView();
+	bool			isAreaShown(int x, int y, int width, int height);
 	void			updateViewport(int x, int y, int width, int height);
 	void			getViewInfo(int* width, int* height, unsigned char** ppixels, int* pitch, int* bpp);
 	void			getViewportInfo(int* x, int* y, int* width, int* height);
 	void			setPalette(unsigned char* palette, int size);
 	void			setFPSCount(int fps, int percent, int warp_flag);
+	void			setProfileText(const char* text);
 	void			setTapeCounter(int count);
 	void			setTapeControl(int status);
 	void			setDriveLed(int drive, int led);
@@ -176,6 +189,12 @@ public:
 	void			getSettingValues(int key, const char** value, const char** src, const char*** values, int* size);
 	int				convertRGBToPixel(uint8_t red, uint8_t green, uint8_t blue);
 	bool			pendingRedraw();
+	void			lockDraw();
+	void			unlockDraw();
+#ifdef USE_PRESENT_THREAD
+	void			getPresentBuffers(unsigned char** buffers);
+	void			presentFrame(unsigned char* pixels);
+#endif
 };
 
 
@@ -0,0 +1,267 @@
+/** \file   autostart-cache.c
+ * \brief   Keep the machine of earlier autostarts in memory
+ *
+ * An autostart boots the machine, waits for "READY.", loads the program
+ * and types RUN.  With the same machine, ROMs and settings the boot comes
+ * out the same every time, so if asked to (AutostartBootCache) the first
+ * autostart keeps a memory snapshot of the booted machine and the next
+ * ones start from there.  With AutostartLoadCache the machine with the
+ * program loaded is kept too, per image.
+ *
+ * Memory snapshots leave out ROMs and disk images, so the image attached
+ * for the autostart stays.  They do keep the tape position, which is why
+ * autostart.c does not use the cache while a tape is attached.
+ */
+
+/*
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+
+#include <string.h>
+
+#include "autostart-cache.h"
+#include "crc32.h"
+#include "lib.h"
+#include "machine.h"
+#include "resources.h"
+#include "snapshot.h"
+#include "types.h"
+
+#define AUTOSTART_CACHE_BOOT_ENTRIES 4
+#define AUTOSTART_CACHE_LOAD_ENTRIES 16
+
+typedef struct autostart_cache_entry_s {
+    uint32_t key;
+    unsigned long used;
+    snapshot_memory_t *mem;
+} autostart_cache_entry_t;
+
+static autostart_cache_entry_t boot_entries[AUTOSTART_CACHE_BOOT_ENTRIES];
+static autostart_cache_entry_t load_entries[AUTOSTART_CACHE_LOAD_ENTRIES];
+
+static autostart_cache_entry_t * const entries[AUTOSTART_CACHE_KINDS] = {
+    boot_entries, load_entries
+};
+static const unsigned int num_entries[AUTOSTART_CACHE_KINDS] = {
+    AUTOSTART_CACHE_BOOT_ENTRIES, AUTOSTART_CACHE_LOAD_ENTRIES
+};
+
+/* Resources that only change the host side.  */
+static const char * const host_resources[] = {
+    "WarpMode", "Speed", "RefreshRate", "Sound", "SoundRecordDeviceName",
+    "MonitorServer", "NetworkControl", "JAMAction", NULL
+};
+
+static unsigned long use_count = 0;
+static uint32_t last_config_key = 0;
+static int unsupported = 0;
+static autostart_cache_stats_t stats;
+
+/* ------------------------------------------------------------------------- */
+
+static uint32_t add_to_key(uint32_t key, const char *s)
+{
+    if (s == NULL) {
+        s = "";
+    }
+    return ((key << 1) | (key >> 31)) ^ crc32_buf(s, (unsigned int)strlen(s) + 1);
+}
+
+static uint32_t add_int_to_key(uint32_t key, uint32_t value)
+{
+    return ((key << 1) | (key >> 31)) ^ value;
+}
+
+uint32_t autostart_cache_config_key(void)
+{
+    char *romset;
+    const char *cartridge = NULL;
+    uint32_t key;
+
+    romset = machine_romset_file_list();
+    resources_get_string("CartridgeFile", &cartridge);
+
+    key = add_to_key(0, machine_get_name());
+    key = add_to_key(key, romset);
+    key = add_to_key(key, cartridge);
+    key = add_int_to_key(key, resources_get_event_crc(host_resources));
+
+    lib_free(romset);
+
+    last_config_key = key ? key : 1;
+    return last_config_key;
+}
+
+uint32_t autostart_cache_image_key(uint32_t config_key, const char *file_name,
+                                   const char *program_name, int basic_load)
+{
+    uint32_t image_crc, key;
+
+    if (config_key == 0 || file_name == NULL) {
+        return 0;
+    }
+    image_crc = crc32_file(file_name);
+    if (image_crc == 0) {
+        return 0;
+    }
+
+    key = add_int_to_key(config_key, image_crc);
+    key = add_to_key(key, program_name);
+    key = add_int_to_key(key, (uint32_t)basic_load);
+
+    return key ? key : 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static autostart_cache_entry_t *find(int kind, uint32_t key)
+{
+    unsigned int i;
+
+    if (key == 0) {
+        return NULL;
+    }
+    for (i = 0; i < num_entries[kind]; i++) {
+        if (entries[kind][i].mem != NULL && entries[kind][i].key == key) {
+            return &entries[kind][i];
+        }
+    }
+    return NULL;
+}
+
+static void drop(autostart_cache_entry_t *e)
+{
+    if (e->mem != NULL) {
+        snapshot_memory_destroy(e->mem);
+    }
+    memset(e, 0, sizeof(*e));
+}
+
+int autostart_cache_available(void)
+{
+    return !unsupported;
+}
+
+int autostart_cache_has(int kind, uint32_t key)
+{
+    return !unsupported && find(kind, key) != NULL;
+}
+
+int autostart_cache_store(int kind, uint32_t key)
+{
+    autostart_cache_entry_t *e, *base = NULL;
+    snapshot_memory_t *mem;
+    unsigned int i;
+
+    if (unsupported || key == 0) {
+        return -1;
+    }
+
+    /* the entry that was used longest ago goes */
+    e = find(kind, key);
+    if (e == NULL) {
+        e = &entries[kind][0];
+        for (i = 1; i < num_entries[kind] && e->mem != NULL; i++) {
+            if (entries[kind][i].mem == NULL || entries[kind][i].used < e->used) {
+                e = &entries[kind][i];
+            }
+        }
+    }
+    drop(e);
+
+    /* a loaded program shares what it did not change with the boot */
+    if (kind == AUTOSTART_CACHE_LOAD) {
+        for (i = 0; i < AUTOSTART_CACHE_BOOT_ENTRIES; i++) {
+            if (boot_entries[i].mem != NULL && boot_entries[i].key == last_config_key) {
+                base = &boot_entries[i];
+            }
+        }
+    }
+
+    mem = snapshot_memory_new();
+    if (machine_write_snapshot_memory(mem, base ? base->mem : NULL) < 0) {
+        snapshot_memory_destroy(mem);
+        unsupported = 1;
+        return -1;
+    }
+
+    e->key = key;
+    e->used = ++use_count;
+    e->mem = mem;
+    stats.stores[kind]++;
+
+    return 0;
+}
+
+int autostart_cache_restore(int kind, uint32_t key)
+{
+    autostart_cache_entry_t *e = find(kind, key);
+
+    if (unsupported || e == NULL) {
+        return -1;
+    }
+    if (machine_read_snapshot_memory(e->mem) < 0) {
+        drop(e);
+        return -1;
+    }
+
+    e->used = ++use_count;
+    stats.hits[kind]++;
+
+    return 0;
+}
+
+void autostart_cache_flush(int kind)
+{
+    unsigned int i;
+
+    for (i = 0; i < num_entries[kind]; i++) {
+        drop(&entries[kind][i]);
+    }
+}
+
+void autostart_cache_get_stats(autostart_cache_stats_t *s)
+{
+    unsigned int i;
+    int kind;
+
+    *s = stats;
+    s->bytes = 0;
+    for (kind = 0; kind < AUTOSTART_CACHE_KINDS; kind++) {
+        s->entries[kind] = 0;
+        for (i = 0; i < num_entries[kind]; i++) {
+            if (entries[kind][i].mem != NULL) {
+                s->entries[kind]++;
+                s->bytes += snapshot_memory_size(entries[kind][i].mem);
+            }
+        }
+    }
+}
+
+void autostart_cache_shutdown(void)
+{
+    int kind;
+
+    for (kind = 0; kind < AUTOSTART_CACHE_KINDS; kind++) {
+        autostart_cache_flush(kind);
+    }
+}
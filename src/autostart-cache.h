@@ -0,0 +1,68 @@
+/*
+ * autostart-cache.h - Keep the machine of earlier autostarts in memory.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_AUTOSTART_CACHE_H
+#define VICE_AUTOSTART_CACHE_H
+
+#include <stddef.h>
+
+#include "types.h"
+
+/* The machine booted up to "READY.", and the machine with the program
+   loaded, just before "RUN".  */
+#define AUTOSTART_CACHE_BOOT    0
+#define AUTOSTART_CACHE_LOAD    1
+#define AUTOSTART_CACHE_KINDS   2
+
+typedef struct autostart_cache_stats_s {
+    unsigned long hits[AUTOSTART_CACHE_KINDS];
+    unsigned long stores[AUTOSTART_CACHE_KINDS];
+    unsigned int entries[AUTOSTART_CACHE_KINDS];
+    size_t bytes;               /* of all entries as snapshot files */
+} autostart_cache_stats_t;
+
+/* Keys are never 0, a key of 0 means nothing can be cached.  The config
+   key covers the machine, the ROM set and the resources that change the
+   emulated machine, the image key also the contents of the image file,
+   the program name and how it is loaded.  */
+extern uint32_t autostart_cache_config_key(void);
+extern uint32_t autostart_cache_image_key(uint32_t config_key,
+                                          const char *file_name,
+                                          const char *program_name,
+                                          int basic_load);
+
+/* False once a machine could not be kept, memory snapshots are not
+   there for every machine.  */
+extern int autostart_cache_available(void);
+extern int autostart_cache_has(int kind, uint32_t key);
+
+/* Only call these from a trap.  Both return -1 if the machine cannot be
+   kept or there is no such entry.  */
+extern int autostart_cache_store(int kind, uint32_t key);
+extern int autostart_cache_restore(int kind, uint32_t key);
+
+extern void autostart_cache_flush(int kind);
+extern void autostart_cache_get_stats(autostart_cache_stats_t *stats);
+extern void autostart_cache_shutdown(void);
+
+#endif
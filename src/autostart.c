@@ -39,6 +39,7 @@
 
 #include "archdep.h"
 #include "autostart.h"
+#include "autostart-cache.h"
 #include "autostart-prg.h"
 #include "attach.h"
 #include "cartridge.h"
@@ -73,6 +74,9 @@
 #include "vdrive.h"
 #include "vdrive-bam.h"
 #include "vice-event.h"
+#ifdef PSVITA
+#include "controller.h"
+#endif
 
 #ifdef DEBUG_AUTOSTART
 #define DBG(_x_)        log_debug _x_
@@ -152,6 +156,17 @@ static int entered_rom = 0;
 /* Flag: trap monitor after done */
 static int trigger_monitor = 0;
 
+/* Keys to keep the machine under in the autostart cache once it is booted
+   and once the program is loaded, 0 if there is nothing to keep.  */
+static uint32_t cache_boot_key = 0;
+static uint32_t cache_load_key = 0;
+
+/* What to restore from the autostart cache instead of resetting, -1 for
+   nothing, and the mode to go on with if that does not work.  */
+static int cache_restore_kind = -1;
+static uint32_t cache_restore_key = 0;
+static unsigned int cache_fallback_mode;
+
 int autostart_ignore_reset = 0; /* FIXME: only used by datasette.c, does it really have to be global? */
 
 /* flag for special case handling of C128 80 columns mode */
@@ -172,6 +187,9 @@ static int AutostartDelayRandom = 0;
 
 static int AutostartPrgMode = AUTOSTART_PRG_MODE_VFS;
 
+static int AutostartBootCache = 0;
+static int AutostartLoadCache = 0;
+
 static char *AutostartPrgDiskImage = NULL;
 
 static const char * const AutostartRunCommandsAvailable[] = {
@@ -273,6 +291,26 @@ static int set_autostart_prg_mode(int val, void *param)
     return 0;
 }
 
+/*! \internal \brief set if autostart should keep the booted machine */
+static int set_autostart_boot_cache(int val, void *param)
+{
+    AutostartBootCache = val ? 1 : 0;
+    if (!AutostartBootCache) {
+        autostart_cache_flush(AUTOSTART_CACHE_BOOT);
+    }
+    return 0;
+}
+
+/*! \internal \brief set if autostart should keep the machine with the program loaded */
+static int set_autostart_load_cache(int val, void *param)
+{
+    AutostartLoadCache = val ? 1 : 0;
+    if (!AutostartLoadCache) {
+        autostart_cache_flush(AUTOSTART_CACHE_LOAD);
+    }
+    return 0;
+}
+
 /*! \internal \brief set disk image name of autostart prg mode */
 
 static int set_autostart_prg_disk_image(const char *val, void *param)
@@ -307,6 +345,10 @@ static const resource_int_t resources_int[] = {
       &AutostartDelay, set_autostart_delay, NULL },
     { "AutostartDelayRandom", 1, RES_EVENT_NO, (resource_value_t)0,
       &AutostartDelayRandom, set_autostart_delayrandom, NULL },
+    { "AutostartBootCache", 0, RES_EVENT_NO, (resource_value_t)0,
+      &AutostartBootCache, set_autostart_boot_cache, NULL },
+    { "AutostartLoadCache", 0, RES_EVENT_NO, (resource_value_t)0,
+      &AutostartLoadCache, set_autostart_load_cache, NULL },
     RESOURCE_INT_LIST_END
 };
 
@@ -377,6 +419,18 @@ static const cmdline_option_t cmdline_options[] =
     { "+autostart-delay-random", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
       NULL, NULL, "AutostartDelayRandom", (resource_value_t)0,
       NULL, "Disable random initial autostart delay." },
+    { "-autostart-boot-cache", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "AutostartBootCache", (resource_value_t)1,
+      NULL, "Keep the booted machine in memory and start the next autostart from there" },
+    { "+autostart-boot-cache", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "AutostartBootCache", (resource_value_t)0,
+      NULL, "Reset the machine for every autostart" },
+    { "-autostart-load-cache", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "AutostartLoadCache", (resource_value_t)1,
+      NULL, "Keep the machine with the program loaded in memory, per image" },
+    { "+autostart-load-cache", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "AutostartLoadCache", (resource_value_t)0,
+      NULL, "Load the program for every autostart" },
     CMDLINE_LIST_END
 };
 
@@ -532,6 +586,24 @@ static void load_snapshot_trap(uint16_t unused_addr, void *unused_data)
     ui_update_menus();
 }
 
+static void cache_store(int kind, uint32_t *key)
+{
+    if (*key != 0 && autostart_cache_store(kind, *key) < 0) {
+        log_message(autostart_log, "Cannot keep this machine in the autostart cache.");
+    }
+    *key = 0;
+}
+
+static void cache_boot_trap(uint16_t unused_addr, void *unused_data)
+{
+    cache_store(AUTOSTART_CACHE_BOOT, &cache_boot_key);
+}
+
+static void cache_load_trap(uint16_t unused_addr, void *unused_data)
+{
+    cache_store(AUTOSTART_CACHE_LOAD, &cache_load_key);
+}
+
 /* ------------------------------------------------------------------------- */
 
 /* Reset autostart.  */
@@ -667,6 +739,14 @@ static void disk_eof_callback(void)
         }
     }
 
+    /* wait for "READY." to keep the machine with the program loaded */
+    if (autostartmode == AUTOSTART_LOADINGDISK && cache_load_key != 0) {
+        autostartmode = AUTOSTART_WAITLOADREADY;
+        entered_rom = 0;
+        machine_bus_eof_callback_set(NULL);
+        return;
+    }
+
     if (autostartmode != AUTOSTART_NONE) {
         autostart_finish();
     }
@@ -808,7 +888,7 @@ static void advance_hasdisk(void)
             lib_free(tmp);
 
             if (!traps) {
-                if (AutostartWarp) {
+                if (AutostartWarp || cache_load_key != 0) {
                     autostartmode = AUTOSTART_WAITSEARCHINGFOR;
                 } else {
                     /* be most compatible if warp is disabled */
@@ -900,6 +980,11 @@ static void advance_waitloadready(void)
 {
     switch (check("READY.", AUTOSTART_WAIT_BLINK)) {
         case YES:
+            if (cache_load_key != 0) {
+                /* keep the loaded program, RUN it next time */
+                interrupt_maincpu_trigger_trap(cache_load_trap, NULL);
+                break;
+            }
             log_message(autostart_log, "Ready");
             disable_warp_if_was_requested();
             autostart_finish();
@@ -950,6 +1035,13 @@ void autostart_advance(void)
         return;
     }
 
+    /* keep the booted machine for the next autostart first */
+    if (cache_boot_key != 0
+        && (autostartmode == AUTOSTART_HASDISK || autostartmode == AUTOSTART_INJECT)) {
+        interrupt_maincpu_trigger_trap(cache_boot_trap, NULL);
+        return;
+    }
+
     switch (autostartmode) {
         case AUTOSTART_HASTAPE:
             advance_hastape();
@@ -989,11 +1081,110 @@ void autostart_advance(void)
     }
 }
 
-/* Clean memory and reboot for autostart.  */
-static void reboot_for_autostart(const char *program_name, unsigned int mode,
-                                 unsigned int runmode)
+/* Additional random delay of up to 10 frames, if asked for.  */
+static CLOCK random_delay_cycles(void)
 {
     int rnd;
+
+    resources_get_int("AutostartDelayRandom", &rnd);
+    if (rnd) {
+        return lib_unsigned_rand(1, machine_get_cycles_per_frame() * 10);
+    }
+    return 0;
+}
+
+/* Clean memory and reset, autostart goes on once the machine is up.  */
+static void reset_for_autostart(void)
+{
+    mem_powerup();
+
+    autostart_ignore_reset = 1;
+
+    autostart_initial_delay_cycles = min_cycles + random_delay_cycles();
+    DBG(("autostart_initial_delay_cycles: %d", autostart_initial_delay_cycles));
+
+    machine_trigger_reset(MACHINE_RESET_MODE_HARD);
+}
+
+/* Put the machine from the autostart cache in place of the reset.  */
+static void cache_restore_trap(uint16_t unused_addr, void *unused_data)
+{
+    /* a snapshot that does not fit resets the machine */
+    autostart_ignore_reset = 1;
+    if (autostart_cache_restore(cache_restore_kind, cache_restore_key) < 0) {
+        log_error(autostart_log, "Cannot restore the machine from the autostart cache.");
+        autostartmode = cache_fallback_mode;
+        cache_restore_kind = -1;
+        reset_for_autostart();
+        return;
+    }
+    autostart_ignore_reset = 0;
+
+    if (cache_restore_kind == AUTOSTART_CACHE_LOAD) {
+        deallocate_program_name();
+    }
+    cache_restore_kind = -1;
+
+    autostart_initial_delay_cycles = maincpu_clk + random_delay_cycles();
+    autostart_wait_for_reset = 0;
+
+    ui_update_menus();
+
+#ifdef PSVITA
+    /* the view expects a reset, as machine_reset() tells it */
+    PSV_NotifyReset();
+#endif
+}
+
+/* Decide what the autostart cache restores and keeps.  The booted machine
+   is the same for disks and injected programs.  The machine with the
+   program loaded is kept per image, only if true drive emulation is left
+   alone.  With a tape attached nothing is cached, memory snapshots keep
+   the tape position.  */
+static void cache_prepare(const char *image_file, unsigned int mode)
+{
+    uint32_t config_key;
+
+    cache_boot_key = 0;
+    cache_load_key = 0;
+    cache_restore_kind = -1;
+
+    if ((!AutostartBootCache && !AutostartLoadCache)
+        || !autostart_cache_available()
+        || (mode != AUTOSTART_HASDISK && mode != AUTOSTART_INJECT)
+        || (tape_image_dev1 != NULL && tape_image_dev1->name != NULL)) {
+        return;
+    }
+
+    config_key = autostart_cache_config_key();
+
+    if (AutostartLoadCache && mode == AUTOSTART_HASDISK
+        && !handle_drive_true_emulation_overridden) {
+        cache_load_key = autostart_cache_image_key(config_key, image_file,
+                                                   autostart_program_name,
+                                                   autostart_basic_load);
+        if (autostart_cache_has(AUTOSTART_CACHE_LOAD, cache_load_key)) {
+            cache_restore_kind = AUTOSTART_CACHE_LOAD;
+            cache_restore_key = cache_load_key;
+            cache_load_key = 0;
+            return;
+        }
+    }
+
+    if (AutostartBootCache) {
+        if (autostart_cache_has(AUTOSTART_CACHE_BOOT, config_key)) {
+            cache_restore_kind = AUTOSTART_CACHE_BOOT;
+            cache_restore_key = config_key;
+        } else {
+            cache_boot_key = config_key;
+        }
+    }
+}
+
+/* Clean memory and reboot for autostart.  */
+static void reboot_for_autostart(const char *program_name, const char *image_file,
+                                 unsigned int mode, unsigned int runmode)
+{
     char *temp_name = NULL, *temp;
 
     if (!autostart_enabled) {
@@ -1023,23 +1214,27 @@ static void reboot_for_autostart(const char *program_name, unsigned int mode,
         resources_set_int("C128ColumnKey", 1);
     }
 
-    mem_powerup();
-
-    autostart_ignore_reset = 1;
     deallocate_program_name();
     if (program_name && program_name[0]) {
         autostart_program_name = lib_stralloc(program_name);
     }
 
-    autostart_initial_delay_cycles = min_cycles;
-    resources_get_int("AutostartDelayRandom", &rnd);
-    if (rnd) {
-        /* additional random delay of up to 10 frames */
-        autostart_initial_delay_cycles += lib_unsigned_rand(1, machine_get_cycles_per_frame() * 10);
-    }
-    DBG(("autostart_initial_delay_cycles: %d", autostart_initial_delay_cycles));
+    cache_prepare(image_file, mode);
 
-    machine_trigger_reset(MACHINE_RESET_MODE_HARD);
+    if (cache_restore_kind >= 0) {
+        log_message(autostart_log, "Restoring the %s machine from the autostart cache.",
+                    cache_restore_kind == AUTOSTART_CACHE_LOAD ? "loaded" : "booted");
+        cache_fallback_mode = mode;
+        if (cache_restore_kind == AUTOSTART_CACHE_LOAD) {
+            /* wait for the ready cursor and type RUN */
+            mode = AUTOSTART_WAITLOADREADY;
+            entered_rom = 0;
+        }
+        autostart_initial_delay_cycles = 0;
+        interrupt_maincpu_trigger_trap(cache_restore_trap, NULL);
+    } else {
+        reset_for_autostart();
+    }
 
     /* The autostartmode must be set AFTER the shutdown to make the autostart
        threadsafe for OS/2 */
@@ -1079,7 +1274,7 @@ int autostart_snapshot(const char *file_name, const char *program_name)
     /*autostart_program_name = lib_stralloc(file_name);
     interrupt_maincpu_trigger_trap(load_snapshot_trap, 0);*/
     /* use for snapshot */
-    reboot_for_autostart(file_name, AUTOSTART_HASSNAPSHOT, AUTOSTART_MODE_RUN);
+    reboot_for_autostart(file_name, NULL, AUTOSTART_HASSNAPSHOT, AUTOSTART_MODE_RUN);
 
     return 0;
 }
@@ -1115,7 +1310,7 @@ int autostart_tape(const char *file_name, const char *program_name,
         if (!tape_tap_attached()) {
             resources_set_int("VirtualDevices", 1); /* Kludge: for t64 images we need devtraps ON */
         }
-        reboot_for_autostart(program_name, AUTOSTART_HASTAPE, runmode);
+        reboot_for_autostart(program_name, file_name, AUTOSTART_HASTAPE, runmode);
 
         return 0;
     }
@@ -1215,7 +1410,7 @@ int autostart_disk(const char *file_name, const char *program_name,
             }
 #endif
 
-            reboot_for_autostart(name, AUTOSTART_HASDISK, runmode);
+            reboot_for_autostart(name, file_name, AUTOSTART_HASDISK, runmode);
             lib_free(name);
 
             return 0;
@@ -1289,7 +1484,7 @@ int autostart_prg(const char *file_name, unsigned int runmode)
     /* Now either proceed with disk image booting or prg injection after reset */
     if (result >= 0) {
         ui_update_menus();
-        reboot_for_autostart(boot_file_name, mode, runmode);
+        reboot_for_autostart(boot_file_name, file_name, mode, runmode);
     }
 
     /* close prg file */
@@ -1398,10 +1593,10 @@ int autostart_device(int num)
 
     switch (num) {
         case 8:
-            reboot_for_autostart(NULL, AUTOSTART_HASDISK, AUTOSTART_MODE_RUN);
+            reboot_for_autostart(NULL, NULL, AUTOSTART_HASDISK, AUTOSTART_MODE_RUN);
             return 0;
         case 1:
-            reboot_for_autostart(NULL, AUTOSTART_HASTAPE, AUTOSTART_MODE_RUN);
+            reboot_for_autostart(NULL, NULL, AUTOSTART_HASTAPE, AUTOSTART_MODE_RUN);
             return 0;
     }
     return -1;
@@ -1441,6 +1636,7 @@ void autostart_shutdown(void)
 {
     deallocate_program_name();
 
+    autostart_cache_shutdown();
     autostart_prg_shutdown();
 }
 
@@ -56,15 +56,8 @@
 #define SNAP_MAJOR 1
 #define SNAP_MINOR 1
 
-int c64_snapshot_write(const char *name, int save_roms, int save_disks, int event_mode)
+static int c64_snapshot_write_modules(snapshot_t *s, int save_roms, int save_disks, int event_mode)
 {
-    snapshot_t *s;
-
-    s = snapshot_create(name, ((uint8_t)(SNAP_MAJOR)), ((uint8_t)(SNAP_MINOR)), machine_get_name());
-    if (s == NULL) {
-        return -1;
-    }
-
     sound_snapshot_prepare();
 
     /* Execute drive CPUs to get in sync with the main CPU.  */
@@ -85,29 +78,18 @@ int c64_snapshot_write(const char *name, int save_roms, int save_disks, int even
         || joyport_snapshot_write_module(s, JOYPORT_1) < 0
         || joyport_snapshot_write_module(s, JOYPORT_2) < 0
         || userport_snapshot_write_module(s) < 0) {
-        snapshot_close(s);
-        ioutil_remove(name);
         return -1;
     }
 
-    snapshot_close(s);
     return 0;
 }
 
-int c64_snapshot_read(const char *name, int event_mode)
+static int c64_snapshot_read_modules(snapshot_t *s, uint8_t major, uint8_t minor, int event_mode)
 {
-    snapshot_t *s;
-    uint8_t minor, major;
-
-    s = snapshot_open(name, &major, &minor, machine_get_name());
-    if (s == NULL) {
-        return -1;
-    }
-
     if (major != SNAP_MAJOR || minor != SNAP_MINOR) {
         log_error(LOG_DEFAULT, "Snapshot version (%d.%d) not valid: expecting %d.%d.", major, minor, SNAP_MAJOR, SNAP_MINOR);
         snapshot_set_error(SNAPSHOT_MODULE_INCOMPATIBLE);
-        goto fail;
+        return -1;
     }
 
     vicii_snapshot_prepare();
@@ -129,7 +111,45 @@ int c64_snapshot_read(const char *name, int event_mode)
         || joyport_snapshot_read_module(s, JOYPORT_1) < 0
         || joyport_snapshot_read_module(s, JOYPORT_2) < 0
         || userport_snapshot_read_module(s) < 0) {
-        goto fail;
+        return -1;
+    }
+
+    return 0;
+}
+
+int c64_snapshot_write(const char *name, int save_roms, int save_disks, int event_mode)
+{
+    snapshot_t *s;
+
+    s = snapshot_create(name, ((uint8_t)(SNAP_MAJOR)), ((uint8_t)(SNAP_MINOR)), machine_get_name());
+    if (s == NULL) {
+        return -1;
+    }
+
+    if (c64_snapshot_write_modules(s, save_roms, save_disks, event_mode) < 0) {
+        snapshot_close(s);
+        ioutil_remove(name);
+        return -1;
+    }
+
+    snapshot_close(s);
+    return 0;
+}
+
+int c64_snapshot_read(const char *name, int event_mode)
+{
+    snapshot_t *s;
+    uint8_t minor, major;
+
+    s = snapshot_open(name, &major, &minor, machine_get_name());
+    if (s == NULL) {
+        return -1;
+    }
+
+    if (c64_snapshot_read_modules(s, major, minor, event_mode) < 0) {
+        snapshot_close(s);
+        machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+        return -1;
     }
 
     snapshot_close(s);
@@ -137,13 +157,44 @@ int c64_snapshot_read(const char *name, int event_mode)
     sound_snapshot_finish();
 
     return 0;
+}
+
+/* Memory snapshots leave out ROMs, disks and event history; they are
+   for going back a little within the same session.  */
+int c64_snapshot_write_memory(snapshot_memory_t *mem, const snapshot_memory_t *base)
+{
+    snapshot_t *s;
+    int retval;
 
-fail:
-    if (s != NULL) {
+    s = snapshot_memory_create(mem, base, ((uint8_t)(SNAP_MAJOR)), ((uint8_t)(SNAP_MINOR)), machine_get_name());
+    if (s == NULL) {
+        return -1;
+    }
+
+    retval = c64_snapshot_write_modules(s, 0, 0, 0);
+    snapshot_close(s);
+    return retval;
+}
+
+int c64_snapshot_read_memory(snapshot_memory_t *mem)
+{
+    snapshot_t *s;
+    uint8_t minor, major;
+
+    s = snapshot_memory_open(mem, &major, &minor, machine_get_name());
+    if (s == NULL) {
+        return -1;
+    }
+
+    if (c64_snapshot_read_modules(s, major, minor, 0) < 0) {
         snapshot_close(s);
+        machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+        return -1;
     }
 
-    machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+    snapshot_close(s);
 
-    return -1;
+    sound_snapshot_finish();
+
+    return 0;
 }
@@ -97,6 +97,7 @@
 #include "printer.h"
 #include "psid.h"
 #include "resources.h"
+#include "rewind.h"
 #include "rs232drv.h"
 #include "rsuser.h"
 #include "rushware_keypad.h"
@@ -620,6 +621,10 @@ int machine_resources_init(void)
         init_resource_fail("event");
         return -1;
     }
+    if (rewind_resources_init() < 0) {
+        init_resource_fail("rewind");
+        return -1;
+    }
     if (kbdbuf_resources_init() < 0) {
         init_resource_fail("Keyboard");
         return -1;
@@ -843,6 +848,10 @@ int machine_cmdline_options_init(void)
         init_cmdline_options_fail("event");
         return -1;
     }
+    if (rewind_cmdline_options_init() < 0) {
+        init_cmdline_options_fail("rewind");
+        return -1;
+    }
     if (kbdbuf_cmdline_options_init() < 0) {
         init_cmdline_options_fail("keyboard");
         return -1;
@@ -978,6 +987,8 @@ int machine_specific_init(void)
 
     event_init();
 
+    rewind_init();
+
     /* Setup trap handling.  */
     traps_init();
 
@@ -1318,6 +1329,16 @@ int machine_read_snapshot(const char *name, int event_mode)
     return c64_snapshot_read(name, event_mode);
 }
 
+int machine_write_snapshot_memory(snapshot_memory_t *mem, const snapshot_memory_t *base)
+{
+    return c64_snapshot_write_memory(mem, base);
+}
+
+int machine_read_snapshot_memory(snapshot_memory_t *mem)
+{
+    return c64_snapshot_read_memory(mem);
+}
+
 /* ------------------------------------------------------------------------- */
 /* FIXME: those two shouldnt be here anymore */
 int machine_autodetect_psid(const char *name)
@@ -200,9 +200,28 @@ static void clk_overflow_callback(CLOCK sub, void *unused_data)
     }
 }
 
+/* RAM pages the REU may read or write directly.  Stores to the VIC-II bank
+   only serve pending VIC-II events before going to RAM, and the REU
+   stops short of those.  */
+static uint8_t *reu_dma_ram(uint16_t addr, int write)
+{
+    if (write) {
+        if (_mem_write_tab_ptr[addr >> 8] == ram_store
+            || _mem_write_tab_ptr[addr >> 8] == vicii_mem_vbank_store) {
+            return mem_ram + addr;
+        }
+    } else if (_mem_read_tab_ptr[addr >> 8] == ram_read) {
+        return mem_ram + addr;
+    }
+    return NULL;
+}
+
 void c64_mem_init(void)
 {
     clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
+
+    /* Initialize REU bulk DMA interface */
+    reu_dma_fast_register(reu_dma_ram, vicii_pending_alarms_clk);
 }
 
 void mem_pla_config_changed(void)
@@ -101,6 +101,7 @@
 #include "westermann.h"
 #include "zaxxon.h"
 #include "util.h"
+#include "zfile.h"
 #undef CARTRIDGE_INCLUDE_PRIVATE_API
 
 /* #define DEBUGCRT */
@@ -126,7 +127,7 @@ FILE *crt_open(const char *filename, crt_header_t *header)
     uint32_t skip;
     FILE *fd;
 
-    fd = fopen(filename, MODE_READ);
+    fd = zfile_fopen(filename, MODE_READ);
 
     if (fd == NULL) {
         return NULL;
@@ -165,7 +166,7 @@ FILE *crt_open(const char *filename, crt_header_t *header)
         return fd; /* Ok, exit */
     } while (0);
 
-    fclose(fd);
+    zfile_fclose(fd);
     return NULL; /* Fault */
 }
 /*
@@ -182,7 +183,7 @@ int crt_getid(const char *filename)
         return -1;
     }
 
-    fclose(fd);
+    zfile_fclose(fd);
 
     return header.type;
 }
@@ -537,7 +538,7 @@ int crt_attach(const char *filename, uint8_t *rawcart)
             break;
     }
 
-    fclose(fd);
+    zfile_fclose(fd);
 
     if (rc == -1) {
         DBG(("crt_attach error (%d)\n", rc));
@@ -54,6 +54,7 @@
 #include "machine.h"
 #include "maincpu.h"
 #include "mem.h"
+#include "profile.h"
 #include "resources.h"
 #include "snapshot.h"
 #include "types.h"
@@ -252,6 +253,19 @@ static struct reu_ba_s reu_ba = {
     NULL, NULL, NULL, 0, 0, 0, 0
 };
 
+/*! \brief interface for moving spans of plain RAM in one go, used for x64 */
+struct reu_dma_fast_s {
+    reu_dma_ram_callback_t *ram;
+    reu_dma_clk_callback_t *next_event;
+    int check;
+};
+
+static struct reu_dma_fast_s reu_dma_fast = {
+    NULL, NULL, 0
+};
+
+static reu_dma_stats_t reu_dma_stats;
+
 static int reu_write_image = 0;
 
 /* ------------------------------------------------------------------------- */
@@ -589,6 +603,28 @@ void reu_ba_register(reu_ba_check_callback_t *ba_check,
     reu_ba.enabled = 1;
 }
 
+void reu_dma_fast_register(reu_dma_ram_callback_t *ram,
+                           reu_dma_clk_callback_t *next_event)
+{
+    reu_dma_fast.ram = ram;
+    reu_dma_fast.next_event = next_event;
+}
+
+void reu_dma_set_check(int enable)
+{
+    reu_dma_fast.check = enable ? 1 : 0;
+}
+
+void reu_dma_get_stats(reu_dma_stats_t *stats)
+{
+    *stats = reu_dma_stats;
+}
+
+void reu_dma_stats_reset(void)
+{
+    memset(&reu_dma_stats, 0, sizeof(reu_dma_stats));
+}
+
 /*! \brief reset the REU */
 void reu_reset(void)
 {
@@ -1147,6 +1183,334 @@ static void reu_dma_update_regs(uint16_t host_addr, unsigned int reu_addr, int l
     }
 }
 
+/* single byte steps of the DMA operations; each one moves a byte and
+   advances the addresses like the REC does in one (swap: two) cycles */
+
+/*! \brief move one byte from the host to the REU */
+inline static void reu_dma_host_to_reu_byte(uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step)
+{
+    uint8_t value;
+
+    reu_clk_inc_pre();
+    machine_handle_pending_alarms(0);
+    value = mem_read(*host_addr);
+    reu_clk_inc_post2();
+    DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Transferring byte: %x from main $%04X to ext $%05X.", value, *host_addr, *reu_addr));
+
+    store_to_reu(*reu_addr, value);
+    *host_addr = (*host_addr + host_step) & 0xffff;
+    *reu_addr = increment_reu_with_wrap_around(*reu_addr, reu_step);
+}
+
+/*! \brief move one byte from the REU to the host */
+inline static void reu_dma_reu_to_host_byte(uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step)
+{
+    uint8_t value;
+
+    DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Transferring byte: %x from ext $%05X to main $%04X.", reu_ram[*reu_addr % reu_size], *reu_addr, *host_addr));
+    reu_clk_inc_pre();
+    value = read_from_reu(*reu_addr);
+    mem_store(*host_addr, value);
+    reu_clk_inc_post();
+    machine_handle_pending_alarms(0);
+    *host_addr = (*host_addr + host_step) & 0xffff;
+    *reu_addr = increment_reu_with_wrap_around(*reu_addr, reu_step);
+}
+
+/*! \brief exchange one byte between the host and the REU */
+inline static void reu_dma_swap_byte(uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step)
+{
+    uint8_t value_from_reu;
+    uint8_t value_from_c64;
+
+    value_from_reu = read_from_reu(*reu_addr);
+    reu_clk_inc_pre();
+    machine_handle_pending_alarms(0);
+    value_from_c64 = mem_read(*host_addr);
+    reu_clk_inc_post2();
+    DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Exchanging bytes: %x from main $%04X with %x from ext $%05X.", value_from_c64, *host_addr, value_from_reu, *reu_addr));
+    store_to_reu(*reu_addr, value_from_c64);
+    mem_store(*host_addr, value_from_reu);
+    reu_clk_inc_pre();
+    reu_clk_inc_post();
+    machine_handle_pending_alarms(0);
+    *host_addr = (*host_addr + host_step) & 0xffff;
+    *reu_addr = increment_reu_with_wrap_around(*reu_addr, reu_step);
+}
+
+/*! \brief compare one byte of the host with one of the REU
+
+  \return
+    non-zero if both are the same
+*/
+inline static int reu_dma_compare_byte(uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step)
+{
+    uint8_t value_from_reu;
+    uint8_t value_from_c64;
+
+    reu_clk_inc_pre();
+    machine_handle_pending_alarms(0);
+    value_from_reu = read_from_reu(*reu_addr);
+    value_from_c64 = mem_read(*host_addr);
+    reu_clk_inc_post2();
+    DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Comparing bytes: %x from main $%04X with %x from ext $%05X.", value_from_c64, *host_addr, value_from_reu, *reu_addr));
+    *reu_addr = increment_reu_with_wrap_around(*reu_addr, reu_step);
+    *host_addr = (*host_addr + host_step) & 0xffff;
+
+    return value_from_reu == value_from_c64;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/* Moving spans in one go.
+
+   Done one byte at a time, a DMA reads or writes RAM through the memory
+   tables and gives the VIC-II the chance to serve its events (badlines,
+   sprite fetches, drawing a raster line) after every cycle.  Within a
+   span that stays on one host page of plain RAM, on REU addresses backed
+   by DRAM and ends before the next VIC-II event, none of that is visible:
+   the bytes can be moved with memcpy() and the cycles added at once.
+   Everything else, and all of x64sc where the REU checks BA every cycle,
+   still goes one byte at a time.  */
+
+/*! \brief the kinds of DMA operation, as in the command register */
+enum {
+    REU_DMA_TO_REU = REU_REG_RW_COMMAND_TRANSFER_TYPE_TO_REU,
+    REU_DMA_FROM_REU = REU_REG_RW_COMMAND_TRANSFER_TYPE_FROM_REU,
+    REU_DMA_SWAP = REU_REG_RW_COMMAND_TRANSFER_TYPE_SWAP,
+    REU_DMA_VERIFY = REU_REG_RW_COMMAND_TRANSFER_TYPE_VERIFY
+};
+
+/*! \brief find the span that can be moved in one go
+
+  \return
+    The number of bytes from here on that can be moved in one go, 0 if the
+    next byte has to be moved on its own. host_ptr and reu_ptr point to
+    the first byte of the span.
+*/
+static int reu_dma_fast_span(int op, uint16_t host_addr, unsigned int reu_addr, int host_step, int reu_step, int len, uint8_t **host_ptr, uint8_t **reu_ptr)
+{
+    unsigned int low = reu_addr & 0x0007ffff;
+    unsigned int dram = reu_addr & (rec_options.dram_wrap_around - 1);
+    CLOCK cycles = (op == REU_DMA_SWAP) ? 2 : 1;
+    CLOCK next;
+    int n = len;
+
+    if (reu_ba.enabled || reu_dma_fast.ram == NULL) {
+        return 0;
+    }
+
+    /* the last cycle of the span has to come before the next event */
+    next = reu_dma_fast.next_event();
+    if (next <= maincpu_clk || (next - maincpu_clk - 1) / cycles == 0) {
+        return 0;
+    }
+    if ((next - maincpu_clk - 1) / cycles < (CLOCK)n) {
+        n = (int)((next - maincpu_clk - 1) / cycles);
+    }
+
+    if (host_step && n > 0x100 - (host_addr & 0xff)) {
+        n = 0x100 - (host_addr & 0xff);
+    }
+    *host_ptr = reu_dma_fast.ram(host_addr, op == REU_DMA_FROM_REU);
+    if (*host_ptr == NULL) {
+        return 0;
+    }
+    if (op == REU_DMA_SWAP && reu_dma_fast.ram(host_addr, 1) != *host_ptr) {
+        return 0;
+    }
+
+    if (dram >= rec_options.not_backedup_addresses) {
+        return 0;
+    }
+    if (reu_step) {
+        if (low >= rec_options.wrap_around) {
+            return 0;
+        }
+        if ((unsigned int)n > rec_options.wrap_around - low) {
+            n = rec_options.wrap_around - low;
+        }
+        if ((unsigned int)n > rec_options.not_backedup_addresses - dram) {
+            n = rec_options.not_backedup_addresses - dram;
+        }
+    }
+    assert(dram < reu_size);
+    *reu_ptr = reu_ram + dram;
+
+    return n;
+}
+
+/*! \brief count the bytes of a span that compare equal */
+static int reu_dma_fast_equal(const uint8_t *host_ptr, const uint8_t *reu_ptr, int host_step, int reu_step, int n)
+{
+    int i;
+
+    if (host_step && reu_step && memcmp(host_ptr, reu_ptr, n) == 0) {
+        return n;
+    }
+    for (i = 0; i < n; i++) {
+        if (host_ptr[i * host_step] != reu_ptr[i * reu_step]) {
+            break;
+        }
+    }
+    return i;
+}
+
+/*! \brief move a span in one go, without the clock */
+static void reu_dma_fast_move(int op, uint8_t *host_ptr, uint8_t *reu_ptr, int host_step, int reu_step, int n)
+{
+    uint8_t value;
+    int i;
+
+    switch (op) {
+        case REU_DMA_TO_REU:
+            if (host_step && reu_step) {
+                memcpy(reu_ptr, host_ptr, n);
+            } else if (reu_step) {
+                memset(reu_ptr, *host_ptr, n);
+            } else {
+                *reu_ptr = host_ptr[(n - 1) * host_step];
+            }
+            break;
+        case REU_DMA_FROM_REU:
+            if (host_step && reu_step) {
+                memcpy(host_ptr, reu_ptr, n);
+            } else if (host_step) {
+                memset(host_ptr, *reu_ptr, n);
+            } else {
+                *host_ptr = reu_ptr[(n - 1) * reu_step];
+            }
+            break;
+        case REU_DMA_SWAP:
+            for (i = 0; i < n; i++) {
+                value = reu_ptr[i * reu_step];
+                reu_ptr[i * reu_step] = host_ptr[i * host_step];
+                host_ptr[i * host_step] = value;
+            }
+            break;
+        default:
+            /* verify only counts the equal bytes */
+            break;
+    }
+}
+
+/*! \brief advance the addresses past a span, like n single steps would */
+static void reu_dma_fast_advance(uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step, int n)
+{
+    unsigned int next;
+
+    *host_addr = (*host_addr + host_step * n) & 0xffff;
+    if (reu_step) {
+        next = (*reu_addr & 0x0007ffff) + n;
+        if (next == rec_options.wrap_around) {
+            next = 0;
+        }
+        *reu_addr = (*reu_addr & 0x00f80000) | next;
+    }
+}
+
+/*! \brief move a span one byte at a time first, then in one go from the
+  same state, and count it if both did not come out the same
+*/
+static void reu_dma_fast_check(int op, uint16_t host_addr, unsigned int reu_addr, int host_step, int reu_step, int n, uint8_t *host_ptr, uint8_t *reu_ptr)
+{
+    int host_len = host_step ? n : 1;
+    int reu_len = reu_step ? n : 1;
+    uint8_t host_before[0x100], host_slow[0x100];
+    uint8_t *reu_before = lib_malloc(reu_len);
+    uint8_t *reu_slow = lib_malloc(reu_len);
+    CLOCK clk_before = maincpu_clk, clk_slow;
+    CLOCK next = reu_dma_fast.next_event();
+    uint16_t host_slow_addr = host_addr;
+    unsigned int reu_slow_addr = reu_addr;
+    uint64_t start;
+    int i, same;
+
+    memcpy(host_before, host_ptr, host_len);
+    memcpy(reu_before, reu_ptr, reu_len);
+
+    start = profile_now_ns();
+    for (i = 0; i < n; i++) {
+        switch (op) {
+            case REU_DMA_TO_REU:
+                reu_dma_host_to_reu_byte(&host_slow_addr, &reu_slow_addr, host_step, reu_step);
+                break;
+            case REU_DMA_FROM_REU:
+                reu_dma_reu_to_host_byte(&host_slow_addr, &reu_slow_addr, host_step, reu_step);
+                break;
+            case REU_DMA_SWAP:
+                reu_dma_swap_byte(&host_slow_addr, &reu_slow_addr, host_step, reu_step);
+                break;
+            default:
+                reu_dma_compare_byte(&host_slow_addr, &reu_slow_addr, host_step, reu_step);
+                break;
+        }
+    }
+    reu_dma_stats.slow_ns += profile_now_ns() - start;
+
+    /* an event served on the way would have changed the next one */
+    same = (reu_dma_fast.next_event() == next);
+    clk_slow = maincpu_clk;
+    memcpy(host_slow, host_ptr, host_len);
+    memcpy(reu_slow, reu_ptr, reu_len);
+
+    memcpy(host_ptr, host_before, host_len);
+    memcpy(reu_ptr, reu_before, reu_len);
+    maincpu_clk = clk_before;
+
+    start = profile_now_ns();
+    reu_dma_fast_move(op, host_ptr, reu_ptr, host_step, reu_step, n);
+    maincpu_clk += (CLOCK)n * ((op == REU_DMA_SWAP) ? 2 : 1);
+    reu_dma_stats.fast_ns += profile_now_ns() - start;
+    reu_dma_fast_advance(&host_addr, &reu_addr, host_step, reu_step, n);
+
+    if (!same || maincpu_clk != clk_slow
+        || host_addr != host_slow_addr || reu_addr != reu_slow_addr
+        || memcmp(host_ptr, host_slow, host_len) != 0
+        || memcmp(reu_ptr, reu_slow, reu_len) != 0) {
+        reu_dma_stats.mismatches++;
+    }
+    reu_dma_stats.checked++;
+
+    lib_free(reu_before);
+    lib_free(reu_slow);
+}
+
+/*! \brief move the next span in one go if possible
+
+  \return
+    The number of bytes moved, 0 if the next byte has to be moved on its
+    own. For verify, only bytes that compare equal are moved.
+*/
+static int reu_dma_fast_step(int op, uint16_t *host_addr, unsigned int *reu_addr, int host_step, int reu_step, int len)
+{
+    uint8_t *host_ptr = NULL;
+    uint8_t *reu_ptr = NULL;
+    int n;
+
+    n = reu_dma_fast_span(op, *host_addr, *reu_addr, host_step, reu_step, len, &host_ptr, &reu_ptr);
+    if (n > 0 && op == REU_DMA_VERIFY) {
+        n = reu_dma_fast_equal(host_ptr, reu_ptr, host_step, reu_step, n);
+    }
+    if (n == 0) {
+        reu_dma_stats.slow_bytes++;
+        return 0;
+    }
+
+    if (reu_dma_fast.check) {
+        reu_dma_fast_check(op, *host_addr, *reu_addr, host_step, reu_step, n, host_ptr, reu_ptr);
+    } else {
+        reu_dma_fast_move(op, host_ptr, reu_ptr, host_step, reu_step, n);
+        maincpu_clk += (CLOCK)n * ((op == REU_DMA_SWAP) ? 2 : 1);
+    }
+    reu_dma_fast_advance(host_addr, reu_addr, host_step, reu_step, n);
+    reu_dma_stats.fast_bytes += n;
+
+    return n;
+}
+
+/* ------------------------------------------------------------------------- */
+
 /*! \brief DMA operation writing from the host to the REU
 
   \param host_addr
@@ -1166,7 +1530,8 @@ static void reu_dma_update_regs(uint16_t host_addr, unsigned int reu_addr, int l
 */
 static void reu_dma_host_to_reu(uint16_t host_addr, unsigned int reu_addr, int host_step, int reu_step, int len)
 {
-    uint8_t value;
+    int n;
+
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "copy ext $%05X %s<= main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1175,16 +1540,12 @@ static void reu_dma_host_to_reu(uint16_t host_addr, unsigned int reu_addr, int h
     assert(len >= 1);
 
     while (len) {
-        reu_clk_inc_pre();
-        machine_handle_pending_alarms(0);
-        value = mem_read(host_addr);
-        reu_clk_inc_post2();
-        DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Transferring byte: %x from main $%04X to ext $%05X.", value, host_addr, reu_addr));
-
-        store_to_reu(reu_addr, value);
-        host_addr = (host_addr + host_step) & 0xffff;
-        reu_addr = increment_reu_with_wrap_around(reu_addr, reu_step);
-        len--;
+        n = reu_dma_fast_step(REU_DMA_TO_REU, &host_addr, &reu_addr, host_step, reu_step, len);
+        if (n == 0) {
+            reu_dma_host_to_reu_byte(&host_addr, &reu_addr, host_step, reu_step);
+            n = 1;
+        }
+        len -= n;
     }
     DEBUG_LOG(DEBUG_LEVEL_REGISTER2, (reu_log, "END OF BLOCK"));
     reu_dma_update_regs(host_addr, reu_addr, ++len, REU_REG_R_STATUS_END_OF_BLOCK);
@@ -1209,7 +1570,8 @@ static void reu_dma_host_to_reu(uint16_t host_addr, unsigned int reu_addr, int h
 */
 static void reu_dma_reu_to_host(uint16_t host_addr, unsigned int reu_addr, int host_step, int reu_step, int len)
 {
-    uint8_t value;
+    int n;
+
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "copy ext $%05X %s=> main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1218,15 +1580,12 @@ static void reu_dma_reu_to_host(uint16_t host_addr, unsigned int reu_addr, int h
     assert(len >= 1);
 
     while (len) {
-        DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Transferring byte: %x from ext $%05X to main $%04X.", reu_ram[reu_addr % reu_size], reu_addr, host_addr));
-        reu_clk_inc_pre();
-        value = read_from_reu(reu_addr);
-        mem_store(host_addr, value);
-        reu_clk_inc_post();
-        machine_handle_pending_alarms(0);
-        host_addr = (host_addr + host_step) & 0xffff;
-        reu_addr = increment_reu_with_wrap_around(reu_addr, reu_step);
-        len--;
+        n = reu_dma_fast_step(REU_DMA_FROM_REU, &host_addr, &reu_addr, host_step, reu_step, len);
+        if (n == 0) {
+            reu_dma_reu_to_host_byte(&host_addr, &reu_addr, host_step, reu_step);
+            n = 1;
+        }
+        len -= n;
     }
     if (reu_ba.enabled && reu_ba.last_cycle) { /* extra cycle if ended while BA set */
        machine_handle_pending_alarms(0);
@@ -1255,8 +1614,8 @@ static void reu_dma_reu_to_host(uint16_t host_addr, unsigned int reu_addr, int h
 */
 static void reu_dma_swap(uint16_t host_addr, unsigned int reu_addr, int host_step, int reu_step, int len)
 {
-    uint8_t value_from_reu;
-    uint8_t value_from_c64;
+    int n;
+
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "swap ext $%05X %s<=> main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1265,20 +1624,12 @@ static void reu_dma_swap(uint16_t host_addr, unsigned int reu_addr, int host_ste
     assert(len >= 1);
 
     while (len) {
-        value_from_reu = read_from_reu(reu_addr);
-        reu_clk_inc_pre();
-        machine_handle_pending_alarms(0);
-        value_from_c64 = mem_read(host_addr);
-        reu_clk_inc_post2();
-        DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Exchanging bytes: %x from main $%04X with %x from ext $%05X.", value_from_c64, host_addr, value_from_reu, reu_addr));
-        store_to_reu(reu_addr, value_from_c64);
-        mem_store(host_addr, value_from_reu);
-        reu_clk_inc_pre();
-        reu_clk_inc_post();
-        machine_handle_pending_alarms(0);
-        host_addr = (host_addr + host_step) & 0xffff;
-        reu_addr = increment_reu_with_wrap_around(reu_addr, reu_step);
-        len--;
+        n = reu_dma_fast_step(REU_DMA_SWAP, &host_addr, &reu_addr, host_step, reu_step, len);
+        if (n == 0) {
+            reu_dma_swap_byte(&host_addr, &reu_addr, host_step, reu_step);
+            n = 1;
+        }
+        len -= n;
     }
     if (reu_ba.enabled && reu_ba.last_cycle) { /* extra cycle if ended while BA set */
        machine_handle_pending_alarms(0);       /* likely needed, but not confirmed yet */
@@ -1309,6 +1660,7 @@ static void reu_dma_compare(uint16_t host_addr, unsigned int reu_addr, int host_
 {
     uint8_t value_from_reu;
     uint8_t value_from_c64;
+    int n, equal;
 
     uint8_t new_status_or_mask = 0;
 
@@ -1325,17 +1677,18 @@ static void reu_dma_compare(uint16_t host_addr, unsigned int reu_addr, int host_
     /* rec.status &= ~ (REU_REG_R_STATUS_VERIFY_ERROR | REU_REG_R_STATUS_END_OF_BLOCK); */
 
     while (len) {
-        reu_clk_inc_pre();
-        machine_handle_pending_alarms(0);
-        value_from_reu = read_from_reu(reu_addr);
-        value_from_c64 = mem_read(host_addr);
-        reu_clk_inc_post2();
-        DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Comparing bytes: %x from main $%04X with %x from ext $%05X.", value_from_c64, host_addr, value_from_reu, reu_addr));
-        reu_addr = increment_reu_with_wrap_around(reu_addr, reu_step);
-        host_addr = (host_addr + host_step) & 0xffff;
+        /* equal bytes can go in one go, a difference always goes the
+           long way */
+        n = reu_dma_fast_step(REU_DMA_VERIFY, &host_addr, &reu_addr, host_step, reu_step, len);
+        if (n > 0) {
+            len -= n;
+            continue;
+        }
+
+        equal = reu_dma_compare_byte(&host_addr, &reu_addr, host_step, reu_step);
         len--;
 
-        if (value_from_reu != value_from_c64) {
+        if (!equal) {
             DEBUG_LOG(DEBUG_LEVEL_REGISTER, (reu_log, "VERIFY ERROR"));
             new_status_or_mask |= REU_REG_R_STATUS_VERIFY_ERROR;
 
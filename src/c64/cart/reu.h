@@ -48,6 +48,31 @@ extern void reu_ba_register(reu_ba_check_callback_t *ba_check,
                             reu_ba_steal_callback_t *ba_steal,
                             int *ba_var, int ba_mask);
 
+/* Plain RAM behind `addr' that a DMA may read (`write' 0) or write
+   directly, NULL if the page has to go through mem_read()/mem_store().  */
+typedef uint8_t *reu_dma_ram_callback_t (uint16_t addr, int write);
+/* The first clock at which machine_handle_pending_alarms() has
+   something to do.  */
+typedef CLOCK reu_dma_clk_callback_t (void);
+
+extern void reu_dma_fast_register(reu_dma_ram_callback_t *ram,
+                                  reu_dma_clk_callback_t *next_event);
+
+typedef struct reu_dma_stats_s {
+    unsigned long fast_bytes;   /* bytes moved in one go */
+    unsigned long slow_bytes;   /* bytes moved one at a time */
+    unsigned long checked;      /* spans also done one at a time */
+    unsigned long mismatches;   /* of those, the ones that came out different */
+    uint64_t fast_ns;
+    uint64_t slow_ns;
+} reu_dma_stats_t;
+
+/* Do every span that is moved in one go one byte at a time first, from
+   the same state, and compare.  */
+extern void reu_dma_set_check(int enable);
+extern void reu_dma_get_stats(reu_dma_stats_t *stats);
+extern void reu_dma_stats_reset(void);
+
 extern void reu_reset(void);
 extern void reu_dma(int immed);
 extern void reu_dma_start(void);
@@ -408,6 +408,16 @@ int machine_read_snapshot(const char *name, int event_mode)
     return c64_snapshot_read(name, event_mode);
 }
 
+int machine_write_snapshot_memory(snapshot_memory_t *mem, const snapshot_memory_t *base)
+{
+    return c64_snapshot_write_memory(mem, base);
+}
+
+int machine_read_snapshot_memory(snapshot_memory_t *mem)
+{
+    return c64_snapshot_read_memory(mem);
+}
+
 /* ------------------------------------------------------------------------- */
 
 int machine_autodetect_psid(const char *name)
@@ -49,7 +49,10 @@ static sound_chip_t sid_sound_chip = {
     sid_sound_machine_reset,
     sid_sound_machine_cycle_based,
     sid_sound_machine_channels,
-    1 /* chip enabled */
+    1, /* chip enabled */
+    sid_sound_machine_calculate_samples_batch,
+    sid_sound_machine_clock_silent,
+    sid_sound_machine_bus_ttl
 };
 
 static uint16_t sid_sound_chip_offset = 0;
@@ -192,7 +192,9 @@
 #undef HAVE_FULLSCREEN
 
 /* Define to 1 if you have the `getcwd' function. */
-#undef HAVE_GETCWD
+#ifndef PSVITA
+#define HAVE_GETCWD 1
+#endif
 
 /* Define to 1 if you have the `getdtablesize' function. */
 #undef HAVE_GETDTABLESIZE
@@ -801,7 +803,11 @@
 #define SIZEOF_UNSIGNED_INT 4
 
 /* The size of `unsigned long', as computed by sizeof. */
+#if defined(__LP64__)
+#define SIZEOF_UNSIGNED_LONG 8
+#else
 #define SIZEOF_UNSIGNED_LONG 4
+#endif
 
 /* The size of `unsigned short', as computed by sizeof. */
 #define SIZEOF_UNSIGNED_SHORT 2
@@ -881,8 +887,10 @@
 /* Enable SDL2 UI support. */
 // #define USE_SDLUI2
 
-/* Enable SDL sound support. */
+/* Enable SDL sound support (the headless build has no sound device). */
+#ifdef PSVITA
 #define USE_SDL_AUDIO
+#endif
 
 /* Enable SDL prefix for header inclusion. */
 //#define USE_SDL_PREFIX
@@ -52,6 +52,7 @@
 #include "types.h"
 #include "uiapi.h"
 #include "vice-event.h"
+#include "vsync.h"
 
 #ifdef DEBUG_TAPE
 #define DBG(x)  log_debug x
@@ -60,7 +61,6 @@
 #endif
 
 #define MOTOR_DELAY         32000
-#define TAP_BUFFER_LENGTH   100000
 
 /* at least every DATASETTE_MAX_GAP cycle there should be an alarm */
 #define DATASETTE_MAX_GAP   100000
@@ -69,8 +69,8 @@
 /* Attached TAP tape image.  */
 static tap_t *current_image = NULL;
 
-/* Buffer for the TAP */
-static uint8_t tap_buffer[TAP_BUFFER_LENGTH];
+/* The pulses of the TAP, in memory with the rest of the image */
+static const uint8_t *tap_buffer = NULL;
 
 /* Pointer and length of the tap-buffer */
 static long next_tap, last_tap;
@@ -122,6 +122,9 @@ static int datasette_tape_wobble = 0;
 /* datasette device enable */
 static int datasette_enable = 0;
 
+/* warp while the tape plays */
+static int datasette_turbo = 0;
+
 static log_t datasette_log = LOG_ERR;
 
 static void datasette_internal_reset(void);
@@ -166,6 +169,19 @@ void datasette_set_tape_sense(int sense)
     }
 }
 
+/* Turbo tape.  With DatasetteTurbo the emulation runs in warp mode
+   whenever the tape plays with the motor running, and the sound engines
+   only clock what the CPU can read back.  Every pulse still reaches the
+   loader at its cycle.  The WarpMode resource is left to the user.
+   Called whenever one of those changes.  */
+static void datasette_update_turbo(void)
+{
+    vsync_set_tape_turbo(datasette_turbo
+                         && datasette_motor
+                         && current_image != NULL
+                         && current_image->mode == DATASETTE_CONTROL_START);
+}
+
 /*******************************************************************************
     Resources
  ******************************************************************************/
@@ -232,6 +248,14 @@ static int set_datasette_enable(int value, void *param)
     return 0;
 }
 
+static int set_datasette_turbo(int val, void *param)
+{
+    datasette_turbo = val ? 1 : 0;
+    datasette_update_turbo();
+
+    return 0;
+}
+
 static const resource_int_t resources_int[] = {
     { "Datasette", 1, RES_EVENT_SAME, NULL,
       &datasette_enable,
@@ -248,6 +272,9 @@ static const resource_int_t resources_int[] = {
     { "DatasetteTapeWobble", 10, RES_EVENT_SAME, NULL,
       &datasette_tape_wobble,
       set_datasette_tape_wobble, NULL },
+    { "DatasetteTurbo", 0, RES_EVENT_NO, NULL,
+      &datasette_turbo,
+      set_datasette_turbo, NULL },
     RESOURCE_INT_LIST_END
 };
 
@@ -285,6 +312,12 @@ static const cmdline_option_t cmdline_options[] =
     { "-dstapewobble", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
       NULL, NULL, "DatasetteTapeWobble", NULL,
       "<value>", "Set maximum random number of cycles added to each gap in the tap" },
+    { "-dsturbo", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DatasetteTurbo", (resource_value_t)1,
+      NULL, "Enable warp mode while the tape plays" },
+    { "+dsturbo", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DatasetteTurbo", (resource_value_t)0,
+      NULL, "Disable warp mode while the tape plays" },
     CMDLINE_LIST_END
 };
 
@@ -332,19 +365,20 @@ void datasette_reset_counter(void)
 }
 
 
+/* Point the buffer at the pulses of the image in memory, so that
+   tap_buffer[next_tap] ~ current_file_seek_position.  */
+inline static void datasette_map_buffer(void)
+{
+    tap_buffer = current_image->data + current_image->offset;
+    next_tap = current_image->current_file_seek_position;
+    last_tap = (long)current_image->data_size - current_image->offset;
+}
+
 inline static int datasette_move_buffer_forward(int offset)
 {
-    /* reads buffer to fit the next gap-read
-       tap_buffer[next_tap] ~ current_file_seek_position
-    */
+    /* fits the next gap-read */
     if (next_tap + offset >= last_tap) {
-        if (fseek(current_image->fd, current_image->current_file_seek_position
-                  + current_image->offset, SEEK_SET)) {
-            log_error(datasette_log, "Cannot read in tap-file.");
-            return 0;
-        }
-        last_tap = (long)fread(tap_buffer, 1, TAP_BUFFER_LENGTH, current_image->fd);
-        next_tap = 0;
+        datasette_map_buffer();
         if (next_tap >= last_tap) {
             return 0;
         }
@@ -354,21 +388,9 @@ inline static int datasette_move_buffer_forward(int offset)
 
 inline static int datasette_move_buffer_back(int offset)
 {
-    /* reads buffer to fit the next gap-read at current_file_seek_position-1
-       tap_buffer[next_tap] ~ current_file_seek_position
-    */
+    /* fits the next gap-read at current_file_seek_position-1 */
     if (next_tap + offset < 0) {
-        if (current_image->current_file_seek_position >= TAP_BUFFER_LENGTH) {
-            next_tap = TAP_BUFFER_LENGTH;
-        } else {
-            next_tap = current_image->current_file_seek_position;
-        }
-        if (fseek(current_image->fd, current_image->current_file_seek_position
-                  - next_tap + current_image->offset, SEEK_SET)) {
-            log_error(datasette_log, "Cannot read in tap-file.");
-            return 0;
-        }
-        last_tap = (long)fread(tap_buffer, 1, TAP_BUFFER_LENGTH, current_image->fd);
+        datasette_map_buffer();
         if (next_tap > last_tap) {
             return 0;
         }
@@ -584,6 +606,7 @@ static void datasette_read_bit(CLOCK offset, void *data)
         motor_stop_clk = 0;
         ui_display_tape_motor_status(0);
         datasette_motor = 0;
+        datasette_update_turbo();
     }
     DBG(("datasette_read_bit(motor:%d)", datasette_motor));
 
@@ -750,6 +773,7 @@ void datasette_set_tape_image(tap_t *image)
     fullwave = 0;
 
     ui_set_tape_status(current_image ? 1 : 0);
+    datasette_update_turbo();
 }
 
 
@@ -826,9 +850,6 @@ void datasette_reset(void)
 static void datasette_start_motor(void)
 {
     DBG(("datasette_start_motor (image present:%s)", current_image ? "yes" : "no"));
-    if (current_image) {
-        fseek(current_image->fd, current_image->current_file_seek_position + current_image->offset, SEEK_SET);
-    }
     if (!datasette_alarm_pending) {
         alarm_set(datasette_alarm, maincpu_clk + MOTOR_DELAY);
         datasette_alarm_pending = 1;
@@ -963,6 +984,8 @@ static void datasette_control_internal(int command)
     }
     /* clear the tap-buffer */
     last_tap = next_tap = 0;
+
+    datasette_update_turbo();
 }
 
 void datasette_control(int command)
@@ -994,6 +1017,7 @@ static void datasette_set_motor(int flag)
             datasette_start_motor();
             ui_display_tape_motor_status(1);
             datasette_motor = 1;
+            datasette_update_turbo();
         }
     }
     if (!flag && datasette_motor && motor_stop_clk == 0) {
@@ -1024,19 +1048,20 @@ inline static void bit_write(void)
         return;
     }
 
+    /* the image in memory may move */
+    last_tap = next_tap = 0;
+
     if (write_time < (CLOCK)(255 * 8 + 7)) {
         write_gap = (uint8_t)(write_time / (CLOCK)8);
-        if (fwrite(&write_gap, 1, 1, current_image->fd) < 1) {
+        if (tap_write(current_image, &write_gap, 1) < 1) {
             datasette_control(DATASETTE_CONTROL_STOP);
             return;
         }
-        current_image->current_file_seek_position++;
     } else {
         write_gap = 0;
-        if (fwrite(&write_gap, 1, 1, current_image->fd) != 1) {
+        if (tap_write(current_image, &write_gap, 1) != 1) {
             log_debug("datasette bit_write failed.");
         }
-        current_image->current_file_seek_position++;
         if (current_image->version >= 1) {
             uint8_t long_gap[3];
             int bytes_written;
@@ -1044,17 +1069,13 @@ inline static void bit_write(void)
             long_gap[1] = (uint8_t)((write_time >> 8) & 0xff);
             long_gap[2] = (uint8_t)((write_time >> 16) & 0xff);
             write_time &= 0xffffff;
-            bytes_written = (int)fwrite(long_gap, 1, 3, current_image->fd);
-            current_image->current_file_seek_position += bytes_written;
+            bytes_written = tap_write(current_image, long_gap, 3);
             if (bytes_written < 3) {
                 datasette_control(DATASETTE_CONTROL_STOP);
                 return;
             }
         }
     }
-    if (current_image->size < current_image->current_file_seek_position) {
-        current_image->size = current_image->current_file_seek_position;
-    }
 
     current_image->cycle_counter += write_time / 8;
 
@@ -1066,7 +1087,6 @@ inline static void bit_write(void)
     if (current_image->cycle_counter_total < current_image->cycle_counter) {
         current_image->cycle_counter_total = current_image->cycle_counter;
     }
-    current_image->has_changed = 1;
     datasette_update_ui_counter();
 }
 
@@ -1202,6 +1222,7 @@ static int datasette_read_snapshot(snapshot_t *s)
     ui_set_tape_status(current_image ? 1 : 0);
     datasette_update_ui_counter();
     ui_display_tape_motor_status(datasette_motor);
+    datasette_update_turbo();
     if (current_image) {
         ui_display_tape_control_status(current_image->mode);
 
@@ -123,6 +123,7 @@ extern void disk_image_media_destroy(disk_image_t *image);
 
 extern int disk_image_open(disk_image_t *image);
 extern int disk_image_close(disk_image_t *image);
+extern int disk_image_flush(disk_image_t *image);
 
 extern int disk_image_read_sector(const disk_image_t *image, uint8_t *buf,
                                   const disk_addr_t *dadr);
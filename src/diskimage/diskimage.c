@@ -584,6 +584,16 @@ int disk_image_close(disk_image_t *image)
     return rc;
 }
 
+/* Write what was written to the image so far to its file.  Called when
+   the drive is idle; closing the image does it as well.  */
+int disk_image_flush(disk_image_t *image)
+{
+    if (image == NULL || image->device != DISK_IMAGE_DEVICE_FS) {
+        return 0;
+    }
+    return fsimage_flush(image);
+}
+
 /*-----------------------------------------------------------------------*/
 
 int disk_image_read_sector(const disk_image_t *image, uint8_t *buf, const disk_addr_t *dadr)
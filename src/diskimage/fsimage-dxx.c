@@ -106,7 +106,7 @@ int fsimage_dxx_write_half_track(disk_image_t *image, unsigned int half_track,
         offset += X64_HEADER_LENGTH;
     }
 
-    if (util_fpwrite(fsimage->fd, buffer, max_sector * 256, offset) < 0) {
+    if (fsimage_pwrite(image, buffer, max_sector * 256, offset) < 0) {
         log_error(fsimage_dxx_log, "Error writing T:%i to disk image.",
                   track);
         lib_free(buffer);
@@ -123,10 +123,10 @@ int fsimage_dxx_write_half_track(disk_image_t *image, unsigned int half_track,
 
             fsimage->error_info.dirty = 0;
             if (error_info_created) {
-                res = util_fpwrite(fsimage->fd, fsimage->error_info.map,
+                res = fsimage_pwrite(image, fsimage->error_info.map,
                                    fsimage->error_info.len, fsimage->error_info.len * 256);
             } else {
-                res = util_fpwrite(fsimage->fd, fsimage->error_info.map + sectors,
+                res = fsimage_pwrite(image, fsimage->error_info.map + sectors,
                                    max_sector, offset);
             }
             if (res < 0) {
@@ -137,8 +137,6 @@ int fsimage_dxx_write_half_track(disk_image_t *image, unsigned int half_track,
         }
     }
 
-    /* Make sure the stream is visible to other readers.  */
-    fflush(fsimage->fd);
     return 0;
 }
 
@@ -168,7 +166,7 @@ int fsimage_read_dxx_image(const disk_image_t *image)
 
     bam_id[0] = bam_id[1] = 0xa0;
     if (sectors >= 0) {
-        util_fpread(fsimage->fd, buffer, 256, sectors << 8);
+        fsimage_pread(image, buffer, 256, sectors << 8);
     }
     header.id1 = bam_id[0];
     header.id2 = bam_id[1];
@@ -194,7 +192,7 @@ int fsimage_read_dxx_image(const disk_image_t *image)
 
                 buffer[BAM_ID_1571] = buffer[BAM_ID_1571 + 1] = 0xa0;
                 if (sectors >= 0) {
-                    util_fpread(fsimage->fd, buffer, 256, sectors << 8);
+                    fsimage_pread(image, buffer, 256, sectors << 8);
                 }
                 header.id1 = buffer[BAM_ID_1571]; /* second side, update id and track */
                 header.id2 = buffer[BAM_ID_1571 + 1];
@@ -218,7 +216,7 @@ int fsimage_read_dxx_image(const disk_image_t *image)
 
                 if (sectors >= 0) {
                     rf = CBMDOS_FDC_ERR_DRIVE;
-                    if (util_fpread(fsimage->fd, buffer, 256, offset) >= 0) {
+                    if (fsimage_pread(image, buffer, 256, offset) >= 0) {
                         if (fsimage->error_info.map != NULL) {
                             rf = fsimage->error_info.map[sectors];
                         }
@@ -266,7 +264,7 @@ int fsimage_dxx_read_sector(const disk_image_t *image, uint8_t *buf, const disk_
     }
 
     if (image->gcr == NULL) {
-        if (util_fpread(fsimage->fd, buf, 256, offset) < 0) {
+        if (fsimage_pread(image, buf, 256, offset) < 0) {
             log_error(fsimage_dxx_log,
                       "Error reading T:%i S:%i from disk image.",
                       dadr->track, dadr->sector);
@@ -329,7 +327,7 @@ int fsimage_dxx_write_sector(disk_image_t *image, const uint8_t *buf, const disk
         offset += X64_HEADER_LENGTH;
     }
 
-    if (util_fpwrite(fsimage->fd, buf, 256, offset) < 0) {
+    if (fsimage_pwrite(image, buf, 256, offset) < 0) {
         log_error(fsimage_dxx_log, "Error writing T:%i S:%i to disk image.",
                   dadr->track, dadr->sector);
         return -1;
@@ -347,14 +345,12 @@ int fsimage_dxx_write_sector(disk_image_t *image, const uint8_t *buf, const disk
         }
 
         fsimage->error_info.map[sectors] = CBMDOS_FDC_ERR_OK;
-        if (util_fpwrite(fsimage->fd, &fsimage->error_info.map[sectors], 1, offset) < 0) {
+        if (fsimage_pwrite(image, &fsimage->error_info.map[sectors], 1, offset) < 0) {
             log_error(fsimage_dxx_log, "Error writing T:%i S:%i error info to disk image.",
                       dadr->track, dadr->sector);
         }
     }
 
-    /* Make sure the stream is visible to other readers.  */
-    fflush(fsimage->fd);
     return 0;
 }
 
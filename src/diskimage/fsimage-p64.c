@@ -53,13 +53,9 @@ int fsimage_read_p64_image(const disk_image_t *image)
     int lSize, rc;
     void *buffer;
 
-    fsimage_t *fsimage;
-
-    fsimage = image->media.fsimage;
-
-    lSize = util_file_length(fsimage->fd);
+    lSize = fsimage_length(image);
     buffer = lib_malloc(lSize);
-    if (util_fpread(fsimage->fd, buffer, lSize, 0) < 0) {
+    if (fsimage_pread(image, buffer, lSize, 0) < 0) {
         lib_free(buffer);
         log_error(fsimage_p64_log, "Could not read P64 disk image.");
         return -1;
@@ -89,18 +85,13 @@ int fsimage_write_p64_image(const disk_image_t *image)
     PP64Image P64Image = (void*)image->p64;
     int rc;
 
-    fsimage_t *fsimage;
-
-    fsimage = image->media.fsimage;
-
     P64MemoryStreamCreate(&P64MemoryStreamInstance);
     P64MemoryStreamClear(&P64MemoryStreamInstance);
     if (P64ImageWriteToStream(P64Image, &P64MemoryStreamInstance)) {
-        if (util_fpwrite(fsimage->fd, P64MemoryStreamInstance.Data, P64MemoryStreamInstance.Size, 0) < 0) {
+        if (fsimage_pwrite((disk_image_t *)image, P64MemoryStreamInstance.Data, P64MemoryStreamInstance.Size, 0) < 0) {
             rc = -1;
             log_error(fsimage_p64_log, "Could not write P64 disk image.");
         } else {
-            fflush(fsimage->fd);
             rc = 0;
         }
     } else {
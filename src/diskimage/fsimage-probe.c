@@ -84,7 +84,7 @@ static int disk_image_check_for_d64(disk_image_t *image)
          and compare this with the size of the given image. */
 
     int checkimage_tracks, checkimage_errorinfo;
-    size_t countbytes, checkimage_blocks, checkimage_realsize;
+    size_t checkimage_blocks, checkimage_realsize;
     fsimage_t *fsimage;
 
     fsimage = image->media.fsimage;
@@ -116,15 +116,7 @@ static int disk_image_check_for_d64(disk_image_t *image)
         }
     }
 
-    /*** test image file: read it (fgetc is pretty fast).
-         further size checks are no longer necessary (done during detection) */
-    rewind(fsimage->fd);
-    for (countbytes = 0; countbytes < checkimage_realsize; countbytes++) {
-        if (fgetc(fsimage->fd) == EOF) {
-            log_error(disk_image_probe_log, "Cannot read D64 image.");
-            return 0;
-        }
-    }
+    /*** no need to read it all here, fsimage_open() does that next */
 
     /*** set parameters in image structure, read error info */
     image->type = DISK_IMAGE_TYPE_D64;
@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "archdep.h"
 #include "diskconstants.h"
@@ -47,6 +48,8 @@
 
 static log_t fsimage_log = LOG_DEFAULT;
 
+#define FSIMAGE_BLOCK_SIZE 256
+
 
 /** \brief  Set image name
  *
@@ -146,13 +149,25 @@ int fsimage_open(disk_image_t *image)
         return -1;
     }
 
-    if (fsimage_probe(image) == 0) {
-        return 0;
+    if (fsimage_probe(image) < 0) {
+        log_message(fsimage_log, "Unknown disk image `%s'.", fsimage->name);
+        fsimage_close(image);
+        return -1;
     }
 
-    log_message(fsimage_log, "Unknown disk image `%s'.", fsimage->name);
-    fsimage_close(image);
-    return -1;
+    /* Sectors and tracks are served from memory from now on, instead of
+       seeking and reading each one.  */
+    fsimage->buffer.size = (size_t)util_file_length(fsimage->fd);
+    fsimage->buffer.data = lib_malloc(fsimage->buffer.size ? fsimage->buffer.size : 1);
+    fsimage->buffer.dirty = lib_calloc(1, fsimage->buffer.size / (FSIMAGE_BLOCK_SIZE * 8) + 1);
+    fsimage->buffer.dirty_blocks = 0;
+    if (util_fpread(fsimage->fd, fsimage->buffer.data, fsimage->buffer.size, 0) < 0) {
+        log_error(fsimage_log, "Cannot read file `%s'.", fsimage->name);
+        fsimage_close(image);
+        return -1;
+    }
+
+    return 0;
 }
 
 int fsimage_close(disk_image_t *image)
@@ -170,6 +185,14 @@ int fsimage_close(disk_image_t *image)
         fsimage_write_p64_image(image);
     }*/
 
+    fsimage_flush(image);
+    lib_free(fsimage->buffer.data);
+    lib_free(fsimage->buffer.dirty);
+    fsimage->buffer.data = NULL;
+    fsimage->buffer.dirty = NULL;
+    fsimage->buffer.size = 0;
+    fsimage->buffer.dirty_blocks = 0;
+
     if (fsimage->error_info.map) {
         lib_free(fsimage->error_info.map);
         fsimage->error_info.map = NULL;
@@ -182,6 +205,144 @@ int fsimage_close(disk_image_t *image)
 
 /*-----------------------------------------------------------------------*/
 
+/** \brief  Read \a num bytes at \a offset of the image
+ *
+ * \return  0 on success, -1 if they are not all in the image
+ */
+int fsimage_pread(const disk_image_t *image, void *buf, size_t num, long offset)
+{
+    fsimage_t *fsimage = image->media.fsimage;
+
+    if (fsimage->buffer.data == NULL) {
+        return util_fpread(fsimage->fd, buf, num, offset);
+    }
+    if (offset < 0 || (size_t)offset > fsimage->buffer.size
+        || num > fsimage->buffer.size - (size_t)offset) {
+        return -1;
+    }
+    memcpy(buf, fsimage->buffer.data + offset, num);
+    return 0;
+}
+
+/** \brief  Write \a num bytes at \a offset of the image
+ *
+ * The image grows if they go past its end.  Nothing reaches the file
+ * before fsimage_flush().
+ *
+ * \return  0 on success, -1 if the image is read only
+ */
+int fsimage_pwrite(disk_image_t *image, const void *buf, size_t num, long offset)
+{
+    fsimage_t *fsimage = image->media.fsimage;
+    size_t block, first, last;
+
+    if (fsimage->buffer.data == NULL) {
+        return util_fpwrite(fsimage->fd, buf, num, offset);
+    }
+    if (image->read_only || offset < 0) {
+        return -1;
+    }
+    if (num == 0) {
+        return 0;
+    }
+
+    first = (size_t)offset / FSIMAGE_BLOCK_SIZE;
+    if ((size_t)offset + num > fsimage->buffer.size) {
+        size_t size = (size_t)offset + num;
+        size_t old_map = fsimage->buffer.size / (FSIMAGE_BLOCK_SIZE * 8) + 1;
+        size_t new_map = size / (FSIMAGE_BLOCK_SIZE * 8) + 1;
+
+        fsimage->buffer.data = lib_realloc(fsimage->buffer.data, size);
+        memset(fsimage->buffer.data + fsimage->buffer.size, 0, size - fsimage->buffer.size);
+        if (new_map > old_map) {
+            fsimage->buffer.dirty = lib_realloc(fsimage->buffer.dirty, new_map);
+            memset(fsimage->buffer.dirty + old_map, 0, new_map - old_map);
+        }
+        /* The gap up to the new data has to reach the file as well.  */
+        if ((size_t)offset > fsimage->buffer.size) {
+            first = fsimage->buffer.size / FSIMAGE_BLOCK_SIZE;
+        }
+        fsimage->buffer.size = size;
+    }
+    memcpy(fsimage->buffer.data + offset, buf, num);
+
+    last = ((size_t)offset + num - 1) / FSIMAGE_BLOCK_SIZE;
+    for (block = first; block <= last; block++) {
+        if (!(fsimage->buffer.dirty[block >> 3] & (1 << (block & 7)))) {
+            fsimage->buffer.dirty[block >> 3] |= 1 << (block & 7);
+            fsimage->buffer.dirty_blocks++;
+        }
+    }
+    return 0;
+}
+
+long fsimage_length(const disk_image_t *image)
+{
+    fsimage_t *fsimage = image->media.fsimage;
+
+    if (fsimage->buffer.data == NULL) {
+        return (long)util_file_length(fsimage->fd);
+    }
+    return (long)fsimage->buffer.size;
+}
+
+/** \brief  Write the dirty blocks of \a image to its file
+ *
+ * Runs of dirty blocks are written with one call each.
+ *
+ * \return  0 on success, -1 if something could not be written; the blocks
+ *          that were not written stay dirty
+ */
+int fsimage_flush(disk_image_t *image)
+{
+    fsimage_t *fsimage = image->media.fsimage;
+    size_t block, first, blocks;
+    int retval = 0;
+
+    if (fsimage->fd == NULL || fsimage->buffer.dirty_blocks == 0) {
+        return 0;
+    }
+
+    blocks = (fsimage->buffer.size + FSIMAGE_BLOCK_SIZE - 1) / FSIMAGE_BLOCK_SIZE;
+    for (block = 0; block < blocks; ) {
+        size_t start, end;
+
+        if (fsimage->buffer.dirty[block >> 3] == 0) {
+            block = (block | 7) + 1;
+            continue;
+        }
+        if (!(fsimage->buffer.dirty[block >> 3] & (1 << (block & 7)))) {
+            block++;
+            continue;
+        }
+        first = block;
+        while (block < blocks && (fsimage->buffer.dirty[block >> 3] & (1 << (block & 7)))) {
+            block++;
+        }
+
+        start = first * FSIMAGE_BLOCK_SIZE;
+        end = block * FSIMAGE_BLOCK_SIZE;
+        if (end > fsimage->buffer.size) {
+            end = fsimage->buffer.size;
+        }
+        if (util_fpwrite(fsimage->fd, fsimage->buffer.data + start, end - start, (long)start) < 0) {
+            log_error(fsimage_log, "Cannot write to file `%s'.", fsimage->name);
+            retval = -1;
+            continue;
+        }
+        for (; first < block; first++) {
+            fsimage->buffer.dirty[first >> 3] &= ~(1 << (first & 7));
+            fsimage->buffer.dirty_blocks--;
+        }
+    }
+
+    /* Make sure the stream is visible to other readers.  */
+    fflush(fsimage->fd);
+    return retval;
+}
+
+/*-----------------------------------------------------------------------*/
+
 int fsimage_read_sector(const disk_image_t *image, uint8_t *buf, const disk_addr_t *dadr)
 {
     fsimage_t *fsimage;
@@ -42,6 +42,14 @@ typedef struct fsimage_s {
         int dirty;
         int len;
     } error_info;
+    /* The whole image, read once when it is opened.  Writes go here and
+       mark their 256 byte blocks dirty until fsimage_flush().  */
+    struct {
+        uint8_t *data;
+        size_t size;
+        uint8_t *dirty;         /* one bit per block */
+        unsigned int dirty_blocks;
+    } buffer;
 } fsimage_t;
 
 
@@ -60,4 +68,9 @@ extern int fsimage_read_sector(const struct disk_image_s *image, uint8_t *buf,
 extern int fsimage_write_sector(struct disk_image_s *image, const uint8_t *buf,
                                 const struct disk_addr_s *dadr);
 
+extern int fsimage_pread(const struct disk_image_s *image, void *buf, size_t num, long offset);
+extern int fsimage_pwrite(struct disk_image_s *image, const void *buf, size_t num, long offset);
+extern long fsimage_length(const struct disk_image_s *image);
+extern int fsimage_flush(struct disk_image_s *image);
+
 #endif
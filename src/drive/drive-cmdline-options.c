@@ -53,6 +53,20 @@ static const cmdline_option_t cmdline_options[] =
     { "-drivesoundvolume", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
       NULL, NULL, "DriveSoundEmulationVolume", NULL,
       "<Volume>", "Set volume for disk drive sound emulation (0-4000)" },
+    { "-drivefastrotation", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DriveFastRotation", (void *)1,
+      NULL, "Skip ahead over idle disk rotation of GCR images" },
+    { "+drivefastrotation", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DriveFastRotation", (void *)0,
+      NULL, "Simulate every bit cell of GCR images" },
+#ifdef USE_DRIVE_THREAD
+    { "-drivethread", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DriveThread", (void *)1,
+      NULL, "Run a single 1541 on a separate thread" },
+    { "+drivethread", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "DriveThread", (void *)0,
+      NULL, "Run disk drives on the emulation thread" },
+#endif
     CMDLINE_LIST_END
 };
 
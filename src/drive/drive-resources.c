@@ -30,6 +30,7 @@
 
 #include "drive-check.h"
 #include "drive-resources.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivecpu.h"
 #include "drivecpu65c02.h"
@@ -44,6 +45,7 @@
 #include "machine-bus.h"
 #include "machine-drive.h"
 #include "resources.h"
+#include "rotation.h"
 #include "vdrive-bam.h"
 
 
@@ -60,6 +62,8 @@ static int set_drive_true_emulation(int val, void *param)
     unsigned int dnr;
     drive_t *drive;
 
+    drive_thread_stop();
+
     drive_true_emulation = val ? 1 : 0;
 
     machine_bus_status_truedrive_set((unsigned int)drive_true_emulation);
@@ -93,6 +97,8 @@ static int set_drive_true_emulation(int val, void *param)
 
 static int set_drive_sound_emulation(int val, void *param)
 {
+    drive_thread_stop();
+
     drive_sound_emulation = val ? 1 : 0;
 
     return 0;
@@ -130,6 +136,8 @@ static int drive_resources_type(int val, void *param)
     dnr = vice_ptr_to_uint(param);
     drive = drive_context[dnr]->drive;
 
+    drive_thread_stop();
+
     type = (unsigned int)val;
     busses = iec_available_busses();
 
@@ -274,6 +282,8 @@ static int set_drive_idling_method(int val, void *param)
     dnr = vice_ptr_to_uint(param);
     drive = drive_context[dnr]->drive;
 
+    drive_thread_stop();
+
     /* FIXME: Maybe we should call `drive_cpu_execute()' here?  */
     switch (val) {
         case DRIVE_IDLE_SKIP_CYCLES:
@@ -302,6 +312,8 @@ static int set_drive_rpm(int val, void *param)
     dnr = vice_ptr_to_uint(param);
     drive = drive_context[dnr]->drive;
 
+    drive_thread_stop();
+
     drive->rpm = val;
     return 0;
 }
@@ -314,6 +326,8 @@ static int set_drive_rpm_wobble(int val, void *param)
     dnr = vice_ptr_to_uint(param);
     drive = drive_context[dnr]->drive;
 
+    drive_thread_stop();
+
     drive->rpm_wobble = val;
     return 0;
 }
@@ -331,6 +345,28 @@ static int set_drive_rtc_save(int val, void *param)
     return 0;
 }
 
+static int set_drive_fast_rotation(int val, void *param)
+{
+    drive_thread_stop();
+    rotation_fast_forward = val ? 1 : 0;
+
+    return 0;
+}
+
+#ifdef USE_DRIVE_THREAD
+static int set_drive_thread(int val, void *param)
+{
+    drive_thread_enabled = val ? 1 : 0;
+
+    /* it is taken at the next frame if switched on */
+    if (!drive_thread_enabled) {
+        drive_thread_stop();
+    }
+
+    return 0;
+}
+#endif
+
 static const resource_int_t resources_int[] = {
     { "DriveTrueEmulation", 1, RES_EVENT_STRICT, (resource_value_t)1,
       &drive_true_emulation, set_drive_true_emulation, NULL },
@@ -338,6 +374,12 @@ static const resource_int_t resources_int[] = {
       &drive_sound_emulation, set_drive_sound_emulation, NULL },
     { "DriveSoundEmulationVolume", 1000, RES_EVENT_NO, (resource_value_t)1000,
       &drive_sound_emulation_volume, set_drive_sound_emulation_volume, NULL },
+    { "DriveFastRotation", 1, RES_EVENT_NO, NULL,
+      &rotation_fast_forward, set_drive_fast_rotation, NULL },
+#ifdef USE_DRIVE_THREAD
+    { "DriveThread", 0, RES_EVENT_NO, NULL,
+      &drive_thread_enabled, set_drive_thread, NULL },
+#endif
     RESOURCE_INT_LIST_END
 };
 
@@ -35,6 +35,7 @@
 #include "diskimage.h"
 #include "drive-snapshot.h"
 #include "drive-sound.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivecpu.h"
 #include "drivecpu65c02.h"
@@ -118,6 +119,8 @@ int drive_snapshot_write_module(snapshot_t *s, int save_disks, int save_roms)
     int sync_factor;
     drive_t *drive;
 
+    drive_thread_stop();
+
     resources_get_int("DriveTrueEmulation", &drive_true_emulation);
 
     if (vdrive_snapshot_module_write(s, drive_true_emulation ? 10 : 8) < 0) {
@@ -311,6 +314,9 @@ int drive_snapshot_read_module(snapshot_t *s)
     int dummy;
     int half_track[DRIVE_NUM];
 
+    drive_thread_stop();
+    drive_thread_drop_pending();
+
     m = snapshot_module_open(s, snap_module_name,
                              &major_version, &minor_version);
     if (m == NULL) {
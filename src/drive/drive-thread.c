@@ -0,0 +1,829 @@
+/*
+ * drive-thread.c - Run a true emulation drive on its own thread.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * Without the thread the emulation runs the drive CPU up to the current
+ * cycle whenever the computer touches the serial bus, and once a frame.
+ * With it, the emulation keeps doing the arithmetic of drivecpu_execute()
+ * on a copy of the drive's clocks and hands the drive thread a list of
+ * events instead: "run up to S", "the computer wrote this to the bus
+ * when the drive was at S", "a frame ended at S".  The drive thread works
+ * through them in order and is free to run ahead of the newest one, up to
+ * most of a frame, as long as nothing it does depends on the computer.
+ *
+ * That holds for everything but the serial port of the first VIA.  While
+ * the thread runs, the VIA works on a bus of its own which only the drive
+ * thread touches.  Whenever the drive reads that VIA, writes anything but
+ * its port B, or is at an instruction where the ATN interrupt could be
+ * taken, it waits until the emulation has posted past its clock and
+ * applies the bus writes that belong before it.  The lines the drive puts
+ * on the bus go the other way, in a ring of (clock, value) pairs the
+ * emulation folds in when it reads the bus.  Both sides therefore see
+ * the other exactly as they would if the drive ran in lockstep; nothing
+ * is ever rolled back, the drive only stalls when it has to look.
+ *
+ * Only a single 1541 on the serial bus is taken over, and only when
+ * nothing else looks at its memory (monitor, watchpoints, drive sound,
+ * RAM expansions).  Everything outside that path that touches the drive
+ * first calls drive_thread_stop(), which lets the thread finish the
+ * events posted so far and hands the drive back; it is taken again at
+ * the next frame.  The drive may have run ahead of the emulation by then.
+ * It just waits in drivecpu_execute() until the emulation gets there, and
+ * the values it put on the bus meanwhile stay in the ring until then.
+ */
+
+#include "vice.h"
+
+#ifdef USE_DRIVE_THREAD
+
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <string.h>
+
+#include "6510core.h"
+#include "clkguard.h"
+#include "drive-thread.h"
+#include "drive.h"
+#include "drivecpu.h"
+#include "drivetypes.h"
+#include "iecbus.h"
+#include "interrupt.h"
+#include "log.h"
+#include "maincpu.h"
+#include "monitor.h"
+#include "mos6510.h"
+#include "profile.h"
+#include "resources.h"
+#include "rotation.h"
+#include "types.h"
+#include "via.h"
+#include "via1d1541.h"
+
+/* Both are powers of two.  */
+#define DRIVE_THREAD_EVENTS     4096
+#define DRIVE_THREAD_PORT       8192
+
+#define DRIVE_THREAD_SPINS      100
+
+/* Hand the drive back this long before its clock needs renumbering.  */
+#define DRIVE_THREAD_CLK_MARGIN 0x100000
+
+enum {
+    DRIVE_THREAD_RUN,
+    DRIVE_THREAD_WRITE,
+    DRIVE_THREAD_VSYNC,
+    DRIVE_THREAD_PARK
+};
+
+typedef struct drive_thread_event_s {
+    CLOCK stop;                 /* drive clock the lockstep run would end at */
+    CLOCK limit;                /* DRIVE_THREAD_VSYNC: how far to run ahead */
+    uint8_t type;
+    uint8_t cpu_bus;            /* DRIVE_THREAD_WRITE */
+    uint8_t atn_changed;
+} drive_thread_event_t;
+
+typedef struct drive_thread_port_s {
+    CLOCK clk;                  /* start of the instruction that wrote it */
+    uint8_t data;
+} drive_thread_port_t;
+
+typedef struct drive_thread_s {
+    drive_context_t *drv;
+    unsigned int unit;
+    pthread_t thread;
+    sem_t wakeup;
+
+    /* emulation thread: what drivecpu_execute() would have by now */
+    CLOCK last_clk;
+    CLOCK stop_clk;
+    CLOCK cycle_accum;
+    uint8_t port_data;
+
+    /* drive thread */
+    iecbus_t bus;
+    CLOCK boundary;             /* start of the current instruction */
+    CLOCK prev_boundary;        /* start of the one before */
+    CLOCK limit;
+    uint8_t last_data;
+    int parked;
+
+    /* shared */
+    drive_thread_event_t events[DRIVE_THREAD_EVENTS];
+    unsigned int events_head;
+    unsigned int events_tail;
+    CLOCK posted;               /* stop of the newest event */
+    int park;
+    drive_thread_port_t port[DRIVE_THREAD_PORT];
+    unsigned int port_head;
+    unsigned int port_tail;
+    CLOCK pos;                  /* drive clock at the last instruction boundary */
+    int sleeping;
+    int done;
+    drive_thread_stats_t stats;
+} drive_thread_t;
+
+int drive_thread_enabled = 0;
+int drive_thread_port_pending = 0;
+
+static drive_thread_t drive_thread;
+static int drive_thread_running = 0;
+static drive_thread_stats_t drive_thread_totals;
+
+static CLOCK vsync_last_clk = 0;
+static CLOCK frame_cycles = 0;
+
+static int clk_guard_added[DRIVE_NUM];
+
+/* ------------------------------------------------------------------------- */
+
+#define STAT_INC(x) __atomic_store_n(&(x), (x) + 1, __ATOMIC_RELAXED)
+
+/* Recompute what the drive puts on the bus, as iecbus.c does.  */
+static void drive_thread_update_bus(iecbus_t *bus, unsigned int unit)
+{
+    uint8_t data = bus->drv_data[unit];
+    unsigned int i;
+
+    bus->drv_bus[unit] = (((data << 3) & 0x40)
+                          | ((data << 6) & ((~data ^ bus->cpu_bus) << 3) & 0x80));
+
+    bus->cpu_port = bus->cpu_bus;
+    for (i = 4; i < 8 + DRIVE_NUM; i++) {
+        bus->cpu_port &= bus->drv_bus[i];
+    }
+
+    bus->drv_port = (((bus->cpu_port >> 4) & 0x4)
+                     | (bus->cpu_port >> 7)
+                     | ((bus->cpu_bus << 3) & 0x80));
+}
+
+static void drive_thread_wake(drive_thread_t *t)
+{
+    if (__atomic_load_n(&t->sleeping, __ATOMIC_SEQ_CST)
+        && __atomic_exchange_n(&t->sleeping, 0, __ATOMIC_SEQ_CST)) {
+        sem_post(&t->wakeup);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* Drive thread.  */
+
+/* Wait until the emulation posts something after `head'.  */
+static void drive_thread_wait(drive_thread_t *t, unsigned int head)
+{
+    int spins = 0;
+
+    STAT_INC(t->stats.stalls);
+
+    while (__atomic_load_n(&t->events_head, __ATOMIC_ACQUIRE) == head) {
+        if (spins++ < DRIVE_THREAD_SPINS) {
+            sched_yield();
+            continue;
+        }
+        __atomic_store_n(&t->sleeping, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&t->events_head, __ATOMIC_SEQ_CST) == head) {
+            sem_wait(&t->wakeup);
+        }
+        __atomic_store_n(&t->sleeping, 0, __ATOMIC_SEQ_CST);
+        spins = 0;
+    }
+}
+
+static void drive_thread_drain(drive_thread_t *t, CLOCK clk, int late);
+
+/* Record a new value on port B, written by the instruction that started
+   at `boundary'.  The next one starts at `clk'.  */
+static void drive_thread_push_port(drive_thread_t *t, CLOCK clk)
+{
+    uint8_t data = t->bus.drv_data[t->unit];
+    unsigned int head = t->port_head;
+
+    if (data == t->last_data) {
+        return;
+    }
+
+    while (head - __atomic_load_n(&t->port_tail, __ATOMIC_ACQUIRE) == DRIVE_THREAD_PORT) {
+        /* the emulation may be waiting for room to post */
+        drive_thread_drain(t, clk, 0);
+        sched_yield();
+    }
+
+    t->port[head & (DRIVE_THREAD_PORT - 1)].clk = t->boundary;
+    t->port[head & (DRIVE_THREAD_PORT - 1)].data = data;
+    __atomic_store_n(&t->port_head, head + 1, __ATOMIC_RELEASE);
+
+    t->last_data = data;
+}
+
+static void drive_thread_apply(drive_thread_t *t, const drive_thread_event_t *event)
+{
+    drive_context_t *drv = t->drv;
+
+    switch (event->type) {
+        case DRIVE_THREAD_WRITE:
+            t->bus.cpu_bus = event->cpu_bus;
+            if (event->atn_changed) {
+                viacore_signal(drv->via1d1541, VIA_SIG_CA1,
+                               (event->cpu_bus & 0x10) ? 0 : VIA_SIG_RISE);
+            }
+            drive_thread_update_bus(&t->bus, t->unit);
+            break;
+        case DRIVE_THREAD_VSYNC:
+            drive_update_ui_drive_status(drv->mynumber);
+            if (drv->drive->idling_method == DRIVE_IDLE_NO_IDLE) {
+                /* if drive is never idle, also rotate the disk. this prevents
+                 * huge peaks in cpu usage when the drive must catch up with
+                 * a longer period of time.
+                 */
+                rotation_rotate_disk(drv->drive);
+            }
+            t->limit = event->limit;
+            break;
+        default:
+            break;
+    }
+}
+
+/* Apply the events that belong before the instruction at `clk'.  Sets
+   `parked' when the emulation wants the drive back there.  */
+static void drive_thread_drain(drive_thread_t *t, CLOCK clk, int late)
+{
+    unsigned int tail = t->events_tail;
+    unsigned int head = __atomic_load_n(&t->events_head, __ATOMIC_ACQUIRE);
+    const drive_thread_event_t *event;
+
+    while (tail != head) {
+        event = &t->events[tail & (DRIVE_THREAD_EVENTS - 1)];
+        if ((int)(event->stop - clk) > 0) {
+            break;
+        }
+        if (event->type == DRIVE_THREAD_PARK) {
+            t->parked = 1;
+            break;
+        }
+        if (event->type != DRIVE_THREAD_RUN
+            && (late || (int)(event->stop - t->prev_boundary) <= 0)) {
+            STAT_INC(t->stats.late);
+        }
+        drive_thread_apply(t, event);
+        tail++;
+    }
+
+    if (tail != t->events_tail) {
+        __atomic_store_n(&t->events_tail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+/* Wait until the emulation has posted past `clk' and apply what belongs
+   before it.  */
+static void drive_thread_sync(drive_thread_t *t, CLOCK clk, int late)
+{
+    unsigned int head;
+
+    for (;;) {
+        head = __atomic_load_n(&t->events_head, __ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&t->park, __ATOMIC_ACQUIRE)
+            || (int)(__atomic_load_n(&t->posted, __ATOMIC_ACQUIRE) - clk) > 0) {
+            break;
+        }
+        /* keep the queue moving while we wait */
+        drive_thread_drain(t, clk, late);
+        drive_thread_wait(t, head);
+    }
+
+    drive_thread_drain(t, clk, late);
+}
+
+/* Can the ATN interrupt be taken before the next instruction?  */
+static int drive_thread_irq_window(drive_context_t *drv)
+{
+    drivecpu_context_t *cpu = drv->cpu;
+    unsigned int pc;
+    uint8_t *base;
+
+    if (!(drv->via1d1541->ier & VIA_IM_CA1)) {
+        return 0;
+    }
+    if (!(cpu->cpu_regs.p & P_INTERRUPT)
+        || OPINFO_DISABLES_IRQ(cpu->last_opcode_info)) {
+        return 1;
+    }
+
+    /* CLI, PLP and RTI can let it in right after themselves.  */
+    pc = cpu->cpu_regs.pc;
+    base = drv->cpud->read_base_tab_ptr[pc >> 8];
+    if (base == NULL) {
+        return 1;
+    }
+    switch (base[pc]) {
+        case 0x58:
+        case 0x28:
+        case 0x40:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+int drive_thread_boundary(drive_context_t *drv)
+{
+    drive_thread_t *t = drv->thread;
+    CLOCK clk = *(drv->clk_ptr);
+
+    if (clk != t->boundary) {
+        drive_thread_push_port(t, clk);
+        t->prev_boundary = t->boundary;
+        t->boundary = clk;
+        __atomic_store_n(&t->pos, clk, __ATOMIC_RELEASE);
+    }
+
+    if (drive_thread_irq_window(drv)) {
+        drive_thread_sync(t, clk, 0);
+    } else {
+        drive_thread_drain(t, clk, 0);
+    }
+
+    return t->parked ? -1 : 0;
+}
+
+void drive_thread_observe(drive_context_t *drv)
+{
+    drive_thread_t *t = drv->thread;
+
+    drive_thread_sync(t, t->boundary, 1);
+}
+
+CLOCK drive_thread_trap_stop_clk(drive_context_t *drv)
+{
+    drive_thread_t *t = drv->thread;
+    const drive_thread_event_t *event;
+
+    drive_thread_sync(t, t->boundary, 1);
+
+    /* The idle loop may skip to the next point the computer can change
+       anything, which is the first event still pending.  */
+    if (!t->parked
+        && t->events_tail != __atomic_load_n(&t->events_head, __ATOMIC_ACQUIRE)) {
+        event = &t->events[t->events_tail & (DRIVE_THREAD_EVENTS - 1)];
+        if (event->type != DRIVE_THREAD_PARK) {
+            return event->stop;
+        }
+    }
+
+    return t->boundary;
+}
+
+static void *drive_thread_main(void *arg)
+{
+    drive_thread_t *t = arg;
+    drive_context_t *drv = t->drv;
+    unsigned int head;
+    CLOCK stop;
+#ifdef VICE_PROFILE
+    uint64_t start_ns;
+    CLOCK start_clk;
+#endif
+
+    while (drive_thread_boundary(drv) == 0) {
+        head = __atomic_load_n(&t->events_head, __ATOMIC_ACQUIRE);
+        stop = __atomic_load_n(&t->posted, __ATOMIC_ACQUIRE);
+        if ((int)(t->limit - stop) > 0) {
+            stop = t->limit;
+        }
+
+        if ((int)(*(drv->clk_ptr) - stop) >= 0) {
+            drive_thread_wait(t, head);
+            continue;
+        }
+
+        drv->cpu->stop_clk = stop;
+#ifdef VICE_PROFILE
+        start_ns = profile_now_ns();
+        start_clk = *(drv->clk_ptr);
+#endif
+        drivecpu_run(drv);
+        PROFILE_COUNT(PROFILE_COUNT_DRIVE_CYCLES, *(drv->clk_ptr) - start_clk);
+        PROFILE_ADD(PROFILE_DRIVECPU, profile_now_ns() - start_ns);
+    }
+
+    __atomic_store_n(&t->done, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Emulation thread.  */
+
+/* Take the port values written before `clk' off the ring.  */
+static void drive_thread_fold_port(drive_thread_t *t, CLOCK clk)
+{
+    unsigned int tail = t->port_tail;
+    unsigned int head = __atomic_load_n(&t->port_head, __ATOMIC_ACQUIRE);
+    const drive_thread_port_t *entry;
+
+    while (tail != head) {
+        entry = &t->port[tail & (DRIVE_THREAD_PORT - 1)];
+        if ((int)(entry->clk - clk) >= 0) {
+            break;
+        }
+        t->port_data = entry->data;
+        tail++;
+    }
+
+    __atomic_store_n(&t->port_tail, tail, __ATOMIC_RELEASE);
+}
+
+static void drive_thread_post(drive_thread_t *t, int type, CLOCK limit,
+                              uint8_t cpu_bus, int atn_changed)
+{
+    unsigned int head = t->events_head;
+    drive_thread_event_t *event;
+
+    while (head - __atomic_load_n(&t->events_tail, __ATOMIC_ACQUIRE) == DRIVE_THREAD_EVENTS) {
+        drive_thread_wake(t);
+        drive_thread_fold_port(t, t->stop_clk);
+        sched_yield();
+    }
+
+    event = &t->events[head & (DRIVE_THREAD_EVENTS - 1)];
+    event->stop = t->stop_clk;
+    event->limit = limit;
+    event->type = (uint8_t)type;
+    event->cpu_bus = cpu_bus;
+    event->atn_changed = (uint8_t)atn_changed;
+
+    __atomic_store_n(&t->events_head, head + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&t->posted, t->stop_clk, __ATOMIC_RELEASE);
+    t->stats.events++;
+
+    drive_thread_wake(t);
+}
+
+/* What drivecpu_execute() does to the clocks, on the copy.  */
+static void drive_thread_advance(drive_thread_t *t, CLOCK clk)
+{
+    /* drivecpu_wake_up() */
+    if (maincpu_clk - t->last_clk > 0xffffff
+        && __atomic_load_n(&t->pos, __ATOMIC_ACQUIRE) > 934639) {
+        log_message(t->drv->drive->log, "Skipping cycles.");
+        t->last_clk = maincpu_clk;
+    }
+
+    drivecpu_advance_stop_clk(t->drv, clk, t->last_clk, &t->stop_clk, &t->cycle_accum);
+    t->last_clk = clk;
+}
+
+/* Wait until the drive has reached `clk'.  */
+static void drive_thread_wait_pos(drive_thread_t *t, CLOCK clk)
+{
+    if ((int)(__atomic_load_n(&t->pos, __ATOMIC_ACQUIRE) - clk) >= 0) {
+        return;
+    }
+
+    t->stats.waits++;
+    drive_thread_wake(t);
+
+    while ((int)(__atomic_load_n(&t->pos, __ATOMIC_ACQUIRE) - clk) < 0) {
+        drive_thread_fold_port(t, clk);
+        sched_yield();
+    }
+}
+
+void drive_thread_execute(drive_context_t *drv, CLOCK clk)
+{
+    drive_thread_t *t = drv->thread;
+    CLOCK stop = t->stop_clk;
+
+    drive_thread_advance(t, clk);
+    if (t->stop_clk != stop) {
+        drive_thread_post(t, DRIVE_THREAD_RUN, 0, 0, 0);
+    }
+}
+
+uint8_t drive_thread_cpu_read(drive_context_t *drv, CLOCK clk)
+{
+    drive_thread_t *t = drv->thread;
+
+    drive_thread_execute(drv, clk);
+    drive_thread_wait_pos(t, t->stop_clk);
+    drive_thread_fold_port(t, t->stop_clk);
+
+    return t->port_data;
+}
+
+void drive_thread_cpu_write(drive_context_t *drv, uint8_t cpu_bus, int atn_changed,
+                            CLOCK clk)
+{
+    drive_thread_t *t = drv->thread;
+
+    drive_thread_advance(t, clk);
+    drive_thread_post(t, DRIVE_THREAD_WRITE, 0, cpu_bus, atn_changed);
+}
+
+/* Drive cycles the thread may run ahead of the emulation.  */
+static CLOCK drive_thread_lead(drive_context_t *drv)
+{
+    CLOCK cycles = frame_cycles - frame_cycles / 8;
+
+    return (CLOCK)(((uint64_t)cycles * drv->cpud->sync_factor) >> 16);
+}
+
+void drive_thread_vsync(drive_context_t *drv, CLOCK clk)
+{
+    drive_thread_t *t = drv->thread;
+
+    drive_thread_advance(t, clk);
+    drive_thread_post(t, DRIVE_THREAD_VSYNC, t->stop_clk + drive_thread_lead(drv), 0, 0);
+    drive_thread_fold_port(t, t->stop_clk);
+}
+
+static drive_context_t *drive_thread_eligible(void)
+{
+    drive_context_t *drv;
+    drive_t *drive;
+    int dnr, i, sound = 0;
+
+    if (!drive_thread_enabled) {
+        return NULL;
+    }
+
+    dnr = iecbus_sole_truedrive();
+    if (dnr < 0) {
+        return NULL;
+    }
+    for (i = 0; i < DRIVE_NUM; i++) {
+        if (i != dnr && drive_context[i]->drive->enable) {
+            return NULL;
+        }
+    }
+
+    drv = drive_context[dnr];
+    drive = drv->drive;
+
+    switch (drive->type) {
+        case DRIVE_TYPE_1540:
+        case DRIVE_TYPE_1541:
+        case DRIVE_TYPE_1541II:
+            break;
+        default:
+            return NULL;
+    }
+
+    if (!drive->enable
+        || drive->idling_method == DRIVE_IDLE_SKIP_CYCLES
+        || drive->parallel_cable != DRIVE_PC_NONE
+        || drive->drive_ram2_enabled || drive->drive_ram4_enabled
+        || drive->drive_ram6_enabled || drive->drive_ram8_enabled
+        || drive->drive_rama_enabled
+        || drive->profdos || drive->supercard || drive->stardos) {
+        return NULL;
+    }
+
+    if (resources_get_int("DriveSoundEmulation", &sound) < 0 || sound) {
+        return NULL;
+    }
+
+    /* The monitor and watchpoints look at the drive from this thread.  */
+    if (monitor_mask[drv->cpu->monspace]
+        || (drv->cpu->int_status->global_pending_int & IK_MONITOR)
+        || drv->cpud->read_func_ptr != drv->cpud->read_tab[0]) {
+        return NULL;
+    }
+
+    return drv;
+}
+
+/* Put what the drive drives now on the bus, as store_prb() in
+   via1d1541.c does.  */
+static void drive_thread_put_port(drive_thread_t *t)
+{
+    iecbus_t *bus = iecbus_drive_port();
+
+    bus->drv_data[t->unit] = t->port_data;
+    drive_thread_update_bus(bus, t->unit);
+}
+
+void drive_thread_fold_pending(drive_context_t *drv)
+{
+    drive_thread_t *t = &drive_thread;
+    uint8_t data = t->port_data;
+
+    if (drv != t->drv) {
+        return;
+    }
+
+    drive_thread_fold_port(t, drv->cpu->stop_clk);
+    if (t->port_data != data) {
+        drive_thread_put_port(t);
+    }
+    drive_thread_port_pending = t->port_tail != t->port_head;
+}
+
+void drive_thread_drop_pending(void)
+{
+    drive_thread_t *t = &drive_thread;
+
+    if (drive_thread_running) {
+        return;
+    }
+    t->port_tail = t->port_head;
+    drive_thread_port_pending = 0;
+}
+
+/* The drive clock got renumbered while values were still pending.  */
+static void drive_thread_clk_overflow_callback(CLOCK sub, void *data)
+{
+    drive_thread_t *t = &drive_thread;
+    unsigned int tail;
+
+    if (!drive_thread_port_pending || data != t->drv) {
+        return;
+    }
+    for (tail = t->port_tail; tail != t->port_head; tail++) {
+        t->port[tail & (DRIVE_THREAD_PORT - 1)].clk -= sub;
+    }
+}
+
+static void drive_thread_start(drive_context_t *drv)
+{
+    drive_thread_t *t = &drive_thread;
+    drivecpu_context_t *cpu = drv->cpu;
+
+    if (!clk_guard_added[drv->mynumber]) {
+        clk_guard_add_callback(cpu->clk_guard, drive_thread_clk_overflow_callback, drv);
+        clk_guard_added[drv->mynumber] = 1;
+    }
+
+    t->drv = drv;
+    t->unit = drv->mynumber + 8;
+
+    t->last_clk = cpu->last_clk;
+    t->stop_clk = cpu->stop_clk;
+    t->cycle_accum = cpu->cycle_accum;
+
+    memcpy(&t->bus, iecbus_drive_port(), sizeof(iecbus_t));
+    t->port_data = t->bus.drv_data[t->unit];
+    t->last_data = t->port_data;
+
+    t->boundary = *(drv->clk_ptr);
+    t->prev_boundary = cpu->stop_clk - 1;
+    t->limit = cpu->stop_clk + drive_thread_lead(drv);
+    t->parked = 0;
+
+    t->events_head = 0;
+    t->events_tail = 0;
+    t->posted = cpu->stop_clk;
+    t->park = 0;
+    t->port_head = 0;
+    t->port_tail = 0;
+    t->pos = t->boundary;
+    t->sleeping = 0;
+    t->done = 0;
+    memset(&t->stats, 0, sizeof(drive_thread_stats_t));
+
+    if (sem_init(&t->wakeup, 0, 0) != 0) {
+        log_error(LOG_DEFAULT, "Cannot create the drive thread, using none.");
+        drive_thread_enabled = 0;
+        return;
+    }
+
+    via1d1541_set_iecbus(drv, &t->bus);
+    drv->thread = t;
+
+    if (pthread_create(&t->thread, NULL, drive_thread_main, t) != 0) {
+        log_error(LOG_DEFAULT, "Cannot create the drive thread, using none.");
+        drv->thread = NULL;
+        via1d1541_set_iecbus(drv, NULL);
+        sem_destroy(&t->wakeup);
+        drive_thread_enabled = 0;
+        return;
+    }
+
+    drive_thread_running = 1;
+    t->stats.starts = 1;
+}
+
+void drive_thread_stop(void)
+{
+    drive_thread_t *t = &drive_thread;
+    drive_context_t *drv = t->drv;
+    drivecpu_context_t *cpu;
+
+    if (!drive_thread_running || pthread_equal(pthread_self(), t->thread)) {
+        return;
+    }
+
+    /* Let the drive catch up with everything posted and stop there.  */
+    drive_thread_post(t, DRIVE_THREAD_PARK, 0, 0, 0);
+    __atomic_store_n(&t->park, 1, __ATOMIC_RELEASE);
+    drive_thread_wake(t);
+
+    while (!__atomic_load_n(&t->done, __ATOMIC_ACQUIRE)) {
+        drive_thread_fold_port(t, t->stop_clk);
+        if (__atomic_load_n(&t->port_head, __ATOMIC_ACQUIRE) - t->port_tail
+            == DRIVE_THREAD_PORT) {
+            /* a full ring of values ahead of us, give up on the oldest */
+            t->port_data = t->port[t->port_tail & (DRIVE_THREAD_PORT - 1)].data;
+            __atomic_store_n(&t->port_tail, t->port_tail + 1, __ATOMIC_RELEASE);
+        }
+        drive_thread_wake(t);
+        sched_yield();
+    }
+    pthread_join(t->thread, NULL);
+    sem_destroy(&t->wakeup);
+    drive_thread_running = 0;
+
+    cpu = drv->cpu;
+    cpu->last_clk = t->last_clk;
+    cpu->stop_clk = t->stop_clk;
+    cpu->cycle_accum = t->cycle_accum;
+
+    /* The drive may have run past the last event.  The bus gets what it
+       put there up to the emulation's clock, the rest stays pending for
+       drivecpu_execute() to hand on when the emulation gets there.  */
+    drive_thread_fold_port(t, t->stop_clk);
+    drive_thread_put_port(t);
+    via1d1541_set_iecbus(drv, NULL);
+    drv->thread = NULL;
+    (*iecbus_update_ports)();
+    drive_thread_port_pending = t->port_tail != t->port_head;
+
+    drive_thread_totals.starts += t->stats.starts;
+    drive_thread_totals.events += t->stats.events;
+    drive_thread_totals.late += t->stats.late;
+    drive_thread_totals.waits += t->stats.waits;
+    drive_thread_totals.stalls += t->stats.stalls;
+    memset(&t->stats, 0, sizeof(drive_thread_stats_t));
+}
+
+void drive_thread_vsync_end(void)
+{
+    CLOCK cycles = maincpu_clk - vsync_last_clk;
+    drive_context_t *drv;
+
+    /* A renumbered clock gives one bogus frame; keep the last one.  */
+    if (cycles < 0x100000) {
+        frame_cycles = cycles;
+    }
+    vsync_last_clk = maincpu_clk;
+
+    drv = drive_thread_eligible();
+    if (drive_thread_running && drv != drive_thread.drv) {
+        drive_thread_stop();
+    }
+    if (!drive_thread_running && drv != NULL && frame_cycles != 0
+        && !drive_thread_port_pending) {
+        drive_thread_start(drv);
+    }
+}
+
+void drive_thread_prevent_clk_overflow(CLOCK sub)
+{
+    if (!drive_thread_running) {
+        return;
+    }
+
+    if (sub != 0
+        || __atomic_load_n(&drive_thread.pos, __ATOMIC_ACQUIRE)
+           > CLOCK_MAX - CLKGUARD_SUB_MIN - DRIVE_THREAD_CLK_MARGIN) {
+        drive_thread_stop();
+    }
+}
+
+void drive_thread_get_stats(drive_thread_stats_t *stats)
+{
+    drive_thread_t *t = &drive_thread;
+
+    *stats = drive_thread_totals;
+    if (drive_thread_running) {
+        stats->starts += t->stats.starts;
+        stats->events += t->stats.events;
+        stats->late += __atomic_load_n(&t->stats.late, __ATOMIC_RELAXED);
+        stats->waits += t->stats.waits;
+        stats->stalls += __atomic_load_n(&t->stats.stalls, __ATOMIC_RELAXED);
+    }
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * drive-thread.h - Run a true emulation drive on its own thread.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_DRIVE_THREAD_H
+#define VICE_DRIVE_THREAD_H
+
+#include "types.h"
+
+struct drive_context_s;
+
+typedef struct drive_thread_stats_s {
+    unsigned long starts;       /* times the thread took the drive */
+    unsigned long events;       /* bus accesses and frames handed over */
+    unsigned long late;         /* of those, done after the point they belong to */
+    unsigned long waits;        /* times the emulation waited for the drive */
+    unsigned long stalls;       /* times the drive waited for the emulation */
+} drive_thread_stats_t;
+
+#ifdef USE_DRIVE_THREAD
+
+/* The DriveThread resource.  */
+extern int drive_thread_enabled;
+
+/* Set while the drive, handed back ahead of the emulation, still has
+   values for the bus that belong after the emulation's clock.  */
+extern int drive_thread_port_pending;
+
+/* Emulation thread.  */
+extern void drive_thread_vsync(struct drive_context_s *drv, CLOCK clk);
+extern void drive_thread_vsync_end(void);
+extern void drive_thread_execute(struct drive_context_s *drv, CLOCK clk);
+extern uint8_t drive_thread_cpu_read(struct drive_context_s *drv, CLOCK clk);
+extern void drive_thread_cpu_write(struct drive_context_s *drv, uint8_t cpu_bus,
+                                   int atn_changed, CLOCK clk);
+extern void drive_thread_prevent_clk_overflow(CLOCK sub);
+extern void drive_thread_stop(void);
+extern void drive_thread_get_stats(drive_thread_stats_t *stats);
+
+/* Emulation thread, after drive_thread_stop(): put the pending values
+   before the drive's stop_clk on the bus, or forget them all when the
+   drive is reset or replaced.  */
+extern void drive_thread_fold_pending(struct drive_context_s *drv);
+extern void drive_thread_drop_pending(void);
+
+/* Drive thread, from the drive CPU and its VIA.  */
+extern int drive_thread_boundary(struct drive_context_s *drv);
+extern void drive_thread_observe(struct drive_context_s *drv);
+extern CLOCK drive_thread_trap_stop_clk(struct drive_context_s *drv);
+
+#else
+
+#define drive_thread_stop()
+#define drive_thread_drop_pending()
+
+#endif
+
+#endif
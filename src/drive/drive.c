@@ -49,6 +49,7 @@
 #include "diskimage.h"
 #include "drive-check.h"
 #include "drive-overflow.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivecpu.h"
 #include "drivecpu65c02.h"
@@ -94,6 +95,8 @@ void drive_set_disk_memory(uint8_t *id, unsigned int track, unsigned int sector,
 {
     drive_t *drive;
 
+    drive_thread_stop();
+
     drive = drv->drive;
 
     if (drive->type == DRIVE_TYPE_1540
@@ -118,6 +121,8 @@ void drive_set_last_read(unsigned int track, unsigned int sector, uint8_t *buffe
     drive_t *drive;
     int side = 0;
 
+    drive_thread_stop();
+
     drive = drv->drive;
 
     drive_gcr_data_writeback(drive);
@@ -268,6 +273,8 @@ void drive_shutdown(void)
         return;
     }
 
+    drive_thread_stop();
+
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
         if (drive_context[dnr]->drive->type == DRIVE_TYPE_2000 || drive_context[dnr]->drive->type == DRIVE_TYPE_4000) {
             drivecpu65c02_shutdown(drive_context[dnr]);
@@ -340,6 +347,8 @@ int drive_set_disk_drive_type(unsigned int type, struct drive_context_s *drv)
         return -1;
     }
 
+    drive_thread_stop();
+
     drive = drv->drive;
     rotation_rotate_disk(drive);
 
@@ -426,6 +435,8 @@ int drive_enable(drive_context_t *drv)
         return -1;
     }
 
+    drive_thread_stop();
+
     resources_get_int("DriveTrueEmulation", &drive_true_emulation);
 
     /* Always disable kernal traps. */
@@ -464,6 +475,9 @@ void drive_disable(drive_context_t *drv)
 
     drive = drv->drive;
 
+    drive_thread_stop();
+    drive_thread_drop_pending();
+
     /* This must come first, because this might be called before the true
        drive initialization.  */
     drive->enable = 0;
@@ -503,8 +517,16 @@ void drive_cpu_prevent_clk_overflow_all(CLOCK sub)
 {
     unsigned int dnr;
 
+#ifdef USE_DRIVE_THREAD
+    drive_thread_prevent_clk_overflow(sub);
+#endif
+
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
         drive_t *drive = drive_context[dnr]->drive;
+        if (drive_context[dnr]->thread != NULL) {
+            /* renumbered once it is handed back */
+            continue;
+        }
         if (drive->type == DRIVE_TYPE_2000 || drive->type == DRIVE_TYPE_4000) {
             drivecpu65c02_prevent_clk_overflow(drive_context[dnr], sub);
         } else {
@@ -516,6 +538,8 @@ void drive_cpu_prevent_clk_overflow_all(CLOCK sub)
 void drive_cpu_trigger_reset(unsigned int dnr)
 {
     drive_t *drive = drive_context[dnr]->drive;
+
+    drive_thread_stop();
     if (drive->type == DRIVE_TYPE_2000 || drive->type == DRIVE_TYPE_4000) {
         drivecpu65c02_trigger_reset(dnr);
     } else {
@@ -529,6 +553,8 @@ void drive_reset(void)
     unsigned int dnr;
     drive_t *drive;
 
+    drive_thread_stop();
+
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
         drive = drive_context[dnr]->drive;
 
@@ -667,11 +693,24 @@ void drive_gcr_data_writeback(drive_t *drive)
     drive->GCR_dirty_track = 0;
 }
 
+/* The motor stopped: write the track back and the image to its file,
+   instead of leaving both until the head moves or the image is detached.  */
+void drive_gcr_data_flush(drive_t *drive)
+{
+    if (drive->image == NULL) {
+        return;
+    }
+    drive_gcr_data_writeback(drive);
+    disk_image_flush(drive->image);
+}
+
 void drive_gcr_data_writeback_all(void)
 {
     drive_t *drive;
     unsigned int i;
 
+    drive_thread_stop();
+
     for (i = 0; i < DRIVE_NUM; i++) {
         drive = drive_context[i]->drive;
         drive_gcr_data_writeback(drive);
@@ -742,36 +781,45 @@ static void drive_led_update(drive_t *drive, drive_t *drive0)
 }
 
 /* Update the status bar in the UI.  */
-void drive_update_ui_status(void)
+/* Update the LED and the track indicator of drive `dnr'.  */
+void drive_update_ui_drive_status(unsigned int dnr)
 {
-    int i;
+    drive_t *drive = drive_context[dnr]->drive;
+    drive_t *drive0 = drive->drive0;
+    int dual = drive0 && drive0->enable;
 
     if (console_mode || (machine_class == VICE_MACHINE_VSID)) {
         return;
     }
 
-    /* Update the LEDs and the track indicators.  */
-    for (i = 0; i < DRIVE_NUM; i++) {
-        drive_t *drive = drive_context[i]->drive;
-        drive_t *drive0 = drive->drive0;
-        int dual = drive0 && drive0->enable;
+    if (drive->enable || dual) {
+        if (!drive0) {
+            drive0 = drive;
+        }
 
-        if (drive->enable || dual) {
-            if (!drive0) {
-                drive0 = drive;
-            }
+        drive_led_update(drive, drive0);
 
-            drive_led_update(drive, drive0);
+        if (drive->current_half_track != drive->old_half_track
+            || drive->side != drive->old_side) {
+            drive->old_half_track = drive->current_half_track;
+            drive->old_side = drive->side;
+            dual = dual || drive->drive1;   /* also include drive 0 */
+            ui_display_drive_track(dnr,
+                                   dual ? 0 : 8,
+                                   drive->current_half_track + (drive->side * DRIVE_HALFTRACKS_1571));
+        }
+    }
+}
 
-            if (drive->current_half_track != drive->old_half_track
-                || drive->side != drive->old_side) {
-                drive->old_half_track = drive->current_half_track;
-                drive->old_side = drive->side;
-                dual = dual || drive->drive1;   /* also include drive 0 */
-                ui_display_drive_track(i,
-                                       dual ? 0 : 8,
-                                       drive->current_half_track + (drive->side * DRIVE_HALFTRACKS_1571));
-            }
+void drive_update_ui_status(void)
+{
+    unsigned int i;
+
+    /* Update the LEDs and the track indicators.  A drive on its own
+       thread does this itself.  */
+    for (i = 0; i < DRIVE_NUM; i++) {
+        if (drive_context[i]->thread == NULL) {
+            drive_update_ui_drive_status(i);
         }
     }
 }
@@ -798,6 +846,13 @@ void drive_cpu_execute_one(drive_context_t *drv, CLOCK clk_value)
 {
     drive_t *drive = drv->drive;
 
+#ifdef USE_DRIVE_THREAD
+    if (drv->thread != NULL) {
+        drive_thread_execute(drv, clk_value);
+        return;
+    }
+#endif
+
     if (drive->type == DRIVE_TYPE_2000 || drive->type == DRIVE_TYPE_4000) {
         drivecpu65c02_execute(drv, clk_value);
     } else {
@@ -839,6 +894,12 @@ void drive_vsync_hook(void)
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
         drive_t *drive = drive_context[dnr]->drive;
         if (drive->enable) {
+#ifdef USE_DRIVE_THREAD
+            if (drive_context[dnr]->thread != NULL) {
+                drive_thread_vsync(drive_context[dnr], maincpu_clk);
+                continue;
+            }
+#endif
             if (drive->idling_method != DRIVE_IDLE_SKIP_CYCLES) {
                 drive_cpu_execute_one(drive_context[dnr], maincpu_clk);
             }
@@ -852,6 +913,10 @@ void drive_vsync_hook(void)
             /* printf("drive_vsync_hook drv %d @clk:%d\n", dnr, maincpu_clk); */
         }
     }
+
+#ifdef USE_DRIVE_THREAD
+    drive_thread_vsync_end();
+#endif
 }
 
 /* ------------------------------------------------------------------------- */
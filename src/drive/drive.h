@@ -358,7 +358,9 @@ extern void drive_vsync_hook(void);
 extern int drive_get_disk_drive_type(int dnr);
 extern void drive_enable_update_ui(struct drive_context_s *drv);
 extern void drive_update_ui_status(void);
+extern void drive_update_ui_drive_status(unsigned int dnr);
 extern void drive_gcr_data_writeback(struct drive_s *drive);
+extern void drive_gcr_data_flush(struct drive_s *drive);
 extern void drive_gcr_data_writeback_all(void);
 extern void drive_set_active_led_color(unsigned int type, unsigned int dnr);
 extern int drive_set_disk_drive_type(unsigned int drive_type,
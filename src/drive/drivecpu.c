@@ -40,6 +40,7 @@
 #include "drive.h"
 #include "drivecpu.h"
 #include "drive-check.h"
+#include "drive-thread.h"
 #include "drivemem.h"
 #include "drivetypes.h"
 #include "interrupt.h"
@@ -50,6 +51,7 @@
 #include "mem.h"
 #include "monitor.h"
 #include "mos6510.h"
+#include "profile.h"
 #include "rotation.h"
 #include "snapshot.h"
 #include "types.h"
@@ -120,6 +122,7 @@ void drivecpu_setup_context(struct drive_context_s *drv, int i)
         drv->cpu->clk_guard = clk_guard_new(drv->clk_ptr, CLOCK_MAX - CLKGUARD_SUB_MIN);
 
         drv->cpu->alarm_context = alarm_context_new(drv->cpu->identification_string);
+        drv->cpu->alarm_context->profile_counter = PROFILE_COUNT_DRIVE_ALARMS;
     }
 }
 
@@ -182,6 +185,8 @@ void drivecpu_reset(drive_context_t *drv)
 {
     int preserve_monitor;
 
+    drive_thread_drop_pending();
+
     *(drv->clk_ptr) = 0;
     drivecpu_reset_clk(drv);
 
@@ -285,11 +290,17 @@ inline static uint32_t drive_trap_handler(drive_context_t *drv)
         MOS6510_REGS_SET_PC(&(drv->cpu->cpu_regs), drv->drive->trapcont);
         if (drv->drive->idling_method == DRIVE_IDLE_TRAP_IDLE) {
             CLOCK next_clk;
+            CLOCK stop_clk = drv->cpu->stop_clk;
 
+#ifdef USE_DRIVE_THREAD
+            if (drv->thread != NULL) {
+                stop_clk = drive_thread_trap_stop_clk(drv);
+            }
+#endif
             next_clk = alarm_context_next_pending_clk(drv->cpu->alarm_context);
 
-            if (next_clk > drv->cpu->stop_clk) {
-                next_clk = drv->cpu->stop_clk;
+            if (next_clk > stop_clk) {
+                next_clk = stop_clk;
             }
 
             *(drv->clk_ptr) = next_clk;
@@ -365,12 +376,71 @@ inline static int interrupt_check_irq_delay(interrupt_cpu_status_t *cs,
 #pragma optimize("",off)
 #endif
 /* -------------------------------------------------------------------------- */
+/* Move `*stop_clk' on by the drive cycles that correspond to the main CPU
+   cycles from `last_clk' to `clk_value'.  The remainder is kept in
+   `*cycle_accum'.  */
+void drivecpu_advance_stop_clk(drive_context_t *drv, CLOCK clk_value, CLOCK last_clk,
+                               CLOCK *stop_clk, CLOCK *cycle_accum)
+{
+    CLOCK cycles;
+    int tcycles;
+
+    /* Calculate number of main CPU clocks to emulate */
+    if (clk_value > last_clk) {
+        cycles = clk_value - last_clk;
+    } else {
+        cycles = 0;
+    }
+
+    while (cycles != 0) {
+        tcycles = cycles > 10000 ? 10000 : cycles;
+        cycles -= tcycles;
+
+        *cycle_accum += drv->cpud->sync_factor * tcycles;
+        *stop_clk += *cycle_accum >> 16;
+        *cycle_accum &= 0xffff;
+    }
+}
+
 /* Execute up to the current main CPU clock value.  This automatically
    calculates the corresponding number of clock ticks in the drive.  */
 void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
 {
-    CLOCK cycles;
-    int tcycles;
+    drivecpu_context_t *cpu;
+#ifdef VICE_PROFILE
+    CLOCK start_clk;
+#endif
+
+    cpu = drv->cpu;
+
+    PROFILE_ENTER(PROFILE_DRIVECPU);
+
+    drivecpu_wake_up(drv);
+
+    drivecpu_advance_stop_clk(drv, clk_value, cpu->last_clk,
+                              &cpu->stop_clk, &cpu->cycle_accum);
+
+#ifdef USE_DRIVE_THREAD
+    if (drive_thread_port_pending) {
+        drive_thread_fold_pending(drv);
+    }
+#endif
+
+#ifdef VICE_PROFILE
+    start_clk = *(drv->clk_ptr);
+#endif
+    drivecpu_run(drv);
+    PROFILE_COUNT(PROFILE_COUNT_DRIVE_CYCLES, *(drv->clk_ptr) - start_clk);
+
+    cpu->last_clk = clk_value;
+    drivecpu_sleep(drv);
+
+    PROFILE_LEAVE();
+}
+
+/* Run the drive CPU until its clock reaches `stop_clk'.  */
+void drivecpu_run(drive_context_t *drv)
+{
     drivecpu_context_t *cpu;
 
 #define reg_a   (cpu->cpu_regs.a)
@@ -384,29 +454,16 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
 
     cpu = drv->cpu;
 
-    drivecpu_wake_up(drv);
-
-    /* Calculate number of main CPU clocks to emulate */
-    if (clk_value > cpu->last_clk) {
-        cycles = clk_value - cpu->last_clk;
-    } else {
-        cycles = 0;
-    }
-
-    while (cycles != 0) {
-        tcycles = cycles > 10000 ? 10000 : cycles;
-        cycles -= tcycles;
-
-        cpu->cycle_accum += drv->cpud->sync_factor * tcycles;
-        cpu->stop_clk += cpu->cycle_accum >> 16;
-        cpu->cycle_accum &= 0xffff;
-    }
-
     /* Run drive CPU emulation until the stop_clk clock has been reached.
      * There appears to be a nasty 32-bit overflow problem here, so we
      * paper over it by only considering subtractions of 2nd complement
      * integers. */
     while ((int) (*(drv->clk_ptr) - cpu->stop_clk) < 0) {
+#ifdef USE_DRIVE_THREAD
+        if (drv->thread != NULL && drive_thread_boundary(drv) < 0) {
+            break;
+        }
+#endif
 /* Include the 6502/6510 CPU emulation core.  */
 
 #define CLK (*(drv->clk_ptr))
@@ -451,9 +508,6 @@ void drivecpu_execute(drive_context_t *drv, CLOCK clk_value)
 
 #include "6510core.c"
     }
-
-    cpu->last_clk = clk_value;
-    drivecpu_sleep(drv);
 }
 
 #ifdef _MSC_VER
@@ -55,6 +55,9 @@ extern void drivecpu_trigger_reset(unsigned int dnr);
 extern void drivecpu_set_overflow(struct drive_context_s *drv);
 
 extern void drivecpu_execute(struct drive_context_s *drv, CLOCK clk_value);
+extern void drivecpu_advance_stop_clk(struct drive_context_s *drv, CLOCK clk_value,
+                                      CLOCK last_clk, CLOCK *stop_clk, CLOCK *cycle_accum);
+extern void drivecpu_run(struct drive_context_s *drv);
 extern int drivecpu_snapshot_write_module(struct drive_context_s *drv,
                                           struct snapshot_s *s);
 extern int drivecpu_snapshot_read_module(struct drive_context_s *drv,
@@ -111,6 +111,7 @@ void drivecpu65c02_setup_context(struct drive_context_s *drv, int i)
         drv->cpu->clk_guard = clk_guard_new(drv->clk_ptr, CLOCK_MAX - CLKGUARD_SUB_MIN);
 
         drv->cpu->alarm_context = alarm_context_new(drv->cpu->identification_string);
+        drv->cpu->alarm_context->profile_counter = PROFILE_COUNT_DRIVE_ALARMS;
     }
 }
 
@@ -31,6 +31,7 @@
 
 #include "diskconstants.h"
 #include "diskimage.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "driveimage.h"
 #include "drivetypes.h"
@@ -134,6 +135,8 @@ int drive_image_attach(disk_image_t *image, unsigned int unit)
         return -1;
     }
 
+    drive_thread_stop();
+
     dnr = unit - 8;
     drive = drive_context[dnr]->drive;
 
@@ -193,6 +196,8 @@ int drive_image_detach(disk_image_t *image, unsigned int unit)
         return -1;
     }
 
+    drive_thread_stop();
+
     dnr = unit - 8;
     drive = drive_context[dnr]->drive;
 
@@ -31,6 +31,7 @@
 #include <string.h>
 
 #include "ciad.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivemem.h"
 #include "driverom.h"
@@ -101,6 +102,8 @@ void drivemem_toggle_watchpoints(int flag, void *context)
 {
     drive_context_t *drv = (drive_context_t *)context;
 
+    drive_thread_stop();
+
     if (flag) {
         drv->cpud->read_func_ptr = read_tab_watch;
         drv->cpud->store_func_ptr = store_tab_watch;
@@ -153,6 +156,8 @@ uint8_t drivemem_bank_read(int bank, uint16_t addr, void *context)
 {
     drive_context_t *drv = (drive_context_t *)context;
 
+    drive_thread_stop();
+
     return drv->cpud->read_func_ptr[addr >> 8](drv, addr);
 }
 
@@ -160,6 +165,8 @@ uint8_t drivemem_bank_peek(int bank, uint16_t addr, void *context)
 {
     drive_context_t *drv = (drive_context_t *)context;
 
+    drive_thread_stop();
+
     return drv->cpud->peek_func_ptr[addr >> 8](drv, addr);
 }
 
@@ -167,6 +174,8 @@ void drivemem_bank_store(int bank, uint16_t addr, uint8_t value, void *context)
 {
     drive_context_t *drv = (drive_context_t *)context;
 
+    drive_thread_stop();
+
     drv->cpud->store_func_ptr[addr >> 8](drv, addr, value);
 }
 
@@ -176,6 +185,8 @@ void drivemem_init(drive_context_t *drv, unsigned int type)
 {
     int i;
 
+    drive_thread_stop();
+
     /* setup watchpoint tables */
     if (!read_tab_watch[0]) {
         read_tab_watch[0] = drive_zero_read_watch;
@@ -29,6 +29,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivetypes.h"
 #include "driverom.h"
@@ -78,6 +79,8 @@ int driverom_load(const char *resource_name, uint8_t *drive_rom, unsigned
         return 0;
     }
 
+    drive_thread_stop();
+
     resources_get_string(resource_name, &rom_name);
 
     filesize = sysfile_load(rom_name, drive_rom, min, max);
@@ -127,6 +130,8 @@ int driverom_load_images(void)
 
 void driverom_initialize_traps(drive_t *drive)
 {
+    drive_thread_stop();
+
     memcpy(drive->trap_rom, drive->rom, DRIVE_ROM_SIZE);
 
     drive->trap = -1;
@@ -30,6 +30,7 @@
 #include <math.h>
 #endif
 
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivesync.h"
 #include "drivetypes.h"
@@ -54,6 +55,8 @@ void drive_set_machine_parameter(long cycles_per_sec)
 {
     unsigned int dnr;
 
+    drive_thread_stop();
+
     sync_factor = (unsigned int)floor(65536.0 * (1000000.0 / ((double)cycles_per_sec)));
 
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
@@ -183,6 +183,9 @@ typedef struct drive_context_s {
     struct tpi_context_s *tpid;
     struct pc8477_s *pc8477;
     struct wd1770_s *wd1770;
+
+    /* Set while the CPU runs on its own thread (drive-thread.c).  */
+    struct drive_thread_s *thread;
 } drive_context_t;
 
 #endif
@@ -29,6 +29,7 @@
 #include <stdio.h>
 
 #include "c64exp-resources.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivemem.h"
 #include "lib.h"
@@ -62,6 +63,8 @@ static int set_drive_parallel_cable(int val, void *param)
 {
     drive_t *drive = drive_context[vice_ptr_to_uint(param)]->drive;
 
+    drive_thread_stop();
+
     switch (val) {
         case DRIVE_PC_NONE:
         case DRIVE_PC_STANDARD:
@@ -82,6 +85,8 @@ static int set_drive_profdos(int val, void *param)
 {
     drive_t *drive = drive_context[vice_ptr_to_uint(param)]->drive;
 
+    drive_thread_stop();
+
     drive->profdos = val ? 1 : 0;
     set_drive_ram(vice_ptr_to_uint(param));
 
@@ -101,6 +106,8 @@ static int set_drive_supercard(int val, void *param)
 {
     drive_t *drive = drive_context[vice_ptr_to_uint(param)]->drive;
 
+    drive_thread_stop();
+
     drive->supercard = val ? 1 : 0;
     set_drive_ram(vice_ptr_to_uint(param));
 
@@ -120,6 +127,8 @@ static int set_drive_stardos(int val, void *param)
 {
     drive_t *drive = drive_context[vice_ptr_to_uint(param)]->drive;
 
+    drive_thread_stop();
+
     drive->stardos = val ? 1 : 0;
 
     return 0;
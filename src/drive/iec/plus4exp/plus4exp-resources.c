@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivemem.h"
 #include "lib.h"
@@ -53,6 +54,8 @@ static int set_drive_parallel_cable(int val, void *param)
 {
     drive_t *drive = drive_context[vice_ptr_to_uint(param)]->drive;
 
+    drive_thread_stop();
+
     switch (val) {
         case DRIVE_PC_NONE:
         case DRIVE_PC_STANDARD:
@@ -32,6 +32,7 @@
 #include <stdio.h>
 
 #include "debug.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivesync.h"
 #include "drivetypes.h"
@@ -60,11 +61,22 @@ typedef struct drivevia1_context_s {
 
 void via1d1541_store(drive_context_t *ctxptr, uint16_t addr, uint8_t data)
 {
+#ifdef USE_DRIVE_THREAD
+    /* Only what goes out on port B is independent of the computer.  */
+    if (ctxptr->thread != NULL && (addr & 0xf) != VIA_PRB) {
+        drive_thread_observe(ctxptr);
+    }
+#endif
     viacore_store(ctxptr->via1d1541, addr, data);
 }
 
 uint8_t via1d1541_read(drive_context_t *ctxptr, uint16_t addr)
 {
+#ifdef USE_DRIVE_THREAD
+    if (ctxptr->thread != NULL) {
+        drive_thread_observe(ctxptr);
+    }
+#endif
     return viacore_read(ctxptr->via1d1541, addr);
 }
 
@@ -341,6 +353,17 @@ static uint8_t read_prb(via_context_t *via_context)
     return byte;
 }
 
+/* The drive thread gives the VIA a bus of its own while it runs, NULL
+   goes back to the machine's.  */
+void via1d1541_set_iecbus(drive_context_t *ctxptr, struct iecbus_s *bus)
+{
+    drivevia1_context_t *via1p;
+
+    via1p = (drivevia1_context_t *)(ctxptr->via1d1541->prv);
+
+    iecbus = bus != NULL ? bus : iecbus_drive_port();
+}
+
 void via1d1541_init(drive_context_t *ctxptr)
 {
     viacore_init(ctxptr->via1d1541, ctxptr->cpu->alarm_context,
@@ -31,6 +31,7 @@
 #include "types.h"
 
 struct drive_context_s;
+struct iecbus_s;
 struct via_context_s;
 
 extern void via1d1541_setup_context(struct drive_context_s *ctxptr);
@@ -41,4 +42,6 @@ extern uint8_t via1d1541_read(struct drive_context_s *ctxptr, uint16_t addr);
 extern uint8_t via1d1541_peek(struct drive_context_s *ctxptr, uint16_t addr);
 extern int via1d1541_dump(drive_context_t *ctxptr, uint16_t addr);
 
+extern void via1d1541_set_iecbus(struct drive_context_s *ctxptr, struct iecbus_s *bus);
+
 #endif
@@ -299,6 +299,7 @@ static void store_prb(via_context_t *via_context, uint8_t byte, uint8_t poldpb,
                drive_cpu_set_overflow(dc);
                drv->byte_ready_edge = 0;
             }
+            drive_gcr_data_flush(drv);
         }
     }
 
@@ -43,6 +43,12 @@
 
 #define ROTATION_TABLE_SIZE 0x1000
 
+/* Fast forward only over stretches of at least this many bits.  */
+#define ROTATION_SKIP_MIN_BITS  64
+
+/* Bits always left to the cell by cell simulation.  */
+#define ROTATION_SKIP_SETTLE    8
+
 
 struct rotation_s {
     uint32_t accum;
@@ -78,12 +84,17 @@ struct rotation_s {
     uint32_t seed;
 
     uint32_t xorShift32;
+
+    uint32_t wobble_rand; /* own generator, rand() is shared with the computer */
 };
 typedef struct rotation_s rotation_t;
 
 
 static rotation_t rotation[DRIVE_NUM];
 
+/* The DriveFastRotation resource.  */
+int rotation_fast_forward = 1;
+
 /* Speed (in bps) of the disk in the 4 disk areas.  */
 static const unsigned int rot_speed_bps[2][4] = { { 250000, 266667, 285714, 307692 },
                                                   { 125000, 133333, 142857, 153846 } };
@@ -97,6 +108,7 @@ void rotation_init(int freq, unsigned int dnr)
     rotation[dnr].uf4_counter = 0;
     rotation[dnr].fr_randcount = 0;
     rotation[dnr].xorShift32 = 0x1234abcd;
+    rotation[dnr].wobble_rand = 0x2545f491;
     rotation[dnr].filter_counter = 0;
     rotation[dnr].filter_state = 0;
     rotation[dnr].filter_last_state = 0;
@@ -119,6 +131,7 @@ void rotation_reset(drive_t *drive)
     rotation[dnr].accum = 0;
     rotation[dnr].seed = 0;
     rotation[dnr].xorShift32 = 0x1234abcd;
+    rotation[dnr].wobble_rand = 0x2545f491;
     rotation[dnr].rotation_last_clk = *(drive->clk);
     rotation[dnr].ue7_counter = 0;
     rotation[dnr].uf4_counter = 0;
@@ -284,6 +297,20 @@ inline static uint32_t RANDOM_nextUInt(rotation_t *rptr)
     return rptr->xorShift32 ^= (rptr->xorShift32 << 5);
 }
 
+/* The RPM wobble, -wobble/2 ... +wobble/2.  The drive may run on its own
+   thread, so the draws cannot come from rand(): the order of the calls
+   from both threads would decide the outcome.  */
+inline static int rotation_wobble(drive_t *dptr, rotation_t *rptr)
+{
+    if (!dptr->rpm_wobble) {
+        return 0;
+    }
+    rptr->wobble_rand ^= (rptr->wobble_rand << 13);
+    rptr->wobble_rand ^= (rptr->wobble_rand >> 17);
+    rptr->wobble_rand ^= (rptr->wobble_rand << 5);
+    return (int)(rptr->wobble_rand % (dptr->rpm_wobble + 1)) - (dptr->rpm_wobble / 2);
+}
+
 void rotation_begins(drive_t *dptr)
 {
     unsigned int dnr = dptr->mynumber;
@@ -291,6 +318,152 @@ void rotation_begins(drive_t *dptr)
     rotation[dnr].cycle_index = 0;
 }
 
+inline static int gcr_bit(const drive_t *dptr, uint32_t pos)
+{
+    return (dptr->GCR_track_start_ptr[pos >> 3] >> ((~pos) & 7)) & 1;
+}
+
+/*******************************************************************************
+ * Fast forward for rotation_1541_gcr() in read mode.
+ *
+ * When the drive CPU has been idle, the disk may have turned a long way
+ * since the last call.  Where the head is at the end follows in closed
+ * form from the reference cycles.  Most of the read circuit does not need
+ * the whole way either: a little into a SYNC mark the shifter is all ones
+ * and the bit counter is held at zero, whatever came before, and every
+ * one bit starts the clock recovery counters over.  So this moves the
+ * head into the last SYNC mark on the way and leaves the rest to the
+ * loop.  The last byte read before that mark is found by framing the
+ * bits from the SYNC mark before it, which is why two are needed.
+ *
+ * Every flux reversal the loop detects draws a random number, and a run
+ * of zeros long enough for that count to run out brings the random flux
+ * reversals weak bits are made of.  So the random numbers are drawn here
+ * as the loop would, and the skip ends before the first run of zeros
+ * that would see a random flux reversal.
+ *
+ * Returns the reference cycles that are left to simulate.
+ ******************************************************************************/
+static int rotation_1541_gcr_skip(drive_t *dptr, rotation_t *rptr, int ref_cycles,
+                                  uint32_t count_new_bitcell, uint32_t cyc_sum_frv)
+{
+    uint32_t track_bits = dptr->GCR_current_track_size << 3;
+    uint32_t off = dptr->GCR_head_offset;
+    uint32_t bits, j, pos, skip = 0;
+    uint32_t rand_start, fr_count, skip_rand = 0, skip_fr = 0;
+    unsigned int shifter = 0;
+    int run = 0, framed = 0, bit_counter = 0, bit;
+    uint8_t gcr = 0, skip_gcr = 0;
+    uint64_t cycles, read_clk = 0, detect_clk;
+
+    if (dptr->GCR_image_loaded == 0 || dptr->GCR_track_start_ptr == NULL
+        || track_bits == 0 || off >= track_bits) {
+        return ref_cycles;
+    }
+
+    /* the bits the loop would read */
+    cycles = ((uint64_t)rptr->accum + (uint64_t)cyc_sum_frv * (uint32_t)ref_cycles) / count_new_bitcell;
+    if (cycles < ROTATION_SKIP_MIN_BITS + ROTATION_SKIP_SETTLE) {
+        return ref_cycles;
+    }
+    bits = (uint32_t)cycles - ROTATION_SKIP_SETTLE;
+
+    /* The reference cycle of the last flux reversal detected, counted
+       from 1, and what is left of `fr_randcount' from there.  A one bit
+       read in the cycle before is detected in the first one.  */
+    rand_start = rptr->xorShift32;
+    if (rptr->filter_last_state != rptr->filter_state) {
+        fr_count = ((RANDOM_nextUInt(rptr) >> 16) % 31) + 289;
+        detect_clk = 1;
+    } else {
+        fr_count = rptr->fr_randcount;
+        detect_clk = 0;
+    }
+
+    /* Frame the bits as the shifter does; after ten ones in a row that
+       is exact.  Bit j is the one read at (off + j).  */
+    pos = off;
+    for (j = 0; j < bits; j++) {
+        bit = gcr_bit(dptr, pos);
+        if (++pos == track_bits) {
+            pos = 0;
+        }
+
+        if (bit) {
+            /* bit j is read in this cycle and detected in the next one */
+            read_clk = ((uint64_t)(j + 1) * count_new_bitcell - rptr->accum + cyc_sum_frv - 1) / cyc_sum_frv;
+            /* a zero count does not run out, it wraps around */
+            if (fr_count != 0 && read_clk - detect_clk >= fr_count) {
+                break;
+            }
+        }
+
+        run = bit ? run + 1 : 0;
+        shifter = ((shifter << 1) & 0x3fe) | bit;
+        if (shifter == 0x3ff) {
+            bit_counter = 0;
+            if (framed == 0) {
+                framed = 1;
+            }
+        } else if (++bit_counter == 8) {
+            bit_counter = 0;
+            gcr = (uint8_t)shifter;
+            if (framed) {
+                framed = 2;
+            }
+        }
+
+        /* two bits of slack for the shifter lagging the head */
+        if (run >= 12 && framed == 2 && j + 1 >= ROTATION_SKIP_MIN_BITS) {
+            skip = j + 1;
+            skip_gcr = gcr;
+            /* the loop detects this last one bit itself */
+            skip_rand = rptr->xorShift32;
+            skip_fr = fr_count - (uint32_t)(read_clk - detect_clk);
+        }
+
+        if (bit) {
+            fr_count = ((RANDOM_nextUInt(rptr) >> 16) % 31) + 289;
+            detect_clk = read_clk + 1;
+        }
+    }
+    if (skip == 0) {
+        rptr->xorShift32 = rand_start;
+        return ref_cycles;
+    }
+    rptr->xorShift32 = skip_rand;
+    rptr->fr_randcount = skip_fr;
+
+    /* A byte was read on the way, so BYTE READY went high if enabled, and
+       a pending one went high anyway.  */
+    if (rptr->so_delay || (dptr->byte_ready_active & 2) != 0) {
+        dptr->byte_ready_edge = 1;
+        dptr->byte_ready_level = 1;
+    }
+    rptr->so_delay = 0;
+    dptr->GCR_read = skip_gcr;
+
+    /* bit `skip' - 1 is read at the first cycle that takes the count to
+       skip * count_new_bitcell */
+    cycles = ((uint64_t)skip * count_new_bitcell - rptr->accum + cyc_sum_frv - 1) / cyc_sum_frv;
+    rptr->accum = (uint32_t)(rptr->accum + cycles * cyc_sum_frv - (uint64_t)skip * count_new_bitcell);
+    rptr->cycle_index += (uint32_t)cycles;
+    dptr->GCR_head_offset = (off + skip) % track_bits;
+
+    /* the circuit right after reading that one bit */
+    rptr->last_read_data = 0x3ff;
+    rptr->bit_counter = 0;
+    rptr->last_write_data = 0;
+    rptr->write_flux = 0;
+    rptr->ue7_counter = rptr->ue7_dcba;
+    rptr->uf4_counter = 0;
+    rptr->filter_counter = 39;
+    rptr->filter_last_state = rptr->filter_state;
+    rptr->filter_state ^= 1;
+
+    return ref_cycles - (int)cycles;
+}
+
 /*******************************************************************************
  * 1541 circuit simulation for GCR-based images (.g64),
  * see 1541 circuit description in this file for details
@@ -321,7 +494,7 @@ static void rotation_1541_gcr(drive_t *dptr, int ref_cycles)
      *    in reality the constant offset can be relatively large, but does not
      *    change a lot over time, so the random offset is rather small.
      */
-    wobble = dptr->rpm_wobble ? lib_unsigned_rand(0, dptr->rpm_wobble) - (dptr->rpm_wobble / 2) : 0;
+    wobble = rotation_wobble(dptr, rptr);
     tmp *= clk_ref_per_rev;
     tmp /= dptr->rpm + wobble;
     clk_ref_per_rev = (int)tmp;
@@ -337,6 +510,11 @@ static void rotation_1541_gcr(drive_t *dptr, int ref_cycles)
     cyc_sum_frv = cyc_sum_frv ? cyc_sum_frv : 1;
 
     if (dptr->read_write_mode) {
+        if (rotation_fast_forward) {
+            ref_cycles = rotation_1541_gcr_skip(dptr, rptr, ref_cycles,
+                                                count_new_bitcell, cyc_sum_frv);
+        }
+
         /* emulate the number of reference clocks requested */
         while (ref_cycles > 0) {
             /* calculate how much cycles can we do in one single pass */
@@ -961,7 +1139,7 @@ static void rotation_1541_simple(drive_t *dptr)
     delta = *(dptr->clk) - rptr->rotation_last_clk;
     rptr->rotation_last_clk = *(dptr->clk);
 
-    wobble = dptr->rpm_wobble ? lib_unsigned_rand(0, dptr->rpm_wobble) - (dptr->rpm_wobble / 2) : 0;
+    wobble = rotation_wobble(dptr, rptr);
     tmp *= 30000UL;
     tmp /= (dptr->rpm + wobble);
     rpmscale = (unsigned long)(tmp);
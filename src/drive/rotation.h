@@ -34,6 +34,10 @@ struct drive_s;
 /* 875ns delay (14*62.5ns R cycles) for data bus read access */
 #define BUS_READ_DELAY 14
 
+/* The DriveFastRotation resource: skip ahead over long idle stretches of
+   a GCR image instead of simulating every bit cell.  */
+extern int rotation_fast_forward;
+
 extern void rotation_init(int freq, unsigned int dnr);
 extern void rotation_reset(struct drive_s *drive);
 extern void rotation_speed_zone_set(unsigned int zone, unsigned int dnr);
@@ -50,6 +50,7 @@
 #include "maincpu.h"
 #include "network.h"
 #include "resources.h"
+#include "rewind.h"
 #include "snapshot.h"
 #include "tape.h"
 #include "types.h"
@@ -88,6 +89,9 @@ static log_t event_log = LOG_DEFAULT;
 
 static unsigned int playback_active = 0, record_active = 0;
 
+/* Rewind keeps the input since its last keyframe in a list of its own.  */
+static event_list_state_t *rewind_list = NULL;
+
 static unsigned int current_timestamp, milestone_timestamp, playback_time;
 static CLOCK next_timestamp_clk;
 static CLOCK milestone_timestamp_alarm;
@@ -367,6 +371,16 @@ void event_record(unsigned int type, void *data, unsigned int size)
     if (record_active == 1) {
         event_record_in_list(event_list, type, data, size);
     }
+
+    /* Rewind starts over after a reset.  */
+    if (rewind_list != NULL && type != EVENT_RESETCPU) {
+        event_record_in_list(rewind_list, type, data, size);
+    }
+}
+
+void event_record_rewind_list(event_list_state_t *list)
+{
+    rewind_list = list;
 }
 
 
@@ -999,7 +1013,7 @@ int event_record_active(void)
 
 int event_playback_active(void)
 {
-    return playback_active;
+    return playback_active || rewind_replay_active();
 }
 
 /*-----------------------------------------------------------------------*/
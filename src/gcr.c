@@ -65,48 +65,49 @@ static const uint8_t From_GCR_conv_data[32] =
 };
 
 
-static void gcr_convert_4bytes_to_GCR(const uint8_t *source, uint8_t *dest)
+/* Both directions a byte at a time: the 10 GCR bits of a byte, and the
+   byte a group of 10 GCR bits decodes to.  Built from the nybble tables
+   above on first use.  */
+static uint16_t GCR_encode_byte[256];
+static uint8_t GCR_decode_10bits[1024];
+static int gcr_tables_ready = 0;
+
+static void gcr_init_tables(void)
 {
-    int i;
-    register unsigned int tdest = 0;    /* at least 16 bits for overflow shifting */
-
-    for (i = 2; i < 10; i += 2, source++, dest++)
-    {
-        tdest <<= 5;  /* make room for the upper nybble */
-        tdest |= GCR_conv_data[(*source) >> 4];
+    unsigned int i;
 
-        tdest <<= 5;  /* make room for the lower nybble */
-        tdest |= GCR_conv_data[(*source) & 0x0f];
-
-        *dest = (uint8_t)(tdest >> i);
+    for (i = 0; i < 256; i++) {
+        GCR_encode_byte[i] = (uint16_t)((GCR_conv_data[i >> 4] << 5) | GCR_conv_data[i & 0x0f]);
     }
-
-    *dest = (uint8_t)tdest;
+    for (i = 0; i < 1024; i++) {
+        GCR_decode_10bits[i] = (uint8_t)((From_GCR_conv_data[i >> 5] << 4) | From_GCR_conv_data[i & 0x1f]);
+    }
+    gcr_tables_ready = 1;
 }
 
-static void gcr_convert_GCR_to_4bytes(const uint8_t *source, uint8_t *dest)
+static void gcr_convert_4bytes_to_GCR(const uint8_t *source, uint8_t *dest)
 {
-    int i;
-    /* at least 24 bits for shifting into bits 16...20 */
-    register uint32_t tdest = *source;
-
-    tdest <<= 13;
-
-    for (i = 5; i < 13; i += 2, dest++)
-    {
-        source++;
-        tdest |= ((uint32_t)(*source)) << i;
-
-        /*  "tdest >> 16" could be optimized to a word
-         *  aligned access, hopefully the compiler does
-         *  this for us (in a portable way)
-         */
-        *dest = From_GCR_conv_data[(tdest >> 16) & 0x1f] << 4;
-        tdest <<= 5;
+    uint64_t tdest;
+
+    tdest = ((uint64_t)GCR_encode_byte[source[0]] << 30)
+            | ((uint64_t)GCR_encode_byte[source[1]] << 20)
+            | ((uint64_t)GCR_encode_byte[source[2]] << 10)
+            | GCR_encode_byte[source[3]];
+
+    dest[0] = (uint8_t)(tdest >> 32);
+    dest[1] = (uint8_t)(tdest >> 24);
+    dest[2] = (uint8_t)(tdest >> 16);
+    dest[3] = (uint8_t)(tdest >> 8);
+    dest[4] = (uint8_t)tdest;
+}
 
-        *dest |= From_GCR_conv_data[(tdest >> 16) & 0x1f];
-        tdest <<= 5;
-    }
+/* `tsource' holds 5 GCR bytes in its low 40 bits.  */
+static void gcr_convert_GCR_to_4bytes(uint64_t tsource, uint8_t *dest)
+{
+    dest[0] = GCR_decode_10bits[(tsource >> 30) & 0x3ff];
+    dest[1] = GCR_decode_10bits[(tsource >> 20) & 0x3ff];
+    dest[2] = GCR_decode_10bits[(tsource >> 10) & 0x3ff];
+    dest[3] = GCR_decode_10bits[tsource & 0x3ff];
 }
 
 void gcr_convert_sector_to_GCR(const uint8_t *buffer, uint8_t *data, const gcr_header_t *header,
@@ -115,6 +116,10 @@ void gcr_convert_sector_to_GCR(const uint8_t *buffer, uint8_t *data, const gcr_h
     int i;
     uint8_t buf[4], chksum, idm;
 
+    if (!gcr_tables_ready) {
+        gcr_init_tables();
+    }
+
     idm = (error_code == CBMDOS_FDC_ERR_ID) ? 0xff : 0x00;
 
     memset(data, (error_code == CBMDOS_FDC_ERR_SYNC) ? 0x55 : 0xff, 5);       /* Sync */
@@ -167,35 +172,72 @@ void gcr_convert_sector_to_GCR(const uint8_t *buffer, uint8_t *data, const gcr_h
     gcr_convert_4bytes_to_GCR(buf, data);
 }
 
+/* Look at up to 32 bits at a time.  `w' has the `n' bits from `p' on at
+   the top; `run' counts the ones just before them.  Returns the position
+   of the first bit after a SYNC mark, if there is one among them.  */
+static int gcr_find_sync_bits(uint32_t w, int n, int p, int *run)
+{
+    uint32_t valid = 0xffffffffu << (32 - n);
+    uint32_t ones, ends;
+    int lead;
+
+    lead = (~w & valid) ? __builtin_clz(~w & valid) : n;
+    if (lead == n) {
+        *run += n;
+        return -1;
+    }
+    if (*run + lead >= 10) {
+        return p + lead;
+    }
+
+    /* ten ones in a row within the bits, followed by a zero */
+    ones = w & valid;
+    ends = ones & (ones >> 1);
+    ends &= ends >> 2;
+    ends &= ends >> 4;
+    ends &= (ones >> 8) & (ones >> 9);
+    ends = (ends >> 1) & ~w & valid;
+    if (ends) {
+        return p + __builtin_clz(ends);
+    }
+
+    *run = __builtin_ctz(~(w >> (32 - n)));
+    return -1;
+}
+
 static int gcr_find_sync(const disk_track_t *raw, int p, int s)
 {
-    int w, b;
+    const uint8_t *data = raw->data;
+    int bits = raw->size * 8;
+    int run = 0, n, found;
+    uint32_t w;
 
-    if (!raw->data || !raw->size) {
+    if (!data || !raw->size) {
         return -CBMDOS_FDC_ERR_SYNC;
     }
 
-    w = 0;
-    b = raw->data[p >> 3] << (p & 7);
-    while (s--) {
-        if (b & 0x80) {
-            w = (w << 1) | 1;
+    while (s > 0) {
+        if ((p & 7) == 0 && s >= 32 && p + 32 <= bits) {
+            w = ((uint32_t)data[p >> 3] << 24) | ((uint32_t)data[(p >> 3) + 1] << 16)
+                | ((uint32_t)data[(p >> 3) + 2] << 8) | data[(p >> 3) + 3];
+            n = 32;
         } else {
-            if (~w & 0x3ff) {
-                w <<= 1;
-            } else {
-                return p;
+            w = (uint32_t)(uint8_t)(data[p >> 3] << (p & 7)) << 24;
+            n = 8 - (p & 7);
+            if (n > s) {
+                n = s;
             }
         }
-        if (~p & 7) {
-            p++;
-            b <<= 1;
-        } else {
-            p++;
-            if (p >= raw->size * 8) {
-                p = 0;
-            }
-            b = raw->data[p >> 3];
+
+        found = gcr_find_sync_bits(w, n, p, &run);
+        if (found >= 0) {
+            return found;
+        }
+
+        p += n;
+        s -= n;
+        if (p >= bits) {
+            p = 0;
         }
     }
     return -CBMDOS_FDC_ERR_SYNC;
@@ -204,25 +246,38 @@ static int gcr_find_sync(const disk_track_t *raw, int p, int s)
 static void gcr_decode_block(const disk_track_t *raw, int p, uint8_t *buf, int num)
 {
     int shift, i, j;
-    uint8_t gcr[5], b;
-    uint8_t *offset, *end = raw->data + raw->size;
+    uint64_t gcr;
+    uint8_t b;
+    const uint8_t *offset, *end = raw->data + raw->size;
 
     shift = p & 7;
     offset = raw->data + (p >> 3);
 
+    /* the usual case: the block does not wrap around the track end */
+    if (offset + num * 5 + 1 <= end) {
+        for (i = 0; i < num; i++, buf += 4, offset += 5) {
+            gcr = ((uint64_t)offset[0] << 40) | ((uint64_t)offset[1] << 32)
+                  | ((uint64_t)offset[2] << 24) | ((uint64_t)offset[3] << 16)
+                  | ((uint64_t)offset[4] << 8) | offset[5];
+            gcr_convert_GCR_to_4bytes(gcr >> (8 - shift), buf);
+        }
+        return;
+    }
+
     b = offset[0] << shift;
     for (i = 0; i < num; i++, buf += 4) {
         /* get 5 bytes of gcr data */
+        gcr = 0;
         for (j = 0; j < 5; j++) {
             offset++;
             if (offset >= end) {
                 offset = raw->data;
             }
             if (shift) {
-                gcr[j] = b | ((offset[0] << shift) >> 8);
+                gcr = (gcr << 8) | (uint8_t)(b | ((offset[0] << shift) >> 8));
                 b = offset[0] << shift;
             } else {
-                gcr[j] = b;
+                gcr = (gcr << 8) | b;
                 b = offset[0];
             }
         }
@@ -265,6 +320,10 @@ fdc_err_t gcr_read_sector(const disk_track_t *raw, uint8_t *data, uint8_t sector
     uint8_t b;
     int i, p;
 
+    if (!gcr_tables_ready) {
+        gcr_init_tables();
+    }
+
     p = gcr_find_sector_header(raw, sector);
     if (p < 0) {
         return -p;
@@ -297,6 +356,10 @@ fdc_err_t gcr_write_sector(disk_track_t *raw, const uint8_t *data, uint8_t secto
     uint8_t gcr[5], chksum, b;
     int i, j, shift, p;
 
+    if (!gcr_tables_ready) {
+        gcr_init_tables();
+    }
+
     p = gcr_find_sector_header(raw, sector);
     if (p < 0) {
         return -p;
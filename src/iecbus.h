@@ -88,6 +88,7 @@ typedef struct iecbus_s {
 extern iecbus_t iecbus;
 
 extern iecbus_t *iecbus_drive_port(void);
+extern int iecbus_sole_truedrive(void);
 
 extern void iecbus_init(void);
 extern void iecbus_cpu_undump(uint8_t data);
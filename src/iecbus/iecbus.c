@@ -30,6 +30,7 @@
 #include <string.h>
 
 #include "cia.h"
+#include "drive-thread.h"
 #include "drive.h"
 #include "drivetypes.h"
 #include "iecbus.h"
@@ -195,6 +196,8 @@ void iecbus_init(void)
 
 void iecbus_cpu_undump(uint8_t data)
 {
+    drive_thread_stop();
+
     iec_update_cpu_bus(data);
     iec_old_atn = iecbus.cpu_bus & 0x10;
 }
@@ -214,9 +217,49 @@ static void iecbus_cpu_write_conf0(uint8_t data, CLOCK clock)
     iecbus.iec_fast_1541 = data;
 }
 
+#ifdef USE_DRIVE_THREAD
+/* The drive runs on its own thread (drive-thread.c), which keeps its
+   view of the bus to itself.  Only the lines it drives are fetched when
+   the computer reads, so `drv_bus' and the ports are stale in between.  */
+static uint8_t iecbus_cpu_read_thread(drive_context_t *drv, CLOCK clock)
+{
+    unsigned int unit = drv->mynumber + 8;
+
+    iecbus.drv_data[unit] = drive_thread_cpu_read(drv, clock);
+    iecbus.drv_bus[unit] = (((iecbus.drv_data[unit] << 3) & 0x40)
+                            | ((iecbus.drv_data[unit] << 6)
+                               & ((~iecbus.drv_data[unit] ^ iecbus.cpu_bus) << 3)
+                               & 0x80));
+    iec_update_ports();
+
+    DEBUG_IEC_CPU_READ(iecbus.cpu_port);
+
+    return iecbus.cpu_port;
+}
+
+static void iecbus_cpu_write_thread(drive_context_t *drv, uint8_t data, CLOCK clock)
+{
+    int atn_changed;
+
+    DEBUG_IEC_CPU_WRITE(data);
+
+    iec_update_cpu_bus(data);
+
+    atn_changed = iec_old_atn != (iecbus.cpu_bus & 0x10);
+    iec_old_atn = iecbus.cpu_bus & 0x10;
+
+    drive_thread_cpu_write(drv, iecbus.cpu_bus, atn_changed, clock);
+}
+#endif
+
 /* Only the first drive is enabled.  */
 static uint8_t iecbus_cpu_read_conf1(CLOCK clock)
 {
+#ifdef USE_DRIVE_THREAD
+    if (drive_context[0]->thread != NULL) {
+        return iecbus_cpu_read_thread(drive_context[0], clock);
+    }
+#endif
     drive_cpu_execute_all(clock);
 
     DEBUG_IEC_CPU_READ(iecbus.cpu_port);
@@ -228,6 +271,12 @@ static void iecbus_cpu_write_conf1(uint8_t data, CLOCK clock)
 {
     drive_t *drive;
 
+#ifdef USE_DRIVE_THREAD
+    if (drive_context[0]->thread != NULL) {
+        iecbus_cpu_write_thread(drive_context[0], data, clock);
+        return;
+    }
+#endif
     drive = drive_context[0]->drive;
     drive_cpu_execute_one(drive_context[0], clock);
 
@@ -275,6 +324,11 @@ static void iecbus_cpu_write_conf1(uint8_t data, CLOCK clock)
 /* Only the second drive is enabled.  */
 static uint8_t iecbus_cpu_read_conf2(CLOCK clock)
 {
+#ifdef USE_DRIVE_THREAD
+    if (drive_context[1]->thread != NULL) {
+        return iecbus_cpu_read_thread(drive_context[1], clock);
+    }
+#endif
     drive_cpu_execute_all(clock);
 
     DEBUG_IEC_CPU_READ(iecbus.cpu_port);
@@ -286,6 +340,12 @@ static void iecbus_cpu_write_conf2(uint8_t data, CLOCK clock)
 {
     drive_t *drive;
 
+#ifdef USE_DRIVE_THREAD
+    if (drive_context[1]->thread != NULL) {
+        iecbus_cpu_write_thread(drive_context[1], data, clock);
+        return;
+    }
+#endif
     drive = drive_context[1]->drive;
     drive_cpu_execute_one(drive_context[1], clock);
 
@@ -512,9 +572,23 @@ void iecbus_status_set(unsigned int type, unsigned int unit,
         iecbus_device[dev] = iecbus_device_index[index];
     }
 
+    drive_thread_stop();
     calculate_callback_index();
 }
 
+/* The drive if the computer shares the bus with a single true drive
+   emulation drive and nothing else, -1 otherwise.  */
+int iecbus_sole_truedrive(void)
+{
+    if (iecbus_callback_read == iecbus_cpu_read_conf1) {
+        return 0;
+    }
+    if (iecbus_callback_read == iecbus_cpu_read_conf2) {
+        return 1;
+    }
+    return -1;
+}
+
 
 uint8_t iecbus_device_read(void)
 {
@@ -196,6 +196,19 @@ int ioutil_stat(const char *file_name, unsigned int *len, unsigned int *isdir)
     return archdep_stat(file_name, len, isdir);
 }
 
+/* Last modification of `file_name' in seconds, only good for telling
+   whether the file changed.  */
+int ioutil_mtime(const char *file_name, unsigned long *mtime)
+{
+    struct stat statbuf;
+
+    if (stat(file_name, &statbuf) < 0) {
+        return -1;
+    }
+    *mtime = (unsigned long)statbuf.st_mtime;
+    return 0;
+}
+
 /* ------------------------------------------------------------------------- */
 /* IO helper functions.  */
 char *ioutil_current_dir(void)
@@ -57,6 +57,7 @@ extern int ioutil_remove(const char *name);
 extern int ioutil_rmdir(const char *pathname);
 extern int ioutil_rename(const char *oldpath, const char *newpath);
 extern int ioutil_stat(const char *file_name, unsigned int *len, unsigned int *isdir);
+extern int ioutil_mtime(const char *file_name, unsigned long *mtime);
 
 extern char *ioutil_current_dir(void);
 
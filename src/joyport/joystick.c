@@ -188,6 +188,11 @@ static void joystick_latch_handler(CLOCK offset, void *data)
     alarm_unset(joystick_alarm);
     alarm_context_update_next_pending(joystick_alarm->context);
 
+    /* Host input from before a rewind step back.  */
+    if (event_playback_active()) {
+        return;
+    }
+
     joystick_latch_matrix(offset);
 
     joystick_event_record();
@@ -214,6 +214,13 @@ int kbdbuf_is_empty(void)
     return (int)(mem_read((uint16_t)(num_pending_location)) == 0);
 }
 
+/* Return nonzero if there is still text waiting to go into the keyboard
+   buffer.  */
+int kbdbuf_queue_is_pending(void)
+{
+    return (num_pending != 0) || (kbdbuf_flush_alarm_time != 0);
+}
+
 /* Feed `string' into the incoming queue.  */
 static int string_to_queue(const char *string)
 {
@@ -31,6 +31,7 @@
 #include "types.h"
 
 extern int kbdbuf_is_empty(void);
+extern int kbdbuf_queue_is_pending(void);
 extern void kbdbuf_init(int location, int plocation, int buffer_size, CLOCK mincycles);
 extern void kbdbuf_shutdown(void);
 extern void kbdbuf_reset(int location, int plocation, int buffer_size, CLOCK mincycles);
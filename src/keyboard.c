@@ -160,6 +160,11 @@ static void keyboard_latch_handler(CLOCK offset, void *data)
     alarm_unset(keyboard_alarm);
     alarm_context_update_next_pending(keyboard_alarm->context);
 
+    /* Host input from before a rewind step back.  */
+    if (event_playback_active()) {
+        return;
+    }
+
     keyboard_latch_matrix(offset);
 
     keyboard_event_record();
@@ -57,8 +57,10 @@
 #include "network.h"
 #include "printer.h"
 #include "resources.h"
+#include "rewind.h"
 #include "romset.h"
 #include "screenshot.h"
+#include "snapshot-writer.h"
 #include "sound.h"
 #include "sysfile.h"
 #include "tape.h"
@@ -69,7 +71,9 @@
 #include "video.h"
 #include "vsync.h"
 #include "zfile.h"
+#ifdef PSVITA
 #include "controller.h"
+#endif
 
 /* #define DEBUGMACHINE */
 
@@ -207,10 +211,14 @@ void machine_reset(void)
 
     event_reset_ack();
 
+    rewind_reset();
+
     vsync_suspend_speed_eval();
 
+#ifdef PSVITA
 	// Notify View about the reset (PSVITA).
 	PSV_NotifyReset();
+#endif
 }
 
 static void machine_maincpu_clk_overflow_callback(CLOCK sub, void *data)
@@ -340,6 +348,10 @@ void machine_shutdown(void)
 
     event_shutdown();
 
+    rewind_shutdown();
+
+    snapshot_writer_shutdown();
+
     network_shutdown();
 
     autostart_resources_shutdown();
@@ -142,6 +142,12 @@ extern int machine_write_snapshot(const char *name, int save_roms,
 /* Read a snapshot.  */
 extern int machine_read_snapshot(const char *name, int even_mode);
 
+/* Write and read a snapshot kept in memory, see snapshot.h.  */
+struct snapshot_memory_s;
+extern int machine_write_snapshot_memory(struct snapshot_memory_s *mem,
+                                         const struct snapshot_memory_s *base);
+extern int machine_read_snapshot_memory(struct snapshot_memory_s *mem);
+
 /* handle pending interrupts - needed by libsid.a.  */
 extern void machine_handle_pending_alarms(int num_write_cycles);
 
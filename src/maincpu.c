@@ -41,6 +41,7 @@
 #include "maincpu.h"
 #include "mem.h"
 #include "monitor.h"
+#include "profile.h"
 #ifdef C64DTV
 #include "mos6510dtv.h"
 #else
@@ -460,6 +461,10 @@ void maincpu_mainloop(void)
 
     machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
 
+    /* Host time is charged to the main CPU from here on, unless one of
+       the other sections is entered.  */
+    profile_reset();
+
     while (1) {
 #define CLK maincpu_clk
 #define RMW_FLAG maincpu_rmw_flag
@@ -508,14 +513,19 @@ void maincpu_mainloop(void)
 
 #define GLOBAL_REGS maincpu_regs
 
-#include "6510core.c"
+#define OPCODE_LOOP_TAIL()                                            \
+    do {                                                              \
+        maincpu_int_status->num_dma_per_opcode = 0;                   \
+                                                                      \
+        if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) { \
+            log_error(LOG_DEFAULT, "cycle limit reached.");           \
+            archdep_vice_exit(EXIT_FAILURE);                          \
+        }                                                             \
+    } while (0)
 
-        maincpu_int_status->num_dma_per_opcode = 0;
+#include "6510core.c"
 
-        if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) {
-            log_error(LOG_DEFAULT, "cycle limit reached.");
-            archdep_vice_exit(EXIT_FAILURE);
-        }
+        OPCODE_LOOP_TAIL();
 #if 0
         if (CLK > 246171754) {
             debug.maincpu_traceflg = 1;
@@ -134,6 +134,14 @@ static const mon_cmds_t mon_cmd_array[] = {
       NO_FILENAME_ARG
     },
 
+    { "profile", "",
+      "[reset|\"<filename>\"]",
+      "In VICE_PROFILE builds, print the host time spent per frame in each\n"
+      "part of the emulator, averaged over the last frames.  'reset' clears\n"
+      "the frame records, a filename writes them to it as CSV.",
+      NO_FILENAME_ARG
+    },
+
     { "registers", "r",
       "[<reg_name> = <number> [, <reg_name> = <number>]*]",
       "Assign respective registers.  With no parameters, display register\n"
@@ -2531,7 +2531,7 @@ YY_RULE_SETUP
 case 85:
 YY_RULE_SETUP
 #line 246 "mon_lex.l"
-{ BEGIN(LABEL_ASGN); yylval.str = lib_stralloc(yytext); return CMD_LABEL_ASGN; }
+{ if (strcmp(yytext, "profile") == 0) { BEGIN(INITIAL); return CMD_PROFILE; } BEGIN(LABEL_ASGN); yylval.str = lib_stralloc(yytext); return CMD_LABEL_ASGN; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 1 "mon_parse.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 1 "mon_parse.y"
 
 /* -*- C -*-
  *
@@ -196,430 +201,353 @@ extern int cur_len, last_len;
 #define YYDEBUG 1
 
 
-#line 200 "mon_parse.c" /* yacc.c:339  */
+#line 205 "mon_parse.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "y.tab.h".  */
-#ifndef YY_YY_MON_PARSE_H_INCLUDED
-# define YY_YY_MON_PARSE_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    H_NUMBER = 258,
-    D_NUMBER = 259,
-    O_NUMBER = 260,
-    B_NUMBER = 261,
-    CONVERT_OP = 262,
-    B_DATA = 263,
-    H_RANGE_GUESS = 264,
-    D_NUMBER_GUESS = 265,
-    O_NUMBER_GUESS = 266,
-    B_NUMBER_GUESS = 267,
-    BAD_CMD = 268,
-    MEM_OP = 269,
-    IF = 270,
-    MEM_COMP = 271,
-    MEM_DISK8 = 272,
-    MEM_DISK9 = 273,
-    MEM_DISK10 = 274,
-    MEM_DISK11 = 275,
-    EQUALS = 276,
-    TRAIL = 277,
-    CMD_SEP = 278,
-    LABEL_ASGN_COMMENT = 279,
-    CMD_SIDEFX = 280,
-    CMD_RETURN = 281,
-    CMD_BLOCK_READ = 282,
-    CMD_BLOCK_WRITE = 283,
-    CMD_UP = 284,
-    CMD_DOWN = 285,
-    CMD_LOAD = 286,
-    CMD_SAVE = 287,
-    CMD_VERIFY = 288,
-    CMD_IGNORE = 289,
-    CMD_HUNT = 290,
-    CMD_FILL = 291,
-    CMD_MOVE = 292,
-    CMD_GOTO = 293,
-    CMD_REGISTERS = 294,
-    CMD_READSPACE = 295,
-    CMD_WRITESPACE = 296,
-    CMD_RADIX = 297,
-    CMD_MEM_DISPLAY = 298,
-    CMD_BREAK = 299,
-    CMD_TRACE = 300,
-    CMD_IO = 301,
-    CMD_BRMON = 302,
-    CMD_COMPARE = 303,
-    CMD_DUMP = 304,
-    CMD_UNDUMP = 305,
-    CMD_EXIT = 306,
-    CMD_DELETE = 307,
-    CMD_CONDITION = 308,
-    CMD_COMMAND = 309,
-    CMD_ASSEMBLE = 310,
-    CMD_DISASSEMBLE = 311,
-    CMD_NEXT = 312,
-    CMD_STEP = 313,
-    CMD_PRINT = 314,
-    CMD_DEVICE = 315,
-    CMD_HELP = 316,
-    CMD_WATCH = 317,
-    CMD_DISK = 318,
-    CMD_QUIT = 319,
-    CMD_CHDIR = 320,
-    CMD_BANK = 321,
-    CMD_LOAD_LABELS = 322,
-    CMD_SAVE_LABELS = 323,
-    CMD_ADD_LABEL = 324,
-    CMD_DEL_LABEL = 325,
-    CMD_SHOW_LABELS = 326,
-    CMD_CLEAR_LABELS = 327,
-    CMD_RECORD = 328,
-    CMD_MON_STOP = 329,
-    CMD_PLAYBACK = 330,
-    CMD_CHAR_DISPLAY = 331,
-    CMD_SPRITE_DISPLAY = 332,
-    CMD_TEXT_DISPLAY = 333,
-    CMD_SCREENCODE_DISPLAY = 334,
-    CMD_ENTER_DATA = 335,
-    CMD_ENTER_BIN_DATA = 336,
-    CMD_KEYBUF = 337,
-    CMD_BLOAD = 338,
-    CMD_BSAVE = 339,
-    CMD_SCREEN = 340,
-    CMD_UNTIL = 341,
-    CMD_CPU = 342,
-    CMD_YYDEBUG = 343,
-    CMD_BACKTRACE = 344,
-    CMD_SCREENSHOT = 345,
-    CMD_PWD = 346,
-    CMD_DIR = 347,
-    CMD_RESOURCE_GET = 348,
-    CMD_RESOURCE_SET = 349,
-    CMD_LOAD_RESOURCES = 350,
-    CMD_SAVE_RESOURCES = 351,
-    CMD_ATTACH = 352,
-    CMD_DETACH = 353,
-    CMD_MON_RESET = 354,
-    CMD_TAPECTRL = 355,
-    CMD_CARTFREEZE = 356,
-    CMD_CPUHISTORY = 357,
-    CMD_MEMMAPZAP = 358,
-    CMD_MEMMAPSHOW = 359,
-    CMD_MEMMAPSAVE = 360,
-    CMD_COMMENT = 361,
-    CMD_LIST = 362,
-    CMD_STOPWATCH = 363,
-    RESET = 364,
-    CMD_EXPORT = 365,
-    CMD_AUTOSTART = 366,
-    CMD_AUTOLOAD = 367,
-    CMD_MAINCPU_TRACE = 368,
-    CMD_LABEL_ASGN = 369,
-    L_PAREN = 370,
-    R_PAREN = 371,
-    ARG_IMMEDIATE = 372,
-    REG_A = 373,
-    REG_X = 374,
-    REG_Y = 375,
-    COMMA = 376,
-    INST_SEP = 377,
-    L_BRACKET = 378,
-    R_BRACKET = 379,
-    LESS_THAN = 380,
-    REG_U = 381,
-    REG_S = 382,
-    REG_PC = 383,
-    REG_PCR = 384,
-    REG_B = 385,
-    REG_C = 386,
-    REG_D = 387,
-    REG_E = 388,
-    REG_H = 389,
-    REG_L = 390,
-    REG_AF = 391,
-    REG_BC = 392,
-    REG_DE = 393,
-    REG_HL = 394,
-    REG_IX = 395,
-    REG_IY = 396,
-    REG_SP = 397,
-    REG_IXH = 398,
-    REG_IXL = 399,
-    REG_IYH = 400,
-    REG_IYL = 401,
-    PLUS = 402,
-    MINUS = 403,
-    STRING = 404,
-    FILENAME = 405,
-    R_O_L = 406,
-    OPCODE = 407,
-    LABEL = 408,
-    BANKNAME = 409,
-    CPUTYPE = 410,
-    MON_REGISTER = 411,
-    COMPARE_OP = 412,
-    RADIX_TYPE = 413,
-    INPUT_SPEC = 414,
-    CMD_CHECKPT_ON = 415,
-    CMD_CHECKPT_OFF = 416,
-    TOGGLE = 417,
-    MASK = 418
-  };
-#endif
-/* Tokens.  */
-#define H_NUMBER 258
-#define D_NUMBER 259
-#define O_NUMBER 260
-#define B_NUMBER 261
-#define CONVERT_OP 262
-#define B_DATA 263
-#define H_RANGE_GUESS 264
-#define D_NUMBER_GUESS 265
-#define O_NUMBER_GUESS 266
-#define B_NUMBER_GUESS 267
-#define BAD_CMD 268
-#define MEM_OP 269
-#define IF 270
-#define MEM_COMP 271
-#define MEM_DISK8 272
-#define MEM_DISK9 273
-#define MEM_DISK10 274
-#define MEM_DISK11 275
-#define EQUALS 276
-#define TRAIL 277
-#define CMD_SEP 278
-#define LABEL_ASGN_COMMENT 279
-#define CMD_SIDEFX 280
-#define CMD_RETURN 281
-#define CMD_BLOCK_READ 282
-#define CMD_BLOCK_WRITE 283
-#define CMD_UP 284
-#define CMD_DOWN 285
-#define CMD_LOAD 286
-#define CMD_SAVE 287
-#define CMD_VERIFY 288
-#define CMD_IGNORE 289
-#define CMD_HUNT 290
-#define CMD_FILL 291
-#define CMD_MOVE 292
-#define CMD_GOTO 293
-#define CMD_REGISTERS 294
-#define CMD_READSPACE 295
-#define CMD_WRITESPACE 296
-#define CMD_RADIX 297
-#define CMD_MEM_DISPLAY 298
-#define CMD_BREAK 299
-#define CMD_TRACE 300
-#define CMD_IO 301
-#define CMD_BRMON 302
-#define CMD_COMPARE 303
-#define CMD_DUMP 304
-#define CMD_UNDUMP 305
-#define CMD_EXIT 306
-#define CMD_DELETE 307
-#define CMD_CONDITION 308
-#define CMD_COMMAND 309
-#define CMD_ASSEMBLE 310
-#define CMD_DISASSEMBLE 311
-#define CMD_NEXT 312
-#define CMD_STEP 313
-#define CMD_PRINT 314
-#define CMD_DEVICE 315
-#define CMD_HELP 316
-#define CMD_WATCH 317
-#define CMD_DISK 318
-#define CMD_QUIT 319
-#define CMD_CHDIR 320
-#define CMD_BANK 321
-#define CMD_LOAD_LABELS 322
-#define CMD_SAVE_LABELS 323
-#define CMD_ADD_LABEL 324
-#define CMD_DEL_LABEL 325
-#define CMD_SHOW_LABELS 326
-#define CMD_CLEAR_LABELS 327
-#define CMD_RECORD 328
-#define CMD_MON_STOP 329
-#define CMD_PLAYBACK 330
-#define CMD_CHAR_DISPLAY 331
-#define CMD_SPRITE_DISPLAY 332
-#define CMD_TEXT_DISPLAY 333
-#define CMD_SCREENCODE_DISPLAY 334
-#define CMD_ENTER_DATA 335
-#define CMD_ENTER_BIN_DATA 336
-#define CMD_KEYBUF 337
-#define CMD_BLOAD 338
-#define CMD_BSAVE 339
-#define CMD_SCREEN 340
-#define CMD_UNTIL 341
-#define CMD_CPU 342
-#define CMD_YYDEBUG 343
-#define CMD_BACKTRACE 344
-#define CMD_SCREENSHOT 345
-#define CMD_PWD 346
-#define CMD_DIR 347
-#define CMD_RESOURCE_GET 348
-#define CMD_RESOURCE_SET 349
-#define CMD_LOAD_RESOURCES 350
-#define CMD_SAVE_RESOURCES 351
-#define CMD_ATTACH 352
-#define CMD_DETACH 353
-#define CMD_MON_RESET 354
-#define CMD_TAPECTRL 355
-#define CMD_CARTFREEZE 356
-#define CMD_CPUHISTORY 357
-#define CMD_MEMMAPZAP 358
-#define CMD_MEMMAPSHOW 359
-#define CMD_MEMMAPSAVE 360
-#define CMD_COMMENT 361
-#define CMD_LIST 362
-#define CMD_STOPWATCH 363
-#define RESET 364
-#define CMD_EXPORT 365
-#define CMD_AUTOSTART 366
-#define CMD_AUTOLOAD 367
-#define CMD_MAINCPU_TRACE 368
-#define CMD_LABEL_ASGN 369
-#define L_PAREN 370
-#define R_PAREN 371
-#define ARG_IMMEDIATE 372
-#define REG_A 373
-#define REG_X 374
-#define REG_Y 375
-#define COMMA 376
-#define INST_SEP 377
-#define L_BRACKET 378
-#define R_BRACKET 379
-#define LESS_THAN 380
-#define REG_U 381
-#define REG_S 382
-#define REG_PC 383
-#define REG_PCR 384
-#define REG_B 385
-#define REG_C 386
-#define REG_D 387
-#define REG_E 388
-#define REG_H 389
-#define REG_L 390
-#define REG_AF 391
-#define REG_BC 392
-#define REG_DE 393
-#define REG_HL 394
-#define REG_IX 395
-#define REG_IY 396
-#define REG_SP 397
-#define REG_IXH 398
-#define REG_IXL 399
-#define REG_IYH 400
-#define REG_IYL 401
-#define PLUS 402
-#define MINUS 403
-#define STRING 404
-#define FILENAME 405
-#define R_O_L 406
-#define OPCODE 407
-#define LABEL 408
-#define BANKNAME 409
-#define CPUTYPE 410
-#define MON_REGISTER 411
-#define COMPARE_OP 412
-#define RADIX_TYPE 413
-#define INPUT_SPEC 414
-#define CMD_CHECKPT_ON 415
-#define CMD_CHECKPT_OFF 416
-#define TOGGLE 417
-#define MASK 418
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "mon_parse.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 135 "mon_parse.y" /* yacc.c:355  */
-
-    MON_ADDR a;
-    MON_ADDR range[2];
-    int i;
-    REG_ID reg;
-    CONDITIONAL cond_op;
-    cond_node_t *cond_node;
-    RADIXTYPE rt;
-    ACTION action;
-    char *str;
-    asm_mode_addr_info_t mode;
-
-#line 579 "mon_parse.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_H_NUMBER = 3,                   /* H_NUMBER  */
+  YYSYMBOL_D_NUMBER = 4,                   /* D_NUMBER  */
+  YYSYMBOL_O_NUMBER = 5,                   /* O_NUMBER  */
+  YYSYMBOL_B_NUMBER = 6,                   /* B_NUMBER  */
+  YYSYMBOL_CONVERT_OP = 7,                 /* CONVERT_OP  */
+  YYSYMBOL_B_DATA = 8,                     /* B_DATA  */
+  YYSYMBOL_H_RANGE_GUESS = 9,              /* H_RANGE_GUESS  */
+  YYSYMBOL_D_NUMBER_GUESS = 10,            /* D_NUMBER_GUESS  */
+  YYSYMBOL_O_NUMBER_GUESS = 11,            /* O_NUMBER_GUESS  */
+  YYSYMBOL_B_NUMBER_GUESS = 12,            /* B_NUMBER_GUESS  */
+  YYSYMBOL_BAD_CMD = 13,                   /* BAD_CMD  */
+  YYSYMBOL_MEM_OP = 14,                    /* MEM_OP  */
+  YYSYMBOL_IF = 15,                        /* IF  */
+  YYSYMBOL_MEM_COMP = 16,                  /* MEM_COMP  */
+  YYSYMBOL_MEM_DISK8 = 17,                 /* MEM_DISK8  */
+  YYSYMBOL_MEM_DISK9 = 18,                 /* MEM_DISK9  */
+  YYSYMBOL_MEM_DISK10 = 19,                /* MEM_DISK10  */
+  YYSYMBOL_MEM_DISK11 = 20,                /* MEM_DISK11  */
+  YYSYMBOL_EQUALS = 21,                    /* EQUALS  */
+  YYSYMBOL_TRAIL = 22,                     /* TRAIL  */
+  YYSYMBOL_CMD_SEP = 23,                   /* CMD_SEP  */
+  YYSYMBOL_LABEL_ASGN_COMMENT = 24,        /* LABEL_ASGN_COMMENT  */
+  YYSYMBOL_CMD_SIDEFX = 25,                /* CMD_SIDEFX  */
+  YYSYMBOL_CMD_RETURN = 26,                /* CMD_RETURN  */
+  YYSYMBOL_CMD_BLOCK_READ = 27,            /* CMD_BLOCK_READ  */
+  YYSYMBOL_CMD_BLOCK_WRITE = 28,           /* CMD_BLOCK_WRITE  */
+  YYSYMBOL_CMD_UP = 29,                    /* CMD_UP  */
+  YYSYMBOL_CMD_DOWN = 30,                  /* CMD_DOWN  */
+  YYSYMBOL_CMD_LOAD = 31,                  /* CMD_LOAD  */
+  YYSYMBOL_CMD_SAVE = 32,                  /* CMD_SAVE  */
+  YYSYMBOL_CMD_VERIFY = 33,                /* CMD_VERIFY  */
+  YYSYMBOL_CMD_IGNORE = 34,                /* CMD_IGNORE  */
+  YYSYMBOL_CMD_HUNT = 35,                  /* CMD_HUNT  */
+  YYSYMBOL_CMD_FILL = 36,                  /* CMD_FILL  */
+  YYSYMBOL_CMD_MOVE = 37,                  /* CMD_MOVE  */
+  YYSYMBOL_CMD_GOTO = 38,                  /* CMD_GOTO  */
+  YYSYMBOL_CMD_REGISTERS = 39,             /* CMD_REGISTERS  */
+  YYSYMBOL_CMD_READSPACE = 40,             /* CMD_READSPACE  */
+  YYSYMBOL_CMD_WRITESPACE = 41,            /* CMD_WRITESPACE  */
+  YYSYMBOL_CMD_RADIX = 42,                 /* CMD_RADIX  */
+  YYSYMBOL_CMD_MEM_DISPLAY = 43,           /* CMD_MEM_DISPLAY  */
+  YYSYMBOL_CMD_BREAK = 44,                 /* CMD_BREAK  */
+  YYSYMBOL_CMD_TRACE = 45,                 /* CMD_TRACE  */
+  YYSYMBOL_CMD_IO = 46,                    /* CMD_IO  */
+  YYSYMBOL_CMD_BRMON = 47,                 /* CMD_BRMON  */
+  YYSYMBOL_CMD_COMPARE = 48,               /* CMD_COMPARE  */
+  YYSYMBOL_CMD_DUMP = 49,                  /* CMD_DUMP  */
+  YYSYMBOL_CMD_UNDUMP = 50,                /* CMD_UNDUMP  */
+  YYSYMBOL_CMD_EXIT = 51,                  /* CMD_EXIT  */
+  YYSYMBOL_CMD_DELETE = 52,                /* CMD_DELETE  */
+  YYSYMBOL_CMD_CONDITION = 53,             /* CMD_CONDITION  */
+  YYSYMBOL_CMD_COMMAND = 54,               /* CMD_COMMAND  */
+  YYSYMBOL_CMD_ASSEMBLE = 55,              /* CMD_ASSEMBLE  */
+  YYSYMBOL_CMD_DISASSEMBLE = 56,           /* CMD_DISASSEMBLE  */
+  YYSYMBOL_CMD_NEXT = 57,                  /* CMD_NEXT  */
+  YYSYMBOL_CMD_STEP = 58,                  /* CMD_STEP  */
+  YYSYMBOL_CMD_PRINT = 59,                 /* CMD_PRINT  */
+  YYSYMBOL_CMD_DEVICE = 60,                /* CMD_DEVICE  */
+  YYSYMBOL_CMD_HELP = 61,                  /* CMD_HELP  */
+  YYSYMBOL_CMD_WATCH = 62,                 /* CMD_WATCH  */
+  YYSYMBOL_CMD_DISK = 63,                  /* CMD_DISK  */
+  YYSYMBOL_CMD_QUIT = 64,                  /* CMD_QUIT  */
+  YYSYMBOL_CMD_CHDIR = 65,                 /* CMD_CHDIR  */
+  YYSYMBOL_CMD_BANK = 66,                  /* CMD_BANK  */
+  YYSYMBOL_CMD_LOAD_LABELS = 67,           /* CMD_LOAD_LABELS  */
+  YYSYMBOL_CMD_SAVE_LABELS = 68,           /* CMD_SAVE_LABELS  */
+  YYSYMBOL_CMD_ADD_LABEL = 69,             /* CMD_ADD_LABEL  */
+  YYSYMBOL_CMD_DEL_LABEL = 70,             /* CMD_DEL_LABEL  */
+  YYSYMBOL_CMD_SHOW_LABELS = 71,           /* CMD_SHOW_LABELS  */
+  YYSYMBOL_CMD_CLEAR_LABELS = 72,          /* CMD_CLEAR_LABELS  */
+  YYSYMBOL_CMD_RECORD = 73,                /* CMD_RECORD  */
+  YYSYMBOL_CMD_MON_STOP = 74,              /* CMD_MON_STOP  */
+  YYSYMBOL_CMD_PLAYBACK = 75,              /* CMD_PLAYBACK  */
+  YYSYMBOL_CMD_CHAR_DISPLAY = 76,          /* CMD_CHAR_DISPLAY  */
+  YYSYMBOL_CMD_SPRITE_DISPLAY = 77,        /* CMD_SPRITE_DISPLAY  */
+  YYSYMBOL_CMD_TEXT_DISPLAY = 78,          /* CMD_TEXT_DISPLAY  */
+  YYSYMBOL_CMD_SCREENCODE_DISPLAY = 79,    /* CMD_SCREENCODE_DISPLAY  */
+  YYSYMBOL_CMD_ENTER_DATA = 80,            /* CMD_ENTER_DATA  */
+  YYSYMBOL_CMD_ENTER_BIN_DATA = 81,        /* CMD_ENTER_BIN_DATA  */
+  YYSYMBOL_CMD_KEYBUF = 82,                /* CMD_KEYBUF  */
+  YYSYMBOL_CMD_BLOAD = 83,                 /* CMD_BLOAD  */
+  YYSYMBOL_CMD_BSAVE = 84,                 /* CMD_BSAVE  */
+  YYSYMBOL_CMD_SCREEN = 85,                /* CMD_SCREEN  */
+  YYSYMBOL_CMD_UNTIL = 86,                 /* CMD_UNTIL  */
+  YYSYMBOL_CMD_CPU = 87,                   /* CMD_CPU  */
+  YYSYMBOL_CMD_YYDEBUG = 88,               /* CMD_YYDEBUG  */
+  YYSYMBOL_CMD_BACKTRACE = 89,             /* CMD_BACKTRACE  */
+  YYSYMBOL_CMD_SCREENSHOT = 90,            /* CMD_SCREENSHOT  */
+  YYSYMBOL_CMD_PWD = 91,                   /* CMD_PWD  */
+  YYSYMBOL_CMD_DIR = 92,                   /* CMD_DIR  */
+  YYSYMBOL_CMD_RESOURCE_GET = 93,          /* CMD_RESOURCE_GET  */
+  YYSYMBOL_CMD_RESOURCE_SET = 94,          /* CMD_RESOURCE_SET  */
+  YYSYMBOL_CMD_LOAD_RESOURCES = 95,        /* CMD_LOAD_RESOURCES  */
+  YYSYMBOL_CMD_SAVE_RESOURCES = 96,        /* CMD_SAVE_RESOURCES  */
+  YYSYMBOL_CMD_ATTACH = 97,                /* CMD_ATTACH  */
+  YYSYMBOL_CMD_DETACH = 98,                /* CMD_DETACH  */
+  YYSYMBOL_CMD_MON_RESET = 99,             /* CMD_MON_RESET  */
+  YYSYMBOL_CMD_TAPECTRL = 100,             /* CMD_TAPECTRL  */
+  YYSYMBOL_CMD_CARTFREEZE = 101,           /* CMD_CARTFREEZE  */
+  YYSYMBOL_CMD_CPUHISTORY = 102,           /* CMD_CPUHISTORY  */
+  YYSYMBOL_CMD_MEMMAPZAP = 103,            /* CMD_MEMMAPZAP  */
+  YYSYMBOL_CMD_MEMMAPSHOW = 104,           /* CMD_MEMMAPSHOW  */
+  YYSYMBOL_CMD_MEMMAPSAVE = 105,           /* CMD_MEMMAPSAVE  */
+  YYSYMBOL_CMD_COMMENT = 106,              /* CMD_COMMENT  */
+  YYSYMBOL_CMD_LIST = 107,                 /* CMD_LIST  */
+  YYSYMBOL_CMD_STOPWATCH = 108,            /* CMD_STOPWATCH  */
+  YYSYMBOL_RESET = 109,                    /* RESET  */
+  YYSYMBOL_CMD_PROFILE = 110,              /* CMD_PROFILE  */
+  YYSYMBOL_CMD_EXPORT = 111,               /* CMD_EXPORT  */
+  YYSYMBOL_CMD_AUTOSTART = 112,            /* CMD_AUTOSTART  */
+  YYSYMBOL_CMD_AUTOLOAD = 113,             /* CMD_AUTOLOAD  */
+  YYSYMBOL_CMD_MAINCPU_TRACE = 114,        /* CMD_MAINCPU_TRACE  */
+  YYSYMBOL_CMD_LABEL_ASGN = 115,           /* CMD_LABEL_ASGN  */
+  YYSYMBOL_L_PAREN = 116,                  /* L_PAREN  */
+  YYSYMBOL_R_PAREN = 117,                  /* R_PAREN  */
+  YYSYMBOL_ARG_IMMEDIATE = 118,            /* ARG_IMMEDIATE  */
+  YYSYMBOL_REG_A = 119,                    /* REG_A  */
+  YYSYMBOL_REG_X = 120,                    /* REG_X  */
+  YYSYMBOL_REG_Y = 121,                    /* REG_Y  */
+  YYSYMBOL_COMMA = 122,                    /* COMMA  */
+  YYSYMBOL_INST_SEP = 123,                 /* INST_SEP  */
+  YYSYMBOL_L_BRACKET = 124,                /* L_BRACKET  */
+  YYSYMBOL_R_BRACKET = 125,                /* R_BRACKET  */
+  YYSYMBOL_LESS_THAN = 126,                /* LESS_THAN  */
+  YYSYMBOL_REG_U = 127,                    /* REG_U  */
+  YYSYMBOL_REG_S = 128,                    /* REG_S  */
+  YYSYMBOL_REG_PC = 129,                   /* REG_PC  */
+  YYSYMBOL_REG_PCR = 130,                  /* REG_PCR  */
+  YYSYMBOL_REG_B = 131,                    /* REG_B  */
+  YYSYMBOL_REG_C = 132,                    /* REG_C  */
+  YYSYMBOL_REG_D = 133,                    /* REG_D  */
+  YYSYMBOL_REG_E = 134,                    /* REG_E  */
+  YYSYMBOL_REG_H = 135,                    /* REG_H  */
+  YYSYMBOL_REG_L = 136,                    /* REG_L  */
+  YYSYMBOL_REG_AF = 137,                   /* REG_AF  */
+  YYSYMBOL_REG_BC = 138,                   /* REG_BC  */
+  YYSYMBOL_REG_DE = 139,                   /* REG_DE  */
+  YYSYMBOL_REG_HL = 140,                   /* REG_HL  */
+  YYSYMBOL_REG_IX = 141,                   /* REG_IX  */
+  YYSYMBOL_REG_IY = 142,                   /* REG_IY  */
+  YYSYMBOL_REG_SP = 143,                   /* REG_SP  */
+  YYSYMBOL_REG_IXH = 144,                  /* REG_IXH  */
+  YYSYMBOL_REG_IXL = 145,                  /* REG_IXL  */
+  YYSYMBOL_REG_IYH = 146,                  /* REG_IYH  */
+  YYSYMBOL_REG_IYL = 147,                  /* REG_IYL  */
+  YYSYMBOL_PLUS = 148,                     /* PLUS  */
+  YYSYMBOL_MINUS = 149,                    /* MINUS  */
+  YYSYMBOL_STRING = 150,                   /* STRING  */
+  YYSYMBOL_FILENAME = 151,                 /* FILENAME  */
+  YYSYMBOL_R_O_L = 152,                    /* R_O_L  */
+  YYSYMBOL_OPCODE = 153,                   /* OPCODE  */
+  YYSYMBOL_LABEL = 154,                    /* LABEL  */
+  YYSYMBOL_BANKNAME = 155,                 /* BANKNAME  */
+  YYSYMBOL_CPUTYPE = 156,                  /* CPUTYPE  */
+  YYSYMBOL_MON_REGISTER = 157,             /* MON_REGISTER  */
+  YYSYMBOL_COMPARE_OP = 158,               /* COMPARE_OP  */
+  YYSYMBOL_RADIX_TYPE = 159,               /* RADIX_TYPE  */
+  YYSYMBOL_INPUT_SPEC = 160,               /* INPUT_SPEC  */
+  YYSYMBOL_CMD_CHECKPT_ON = 161,           /* CMD_CHECKPT_ON  */
+  YYSYMBOL_CMD_CHECKPT_OFF = 162,          /* CMD_CHECKPT_OFF  */
+  YYSYMBOL_TOGGLE = 163,                   /* TOGGLE  */
+  YYSYMBOL_MASK = 164,                     /* MASK  */
+  YYSYMBOL_165_ = 165,                     /* '+'  */
+  YYSYMBOL_166_ = 166,                     /* '-'  */
+  YYSYMBOL_167_ = 167,                     /* '*'  */
+  YYSYMBOL_168_ = 168,                     /* '/'  */
+  YYSYMBOL_169_ = 169,                     /* '('  */
+  YYSYMBOL_170_ = 170,                     /* ')'  */
+  YYSYMBOL_171_ = 171,                     /* '@'  */
+  YYSYMBOL_172_ = 172,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 173,                 /* $accept  */
+  YYSYMBOL_top_level = 174,                /* top_level  */
+  YYSYMBOL_command_list = 175,             /* command_list  */
+  YYSYMBOL_end_cmd = 176,                  /* end_cmd  */
+  YYSYMBOL_command = 177,                  /* command  */
+  YYSYMBOL_machine_state_rules = 178,      /* machine_state_rules  */
+  YYSYMBOL_register_mod = 179,             /* register_mod  */
+  YYSYMBOL_symbol_table_rules = 180,       /* symbol_table_rules  */
+  YYSYMBOL_asm_rules = 181,                /* asm_rules  */
+  YYSYMBOL_182_1 = 182,                    /* $@1  */
+  YYSYMBOL_memory_rules = 183,             /* memory_rules  */
+  YYSYMBOL_checkpoint_rules = 184,         /* checkpoint_rules  */
+  YYSYMBOL_checkpoint_control_rules = 185, /* checkpoint_control_rules  */
+  YYSYMBOL_monitor_state_rules = 186,      /* monitor_state_rules  */
+  YYSYMBOL_monitor_misc_rules = 187,       /* monitor_misc_rules  */
+  YYSYMBOL_disk_rules = 188,               /* disk_rules  */
+  YYSYMBOL_cmd_file_rules = 189,           /* cmd_file_rules  */
+  YYSYMBOL_data_entry_rules = 190,         /* data_entry_rules  */
+  YYSYMBOL_monitor_debug_rules = 191,      /* monitor_debug_rules  */
+  YYSYMBOL_rest_of_line = 192,             /* rest_of_line  */
+  YYSYMBOL_opt_rest_of_line = 193,         /* opt_rest_of_line  */
+  YYSYMBOL_filename = 194,                 /* filename  */
+  YYSYMBOL_device_num = 195,               /* device_num  */
+  YYSYMBOL_mem_op = 196,                   /* mem_op  */
+  YYSYMBOL_opt_mem_op = 197,               /* opt_mem_op  */
+  YYSYMBOL_register = 198,                 /* register  */
+  YYSYMBOL_reg_list = 199,                 /* reg_list  */
+  YYSYMBOL_reg_asgn = 200,                 /* reg_asgn  */
+  YYSYMBOL_checkpt_num = 201,              /* checkpt_num  */
+  YYSYMBOL_address_opt_range = 202,        /* address_opt_range  */
+  YYSYMBOL_address_range = 203,            /* address_range  */
+  YYSYMBOL_opt_address = 204,              /* opt_address  */
+  YYSYMBOL_address = 205,                  /* address  */
+  YYSYMBOL_opt_sep = 206,                  /* opt_sep  */
+  YYSYMBOL_memspace = 207,                 /* memspace  */
+  YYSYMBOL_memloc = 208,                   /* memloc  */
+  YYSYMBOL_memaddr = 209,                  /* memaddr  */
+  YYSYMBOL_expression = 210,               /* expression  */
+  YYSYMBOL_opt_if_cond_expr = 211,         /* opt_if_cond_expr  */
+  YYSYMBOL_cond_expr = 212,                /* cond_expr  */
+  YYSYMBOL_compare_operand = 213,          /* compare_operand  */
+  YYSYMBOL_data_list = 214,                /* data_list  */
+  YYSYMBOL_data_element = 215,             /* data_element  */
+  YYSYMBOL_hunt_list = 216,                /* hunt_list  */
+  YYSYMBOL_hunt_element = 217,             /* hunt_element  */
+  YYSYMBOL_value = 218,                    /* value  */
+  YYSYMBOL_d_number = 219,                 /* d_number  */
+  YYSYMBOL_guess_default = 220,            /* guess_default  */
+  YYSYMBOL_number = 221,                   /* number  */
+  YYSYMBOL_assembly_instr_list = 222,      /* assembly_instr_list  */
+  YYSYMBOL_assembly_instruction = 223,     /* assembly_instruction  */
+  YYSYMBOL_post_assemble = 224,            /* post_assemble  */
+  YYSYMBOL_asm_operand_mode = 225,         /* asm_operand_mode  */
+  YYSYMBOL_index_reg = 226,                /* index_reg  */
+  YYSYMBOL_index_ureg = 227                /* index_ureg  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_MON_PARSE_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 596 "mon_parse.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -627,15 +555,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -649,47 +590,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -702,8 +639,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -768,8 +719,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -778,17 +728,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -801,11 +751,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -817,12 +767,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -832,38 +782,41 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  312
+#define YYFINAL  316
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1713
+#define YYLAST   1787
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  172
+#define YYNTOKENS  173
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  55
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  314
+#define YYNRULES  317
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  628
+#define YYNSTATES  634
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   418
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   419
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     168,   169,   166,   164,     2,   165,     2,   167,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   171,     2,
-       2,     2,     2,     2,   170,     2,     2,     2,     2,     2,
+     169,   170,   167,   165,     2,   166,     2,   168,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   172,     2,
+       2,     2,     2,     2,   171,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -898,12 +851,12 @@ static const yytype_uint8 yytranslate[] =
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   163
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
        0,   199,   199,   200,   201,   204,   205,   208,   209,   210,
      213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
@@ -919,64 +872,71 @@ static const yytype_uint16 yyrline[] =
      453,   455,   473,   475,   477,   479,   481,   485,   487,   489,
      491,   493,   495,   497,   499,   501,   503,   505,   507,   509,
      511,   513,   515,   517,   519,   521,   523,   525,   527,   529,
-     533,   535,   537,   539,   541,   543,   545,   547,   549,   551,
-     553,   555,   557,   559,   561,   563,   565,   567,   569,   573,
-     575,   577,   581,   583,   587,   591,   594,   595,   598,   599,
-     602,   603,   606,   607,   610,   611,   614,   620,   628,   629,
-     632,   636,   637,   640,   641,   644,   645,   647,   651,   652,
-     655,   660,   665,   675,   676,   679,   680,   681,   682,   683,
-     686,   688,   690,   691,   692,   693,   694,   695,   696,   699,
-     700,   702,   707,   709,   711,   713,   717,   723,   729,   737,
-     738,   741,   742,   745,   746,   749,   750,   751,   754,   755,
-     758,   759,   760,   761,   764,   765,   766,   769,   770,   771,
-     772,   773,   776,   777,   778,   781,   791,   792,   795,   802,
-     813,   824,   832,   851,   857,   865,   873,   875,   877,   878,
-     879,   880,   881,   882,   883,   885,   887,   889,   891,   892,
-     893,   894,   895,   896,   897,   898,   899,   900,   901,   902,
-     903,   904,   905,   906,   907,   908,   909,   911,   912,   927,
-     931,   935,   939,   943,   947,   951,   955,   959,   971,   986,
-     990,   994,   998,  1002,  1006,  1010,  1014,  1018,  1030,  1035,
-    1043,  1044,  1045,  1046,  1050
+     531,   533,   535,   539,   541,   543,   545,   547,   549,   551,
+     553,   555,   557,   559,   561,   563,   565,   567,   569,   571,
+     573,   575,   579,   581,   583,   587,   589,   593,   597,   600,
+     601,   604,   605,   608,   609,   612,   613,   616,   617,   620,
+     626,   634,   635,   638,   642,   643,   646,   647,   650,   651,
+     653,   657,   658,   661,   666,   671,   681,   682,   685,   686,
+     687,   688,   689,   692,   694,   696,   697,   698,   699,   700,
+     701,   702,   705,   706,   708,   713,   715,   717,   719,   723,
+     729,   735,   743,   744,   747,   748,   751,   752,   755,   756,
+     757,   760,   761,   764,   765,   766,   767,   770,   771,   772,
+     775,   776,   777,   778,   779,   782,   783,   784,   787,   797,
+     798,   801,   808,   819,   830,   838,   857,   863,   871,   879,
+     881,   883,   884,   885,   886,   887,   888,   889,   891,   893,
+     895,   897,   898,   899,   900,   901,   902,   903,   904,   905,
+     906,   907,   908,   909,   910,   911,   912,   913,   914,   915,
+     917,   918,   933,   937,   941,   945,   949,   953,   957,   961,
+     965,   977,   992,   996,  1000,  1004,  1008,  1012,  1016,  1020,
+    1024,  1036,  1041,  1049,  1050,  1051,  1052,  1056
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "H_NUMBER", "D_NUMBER", "O_NUMBER",
-  "B_NUMBER", "CONVERT_OP", "B_DATA", "H_RANGE_GUESS", "D_NUMBER_GUESS",
-  "O_NUMBER_GUESS", "B_NUMBER_GUESS", "BAD_CMD", "MEM_OP", "IF",
-  "MEM_COMP", "MEM_DISK8", "MEM_DISK9", "MEM_DISK10", "MEM_DISK11",
-  "EQUALS", "TRAIL", "CMD_SEP", "LABEL_ASGN_COMMENT", "CMD_SIDEFX",
-  "CMD_RETURN", "CMD_BLOCK_READ", "CMD_BLOCK_WRITE", "CMD_UP", "CMD_DOWN",
-  "CMD_LOAD", "CMD_SAVE", "CMD_VERIFY", "CMD_IGNORE", "CMD_HUNT",
-  "CMD_FILL", "CMD_MOVE", "CMD_GOTO", "CMD_REGISTERS", "CMD_READSPACE",
-  "CMD_WRITESPACE", "CMD_RADIX", "CMD_MEM_DISPLAY", "CMD_BREAK",
-  "CMD_TRACE", "CMD_IO", "CMD_BRMON", "CMD_COMPARE", "CMD_DUMP",
-  "CMD_UNDUMP", "CMD_EXIT", "CMD_DELETE", "CMD_CONDITION", "CMD_COMMAND",
-  "CMD_ASSEMBLE", "CMD_DISASSEMBLE", "CMD_NEXT", "CMD_STEP", "CMD_PRINT",
-  "CMD_DEVICE", "CMD_HELP", "CMD_WATCH", "CMD_DISK", "CMD_QUIT",
-  "CMD_CHDIR", "CMD_BANK", "CMD_LOAD_LABELS", "CMD_SAVE_LABELS",
-  "CMD_ADD_LABEL", "CMD_DEL_LABEL", "CMD_SHOW_LABELS", "CMD_CLEAR_LABELS",
-  "CMD_RECORD", "CMD_MON_STOP", "CMD_PLAYBACK", "CMD_CHAR_DISPLAY",
-  "CMD_SPRITE_DISPLAY", "CMD_TEXT_DISPLAY", "CMD_SCREENCODE_DISPLAY",
-  "CMD_ENTER_DATA", "CMD_ENTER_BIN_DATA", "CMD_KEYBUF", "CMD_BLOAD",
-  "CMD_BSAVE", "CMD_SCREEN", "CMD_UNTIL", "CMD_CPU", "CMD_YYDEBUG",
-  "CMD_BACKTRACE", "CMD_SCREENSHOT", "CMD_PWD", "CMD_DIR",
-  "CMD_RESOURCE_GET", "CMD_RESOURCE_SET", "CMD_LOAD_RESOURCES",
+  "\"end of file\"", "error", "\"invalid token\"", "H_NUMBER", "D_NUMBER",
+  "O_NUMBER", "B_NUMBER", "CONVERT_OP", "B_DATA", "H_RANGE_GUESS",
+  "D_NUMBER_GUESS", "O_NUMBER_GUESS", "B_NUMBER_GUESS", "BAD_CMD",
+  "MEM_OP", "IF", "MEM_COMP", "MEM_DISK8", "MEM_DISK9", "MEM_DISK10",
+  "MEM_DISK11", "EQUALS", "TRAIL", "CMD_SEP", "LABEL_ASGN_COMMENT",
+  "CMD_SIDEFX", "CMD_RETURN", "CMD_BLOCK_READ", "CMD_BLOCK_WRITE",
+  "CMD_UP", "CMD_DOWN", "CMD_LOAD", "CMD_SAVE", "CMD_VERIFY", "CMD_IGNORE",
+  "CMD_HUNT", "CMD_FILL", "CMD_MOVE", "CMD_GOTO", "CMD_REGISTERS",
+  "CMD_READSPACE", "CMD_WRITESPACE", "CMD_RADIX", "CMD_MEM_DISPLAY",
+  "CMD_BREAK", "CMD_TRACE", "CMD_IO", "CMD_BRMON", "CMD_COMPARE",
+  "CMD_DUMP", "CMD_UNDUMP", "CMD_EXIT", "CMD_DELETE", "CMD_CONDITION",
+  "CMD_COMMAND", "CMD_ASSEMBLE", "CMD_DISASSEMBLE", "CMD_NEXT", "CMD_STEP",
+  "CMD_PRINT", "CMD_DEVICE", "CMD_HELP", "CMD_WATCH", "CMD_DISK",
+  "CMD_QUIT", "CMD_CHDIR", "CMD_BANK", "CMD_LOAD_LABELS",
+  "CMD_SAVE_LABELS", "CMD_ADD_LABEL", "CMD_DEL_LABEL", "CMD_SHOW_LABELS",
+  "CMD_CLEAR_LABELS", "CMD_RECORD", "CMD_MON_STOP", "CMD_PLAYBACK",
+  "CMD_CHAR_DISPLAY", "CMD_SPRITE_DISPLAY", "CMD_TEXT_DISPLAY",
+  "CMD_SCREENCODE_DISPLAY", "CMD_ENTER_DATA", "CMD_ENTER_BIN_DATA",
+  "CMD_KEYBUF", "CMD_BLOAD", "CMD_BSAVE", "CMD_SCREEN", "CMD_UNTIL",
+  "CMD_CPU", "CMD_YYDEBUG", "CMD_BACKTRACE", "CMD_SCREENSHOT", "CMD_PWD",
+  "CMD_DIR", "CMD_RESOURCE_GET", "CMD_RESOURCE_SET", "CMD_LOAD_RESOURCES",
   "CMD_SAVE_RESOURCES", "CMD_ATTACH", "CMD_DETACH", "CMD_MON_RESET",
   "CMD_TAPECTRL", "CMD_CARTFREEZE", "CMD_CPUHISTORY", "CMD_MEMMAPZAP",
   "CMD_MEMMAPSHOW", "CMD_MEMMAPSAVE", "CMD_COMMENT", "CMD_LIST",
-  "CMD_STOPWATCH", "RESET", "CMD_EXPORT", "CMD_AUTOSTART", "CMD_AUTOLOAD",
-  "CMD_MAINCPU_TRACE", "CMD_LABEL_ASGN", "L_PAREN", "R_PAREN",
-  "ARG_IMMEDIATE", "REG_A", "REG_X", "REG_Y", "COMMA", "INST_SEP",
-  "L_BRACKET", "R_BRACKET", "LESS_THAN", "REG_U", "REG_S", "REG_PC",
-  "REG_PCR", "REG_B", "REG_C", "REG_D", "REG_E", "REG_H", "REG_L",
-  "REG_AF", "REG_BC", "REG_DE", "REG_HL", "REG_IX", "REG_IY", "REG_SP",
-  "REG_IXH", "REG_IXL", "REG_IYH", "REG_IYL", "PLUS", "MINUS", "STRING",
-  "FILENAME", "R_O_L", "OPCODE", "LABEL", "BANKNAME", "CPUTYPE",
+  "CMD_STOPWATCH", "RESET", "CMD_PROFILE", "CMD_EXPORT", "CMD_AUTOSTART",
+  "CMD_AUTOLOAD", "CMD_MAINCPU_TRACE", "CMD_LABEL_ASGN", "L_PAREN",
+  "R_PAREN", "ARG_IMMEDIATE", "REG_A", "REG_X", "REG_Y", "COMMA",
+  "INST_SEP", "L_BRACKET", "R_BRACKET", "LESS_THAN", "REG_U", "REG_S",
+  "REG_PC", "REG_PCR", "REG_B", "REG_C", "REG_D", "REG_E", "REG_H",
+  "REG_L", "REG_AF", "REG_BC", "REG_DE", "REG_HL", "REG_IX", "REG_IY",
+  "REG_SP", "REG_IXH", "REG_IXL", "REG_IYH", "REG_IYL", "PLUS", "MINUS",
+  "STRING", "FILENAME", "R_O_L", "OPCODE", "LABEL", "BANKNAME", "CPUTYPE",
   "MON_REGISTER", "COMPARE_OP", "RADIX_TYPE", "INPUT_SPEC",
   "CMD_CHECKPT_ON", "CMD_CHECKPT_OFF", "TOGGLE", "MASK", "'+'", "'-'",
   "'*'", "'/'", "'('", "')'", "'@'", "':'", "$accept", "top_level",
@@ -993,117 +953,98 @@ static const char *const yytname[] =
   "guess_default", "number", "assembly_instr_list", "assembly_instruction",
   "post_assemble", "asm_operand_mode", "index_reg", "index_ureg", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,    43,    45,    42,    47,    40,    41,
-      64,    58
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -398
+#define YYPACT_NINF (-465)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-398)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -195
+#define YYTABLE_NINF (-198)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    1117,   890,  -398,  -398,   103,   365,   890,   890,    89,    89,
-      49,    49,    49,   574,  1473,  1473,  1473,  1115,   409,    60,
-     983,  1231,  1231,  1115,  1473,    49,    49,   365,   742,   574,
-     574,  1491,  1369,    89,    89,   890,   696,   169,  1231,  -132,
-     365,  -132,   515,   189,   189,  1491,   426,  1511,  1511,    49,
-     365,    49,  1369,  1369,  1369,  1369,  1491,   365,  -132,    49,
-      49,   365,  1369,   137,   365,   365,    49,   365,  -126,  -122,
-     -78,    49,    49,    49,   890,    89,   -70,   365,    89,   365,
-      89,    49,  -126,   503,   324,   365,    49,    49,   -73,    70,
-    1536,   742,   742,   121,  1254,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,   107,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,   890,  -398,   -21,   241,  -398,  -398,  -398,
-    -398,  -398,  -398,   365,  -398,  -398,   927,   927,  -398,  -398,
-     890,  -398,   890,  -398,  -398,   669,   691,   669,  -398,  -398,
-    -398,  -398,  -398,    89,  -398,  -398,  -398,   -70,   -70,   -70,
-    -398,  -398,  -398,   -70,   -70,  -398,   365,   -70,  -398,   122,
-     233,  -398,    95,   365,  -398,   -70,  -398,   365,  -398,   340,
-    -398,  -398,   138,  1473,  -398,  1473,  -398,   365,   -70,   365,
-     365,  -398,   472,  -398,   365,   152,   109,   171,  -398,   365,
-    -398,   890,  -398,   890,   241,   365,  -398,  -398,   365,  -398,
-    1473,   365,  -398,   365,   365,  -398,    65,   365,   -70,   365,
-     -70,   -70,   365,   -70,  -398,   365,  -398,   365,   365,  -398,
-     365,  -398,   365,  -398,   365,  -398,   365,  -398,   365,  1097,
-    -398,   365,   669,   669,  -398,  -398,   365,   365,  -398,  -398,
-    -398,    89,  -398,  -398,   365,   365,    31,   365,   365,   890,
-     241,  -398,   890,   890,  -398,  -398,   890,  -398,  -398,   890,
-     -70,   365,   476,  -398,   365,   255,   365,  -398,  -398,  1592,
-    1592,   365,  1491,   830,  1546,    61,   264,  1566,  1546,    66,
-    -398,    74,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,    76,  -398,  -398,   365,
-    -398,   365,  -398,  -398,  -398,    12,  -398,   890,   890,   890,
-     890,  -398,  -398,   162,   946,   241,   241,  -398,   277,  1392,
-    1415,  1455,  -398,   890,   144,  1491,  1253,  1097,  1491,  -398,
-    1546,  1546,   230,  -398,  -398,  -398,  1473,  -398,  -398,   186,
-     186,  -398,  1491,  -398,  -398,  -398,   716,   365,    54,  -398,
-      62,  -398,   241,   241,  -398,  -398,  -398,   186,  -398,  -398,
-    -398,  -398,    72,  -398,    49,  -398,    49,    71,  -398,    79,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  1513,
-    -398,  -398,  -398,   277,  1435,  -398,  -398,  -398,   890,  -398,
-    -398,   365,  -398,  -398,   241,  -398,   241,   241,   241,   857,
-     890,  -398,  -398,  -398,  -398,  1546,  -398,  1546,  -398,   468,
-      99,   113,   117,   120,   128,   143,    -1,  -398,   442,  -398,
-    -398,  -398,  -398,   332,    91,  -398,   133,   362,   140,   141,
-      -5,  -398,   442,   442,  1580,  -398,  -398,  -398,  -398,    -9,
-      -9,  -398,  -398,   365,  1491,   365,  -398,  -398,   365,  -398,
-     365,  -398,   365,   241,  -398,  -398,    53,  -398,  -398,  -398,
-    -398,  -398,  1513,   365,  -398,  -398,   365,   716,   365,   365,
-     365,   716,   119,  -398,    80,  -398,  -398,  -398,   365,   149,
-     157,   365,  -398,  -398,   365,   365,   365,   365,   365,   365,
-    -398,  1097,   365,  -398,   365,   241,  -398,  -398,  -398,  -398,
-    -398,  -398,   365,   241,   365,   365,   365,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,   153,  -107,  -398,   442,  -398,   134,
-     442,   422,   -98,   442,   442,   534,   173,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,   155,  -398,  -398,
-    -398,     7,   127,   285,  -398,  -398,    62,    62,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,   238,   190,   193,  -398,  -398,   194,
-     442,   195,  -398,   -69,   198,   212,   213,   216,   222,  -398,
-    -398,  1491,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,   192,  -398,   221,  -398,  -398,   224,  -398,  -398,
-    -398,  -398,  -398,  -398,   231,  -398,  -398,  -398
+    1233,   879,  -465,  -465,   105,   168,   879,   879,   515,   515,
+      13,    13,    13,   487,  1556,  1556,  1556,  1490,   261,    48,
+    1098,  1199,  1199,  1490,  1556,    13,    13,   168,   720,   487,
+     487,  1574,  1351,   515,   515,   879,   423,    79,  1199,  -139,
+     168,  -139,   385,   371,   371,  1574,   357,   695,   695,    13,
+     168,    13,  1351,  1351,  1351,  1351,  1574,   168,  -139,    13,
+      13,   168,  1351,    92,   168,   168,    13,   168,  -136,  -100,
+     -73,    13,    13,    13,   879,   515,   -23,   168,   515,   168,
+     515,    13,  -136,   646,   307,   176,   168,    13,    13,   -56,
+      98,  1615,   720,   720,   121,  1371,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+     125,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,   879,  -465,    -1,    46,  -465,  -465,
+    -465,  -465,  -465,  -465,   168,  -465,  -465,   921,   921,  -465,
+    -465,   879,  -465,   879,  -465,  -465,   688,   855,   688,  -465,
+    -465,  -465,  -465,  -465,   515,  -465,  -465,  -465,   -23,   -23,
+     -23,  -465,  -465,  -465,   -23,   -23,  -465,   168,   -23,  -465,
+     145,   111,  -465,    53,   168,  -465,   -23,  -465,   168,  -465,
+     248,  -465,  -465,   161,  1556,  -465,  1556,  -465,   168,   -23,
+     168,   168,  -465,   318,  -465,   168,   163,    54,    94,  -465,
+     168,  -465,   879,  -465,   879,    46,   168,  -465,  -465,   168,
+    -465,  1556,   168,  -465,   168,   168,  -465,    81,   168,   -23,
+     168,   -23,   -23,   168,   -23,  -465,   168,  -465,   168,   168,
+    -465,   168,  -465,   168,  -465,   168,  -465,   168,  -465,   168,
+     472,  -465,   168,   688,   688,  -465,  -465,   168,   168,  -465,
+    -465,  -465,   515,  -465,  -465,   168,   168,    51,   168,   168,
+     879,    46,  -465,   879,   879,  -465,  -465,   879,  -465,  -465,
+     879,   -23,   168,   397,  -465,   168,  -109,   168,  -465,   168,
+     168,  -465,  -465,  1151,  1151,   168,  1574,   539,  1119,    84,
+      31,  1644,  1119,    87,  -465,    96,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+      97,  -465,  -465,   168,  -465,   168,  -465,  -465,  -465,    19,
+    -465,   879,   879,   879,   879,  -465,  -465,   131,   832,    46,
+      46,  -465,   172,   902,  1518,  1231,  -465,   879,   138,  1574,
+     960,   472,  1574,  -465,  1119,  1119,    45,  -465,  -465,  -465,
+    1556,  -465,  -465,   206,   206,  -465,  1574,  -465,  -465,  -465,
+     240,   168,    73,  -465,    77,  -465,    46,    46,  -465,  -465,
+    -465,   206,  -465,  -465,  -465,  -465,    86,  -465,    13,  -465,
+      13,    72,  -465,   100,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  1594,  -465,  -465,  -465,   172,  1538,  -465,
+    -465,  -465,   879,  -465,  -465,   168,  -465,  -465,    46,  -465,
+      46,    46,    46,   972,   879,  -465,  -465,  -465,  -465,  -465,
+    -465,  1119,  -465,  1119,  -465,   326,   144,   147,   148,   149,
+     152,   156,    38,  -465,   232,  -465,  -465,  -465,  -465,   303,
+     127,  -465,   160,   317,   167,   169,    71,  -465,   232,   232,
+    1658,  -465,  -465,  -465,  -465,   -22,   -22,  -465,  -465,   168,
+    1574,   168,  -465,  -465,   168,  -465,   168,  -465,   168,    46,
+    -465,  -465,   300,  -465,  -465,  -465,  -465,  -465,  1594,   168,
+    -465,  -465,   168,   240,   168,   168,   168,   240,   137,  -465,
+      50,  -465,  -465,  -465,   168,   177,   184,   168,  -465,  -465,
+     168,   168,   168,   168,   168,   168,  -465,   472,   168,  -465,
+     168,    46,  -465,  -465,  -465,  -465,  -465,  -465,   168,    46,
+     168,   168,   168,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+     187,  -113,  -465,   232,  -465,   165,   232,   518,   -59,   232,
+     232,   432,   202,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,   174,  -465,  -465,  -465,    23,   171,   119,
+    -465,  -465,    77,    77,  -465,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,
+     225,   245,   252,  -465,  -465,   267,   232,   268,  -465,   -58,
+     269,   270,   275,   285,   296,  -465,  -465,  1574,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,   299,  -465,
+     297,  -465,  -465,   301,  -465,  -465,  -465,  -465,  -465,  -465,
+     304,  -465,  -465,  -465
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
        0,     0,    22,     4,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1111,444 +1052,459 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   167,     0,
-       0,     0,     0,     0,     0,     0,   194,     0,     0,     0,
-       0,     0,   167,     0,     0,     0,     0,     0,     0,     0,
-     268,     0,     0,     0,     2,     5,    10,    47,    11,    13,
-      12,    14,    15,    16,    17,    18,    19,    20,    21,     0,
-     237,   238,   239,   240,   236,   235,   234,   195,   196,   197,
-     198,   199,   176,     0,   229,     0,     0,   208,   241,   228,
-       9,     8,     7,     0,   109,    35,     0,     0,   193,    42,
-       0,    44,     0,   169,   168,     0,     0,     0,   182,   230,
-     233,   232,   231,     0,   181,   186,   192,   194,   194,   194,
-     190,   200,   201,   194,   194,    28,     0,   194,    48,     0,
-       0,   179,     0,     0,   111,   194,    75,     0,   183,   194,
-     173,    90,   174,     0,    96,     0,    29,     0,   194,     0,
-       0,   115,     9,   104,     0,     0,     0,     0,    68,     0,
-      40,     0,    38,     0,     0,     0,   165,   119,     0,    94,
-       0,     0,   114,     0,     0,    23,     0,     0,   194,     0,
-     194,   194,     0,   194,    59,     0,    61,     0,     0,   160,
-       0,    77,     0,    79,     0,    81,     0,    83,     0,     0,
-     163,     0,     0,     0,    46,    92,     0,     0,    31,   164,
-     124,     0,   126,   166,     0,     0,     0,     0,     0,     0,
-       0,   133,     0,     0,   136,    33,     0,    84,    85,     0,
-     194,     0,     9,   151,     0,   170,     0,   139,   113,     0,
-       0,     0,     0,     0,     0,   269,     0,     0,     0,   270,
-     271,   272,   273,   274,   277,   280,   281,   282,   283,   284,
-     285,   286,   275,   278,   276,   279,   249,   245,    98,     0,
-     100,     0,     1,     6,     3,     0,   177,     0,     0,     0,
-       0,   121,   108,   194,     0,     0,     0,   171,   194,   143,
-       0,     0,   101,     0,     0,     0,     0,     0,     0,    27,
-       0,     0,     0,    50,    49,   110,     0,    74,   172,   210,
-     210,    30,     0,    36,    37,   103,     0,     0,     0,    66,
-       0,    67,     0,     0,   118,   112,   120,   210,   117,   122,
-      25,    24,     0,    52,     0,    54,     0,     0,    56,     0,
-      58,    60,   159,   161,    76,    78,    80,    82,   222,     0,
-     220,   221,   123,   194,     0,    91,    32,   127,     0,   125,
-     129,     0,   131,   132,     0,   154,     0,     0,     0,     0,
-       0,   137,   152,   138,   155,     0,   157,     0,   116,     0,
-       0,     0,     0,     0,     0,     0,     0,   248,     0,   310,
-     311,   314,   313,     0,   293,   312,     0,     0,     0,     0,
-       0,   287,     0,     0,     0,    97,    99,   207,   206,   202,
-     203,   204,   205,     0,     0,     0,    43,    45,     0,   144,
-       0,   148,     0,     0,   227,   226,     0,   224,   225,   185,
-     187,   191,     0,     0,   180,   178,     0,     0,     0,     0,
-       0,     0,     0,   216,     0,   215,   217,   107,     0,   247,
-     246,     0,    41,    39,     0,     0,     0,     0,     0,     0,
-     162,     0,     0,   146,     0,     0,   130,   153,   134,   135,
-      34,    86,     0,     0,     0,     0,     0,    62,   258,   259,
-     260,   261,   262,   263,   254,     0,   295,     0,   291,   289,
-       0,     0,     0,     0,     0,     0,   308,   294,   296,   250,
-     251,   252,   297,   253,   288,   149,   188,   150,   140,   142,
-     147,   102,    72,   223,    71,    69,    73,   209,    89,    95,
-      70,     0,     0,     0,   105,   106,     0,   244,    65,    93,
-      26,    51,    53,    55,    57,   219,   141,   145,   128,    87,
-      88,   156,   158,    63,     0,     0,     0,   292,   290,     0,
-       0,     0,   303,     0,     0,     0,     0,     0,     0,   214,
-     213,     0,   212,   211,   242,   243,   264,   257,   265,   266,
-     267,   255,     0,   305,     0,   301,   299,     0,   304,   306,
-     307,   298,   309,   218,     0,   302,   300,   256
+       0,     0,     0,     0,     0,     0,     0,     0,   170,     0,
+       0,     0,     0,     0,     0,     0,   197,     0,     0,     0,
+       0,     0,   170,     0,     0,     0,     0,     0,     0,     0,
+       0,   271,     0,     0,     0,     2,     5,    10,    47,    11,
+      13,    12,    14,    15,    16,    17,    18,    19,    20,    21,
+       0,   240,   241,   242,   243,   239,   238,   237,   198,   199,
+     200,   201,   202,   179,     0,   232,     0,     0,   211,   244,
+     231,     9,     8,     7,     0,   109,    35,     0,     0,   196,
+      42,     0,    44,     0,   172,   171,     0,     0,     0,   185,
+     233,   236,   235,   234,     0,   184,   189,   195,   197,   197,
+     197,   193,   203,   204,   197,   197,    28,     0,   197,    48,
+       0,     0,   182,     0,     0,   111,   197,    75,     0,   186,
+     197,   176,    90,   177,     0,    96,     0,    29,     0,   197,
+       0,     0,   115,     9,   104,     0,     0,     0,     0,    68,
+       0,    40,     0,    38,     0,     0,     0,   168,   119,     0,
+      94,     0,     0,   114,     0,     0,    23,     0,     0,   197,
+       0,   197,   197,     0,   197,    59,     0,    61,     0,     0,
+     163,     0,    77,     0,    79,     0,    81,     0,    83,     0,
+       0,   166,     0,     0,     0,    46,    92,     0,     0,    31,
+     167,   124,     0,   126,   169,     0,     0,     0,     0,     0,
+       0,     0,   133,     0,     0,   136,    33,     0,    84,    85,
+       0,   197,     0,     9,   154,     0,   173,     0,   139,     0,
+       0,   142,   113,     0,     0,     0,     0,     0,     0,   272,
+       0,     0,     0,   273,   274,   275,   276,   277,   280,   283,
+     284,   285,   286,   287,   288,   289,   278,   281,   279,   282,
+     252,   248,    98,     0,   100,     0,     1,     6,     3,     0,
+     180,     0,     0,     0,     0,   121,   108,   197,     0,     0,
+       0,   174,   197,   146,     0,     0,   101,     0,     0,     0,
+       0,     0,     0,    27,     0,     0,     0,    50,    49,   110,
+       0,    74,   175,   213,   213,    30,     0,    36,    37,   103,
+       0,     0,     0,    66,     0,    67,     0,     0,   118,   112,
+     120,   213,   117,   122,    25,    24,     0,    52,     0,    54,
+       0,     0,    56,     0,    58,    60,   162,   164,    76,    78,
+      80,    82,   225,     0,   223,   224,   123,   197,     0,    91,
+      32,   127,     0,   125,   129,     0,   131,   132,     0,   157,
+       0,     0,     0,     0,     0,   137,   155,   138,   140,   141,
+     158,     0,   160,     0,   116,     0,     0,     0,     0,     0,
+       0,     0,     0,   251,     0,   313,   314,   317,   316,     0,
+     296,   315,     0,     0,     0,     0,     0,   290,     0,     0,
+       0,    97,    99,   210,   209,   205,   206,   207,   208,     0,
+       0,     0,    43,    45,     0,   147,     0,   151,     0,     0,
+     230,   229,     0,   227,   228,   188,   190,   194,     0,     0,
+     183,   181,     0,     0,     0,     0,     0,     0,     0,   219,
+       0,   218,   220,   107,     0,   250,   249,     0,    41,    39,
+       0,     0,     0,     0,     0,     0,   165,     0,     0,   149,
+       0,     0,   130,   156,   134,   135,    34,    86,     0,     0,
+       0,     0,     0,    62,   261,   262,   263,   264,   265,   266,
+     257,     0,   298,     0,   294,   292,     0,     0,     0,     0,
+       0,     0,   311,   297,   299,   253,   254,   255,   300,   256,
+     291,   152,   191,   153,   143,   145,   150,   102,    72,   226,
+      71,    69,    73,   212,    89,    95,    70,     0,     0,     0,
+     105,   106,     0,   247,    65,    93,    26,    51,    53,    55,
+      57,   222,   144,   148,   128,    87,    88,   159,   161,    63,
+       0,     0,     0,   295,   293,     0,     0,     0,   306,     0,
+       0,     0,     0,     0,     0,   217,   216,     0,   215,   214,
+     245,   246,   267,   260,   268,   269,   270,   258,     0,   308,
+       0,   304,   302,     0,   307,   309,   310,   301,   312,   221,
+       0,   305,   303,   259
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -398,  -398,  -398,   572,   220,  -398,  -398,  -398,  -398,  -398,
-    -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,  -398,    83,
-     268,   102,  -110,  -398,   -15,    -7,  -398,    10,   374,    15,
-       0,  -307,    29,    64,   -14,  -206,  -398,   234,  -288,  -397,
-    -398,    28,  -133,  -398,   -91,  -398,  -398,  -398,   130,  -398,
-    -355,  -398,  -398,   485,   -62
+    -465,  -465,  -465,   549,   338,  -465,  -465,  -465,  -465,  -465,
+    -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,  -465,    55,
+     367,   436,   191,  -465,    62,   -13,  -465,   107,   288,    56,
+      11,  -311,    29,     3,   -14,  -253,  -465,   812,  -166,  -464,
+    -465,   113,   -52,  -465,   -16,  -465,  -465,  -465,    91,  -465,
+    -356,  -465,  -465,   657,     7
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    93,    94,   134,    95,    96,    97,    98,    99,   360,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   208,
-     254,   145,   274,   182,   183,   124,   170,   171,   153,   177,
-     178,   453,   179,   454,   125,   160,   161,   275,   478,   484,
-     485,   389,   390,   466,   467,   127,   154,   128,   162,   489,
-     109,   491,   307,   434,   435
+       0,    94,    95,   135,    96,    97,    98,    99,   100,   364,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   209,
+     255,   146,   275,   183,   184,   125,   171,   172,   154,   178,
+     179,   459,   180,   460,   126,   161,   162,   276,   484,   490,
+     491,   393,   394,   472,   473,   128,   155,   129,   163,   495,
+     110,   497,   311,   440,   441
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     159,   159,   159,   167,   172,   490,   159,   185,   599,   167,
-     159,   169,   585,   447,   157,   163,   164,   167,   159,   206,
-     586,   458,   205,   210,   188,   253,   592,   255,   216,   218,
-     220,   167,   223,   225,   227,   328,   330,   331,   159,   159,
-     159,   159,   167,   158,   158,   158,   166,   199,   159,   593,
-     143,   138,   187,   158,   130,   616,   110,   111,   112,   113,
-     197,   130,   479,   114,   115,   116,   130,   232,   234,   236,
-     238,   256,   140,   142,   221,   131,   132,   246,   617,   494,
-     557,   130,   131,   132,   561,   239,   502,   131,   132,   281,
-     130,   282,  -194,  -194,  -194,  -194,   130,   201,   203,  -194,
-    -194,  -194,   131,   132,   130,  -194,  -194,  -194,  -194,  -194,
-     357,   131,   132,   146,   147,   524,   535,   131,   132,   536,
-     525,   312,   211,   600,   213,   131,   132,   189,   190,   314,
-     471,   129,   393,   394,   471,   316,   129,   129,   130,   262,
-     263,   241,   266,   341,   269,   217,   219,   110,   111,   112,
-     113,   228,   348,   230,   114,   115,   116,   319,   320,   131,
-     132,   242,   243,  -189,   563,   129,   603,   356,   251,   159,
-     130,   159,   130,   257,   258,   259,   317,   318,   319,   320,
-     401,   448,   428,   270,  -189,  -189,   138,   442,   279,   280,
-     143,   131,   132,   131,   132,   443,   159,   444,   349,   144,
-     350,   477,   464,   488,   129,   117,   118,   119,   120,   121,
-     138,   604,   605,   129,    90,   518,   465,   333,   173,  -194,
-     306,   334,   335,   336,   498,   367,   495,   337,   338,   519,
-     138,   340,   499,   520,   130,   126,   521,   563,   529,   346,
-     136,   137,   130,   335,   522,  -194,   117,   118,   119,   120,
-     121,   316,   352,   129,   530,   131,   132,  -194,  -194,   523,
-     358,   533,   534,   131,   132,   133,   129,   129,   167,   204,
-     129,   566,   129,   562,   584,   129,   129,   129,  -189,   567,
-     372,   588,   374,   138,   376,   377,   602,   379,   110,   111,
-     112,   113,   247,   464,   598,   114,   115,   116,   601,  -189,
-    -189,   117,   118,   119,   120,   121,   611,   465,   260,   612,
-     167,   419,   563,   624,   313,   398,   159,   167,   613,   615,
-     206,   167,   618,   -64,   167,   130,   317,   318,   319,   320,
-     460,   129,   159,   129,   410,   169,   619,   620,   167,   144,
-     621,  -184,   622,   415,   417,   625,   131,   132,   626,   483,
-     271,   627,   475,   455,   342,  -184,   606,   315,   607,   158,
-     462,   476,  -184,  -184,   469,   472,   130,   473,   575,   391,
-     323,   324,   129,   129,   325,   553,   326,   608,   609,   610,
-     159,   480,   544,   429,   430,     0,   122,   131,   132,   129,
-     431,   432,   129,   129,   504,   159,   129,     0,   138,   129,
-     481,     0,   194,   195,   196,   317,   318,   319,   320,     0,
-     130,     0,   433,   426,   427,     0,     0,   440,   441,   317,
-     318,   319,   320,   158,   512,   117,   118,   119,   120,   121,
-       0,   131,   132,   276,     0,   362,     0,   363,     0,     0,
-     167,   122,   117,   118,   119,   120,   121,   129,   129,   129,
-     129,   429,   430,   501,     0,   482,     0,     0,   431,   432,
-       0,   138,     0,   129,   468,   309,   311,   391,     0,   130,
-     483,   474,     0,  -182,   483,     0,   496,  -171,   497,     0,
-     527,   429,   430,   546,     0,     0,   486,     0,   431,   432,
-     131,   132,   516,   404,  -182,  -182,   406,   407,  -171,  -171,
-     408,     0,     0,   409,   272,     0,   110,   111,   112,   113,
-     531,     0,     0,   114,   115,   116,   130,     0,     0,   117,
-     118,   119,   120,   121,     0,   131,   132,     0,   129,     0,
-       0,   117,   118,   119,   120,   121,   501,   131,   132,     0,
-     129,   429,   430,     0,     0,   514,     0,   515,   431,   432,
-       0,   449,   450,   451,   452,     0,   483,     0,     0,     0,
-       0,   429,   430,     0,     0,   122,     0,   463,   431,   432,
-     590,     0,     0,     0,   543,   148,     0,   135,   149,   222,
-     139,   141,     0,     0,   150,   151,   152,   167,     0,   165,
-     168,   174,   176,   181,   184,   186,   468,     0,     0,   191,
-     193,     0,     0,     0,   198,   200,   202,   486,     0,   207,
-     209,   486,   212,     0,   215,     0,     0,     0,     0,   224,
-     226,     0,   229,     0,   231,   233,   235,   237,     0,   240,
-     623,   391,   505,   244,   245,   248,   249,   250,     0,   252,
-       0,     0,     0,     0,   513,     0,     0,   261,     0,   264,
-     265,   267,   268,   429,   430,   273,   277,   278,     0,   122,
-     431,   432,   596,   308,   310,     0,     0,     0,     0,   214,
-     327,   123,   110,   111,   112,   113,     0,     0,     0,   114,
-     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
-       0,     0,   329,   486,   110,   111,   112,   113,   321,     0,
-       0,   114,   115,   116,     0,   322,     0,   117,   118,   119,
-     120,   121,   117,   118,   119,   120,   121,     0,     0,   110,
-     111,   112,   113,     0,     0,   332,   114,   115,   116,     0,
-       0,     0,   117,   118,   119,   120,   121,     0,   339,     0,
-       0,     0,   343,   192,   344,   345,   149,     0,     0,   347,
-       0,     0,   150,   151,   152,     0,     0,     0,     0,   351,
-       0,   353,   354,     0,   131,   132,   355,     0,     0,   359,
-       0,   361,     0,     0,     0,     0,   364,   365,     0,     0,
-     366,     0,     0,   368,     0,   369,   370,     0,   371,   373,
-       0,   375,     0,     0,   378,     0,     0,   380,     0,   381,
-     382,     0,   383,     0,   384,     0,   385,     0,   386,     0,
-     387,     0,     0,   392,     0,     0,     0,     0,   395,   396,
-       0,     0,     0,   397,     0,   122,   399,   400,     0,   402,
-     403,   481,   405,   110,   111,   112,   113,   123,     0,     0,
-     114,   115,   116,   411,     0,     0,   412,   122,   413,     0,
-       0,   414,   416,   418,     0,     0,     0,     0,   130,   123,
-     110,   111,   112,   113,     0,     0,   155,   114,   115,   116,
-       0,     0,   122,   117,   118,   119,   120,   121,     0,   131,
-     132,   445,     0,   446,     0,     0,   482,     0,     0,     0,
-       0,     0,     0,   110,   111,   112,   113,   456,   457,     0,
-     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
-     121,     0,     0,   526,     0,     0,     0,     0,   528,     0,
-       0,     0,   532,     0,     0,     0,     0,   537,   538,   487,
-     110,   111,   112,   113,   492,   493,     0,   114,   115,   116,
-       0,     0,     0,   117,   118,   119,   120,   121,     0,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,   500,   117,   118,   119,   120,   121,   420,   421,   422,
-     423,   424,   425,   506,     0,     0,   507,     0,   508,   509,
-     510,   511,     0,     0,   130,     0,   110,   111,   112,   113,
-       0,   517,   155,   114,   115,   116,     0,     0,     0,   117,
-     118,   119,   120,   121,     0,   131,   132,     0,     0,     0,
-     156,     0,   587,     0,     0,   589,   591,     0,   594,   595,
-     597,   317,   318,   319,   320,   545,     0,   547,     0,     0,
-     548,     0,   549,     0,   550,   551,     0,     0,   552,     0,
-       0,     0,     0,     0,   554,   555,   122,     0,   556,     0,
-     558,   559,   560,     0,     0,     0,   564,     0,   123,     0,
-     565,     0,     0,   568,     0,     0,   569,   570,   571,   572,
-     573,   574,     0,     0,   576,   614,   577,   578,     0,     0,
-       0,     0,     0,   122,   579,   580,   581,   582,   583,     0,
-       0,   317,   318,   319,   320,   123,     0,     0,     0,   156,
-     110,   111,   112,   113,     0,     0,     0,   114,   115,   116,
-     317,   318,   319,   320,     0,     0,   130,     0,   110,   111,
-     112,   113,     0,     0,     1,   114,   115,   116,     0,     0,
-       2,   117,   118,   119,   120,   121,   156,   131,   132,     3,
-       0,   175,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,     0,     0,    19,
-      20,    21,    22,    23,     0,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,     0,    85,    86,    87,
-      88,    89,   130,     0,  -175,  -175,  -175,  -175,     0,     0,
-    -175,  -175,  -175,  -175,     0,   180,   388,  -175,  -175,  -175,
-    -175,  -175,     0,   131,   132,     0,   110,   111,   112,   113,
-       0,     1,   470,   114,   115,   116,     0,     2,   156,    90,
-       0,     0,     0,     0,     0,     0,     0,    91,    92,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,     0,     0,    19,    20,    21,    22,
-      23,     0,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,     0,    85,    86,    87,    88,    89,     0,
-     130,     0,   110,   111,   112,   113,     0,     0,   155,   114,
-     115,   116,     0,     0,  -175,   117,   118,   119,   120,   121,
-       0,   131,   132,  -171,     0,  -171,  -171,  -171,  -171,     0,
-       0,  -171,  -171,  -171,  -171,     0,     0,     0,  -171,  -171,
-    -171,  -171,  -171,     0,    91,    92,   459,     0,   110,   111,
-     112,   113,     0,     0,   155,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   503,     0,   110,   111,
-     112,   113,     0,     0,   155,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   461,     0,   110,   111,
-     112,   113,     0,     0,     0,   114,   115,   116,     0,     0,
-       0,   117,   118,   119,   120,   121,   110,   111,   112,   113,
-       0,     0,   155,   114,   115,   116,     0,     0,     0,   117,
-     118,   119,   120,   121,   110,   111,   112,   113,     0,     0,
-       0,   114,   115,   116,     0,     0,     0,   117,   118,   119,
-     120,   121,   130,     0,   130,     0,  -194,  -194,  -194,  -194,
-       0,     0,   156,  -194,  -194,  -194,     0,   117,   118,   119,
-     120,   121,     0,   131,   132,   131,   132,     0,     0,   110,
-     111,   112,   113,     0,     0,  -171,   114,   115,   116,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   156,   110,
-     111,   112,   113,     0,     0,     0,   114,   115,   116,     0,
-       0,     0,     0,   110,   111,   112,   113,     0,   156,     0,
-     114,   115,   116,   130,     0,  -194,  -194,  -194,  -194,     0,
-       0,     0,  -194,  -194,  -194,     0,     0,     0,   156,     0,
-       0,     0,     0,     0,   131,   132,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   156,     0,     0,     0,
-       0,     0,     0,     0,   138,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   156,     0,     0,     0,     0,     0,
-       0,   283,     0,   284,   285,     0,     0,   286,     0,   287,
-       0,   288,  -194,     0,     0,     0,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,     0,   436,     0,     0,   437,     0,     0,
-       0,     0,     0,     0,     0,     0,   438,     0,   439,   539,
-     540,     0,     0,     0,     0,     0,   431,   541,   542,     0,
-       0,     0,     0,   138
+     160,   160,   160,   168,   173,   170,   160,   591,   496,   168,
+     160,   141,   143,   207,   144,   592,   254,   168,   160,   563,
+     453,   464,   206,   567,   605,   158,   164,   165,   217,   219,
+     221,   168,   224,   226,   228,   189,   202,   204,   160,   160,
+     160,   160,   168,   159,   159,   159,   167,   131,   160,   131,
+     256,   131,   188,   159,   131,   361,   321,   322,   323,   324,
+     198,   118,   119,   120,   121,   122,   598,   622,   132,   133,
+     132,   133,   132,   133,   222,   132,   133,   257,   263,   264,
+     131,   267,   131,   270,   186,   240,   508,   477,   200,   599,
+     623,   477,   130,   131,   212,   131,   214,   130,   130,   139,
+     211,   132,   133,   132,   133,   609,   131,   285,   233,   235,
+     237,   239,   131,   242,   132,   133,   132,   133,   247,   286,
+     608,   316,   111,   112,   113,   114,   130,   132,   133,   115,
+     116,   117,  -192,   132,   133,   118,   119,   120,   121,   122,
+     606,   111,   112,   113,   114,   323,   324,   318,   115,   116,
+     117,   435,   436,  -192,  -192,   530,   320,   337,   437,   438,
+     531,   338,   339,   340,   145,   130,   345,   341,   342,   131,
+     160,   344,   160,  -192,   130,   352,   139,   131,   360,   350,
+     439,   569,   310,   339,   321,   322,   323,   324,   485,   454,
+     132,   133,   356,   541,  -192,  -192,   542,   160,   132,   133,
+     362,   405,   123,   139,  -197,   500,   434,   174,   569,   448,
+     320,   321,   322,   323,   324,   130,   610,   611,   449,   450,
+     376,   483,   378,   494,   380,   381,   504,   383,   130,   130,
+      91,   207,   130,   346,   130,   487,  -197,   130,   130,   130,
+     353,   501,   354,   111,   112,   113,   114,   -64,   248,  -187,
+     115,   116,   117,   139,   505,   402,   118,   119,   120,   121,
+     122,   524,   131,  -187,   525,   526,   527,   371,   134,   528,
+    -187,  -187,   168,   529,   414,   535,   123,   118,   119,   120,
+     121,   122,   536,   132,   133,   279,   421,   423,   470,   539,
+     488,   540,   568,   130,   139,   130,   321,   322,   323,   324,
+     572,   131,   471,   111,   112,   113,   114,   573,   131,   590,
+     115,   116,   117,   594,   168,   425,   195,   196,   197,  -185,
+     160,   168,   132,   133,   604,   168,   280,   131,   168,   132,
+     133,   395,   569,   170,   130,   130,   160,   332,   334,   335,
+    -185,  -185,   168,   607,   612,   466,   613,   489,   132,   133,
+     522,   130,   435,   436,   130,   130,   487,   461,   130,   437,
+     438,   130,   617,   159,   468,   614,   615,   616,   475,   618,
+     139,   479,   144,   118,   119,   120,   121,   122,   432,   433,
+     313,   315,   446,   447,   160,   486,   131,   118,   119,   120,
+     121,   122,   619,   621,   624,   625,   507,   123,  -174,   160,
+     626,   118,   119,   120,   121,   122,   482,   132,   133,   510,
+     627,   488,   130,   130,   130,   130,   277,   628,   123,  -174,
+    -174,   630,   631,   435,   436,   633,   632,   159,   130,   474,
+     437,   438,   395,   317,   397,   398,   480,   435,   436,   118,
+     119,   120,   121,   122,   437,   438,   168,   147,   148,   272,
+     470,   492,   533,   481,   478,   581,   559,   550,     0,     0,
+       0,   190,   191,     0,   471,     0,   537,     0,     0,   518,
+     489,     0,     0,     0,   489,   111,   112,   113,   114,   218,
+     220,   507,   115,   116,   117,   229,     0,   231,   149,   552,
+       0,   150,     0,   130,     0,   243,   244,   151,   152,   153,
+       0,     0,   252,     0,     0,   130,     0,   258,   259,   260,
+       0,   223,   520,     0,   521,     0,   131,   271,  -197,  -197,
+    -197,  -197,   145,   283,   284,  -197,  -197,  -197,     0,     0,
+       0,  -197,  -197,  -197,  -197,  -197,     0,   132,   133,     0,
+     215,   549,   111,   112,   113,   114,     0,     0,     0,   115,
+     116,   117,   435,   436,   136,     0,   489,   140,   142,   437,
+     438,   602,     0,   474,     0,     0,   166,   169,   175,   177,
+     182,   185,   187,     0,   492,     0,   192,   194,   492,     0,
+       0,   199,   201,   203,     0,     0,   208,   210,     0,   213,
+       0,   216,     0,   168,     0,     0,   225,   227,   395,   230,
+       0,   232,   234,   236,   238,     0,   241,     0,     0,     0,
+     245,   246,   249,   250,   251,     0,   253,     0,     0,     0,
+       0,     0,   392,     0,   262,     0,   265,   266,   268,   269,
+       0,     0,   274,   278,   281,   282,   629,   139,   435,   436,
+       0,   312,   314,     0,     0,   437,   438,   273,     0,   111,
+     112,   113,   114,     0,     0,     0,   115,   116,   117,     0,
+     492,     0,   118,   119,   120,   121,   122,   596,   132,   133,
+       0,     0,  -197,     0,     0,     0,   325,   426,   427,   428,
+     429,   430,   431,   326,  -197,     0,     0,     0,     0,   331,
+       0,   111,   112,   113,   114,     0,   131,     0,   115,   116,
+     117,     0,     0,   336,   118,   119,   120,   121,   122,     0,
+       0,   118,   119,   120,   121,   122,   343,   132,   133,     0,
+     347,   193,   348,   349,   150,     0,     0,   351,     0,     0,
+     151,   152,   153,     0,     0,     0,     0,   355,     0,   357,
+     358,     0,   132,   133,   359,     0,     0,   363,     0,   365,
+       0,     0,     0,     0,   368,   369,     0,     0,   370,     0,
+       0,   372,     0,   373,   374,     0,   375,   377,     0,   379,
+       0,     0,   382,     0,     0,   384,     0,   385,   386,     0,
+     387,     0,   388,     0,   389,     0,   390,     0,   391,     0,
+       0,   396,     0,     0,     0,     0,   399,   400,     0,     0,
+       0,   401,     0,   123,   403,   404,     0,   406,   407,     0,
+     409,     0,     0,   127,   502,   124,   503,     0,   137,   138,
+       0,   415,     0,     0,   416,     0,   417,     0,   418,   419,
+       0,     0,   420,   422,   424,   111,   112,   113,   114,     0,
+       0,     0,   115,   116,   117,   123,     0,   205,   118,   119,
+     120,   121,   122,     0,     0,     0,   333,   124,   111,   112,
+     113,   114,   451,     0,   452,   115,   116,   117,     0,     0,
+       0,   118,   119,   120,   121,   122,     0,     0,   462,   463,
+       0,     0,   111,   112,   113,   114,   261,     0,     0,   115,
+     116,   117,     0,     0,     0,   118,   119,   120,   121,   122,
+       0,     0,     0,  -174,     0,  -174,  -174,  -174,  -174,     0,
+     493,  -174,  -174,  -174,  -174,   498,   499,     0,  -174,  -174,
+    -174,  -174,  -174,     0,   111,   112,   113,   114,     0,     0,
+       0,   115,   116,   117,     0,     0,   319,   118,   119,   120,
+     121,   122,   506,     0,     0,     0,     0,     0,     0,   327,
+     328,     0,     0,   329,   512,   330,     0,   513,     0,   514,
+     515,   516,   517,   111,   112,   113,   114,     0,     0,   476,
+     115,   116,   117,   131,   523,   111,   112,   113,   114,     0,
+       0,   156,   115,   116,   117,     0,   157,     0,   118,   119,
+     120,   121,   122,     0,   132,   133,     0,   321,   322,   323,
+     324,     0,     0,     0,     0,     0,     0,     0,   551,     0,
+     553,     0,   123,   554,   366,   555,   367,   556,   557,     0,
+       0,   558,     0,     0,   124,     0,     0,   560,   561,     0,
+       0,   562,     0,   564,   565,   566,   123,     0,     0,   570,
+       0,     0,     0,   571,     0,     0,   574,     0,   124,   575,
+     576,   577,   578,   579,   580,     0,  -174,   582,     0,   583,
+     584,     0,     0,     0,     0,     0,     0,   585,   586,   587,
+     588,   589,   408,     0,     0,   410,   411,     0,   123,   412,
+       0,     0,   413,     0,     0,     0,   321,   322,   323,   324,
+     124,   532,     0,     0,     0,     0,   534,     0,     0,   131,
+     538,   111,   112,   113,   114,   543,   544,   156,   115,   116,
+     117,     0,     0,     0,   118,   119,   120,   121,   122,     0,
+     132,   133,   111,   112,   113,   114,   157,     0,     0,   115,
+     116,   117,     0,   455,   456,   457,   458,   321,   322,   323,
+     324,     0,     0,     0,     0,     0,     0,     0,     0,   469,
+       0,     0,   131,     0,  -197,  -197,  -197,  -197,     0,     0,
+       0,  -197,  -197,  -197,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   132,   133,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     593,     0,     0,   595,   597,     0,   600,   601,   603,     0,
+     131,     0,  -178,  -178,  -178,  -178,     0,     0,  -178,  -178,
+    -178,  -178,     0,   181,   511,  -178,  -178,  -178,  -178,  -178,
+       0,   132,   133,     0,     0,     0,   519,     0,     0,     0,
+       0,     0,   467,     0,   111,   112,   113,   114,     0,     0,
+       1,   115,   116,   117,     0,     0,     2,   118,   119,   120,
+     121,   122,   157,   620,     0,     3,     0,   176,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,   139,     0,    19,    20,    21,    22,    23,
+       0,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,     0,    85,    86,    87,    88,    89,    90,     0,
+       0,     0,   131,  -178,   111,   112,   113,   114,     0,     0,
+     156,   115,   116,   117,     0,     0,     0,   118,   119,   120,
+     121,   122,     0,   132,   133,     0,     0,     0,     1,     0,
+       0,     0,     0,     0,     2,   157,    91,     0,     0,     0,
+       0,     0,     0,     0,    92,    93,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,     0,     0,    19,    20,    21,    22,    23,     0,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+       0,    85,    86,    87,    88,    89,    90,     0,     0,     0,
+       0,   131,     0,   111,   112,   113,   114,     0,     0,     0,
+     115,   116,   117,     0,     0,   157,   118,   119,   120,   121,
+     122,     0,   132,   133,     0,     0,     0,     0,     0,   465,
+       0,   111,   112,   113,   114,     0,     0,   156,   115,   116,
+     117,     0,    92,    93,   118,   119,   120,   121,   122,   509,
+       0,   111,   112,   113,   114,     0,     0,   156,   115,   116,
+     117,     0,     0,     0,   118,   119,   120,   121,   122,   111,
+     112,   113,   114,     0,     0,   156,   115,   116,   117,     0,
+       0,     0,   118,   119,   120,   121,   122,   111,   112,   113,
+     114,     0,     0,     0,   115,   116,   117,     0,     0,     0,
+     118,   119,   120,   121,   122,   131,     0,  -197,  -197,  -197,
+    -197,     0,     0,     0,  -197,  -197,  -197,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   132,   133,   111,   112,
+     113,   114,     0,     0,     0,   115,   116,   117,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   157,     0,     0,   111,   112,   113,
+     114,     0,     0,     0,   115,   116,   117,     0,     0,     0,
+       0,   111,   112,   113,   114,     0,     0,     0,   115,   116,
+     117,     0,   157,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   157,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     157,     0,     0,     0,     0,     0,   139,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   157,     0,
+       0,   287,     0,   288,   289,     0,     0,   290,     0,   291,
+       0,   292,     0,     0,  -197,     0,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   442,     0,     0,   443,     0,     0,     0,
+       0,     0,     0,     0,     0,   444,     0,   445,   545,   546,
+       0,     0,     0,     0,     0,   437,   547,   548
 };
 
 static const yytype_int16 yycheck[] =
 {
-      14,    15,    16,    17,    18,   360,    20,    22,     1,    23,
-      24,    18,   119,     1,    14,    15,    16,    31,    32,   151,
-     127,   328,    36,    38,    24,   151,   124,   149,    42,    43,
-      44,    45,    46,    47,    48,   145,   146,   147,    52,    53,
-      54,    55,    56,    14,    15,    16,    17,    32,    62,   147,
-       1,   121,    23,    24,     1,   124,     3,     4,     5,     6,
-      31,     1,   350,    10,    11,    12,     1,    52,    53,    54,
-      55,   149,     8,     9,    45,    22,    23,    62,   147,   367,
-     477,     1,    22,    23,   481,    56,   393,    22,    23,   162,
-       1,    21,     3,     4,     5,     6,     1,    33,    34,    10,
-      11,    12,    22,    23,     1,    16,    17,    18,    19,    20,
-       1,    22,    23,    11,    12,   116,   121,    22,    23,   124,
-     121,     0,    39,   116,    41,    22,    23,    25,    26,    22,
-     336,     1,   242,   243,   340,   156,     6,     7,     1,    75,
-      76,    58,    78,    21,    80,    43,    44,     3,     4,     5,
-       6,    49,    14,    51,    10,    11,    12,   166,   167,    22,
-      23,    59,    60,     1,   157,    35,   563,    15,    66,   183,
-       1,   185,     1,    71,    72,    73,   164,   165,   166,   167,
-     149,   169,   121,    81,    22,    23,   121,   121,    86,    87,
-       1,    22,    23,    22,    23,   121,   210,   121,   183,   150,
-     185,    15,   149,   149,    74,    16,    17,    18,    19,    20,
-     121,   566,   567,    83,   152,   116,   163,   153,   158,   154,
-      90,   157,   158,   159,   153,   210,   154,   163,   164,   116,
-     121,   167,   153,   116,     1,     1,   116,   157,   147,   175,
-       6,     7,     1,   179,   116,   156,    16,    17,    18,    19,
-      20,   156,   188,   123,   121,    22,    23,   168,   149,   116,
-     196,   121,   121,    22,    23,   162,   136,   137,   282,    35,
-     140,   122,   142,   154,   121,   145,   146,   147,     1,   122,
-     216,   147,   218,   121,   220,   221,     1,   223,     3,     4,
-       5,     6,   155,   149,   121,    10,    11,    12,   171,    22,
-      23,    16,    17,    18,    19,    20,   116,   163,    74,   116,
-     324,   282,   157,   121,    94,   251,   330,   331,   124,   124,
-     151,   335,   124,   152,   338,     1,   164,   165,   166,   167,
-     330,   201,   346,   203,   270,   342,   124,   124,   352,   150,
-     124,     1,   120,   279,   280,   124,    22,    23,   124,   356,
-      82,   120,   342,   324,   121,    15,   118,   123,   120,   330,
-     331,   346,    22,    23,   335,   337,     1,   338,   501,   239,
-     136,   137,   242,   243,   140,   466,   142,   139,   140,   141,
-     394,   352,   444,   119,   120,    -1,   156,    22,    23,   259,
-     126,   127,   262,   263,   394,   409,   266,    -1,   121,   269,
-     115,    -1,    28,    29,    30,   164,   165,   166,   167,    -1,
-       1,    -1,   148,   283,   284,    -1,    -1,   287,   288,   164,
-     165,   166,   167,   394,   409,    16,    17,    18,    19,    20,
-      -1,    22,    23,   109,    -1,   201,    -1,   203,    -1,    -1,
-     454,   156,    16,    17,    18,    19,    20,   317,   318,   319,
-     320,   119,   120,   389,    -1,   170,    -1,    -1,   126,   127,
-      -1,   121,    -1,   333,   334,    91,    92,   337,    -1,     1,
-     477,   341,    -1,     1,   481,    -1,   374,     1,   376,    -1,
-     148,   119,   120,   454,    -1,    -1,   356,    -1,   126,   127,
-      22,    23,    24,   259,    22,    23,   262,   263,    22,    23,
-     266,    -1,    -1,   269,     1,    -1,     3,     4,     5,     6,
-     148,    -1,    -1,    10,    11,    12,     1,    -1,    -1,    16,
-      17,    18,    19,    20,    -1,    22,    23,    -1,   398,    -1,
-      -1,    16,    17,    18,    19,    20,   472,    22,    23,    -1,
-     410,   119,   120,    -1,    -1,   415,    -1,   417,   126,   127,
-      -1,   317,   318,   319,   320,    -1,   563,    -1,    -1,    -1,
-      -1,   119,   120,    -1,    -1,   156,    -1,   333,   126,   127,
-     148,    -1,    -1,    -1,   444,     1,    -1,     5,     4,   153,
-       8,     9,    -1,    -1,    10,    11,    12,   601,    -1,    17,
-      18,    19,    20,    21,    22,    23,   466,    -1,    -1,    27,
-      28,    -1,    -1,    -1,    32,    33,    34,   477,    -1,    37,
-      38,   481,    40,    -1,    42,    -1,    -1,    -1,    -1,    47,
-      48,    -1,    50,    -1,    52,    53,    54,    55,    -1,    57,
-     601,   501,   398,    61,    62,    63,    64,    65,    -1,    67,
-      -1,    -1,    -1,    -1,   410,    -1,    -1,    75,    -1,    77,
-      78,    79,    80,   119,   120,    83,    84,    85,    -1,   156,
-     126,   127,   128,    91,    92,    -1,    -1,    -1,    -1,   154,
-       1,   168,     3,     4,     5,     6,    -1,    -1,    -1,    10,
-      11,    12,    -1,    -1,    -1,    16,    17,    18,    19,    20,
-      -1,    -1,     1,   563,     3,     4,     5,     6,   126,    -1,
-      -1,    10,    11,    12,    -1,   133,    -1,    16,    17,    18,
-      19,    20,    16,    17,    18,    19,    20,    -1,    -1,     3,
-       4,     5,     6,    -1,    -1,   153,    10,    11,    12,    -1,
-      -1,    -1,    16,    17,    18,    19,    20,    -1,   166,    -1,
-      -1,    -1,   170,     1,   172,   173,     4,    -1,    -1,   177,
-      -1,    -1,    10,    11,    12,    -1,    -1,    -1,    -1,   187,
-      -1,   189,   190,    -1,    22,    23,   194,    -1,    -1,   197,
-      -1,   199,    -1,    -1,    -1,    -1,   204,   205,    -1,    -1,
-     208,    -1,    -1,   211,    -1,   213,   214,    -1,   216,   217,
-      -1,   219,    -1,    -1,   222,    -1,    -1,   225,    -1,   227,
-     228,    -1,   230,    -1,   232,    -1,   234,    -1,   236,    -1,
-     238,    -1,    -1,   241,    -1,    -1,    -1,    -1,   246,   247,
-      -1,    -1,    -1,   251,    -1,   156,   254,   255,    -1,   257,
-     258,   115,   260,     3,     4,     5,     6,   168,    -1,    -1,
-      10,    11,    12,   271,    -1,    -1,   274,   156,   276,    -1,
-      -1,   279,   280,   281,    -1,    -1,    -1,    -1,     1,   168,
-       3,     4,     5,     6,    -1,    -1,     9,    10,    11,    12,
-      -1,    -1,   156,    16,    17,    18,    19,    20,    -1,    22,
-      23,   309,    -1,   311,    -1,    -1,   170,    -1,    -1,    -1,
-      -1,    -1,    -1,     3,     4,     5,     6,   325,   326,    -1,
-      10,    11,    12,    -1,    -1,    -1,    16,    17,    18,    19,
-      20,    -1,    -1,   428,    -1,    -1,    -1,    -1,   433,    -1,
-      -1,    -1,   437,    -1,    -1,    -1,    -1,   442,   443,   357,
-       3,     4,     5,     6,   362,   363,    -1,    10,    11,    12,
-      -1,    -1,    -1,    16,    17,    18,    19,    20,    -1,     3,
+      14,    15,    16,    17,    18,    18,    20,   120,   364,    23,
+      24,     8,     9,   152,     1,   128,   152,    31,    32,   483,
+       1,   332,    36,   487,     1,    14,    15,    16,    42,    43,
+      44,    45,    46,    47,    48,    24,    33,    34,    52,    53,
+      54,    55,    56,    14,    15,    16,    17,     1,    62,     1,
+     150,     1,    23,    24,     1,     1,   165,   166,   167,   168,
+      31,    16,    17,    18,    19,    20,   125,   125,    22,    23,
+      22,    23,    22,    23,    45,    22,    23,   150,    75,    76,
+       1,    78,     1,    80,    22,    56,   397,   340,    32,   148,
+     148,   344,     1,     1,    39,     1,    41,     6,     7,   122,
+      38,    22,    23,    22,    23,   569,     1,   163,    52,    53,
+      54,    55,     1,    58,    22,    23,    22,    23,    62,    21,
+       1,     0,     3,     4,     5,     6,    35,    22,    23,    10,
+      11,    12,     1,    22,    23,    16,    17,    18,    19,    20,
+     117,     3,     4,     5,     6,   167,   168,    22,    10,    11,
+      12,   120,   121,    22,    23,   117,   157,   154,   127,   128,
+     122,   158,   159,   160,   151,    74,    21,   164,   165,     1,
+     184,   168,   186,     1,    83,    14,   122,     1,    15,   176,
+     149,   158,    91,   180,   165,   166,   167,   168,   354,   170,
+      22,    23,   189,   122,    22,    23,   125,   211,    22,    23,
+     197,   150,   157,   122,   150,   371,   122,   159,   158,   122,
+     157,   165,   166,   167,   168,   124,   572,   573,   122,   122,
+     217,    15,   219,   150,   221,   222,   154,   224,   137,   138,
+     153,   152,   141,   122,   143,   116,   155,   146,   147,   148,
+     184,   155,   186,     3,     4,     5,     6,   153,   156,     1,
+      10,    11,    12,   122,   154,   252,    16,    17,    18,    19,
+      20,   117,     1,    15,   117,   117,   117,   211,   163,   117,
+      22,    23,   286,   117,   271,   148,   157,    16,    17,    18,
+      19,    20,   122,    22,    23,   109,   283,   284,   150,   122,
+     171,   122,   155,   202,   122,   204,   165,   166,   167,   168,
+     123,     1,   164,     3,     4,     5,     6,   123,     1,   122,
+      10,    11,    12,   148,   328,   286,    28,    29,    30,     1,
+     334,   335,    22,    23,   122,   339,   150,     1,   342,    22,
+      23,   240,   158,   346,   243,   244,   350,   146,   147,   148,
+      22,    23,   356,   172,   119,   334,   121,   360,    22,    23,
+      24,   260,   120,   121,   263,   264,   116,   328,   267,   127,
+     128,   270,   117,   334,   335,   140,   141,   142,   339,   117,
+     122,   342,     1,    16,    17,    18,    19,    20,   287,   288,
+      92,    93,   291,   292,   398,   356,     1,    16,    17,    18,
+      19,    20,   125,   125,   125,   125,   393,   157,     1,   413,
+     125,    16,    17,    18,    19,    20,   350,    22,    23,   398,
+     125,   171,   321,   322,   323,   324,   109,   121,   157,    22,
+      23,   122,   125,   120,   121,   121,   125,   398,   337,   338,
+     127,   128,   341,    95,   243,   244,   345,   120,   121,    16,
+      17,    18,    19,    20,   127,   128,   460,    11,    12,    82,
+     150,   360,   149,   346,   341,   507,   472,   450,    -1,    -1,
+      -1,    25,    26,    -1,   164,    -1,   149,    -1,    -1,   413,
+     483,    -1,    -1,    -1,   487,     3,     4,     5,     6,    43,
+      44,   478,    10,    11,    12,    49,    -1,    51,     1,   460,
+      -1,     4,    -1,   402,    -1,    59,    60,    10,    11,    12,
+      -1,    -1,    66,    -1,    -1,   414,    -1,    71,    72,    73,
+      -1,   154,   421,    -1,   423,    -1,     1,    81,     3,     4,
+       5,     6,   151,    87,    88,    10,    11,    12,    -1,    -1,
+      -1,    16,    17,    18,    19,    20,    -1,    22,    23,    -1,
+     155,   450,     3,     4,     5,     6,    -1,    -1,    -1,    10,
+      11,    12,   120,   121,     5,    -1,   569,     8,     9,   127,
+     128,   129,    -1,   472,    -1,    -1,    17,    18,    19,    20,
+      21,    22,    23,    -1,   483,    -1,    27,    28,   487,    -1,
+      -1,    32,    33,    34,    -1,    -1,    37,    38,    -1,    40,
+      -1,    42,    -1,   607,    -1,    -1,    47,    48,   507,    50,
+      -1,    52,    53,    54,    55,    -1,    57,    -1,    -1,    -1,
+      61,    62,    63,    64,    65,    -1,    67,    -1,    -1,    -1,
+      -1,    -1,   150,    -1,    75,    -1,    77,    78,    79,    80,
+      -1,    -1,    83,    84,    85,    86,   607,   122,   120,   121,
+      -1,    92,    93,    -1,    -1,   127,   128,     1,    -1,     3,
        4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,   389,    16,    17,    18,    19,    20,   137,   138,   139,
-     140,   141,   142,   401,    -1,    -1,   404,    -1,   406,   407,
-     408,   409,    -1,    -1,     1,    -1,     3,     4,     5,     6,
-      -1,   419,     9,    10,    11,    12,    -1,    -1,    -1,    16,
-      17,    18,    19,    20,    -1,    22,    23,    -1,    -1,    -1,
-     153,    -1,   527,    -1,    -1,   530,   531,    -1,   533,   534,
-     535,   164,   165,   166,   167,   453,    -1,   455,    -1,    -1,
-     458,    -1,   460,    -1,   462,   463,    -1,    -1,   466,    -1,
-      -1,    -1,    -1,    -1,   472,   473,   156,    -1,   476,    -1,
-     478,   479,   480,    -1,    -1,    -1,   484,    -1,   168,    -1,
-     488,    -1,    -1,   491,    -1,    -1,   494,   495,   496,   497,
-     498,   499,    -1,    -1,   502,   590,   504,   505,    -1,    -1,
-      -1,    -1,    -1,   156,   512,   513,   514,   515,   516,    -1,
-      -1,   164,   165,   166,   167,   168,    -1,    -1,    -1,   153,
-       3,     4,     5,     6,    -1,    -1,    -1,    10,    11,    12,
-     164,   165,   166,   167,    -1,    -1,     1,    -1,     3,     4,
-       5,     6,    -1,    -1,     7,    10,    11,    12,    -1,    -1,
-      13,    16,    17,    18,    19,    20,   153,    22,    23,    22,
-      -1,   158,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
-      43,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,    -1,   110,   111,   112,
-     113,   114,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    14,   149,    16,    17,    18,
-      19,    20,    -1,    22,    23,    -1,     3,     4,     5,     6,
-      -1,     7,     9,    10,    11,    12,    -1,    13,   153,   152,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   160,   161,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    45,
-      46,    -1,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-     106,   107,   108,    -1,   110,   111,   112,   113,   114,    -1,
+     569,    -1,    16,    17,    18,    19,    20,   149,    22,    23,
+      -1,    -1,   157,    -1,    -1,    -1,   127,   138,   139,   140,
+     141,   142,   143,   134,   169,    -1,    -1,    -1,    -1,     1,
+      -1,     3,     4,     5,     6,    -1,     1,    -1,    10,    11,
+      12,    -1,    -1,   154,    16,    17,    18,    19,    20,    -1,
+      -1,    16,    17,    18,    19,    20,   167,    22,    23,    -1,
+     171,     1,   173,   174,     4,    -1,    -1,   178,    -1,    -1,
+      10,    11,    12,    -1,    -1,    -1,    -1,   188,    -1,   190,
+     191,    -1,    22,    23,   195,    -1,    -1,   198,    -1,   200,
+      -1,    -1,    -1,    -1,   205,   206,    -1,    -1,   209,    -1,
+      -1,   212,    -1,   214,   215,    -1,   217,   218,    -1,   220,
+      -1,    -1,   223,    -1,    -1,   226,    -1,   228,   229,    -1,
+     231,    -1,   233,    -1,   235,    -1,   237,    -1,   239,    -1,
+      -1,   242,    -1,    -1,    -1,    -1,   247,   248,    -1,    -1,
+      -1,   252,    -1,   157,   255,   256,    -1,   258,   259,    -1,
+     261,    -1,    -1,     1,   378,   169,   380,    -1,     6,     7,
+      -1,   272,    -1,    -1,   275,    -1,   277,    -1,   279,   280,
+      -1,    -1,   283,   284,   285,     3,     4,     5,     6,    -1,
+      -1,    -1,    10,    11,    12,   157,    -1,    35,    16,    17,
+      18,    19,    20,    -1,    -1,    -1,     1,   169,     3,     4,
+       5,     6,   313,    -1,   315,    10,    11,    12,    -1,    -1,
+      -1,    16,    17,    18,    19,    20,    -1,    -1,   329,   330,
+      -1,    -1,     3,     4,     5,     6,    74,    -1,    -1,    10,
+      11,    12,    -1,    -1,    -1,    16,    17,    18,    19,    20,
+      -1,    -1,    -1,     1,    -1,     3,     4,     5,     6,    -1,
+     361,     9,    10,    11,    12,   366,   367,    -1,    16,    17,
+      18,    19,    20,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,    -1,    -1,   124,    16,    17,    18,
+      19,    20,   393,    -1,    -1,    -1,    -1,    -1,    -1,   137,
+     138,    -1,    -1,   141,   405,   143,    -1,   408,    -1,   410,
+     411,   412,   413,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    11,    12,     1,   425,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    11,    12,    -1,   154,    -1,    16,    17,
+      18,    19,    20,    -1,    22,    23,    -1,   165,   166,   167,
+     168,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   459,    -1,
+     461,    -1,   157,   464,   202,   466,   204,   468,   469,    -1,
+      -1,   472,    -1,    -1,   169,    -1,    -1,   478,   479,    -1,
+      -1,   482,    -1,   484,   485,   486,   157,    -1,    -1,   490,
+      -1,    -1,    -1,   494,    -1,    -1,   497,    -1,   169,   500,
+     501,   502,   503,   504,   505,    -1,   154,   508,    -1,   510,
+     511,    -1,    -1,    -1,    -1,    -1,    -1,   518,   519,   520,
+     521,   522,   260,    -1,    -1,   263,   264,    -1,   157,   267,
+      -1,    -1,   270,    -1,    -1,    -1,   165,   166,   167,   168,
+     169,   434,    -1,    -1,    -1,    -1,   439,    -1,    -1,     1,
+     443,     3,     4,     5,     6,   448,   449,     9,    10,    11,
+      12,    -1,    -1,    -1,    16,    17,    18,    19,    20,    -1,
+      22,    23,     3,     4,     5,     6,   154,    -1,    -1,    10,
+      11,    12,    -1,   321,   322,   323,   324,   165,   166,   167,
+     168,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   337,
+      -1,    -1,     1,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     533,    -1,    -1,   536,   537,    -1,   539,   540,   541,    -1,
        1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
-      11,    12,    -1,    -1,   153,    16,    17,    18,    19,    20,
-      -1,    22,    23,     1,    -1,     3,     4,     5,     6,    -1,
-      -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
-      18,    19,    20,    -1,   160,   161,     1,    -1,     3,     4,
-       5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
-      -1,    16,    17,    18,    19,    20,     1,    -1,     3,     4,
-       5,     6,    -1,    -1,     9,    10,    11,    12,    -1,    -1,
-      -1,    16,    17,    18,    19,    20,     1,    -1,     3,     4,
+      11,    12,    -1,    14,   402,    16,    17,    18,    19,    20,
+      -1,    22,    23,    -1,    -1,    -1,   414,    -1,    -1,    -1,
+      -1,    -1,     1,    -1,     3,     4,     5,     6,    -1,    -1,
+       7,    10,    11,    12,    -1,    -1,    13,    16,    17,    18,
+      19,    20,   154,   596,    -1,    22,    -1,   159,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,   122,    -1,    42,    43,    44,    45,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,    -1,   110,   111,   112,   113,   114,   115,    -1,
+      -1,    -1,     1,   154,     3,     4,     5,     6,    -1,    -1,
+       9,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
+      19,    20,    -1,    22,    23,    -1,    -1,    -1,     7,    -1,
+      -1,    -1,    -1,    -1,    13,   154,   153,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   161,   162,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    45,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+      -1,   110,   111,   112,   113,   114,   115,    -1,    -1,    -1,
+      -1,     1,    -1,     3,     4,     5,     6,    -1,    -1,    -1,
+      10,    11,    12,    -1,    -1,   154,    16,    17,    18,    19,
+      20,    -1,    22,    23,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    11,
+      12,    -1,   161,   162,    16,    17,    18,    19,    20,     1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    11,
+      12,    -1,    -1,    -1,    16,    17,    18,    19,    20,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    11,    12,    -1,
+      -1,    -1,    16,    17,    18,    19,    20,     3,     4,     5,
+       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
+      16,    17,    18,    19,    20,     1,    -1,     3,     4,     5,
+       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,     3,     4,
        5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,
-      -1,    16,    17,    18,    19,    20,     3,     4,     5,     6,
-      -1,    -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,
-      17,    18,    19,    20,     3,     4,     5,     6,    -1,    -1,
-      -1,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
-      19,    20,     1,    -1,     1,    -1,     3,     4,     5,     6,
-      -1,    -1,   153,    10,    11,    12,    -1,    16,    17,    18,
-      19,    20,    -1,    22,    23,    22,    23,    -1,    -1,     3,
-       4,     5,     6,    -1,    -1,   153,    10,    11,    12,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,
-      -1,    -1,    -1,     3,     4,     5,     6,    -1,   153,    -1,
-      10,    11,    12,     1,    -1,     3,     4,     5,     6,    -1,
-      -1,    -1,    10,    11,    12,    -1,    -1,    -1,   153,    -1,
-      -1,    -1,    -1,    -1,    22,    23,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,    -1,
-      -1,   115,    -1,   117,   118,    -1,    -1,   121,    -1,   123,
-      -1,   125,   149,    -1,    -1,    -1,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,    -1,   118,    -1,    -1,   121,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   130,    -1,   132,   119,
-     120,    -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,
-      -1,    -1,    -1,   121
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   154,    -1,    -1,     3,     4,     5,
+       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,    -1,    -1,    10,    11,
+      12,    -1,   154,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   154,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     154,    -1,    -1,    -1,    -1,    -1,   122,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   154,    -1,
+      -1,   116,    -1,   118,   119,    -1,    -1,   122,    -1,   124,
+      -1,   126,    -1,    -1,   150,    -1,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   119,    -1,    -1,   122,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   131,    -1,   133,   120,   121,
+      -1,    -1,    -1,    -1,    -1,   127,   128,   129
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,     7,    13,    22,    25,    26,    27,    28,    29,    30,
@@ -1560,101 +1516,102 @@ static const yytype_uint8 yystos[] =
       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
       94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
      104,   105,   106,   107,   108,   110,   111,   112,   113,   114,
-     152,   160,   161,   173,   174,   176,   177,   178,   179,   180,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   222,
-       3,     4,     5,     6,    10,    11,    12,    16,    17,    18,
-      19,    20,   156,   168,   197,   206,   209,   217,   219,   220,
-       1,    22,    23,   162,   175,   175,   209,   209,   121,   175,
-     205,   175,   205,     1,   150,   193,   193,   193,     1,     4,
-      10,    11,    12,   200,   218,     9,   153,   202,   204,   206,
-     207,   208,   220,   202,   202,   175,   204,   206,   175,   197,
-     198,   199,   206,   158,   175,   158,   175,   201,   202,   204,
-      14,   175,   195,   196,   175,   196,   175,   204,   202,   193,
-     193,   175,     1,   175,   200,   200,   200,   204,   175,   201,
-     175,   205,   175,   205,   209,   206,   151,   175,   191,   175,
-     196,   191,   175,   191,   154,   175,   206,   193,   206,   193,
-     206,   204,   153,   206,   175,   206,   175,   206,   193,   175,
-     193,   175,   201,   175,   201,   175,   201,   175,   201,   204,
-     175,   191,   193,   193,   175,   175,   201,   155,   175,   175,
-     175,   193,   175,   151,   192,   149,   149,   193,   193,   193,
-     209,   175,   205,   205,   175,   175,   205,   175,   175,   205,
-     193,   192,     1,   175,   194,   209,   109,   175,   175,   193,
-     193,   162,    21,   115,   117,   118,   121,   123,   125,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   220,   224,   175,   200,
-     175,   200,     0,   176,    22,   209,   156,   164,   165,   166,
-     167,   175,   175,   209,   209,   209,   209,     1,   194,     1,
-     194,   194,   175,   205,   205,   205,   205,   205,   205,   175,
-     205,    21,   121,   175,   175,   175,   205,   175,    14,   201,
-     201,   175,   205,   175,   175,   175,    15,     1,   205,   175,
-     181,   175,   209,   209,   175,   175,   175,   201,   175,   175,
-     175,   175,   205,   175,   205,   175,   205,   205,   175,   205,
-     175,   175,   175,   175,   175,   175,   175,   175,   149,   213,
-     214,   220,   175,   194,   194,   175,   175,   175,   205,   175,
-     175,   149,   175,   175,   209,   175,   209,   209,   209,   209,
-     205,   175,   175,   175,   175,   205,   175,   205,   175,   204,
-     137,   138,   139,   140,   141,   142,   220,   220,   121,   119,
-     120,   126,   127,   148,   225,   226,   118,   121,   130,   132,
-     220,   220,   121,   121,   121,   175,   175,     1,   169,   209,
-     209,   209,   209,   203,   205,   204,   175,   175,   203,     1,
-     202,     1,   204,   209,   149,   163,   215,   216,   220,   204,
-       9,   207,   213,   204,   220,   199,   201,    15,   210,   210,
-     204,   115,   170,   197,   211,   212,   220,   175,   149,   221,
-     222,   223,   175,   175,   210,   154,   193,   193,   153,   153,
-     175,   205,   203,     1,   202,   209,   175,   175,   175,   175,
-     175,   175,   201,   209,   220,   220,    24,   175,   116,   116,
-     116,   116,   116,   116,   116,   121,   225,   148,   225,   147,
-     121,   148,   225,   121,   121,   121,   124,   225,   225,   119,
-     120,   127,   128,   220,   226,   175,   204,   175,   175,   175,
-     175,   175,   175,   216,   175,   175,   175,   211,   175,   175,
-     175,   211,   154,   157,   175,   175,   122,   122,   175,   175,
-     175,   175,   175,   175,   175,   214,   175,   175,   175,   175,
-     175,   175,   175,   175,   121,   119,   127,   225,   147,   225,
-     148,   225,   124,   147,   225,   225,   128,   225,   121,     1,
-     116,   171,     1,   211,   222,   222,   118,   120,   139,   140,
-     141,   116,   116,   124,   225,   124,   124,   147,   124,   124,
-     124,   124,   120,   204,   121,   124,   124,   120
+     115,   153,   161,   162,   174,   175,   177,   178,   179,   180,
+     181,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     223,     3,     4,     5,     6,    10,    11,    12,    16,    17,
+      18,    19,    20,   157,   169,   198,   207,   210,   218,   220,
+     221,     1,    22,    23,   163,   176,   176,   210,   210,   122,
+     176,   206,   176,   206,     1,   151,   194,   194,   194,     1,
+       4,    10,    11,    12,   201,   219,     9,   154,   203,   205,
+     207,   208,   209,   221,   203,   203,   176,   205,   207,   176,
+     198,   199,   200,   207,   159,   176,   159,   176,   202,   203,
+     205,    14,   176,   196,   197,   176,   197,   176,   205,   203,
+     194,   194,   176,     1,   176,   201,   201,   201,   205,   176,
+     202,   176,   206,   176,   206,   210,   207,   152,   176,   192,
+     176,   197,   192,   176,   192,   155,   176,   207,   194,   207,
+     194,   207,   205,   154,   207,   176,   207,   176,   207,   194,
+     176,   194,   176,   202,   176,   202,   176,   202,   176,   202,
+     205,   176,   192,   194,   194,   176,   176,   202,   156,   176,
+     176,   176,   194,   176,   152,   193,   150,   150,   194,   194,
+     194,   210,   176,   206,   206,   176,   176,   206,   176,   176,
+     206,   194,   193,     1,   176,   195,   210,   109,   176,   109,
+     150,   176,   176,   194,   194,   163,    21,   116,   118,   119,
+     122,   124,   126,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     221,   225,   176,   201,   176,   201,     0,   177,    22,   210,
+     157,   165,   166,   167,   168,   176,   176,   210,   210,   210,
+     210,     1,   195,     1,   195,   195,   176,   206,   206,   206,
+     206,   206,   206,   176,   206,    21,   122,   176,   176,   176,
+     206,   176,    14,   202,   202,   176,   206,   176,   176,   176,
+      15,     1,   206,   176,   182,   176,   210,   210,   176,   176,
+     176,   202,   176,   176,   176,   176,   206,   176,   206,   176,
+     206,   206,   176,   206,   176,   176,   176,   176,   176,   176,
+     176,   176,   150,   214,   215,   221,   176,   195,   195,   176,
+     176,   176,   206,   176,   176,   150,   176,   176,   210,   176,
+     210,   210,   210,   210,   206,   176,   176,   176,   176,   176,
+     176,   206,   176,   206,   176,   205,   138,   139,   140,   141,
+     142,   143,   221,   221,   122,   120,   121,   127,   128,   149,
+     226,   227,   119,   122,   131,   133,   221,   221,   122,   122,
+     122,   176,   176,     1,   170,   210,   210,   210,   210,   204,
+     206,   205,   176,   176,   204,     1,   203,     1,   205,   210,
+     150,   164,   216,   217,   221,   205,     9,   208,   214,   205,
+     221,   200,   202,    15,   211,   211,   205,   116,   171,   198,
+     212,   213,   221,   176,   150,   222,   223,   224,   176,   176,
+     211,   155,   194,   194,   154,   154,   176,   206,   204,     1,
+     203,   210,   176,   176,   176,   176,   176,   176,   202,   210,
+     221,   221,    24,   176,   117,   117,   117,   117,   117,   117,
+     117,   122,   226,   149,   226,   148,   122,   149,   226,   122,
+     122,   122,   125,   226,   226,   120,   121,   128,   129,   221,
+     227,   176,   205,   176,   176,   176,   176,   176,   176,   217,
+     176,   176,   176,   212,   176,   176,   176,   212,   155,   158,
+     176,   176,   123,   123,   176,   176,   176,   176,   176,   176,
+     176,   215,   176,   176,   176,   176,   176,   176,   176,   176,
+     122,   120,   128,   226,   148,   226,   149,   226,   125,   148,
+     226,   226,   129,   226,   122,     1,   117,   172,     1,   212,
+     223,   223,   119,   121,   140,   141,   142,   117,   117,   125,
+     226,   125,   125,   148,   125,   125,   125,   125,   121,   205,
+     122,   125,   125,   121
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   172,   173,   173,   173,   174,   174,   175,   175,   175,
-     176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,   177,   177,   177,   177,   177,   177,   177,
+       0,   173,   174,   174,   174,   175,   175,   176,   176,   176,
      177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-     177,   177,   177,   177,   177,   177,   177,   177,   178,   178,
-     178,   179,   179,   179,   179,   179,   179,   179,   179,   179,
-     179,   179,   179,   179,   181,   180,   180,   180,   180,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   183,
-     183,   183,   183,   183,   183,   183,   183,   184,   184,   184,
-     184,   184,   184,   184,   184,   184,   184,   184,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     177,   177,   177,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   179,   179,
+     179,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+     180,   180,   180,   180,   182,   181,   181,   181,   181,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   184,
+     184,   184,   184,   184,   184,   184,   184,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
      187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   188,
-     188,   188,   189,   189,   190,   191,   192,   192,   193,   193,
-     194,   194,   195,   195,   196,   196,   197,   197,   198,   198,
-     199,   200,   200,   201,   201,   202,   202,   202,   203,   203,
-     204,   204,   204,   205,   205,   206,   206,   206,   206,   206,
-     207,   208,   209,   209,   209,   209,   209,   209,   209,   210,
-     210,   211,   211,   211,   211,   211,   212,   212,   212,   213,
-     213,   214,   214,   215,   215,   216,   216,   216,   217,   217,
-     218,   218,   218,   218,   219,   219,   219,   220,   220,   220,
-     220,   220,   221,   221,   221,   222,   223,   223,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
-     225,   225,   225,   225,   226
+     187,   187,   187,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   189,   189,   189,   190,   190,   191,   192,   193,
+     193,   194,   194,   195,   195,   196,   196,   197,   197,   198,
+     198,   199,   199,   200,   201,   201,   202,   202,   203,   203,
+     203,   204,   204,   205,   205,   205,   206,   206,   207,   207,
+     207,   207,   207,   208,   209,   210,   210,   210,   210,   210,
+     210,   210,   211,   211,   212,   212,   212,   212,   212,   213,
+     213,   213,   214,   214,   215,   215,   216,   216,   217,   217,
+     217,   218,   218,   219,   219,   219,   219,   220,   220,   220,
+     221,   221,   221,   221,   221,   222,   222,   222,   223,   224,
+     224,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225,
+     225,   225,   225,   226,   226,   226,   226,   227
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     2,     1,     1,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -1670,60 +1627,60 @@ static const yytype_uint8 yyr2[] =
        3,     2,     3,     2,     2,     2,     3,     3,     3,     2,
        3,     3,     3,     3,     2,     3,     2,     3,     5,     3,
        4,     3,     3,     2,     4,     4,     2,     3,     3,     2,
-       5,     5,     5,     3,     4,     5,     4,     5,     4,     5,
-       5,     2,     3,     4,     3,     3,     5,     3,     5,     3,
-       2,     3,     4,     2,     2,     1,     1,     0,     1,     1,
-       1,     1,     2,     1,     1,     0,     1,     2,     3,     1,
-       3,     1,     1,     1,     1,     3,     1,     3,     2,     0,
-       1,     3,     1,     1,     0,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     1,     2,
-       0,     3,     3,     3,     3,     1,     1,     1,     4,     3,
-       1,     1,     1,     2,     1,     1,     1,     1,     1,     1,
+       3,     3,     2,     5,     5,     5,     3,     4,     5,     4,
+       5,     4,     5,     5,     2,     3,     4,     3,     3,     5,
+       3,     5,     3,     2,     3,     4,     2,     2,     1,     1,
+       0,     1,     1,     1,     1,     2,     1,     1,     0,     1,
+       2,     3,     1,     3,     1,     1,     1,     1,     3,     1,
+       3,     2,     0,     1,     3,     1,     1,     0,     1,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     1,     2,     0,     3,     3,     3,     3,     1,     1,
+       1,     4,     3,     1,     1,     1,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     2,     2,     1,     1,     2,     1,
-       3,     3,     3,     3,     3,     5,     7,     5,     3,     3,
-       3,     3,     3,     3,     5,     5,     5,     5,     0,     1,
+       1,     1,     1,     1,     1,     3,     3,     2,     2,     1,
+       1,     2,     1,     3,     3,     3,     3,     3,     5,     7,
+       5,     3,     3,     3,     3,     3,     3,     5,     5,     5,
+       5,     0,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     3,     3,
-       4,     3,     4,     2,     3,     3,     3,     3,     5,     5,
-       6,     5,     6,     4,     5,     5,     5,     5,     3,     5,
-       1,     1,     1,     1,     1
+       2,     3,     3,     4,     3,     4,     2,     3,     3,     3,
+       3,     5,     5,     6,     5,     6,     4,     5,     5,     5,
+       5,     3,     5,     1,     1,     1,     1,     1
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1740,55 +1697,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1797,7 +1751,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1820,21 +1774,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1849,8 +1803,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1873,249 +1827,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2124,6 +1859,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2131,43 +1868,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2175,71 +1905,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2247,30 +1981,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2281,18 +2016,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2320,15 +2066,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2343,7 +2087,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2363,433 +2107,433 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 199 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 2370 "mon_parse.c" /* yacc.c:1646  */
+  case 2: /* top_level: command_list  */
+#line 199 "mon_parse.y"
+                        { (yyval.i) = 0; }
+#line 2114 "mon_parse.c"
     break;
 
-  case 3:
-#line 200 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 2376 "mon_parse.c" /* yacc.c:1646  */
+  case 3: /* top_level: assembly_instruction TRAIL  */
+#line 200 "mon_parse.y"
+                                      { (yyval.i) = 0; }
+#line 2120 "mon_parse.c"
     break;
 
-  case 4:
-#line 201 "mon_parse.y" /* yacc.c:1646  */
-    { new_cmd = 1; asm_mode = 0;  (yyval.i) = 0; }
-#line 2382 "mon_parse.c" /* yacc.c:1646  */
+  case 4: /* top_level: TRAIL  */
+#line 201 "mon_parse.y"
+                 { new_cmd = 1; asm_mode = 0;  (yyval.i) = 0; }
+#line 2126 "mon_parse.c"
     break;
 
-  case 9:
-#line 210 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_END_CMD; }
-#line 2388 "mon_parse.c" /* yacc.c:1646  */
+  case 9: /* end_cmd: error  */
+#line 210 "mon_parse.y"
+               { return ERR_EXPECT_END_CMD; }
+#line 2132 "mon_parse.c"
     break;
 
-  case 22:
-#line 225 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_BAD_CMD; }
-#line 2394 "mon_parse.c" /* yacc.c:1646  */
+  case 22: /* command: BAD_CMD  */
+#line 225 "mon_parse.y"
+                 { return ERR_BAD_CMD; }
+#line 2138 "mon_parse.c"
     break;
 
-  case 23:
-#line 229 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank(e_default_space, NULL); }
-#line 2400 "mon_parse.c" /* yacc.c:1646  */
+  case 23: /* machine_state_rules: CMD_BANK end_cmd  */
+#line 229 "mon_parse.y"
+                     { mon_bank(e_default_space, NULL); }
+#line 2144 "mon_parse.c"
     break;
 
-  case 24:
-#line 231 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank((yyvsp[-1].i), NULL); }
-#line 2406 "mon_parse.c" /* yacc.c:1646  */
+  case 24: /* machine_state_rules: CMD_BANK memspace end_cmd  */
+#line 231 "mon_parse.y"
+                     { mon_bank((yyvsp[-1].i), NULL); }
+#line 2150 "mon_parse.c"
     break;
 
-  case 25:
-#line 233 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank(e_default_space, (yyvsp[-1].str)); }
-#line 2412 "mon_parse.c" /* yacc.c:1646  */
+  case 25: /* machine_state_rules: CMD_BANK BANKNAME end_cmd  */
+#line 233 "mon_parse.y"
+                     { mon_bank(e_default_space, (yyvsp[-1].str)); }
+#line 2156 "mon_parse.c"
     break;
 
-  case 26:
-#line 235 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2418 "mon_parse.c" /* yacc.c:1646  */
+  case 26: /* machine_state_rules: CMD_BANK memspace opt_sep BANKNAME end_cmd  */
+#line 235 "mon_parse.y"
+                     { mon_bank((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2162 "mon_parse.c"
     break;
 
-  case 27:
-#line 237 "mon_parse.y" /* yacc.c:1646  */
-    { mon_jump((yyvsp[-1].a)); }
-#line 2424 "mon_parse.c" /* yacc.c:1646  */
+  case 27: /* machine_state_rules: CMD_GOTO address end_cmd  */
+#line 237 "mon_parse.y"
+                     { mon_jump((yyvsp[-1].a)); }
+#line 2168 "mon_parse.c"
     break;
 
-  case 28:
-#line 239 "mon_parse.y" /* yacc.c:1646  */
-    { mon_go(); }
-#line 2430 "mon_parse.c" /* yacc.c:1646  */
+  case 28: /* machine_state_rules: CMD_GOTO end_cmd  */
+#line 239 "mon_parse.y"
+                     { mon_go(); }
+#line 2174 "mon_parse.c"
     break;
 
-  case 29:
-#line 241 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_io_regs(0); }
-#line 2436 "mon_parse.c" /* yacc.c:1646  */
+  case 29: /* machine_state_rules: CMD_IO end_cmd  */
+#line 241 "mon_parse.y"
+                     { mon_display_io_regs(0); }
+#line 2180 "mon_parse.c"
     break;
 
-  case 30:
-#line 243 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_io_regs((yyvsp[-1].a)); }
-#line 2442 "mon_parse.c" /* yacc.c:1646  */
+  case 30: /* machine_state_rules: CMD_IO address end_cmd  */
+#line 243 "mon_parse.y"
+                     { mon_display_io_regs((yyvsp[-1].a)); }
+#line 2186 "mon_parse.c"
     break;
 
-  case 31:
-#line 245 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_cpu_type_set(""); }
-#line 2448 "mon_parse.c" /* yacc.c:1646  */
+  case 31: /* machine_state_rules: CMD_CPU end_cmd  */
+#line 245 "mon_parse.y"
+                     { monitor_cpu_type_set(""); }
+#line 2192 "mon_parse.c"
     break;
 
-  case 32:
-#line 247 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_cpu_type_set((yyvsp[-1].str)); }
-#line 2454 "mon_parse.c" /* yacc.c:1646  */
+  case 32: /* machine_state_rules: CMD_CPU CPUTYPE end_cmd  */
+#line 247 "mon_parse.y"
+                     { monitor_cpu_type_set((yyvsp[-1].str)); }
+#line 2198 "mon_parse.c"
     break;
 
-  case 33:
-#line 249 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cpuhistory(-1); }
-#line 2460 "mon_parse.c" /* yacc.c:1646  */
+  case 33: /* machine_state_rules: CMD_CPUHISTORY end_cmd  */
+#line 249 "mon_parse.y"
+                     { mon_cpuhistory(-1); }
+#line 2204 "mon_parse.c"
     break;
 
-  case 34:
-#line 251 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cpuhistory((yyvsp[-1].i)); }
-#line 2466 "mon_parse.c" /* yacc.c:1646  */
+  case 34: /* machine_state_rules: CMD_CPUHISTORY opt_sep expression end_cmd  */
+#line 251 "mon_parse.y"
+                     { mon_cpuhistory((yyvsp[-1].i)); }
+#line 2210 "mon_parse.c"
     break;
 
-  case 35:
-#line 253 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instruction_return(); }
-#line 2472 "mon_parse.c" /* yacc.c:1646  */
+  case 35: /* machine_state_rules: CMD_RETURN end_cmd  */
+#line 253 "mon_parse.y"
+                     { mon_instruction_return(); }
+#line 2216 "mon_parse.c"
     break;
 
-  case 36:
-#line 255 "mon_parse.y" /* yacc.c:1646  */
-    { machine_write_snapshot((yyvsp[-1].str),0,0,0); /* FIXME */ }
-#line 2478 "mon_parse.c" /* yacc.c:1646  */
+  case 36: /* machine_state_rules: CMD_DUMP filename end_cmd  */
+#line 255 "mon_parse.y"
+                     { machine_write_snapshot((yyvsp[-1].str),0,0,0); /* FIXME */ }
+#line 2222 "mon_parse.c"
     break;
 
-  case 37:
-#line 257 "mon_parse.y" /* yacc.c:1646  */
-    { machine_read_snapshot((yyvsp[-1].str), 0); }
-#line 2484 "mon_parse.c" /* yacc.c:1646  */
+  case 37: /* machine_state_rules: CMD_UNDUMP filename end_cmd  */
+#line 257 "mon_parse.y"
+                     { machine_read_snapshot((yyvsp[-1].str), 0); }
+#line 2228 "mon_parse.c"
     break;
 
-  case 38:
-#line 259 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_step(-1); }
-#line 2490 "mon_parse.c" /* yacc.c:1646  */
+  case 38: /* machine_state_rules: CMD_STEP end_cmd  */
+#line 259 "mon_parse.y"
+                     { mon_instructions_step(-1); }
+#line 2234 "mon_parse.c"
     break;
 
-  case 39:
-#line 261 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_step((yyvsp[-1].i)); }
-#line 2496 "mon_parse.c" /* yacc.c:1646  */
+  case 39: /* machine_state_rules: CMD_STEP opt_sep expression end_cmd  */
+#line 261 "mon_parse.y"
+                     { mon_instructions_step((yyvsp[-1].i)); }
+#line 2240 "mon_parse.c"
     break;
 
-  case 40:
-#line 263 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_next(-1); }
-#line 2502 "mon_parse.c" /* yacc.c:1646  */
+  case 40: /* machine_state_rules: CMD_NEXT end_cmd  */
+#line 263 "mon_parse.y"
+                     { mon_instructions_next(-1); }
+#line 2246 "mon_parse.c"
     break;
 
-  case 41:
-#line 265 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_next((yyvsp[-1].i)); }
-#line 2508 "mon_parse.c" /* yacc.c:1646  */
+  case 41: /* machine_state_rules: CMD_NEXT opt_sep expression end_cmd  */
+#line 265 "mon_parse.y"
+                     { mon_instructions_next((yyvsp[-1].i)); }
+#line 2252 "mon_parse.c"
     break;
 
-  case 42:
-#line 267 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_up(-1); }
-#line 2514 "mon_parse.c" /* yacc.c:1646  */
+  case 42: /* machine_state_rules: CMD_UP end_cmd  */
+#line 267 "mon_parse.y"
+                     { mon_stack_up(-1); }
+#line 2258 "mon_parse.c"
     break;
 
-  case 43:
-#line 269 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_up((yyvsp[-1].i)); }
-#line 2520 "mon_parse.c" /* yacc.c:1646  */
+  case 43: /* machine_state_rules: CMD_UP opt_sep expression end_cmd  */
+#line 269 "mon_parse.y"
+                     { mon_stack_up((yyvsp[-1].i)); }
+#line 2264 "mon_parse.c"
     break;
 
-  case 44:
-#line 271 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_down(-1); }
-#line 2526 "mon_parse.c" /* yacc.c:1646  */
+  case 44: /* machine_state_rules: CMD_DOWN end_cmd  */
+#line 271 "mon_parse.y"
+                     { mon_stack_down(-1); }
+#line 2270 "mon_parse.c"
     break;
 
-  case 45:
-#line 273 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_down((yyvsp[-1].i)); }
-#line 2532 "mon_parse.c" /* yacc.c:1646  */
+  case 45: /* machine_state_rules: CMD_DOWN opt_sep expression end_cmd  */
+#line 273 "mon_parse.y"
+                     { mon_stack_down((yyvsp[-1].i)); }
+#line 2276 "mon_parse.c"
     break;
 
-  case 46:
-#line 275 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_screen(); }
-#line 2538 "mon_parse.c" /* yacc.c:1646  */
+  case 46: /* machine_state_rules: CMD_SCREEN end_cmd  */
+#line 275 "mon_parse.y"
+                     { mon_display_screen(); }
+#line 2282 "mon_parse.c"
     break;
 
-  case 48:
-#line 280 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[default_memspace]->mon_register_print)(default_memspace); }
-#line 2544 "mon_parse.c" /* yacc.c:1646  */
+  case 48: /* register_mod: CMD_REGISTERS end_cmd  */
+#line 280 "mon_parse.y"
+              { (monitor_cpu_for_memspace[default_memspace]->mon_register_print)(default_memspace); }
+#line 2288 "mon_parse.c"
     break;
 
-  case 49:
-#line 282 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[(yyvsp[-1].i)]->mon_register_print)((yyvsp[-1].i)); }
-#line 2550 "mon_parse.c" /* yacc.c:1646  */
+  case 49: /* register_mod: CMD_REGISTERS memspace end_cmd  */
+#line 282 "mon_parse.y"
+              { (monitor_cpu_for_memspace[(yyvsp[-1].i)]->mon_register_print)((yyvsp[-1].i)); }
+#line 2294 "mon_parse.c"
     break;
 
-  case 51:
-#line 287 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 51: /* symbol_table_rules: CMD_LOAD_LABELS memspace opt_sep filename end_cmd  */
+#line 287 "mon_parse.y"
+                    {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2559 "mon_parse.c" /* yacc.c:1646  */
+#line 2303 "mon_parse.c"
     break;
 
-  case 52:
-#line 292 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 52: /* symbol_table_rules: CMD_LOAD_LABELS filename end_cmd  */
+#line 292 "mon_parse.y"
+                    {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2568 "mon_parse.c" /* yacc.c:1646  */
+#line 2312 "mon_parse.c"
     break;
 
-  case 53:
-#line 297 "mon_parse.y" /* yacc.c:1646  */
-    { mon_save_symbols((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2574 "mon_parse.c" /* yacc.c:1646  */
+  case 53: /* symbol_table_rules: CMD_SAVE_LABELS memspace opt_sep filename end_cmd  */
+#line 297 "mon_parse.y"
+                    { mon_save_symbols((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2318 "mon_parse.c"
     break;
 
-  case 54:
-#line 299 "mon_parse.y" /* yacc.c:1646  */
-    { mon_save_symbols(e_default_space, (yyvsp[-1].str)); }
-#line 2580 "mon_parse.c" /* yacc.c:1646  */
+  case 54: /* symbol_table_rules: CMD_SAVE_LABELS filename end_cmd  */
+#line 299 "mon_parse.y"
+                    { mon_save_symbols(e_default_space, (yyvsp[-1].str)); }
+#line 2324 "mon_parse.c"
     break;
 
-  case 55:
-#line 301 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_name_to_symbol_table((yyvsp[-3].a), (yyvsp[-1].str)); }
-#line 2586 "mon_parse.c" /* yacc.c:1646  */
+  case 55: /* symbol_table_rules: CMD_ADD_LABEL address opt_sep LABEL end_cmd  */
+#line 301 "mon_parse.y"
+                    { mon_add_name_to_symbol_table((yyvsp[-3].a), (yyvsp[-1].str)); }
+#line 2330 "mon_parse.c"
     break;
 
-  case 56:
-#line 303 "mon_parse.y" /* yacc.c:1646  */
-    { mon_remove_name_from_symbol_table(e_default_space, (yyvsp[-1].str)); }
-#line 2592 "mon_parse.c" /* yacc.c:1646  */
+  case 56: /* symbol_table_rules: CMD_DEL_LABEL LABEL end_cmd  */
+#line 303 "mon_parse.y"
+                    { mon_remove_name_from_symbol_table(e_default_space, (yyvsp[-1].str)); }
+#line 2336 "mon_parse.c"
     break;
 
-  case 57:
-#line 305 "mon_parse.y" /* yacc.c:1646  */
-    { mon_remove_name_from_symbol_table((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2598 "mon_parse.c" /* yacc.c:1646  */
+  case 57: /* symbol_table_rules: CMD_DEL_LABEL memspace opt_sep LABEL end_cmd  */
+#line 305 "mon_parse.y"
+                    { mon_remove_name_from_symbol_table((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2342 "mon_parse.c"
     break;
 
-  case 58:
-#line 307 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_symbol_table((yyvsp[-1].i)); }
-#line 2604 "mon_parse.c" /* yacc.c:1646  */
+  case 58: /* symbol_table_rules: CMD_SHOW_LABELS memspace end_cmd  */
+#line 307 "mon_parse.y"
+                    { mon_print_symbol_table((yyvsp[-1].i)); }
+#line 2348 "mon_parse.c"
     break;
 
-  case 59:
-#line 309 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_symbol_table(e_default_space); }
-#line 2610 "mon_parse.c" /* yacc.c:1646  */
+  case 59: /* symbol_table_rules: CMD_SHOW_LABELS end_cmd  */
+#line 309 "mon_parse.y"
+                    { mon_print_symbol_table(e_default_space); }
+#line 2354 "mon_parse.c"
     break;
 
-  case 60:
-#line 311 "mon_parse.y" /* yacc.c:1646  */
-    { mon_clear_symbol_table((yyvsp[-1].i)); }
-#line 2616 "mon_parse.c" /* yacc.c:1646  */
+  case 60: /* symbol_table_rules: CMD_CLEAR_LABELS memspace end_cmd  */
+#line 311 "mon_parse.y"
+                    { mon_clear_symbol_table((yyvsp[-1].i)); }
+#line 2360 "mon_parse.c"
     break;
 
-  case 61:
-#line 313 "mon_parse.y" /* yacc.c:1646  */
-    { mon_clear_symbol_table(e_default_space); }
-#line 2622 "mon_parse.c" /* yacc.c:1646  */
+  case 61: /* symbol_table_rules: CMD_CLEAR_LABELS end_cmd  */
+#line 313 "mon_parse.y"
+                    { mon_clear_symbol_table(e_default_space); }
+#line 2366 "mon_parse.c"
     break;
 
-  case 62:
-#line 315 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 62: /* symbol_table_rules: CMD_LABEL_ASGN EQUALS address end_cmd  */
+#line 315 "mon_parse.y"
+                    {
                         mon_add_name_to_symbol_table((yyvsp[-1].a), mon_prepend_dot_to_name((yyvsp[-3].str)));
                     }
-#line 2630 "mon_parse.c" /* yacc.c:1646  */
+#line 2374 "mon_parse.c"
     break;
 
-  case 63:
-#line 319 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 63: /* symbol_table_rules: CMD_LABEL_ASGN EQUALS address LABEL_ASGN_COMMENT end_cmd  */
+#line 319 "mon_parse.y"
+                    {
                         mon_add_name_to_symbol_table((yyvsp[-2].a), mon_prepend_dot_to_name((yyvsp[-4].str)));
                     }
-#line 2638 "mon_parse.c" /* yacc.c:1646  */
+#line 2382 "mon_parse.c"
     break;
 
-  case 64:
-#line 325 "mon_parse.y" /* yacc.c:1646  */
-    { mon_start_assemble_mode((yyvsp[0].a), NULL); }
-#line 2644 "mon_parse.c" /* yacc.c:1646  */
+  case 64: /* $@1: %empty  */
+#line 325 "mon_parse.y"
+           { mon_start_assemble_mode((yyvsp[0].a), NULL); }
+#line 2388 "mon_parse.c"
     break;
 
-  case 65:
-#line 326 "mon_parse.y" /* yacc.c:1646  */
-    { }
-#line 2650 "mon_parse.c" /* yacc.c:1646  */
+  case 65: /* asm_rules: CMD_ASSEMBLE address $@1 post_assemble end_cmd  */
+#line 326 "mon_parse.y"
+           { }
+#line 2394 "mon_parse.c"
     break;
 
-  case 66:
-#line 328 "mon_parse.y" /* yacc.c:1646  */
-    { mon_start_assemble_mode((yyvsp[-1].a), NULL); }
-#line 2656 "mon_parse.c" /* yacc.c:1646  */
+  case 66: /* asm_rules: CMD_ASSEMBLE address end_cmd  */
+#line 328 "mon_parse.y"
+           { mon_start_assemble_mode((yyvsp[-1].a), NULL); }
+#line 2400 "mon_parse.c"
     break;
 
-  case 67:
-#line 330 "mon_parse.y" /* yacc.c:1646  */
-    { mon_disassemble_lines((yyvsp[-1].range)[0], (yyvsp[-1].range)[1]); }
-#line 2662 "mon_parse.c" /* yacc.c:1646  */
+  case 67: /* asm_rules: CMD_DISASSEMBLE address_opt_range end_cmd  */
+#line 330 "mon_parse.y"
+           { mon_disassemble_lines((yyvsp[-1].range)[0], (yyvsp[-1].range)[1]); }
+#line 2406 "mon_parse.c"
     break;
 
-  case 68:
-#line 332 "mon_parse.y" /* yacc.c:1646  */
-    { mon_disassemble_lines(BAD_ADDR, BAD_ADDR); }
-#line 2668 "mon_parse.c" /* yacc.c:1646  */
+  case 68: /* asm_rules: CMD_DISASSEMBLE end_cmd  */
+#line 332 "mon_parse.y"
+           { mon_disassemble_lines(BAD_ADDR, BAD_ADDR); }
+#line 2412 "mon_parse.c"
     break;
 
-  case 69:
-#line 336 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_move((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2674 "mon_parse.c" /* yacc.c:1646  */
+  case 69: /* memory_rules: CMD_MOVE address_range opt_sep address end_cmd  */
+#line 336 "mon_parse.y"
+              { mon_memory_move((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
+#line 2418 "mon_parse.c"
     break;
 
-  case 70:
-#line 338 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_compare((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2680 "mon_parse.c" /* yacc.c:1646  */
+  case 70: /* memory_rules: CMD_COMPARE address_range opt_sep address end_cmd  */
+#line 338 "mon_parse.y"
+              { mon_memory_compare((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
+#line 2424 "mon_parse.c"
     break;
 
-  case 71:
-#line 340 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_fill((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2686 "mon_parse.c" /* yacc.c:1646  */
+  case 71: /* memory_rules: CMD_FILL address_range opt_sep data_list end_cmd  */
+#line 340 "mon_parse.y"
+              { mon_memory_fill((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
+#line 2430 "mon_parse.c"
     break;
 
-  case 72:
-#line 342 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_hunt((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2692 "mon_parse.c" /* yacc.c:1646  */
+  case 72: /* memory_rules: CMD_HUNT address_range opt_sep hunt_list end_cmd  */
+#line 342 "mon_parse.y"
+              { mon_memory_hunt((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
+#line 2436 "mon_parse.c"
     break;
 
-  case 73:
-#line 344 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display((yyvsp[-3].rt), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2698 "mon_parse.c" /* yacc.c:1646  */
+  case 73: /* memory_rules: CMD_MEM_DISPLAY RADIX_TYPE opt_sep address_opt_range end_cmd  */
+#line 344 "mon_parse.y"
+              { mon_memory_display((yyvsp[-3].rt), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2442 "mon_parse.c"
     break;
 
-  case 74:
-#line 346 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(default_radix, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2704 "mon_parse.c" /* yacc.c:1646  */
+  case 74: /* memory_rules: CMD_MEM_DISPLAY address_opt_range end_cmd  */
+#line 346 "mon_parse.y"
+              { mon_memory_display(default_radix, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2448 "mon_parse.c"
     break;
 
-  case 75:
-#line 348 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(default_radix, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2710 "mon_parse.c" /* yacc.c:1646  */
+  case 75: /* memory_rules: CMD_MEM_DISPLAY end_cmd  */
+#line 348 "mon_parse.y"
+              { mon_memory_display(default_radix, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
+#line 2454 "mon_parse.c"
     break;
 
-  case 76:
-#line 350 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 8, 8); }
-#line 2716 "mon_parse.c" /* yacc.c:1646  */
+  case 76: /* memory_rules: CMD_CHAR_DISPLAY address_opt_range end_cmd  */
+#line 350 "mon_parse.y"
+              { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 8, 8); }
+#line 2460 "mon_parse.c"
     break;
 
-  case 77:
-#line 352 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 8, 8); }
-#line 2722 "mon_parse.c" /* yacc.c:1646  */
+  case 77: /* memory_rules: CMD_CHAR_DISPLAY end_cmd  */
+#line 352 "mon_parse.y"
+              { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 8, 8); }
+#line 2466 "mon_parse.c"
     break;
 
-  case 78:
-#line 354 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 24, 21); }
-#line 2728 "mon_parse.c" /* yacc.c:1646  */
+  case 78: /* memory_rules: CMD_SPRITE_DISPLAY address_opt_range end_cmd  */
+#line 354 "mon_parse.y"
+              { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 24, 21); }
+#line 2472 "mon_parse.c"
     break;
 
-  case 79:
-#line 356 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 24, 21); }
-#line 2734 "mon_parse.c" /* yacc.c:1646  */
+  case 79: /* memory_rules: CMD_SPRITE_DISPLAY end_cmd  */
+#line 356 "mon_parse.y"
+              { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 24, 21); }
+#line 2478 "mon_parse.c"
     break;
 
-  case 80:
-#line 358 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2740 "mon_parse.c" /* yacc.c:1646  */
+  case 80: /* memory_rules: CMD_TEXT_DISPLAY address_opt_range end_cmd  */
+#line 358 "mon_parse.y"
+              { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2484 "mon_parse.c"
     break;
 
-  case 81:
-#line 360 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2746 "mon_parse.c" /* yacc.c:1646  */
+  case 81: /* memory_rules: CMD_TEXT_DISPLAY end_cmd  */
+#line 360 "mon_parse.y"
+              { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
+#line 2490 "mon_parse.c"
     break;
 
-  case 82:
-#line 362 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_SCREEN_CODE); }
-#line 2752 "mon_parse.c" /* yacc.c:1646  */
+  case 82: /* memory_rules: CMD_SCREENCODE_DISPLAY address_opt_range end_cmd  */
+#line 362 "mon_parse.y"
+              { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_SCREEN_CODE); }
+#line 2496 "mon_parse.c"
     break;
 
-  case 83:
-#line 364 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_SCREEN_CODE); }
-#line 2758 "mon_parse.c" /* yacc.c:1646  */
+  case 83: /* memory_rules: CMD_SCREENCODE_DISPLAY end_cmd  */
+#line 364 "mon_parse.y"
+              { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_SCREEN_CODE); }
+#line 2502 "mon_parse.c"
     break;
 
-  case 84:
-#line 366 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_zap(); }
-#line 2764 "mon_parse.c" /* yacc.c:1646  */
+  case 84: /* memory_rules: CMD_MEMMAPZAP end_cmd  */
+#line 366 "mon_parse.y"
+              { mon_memmap_zap(); }
+#line 2508 "mon_parse.c"
     break;
 
-  case 85:
-#line 368 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show(-1,BAD_ADDR,BAD_ADDR); }
-#line 2770 "mon_parse.c" /* yacc.c:1646  */
+  case 85: /* memory_rules: CMD_MEMMAPSHOW end_cmd  */
+#line 368 "mon_parse.y"
+              { mon_memmap_show(-1,BAD_ADDR,BAD_ADDR); }
+#line 2514 "mon_parse.c"
     break;
 
-  case 86:
-#line 370 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show((yyvsp[-1].i),BAD_ADDR,BAD_ADDR); }
-#line 2776 "mon_parse.c" /* yacc.c:1646  */
+  case 86: /* memory_rules: CMD_MEMMAPSHOW opt_sep expression end_cmd  */
+#line 370 "mon_parse.y"
+              { mon_memmap_show((yyvsp[-1].i),BAD_ADDR,BAD_ADDR); }
+#line 2520 "mon_parse.c"
     break;
 
-  case 87:
-#line 372 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show((yyvsp[-2].i),(yyvsp[-1].range)[0],(yyvsp[-1].range)[1]); }
-#line 2782 "mon_parse.c" /* yacc.c:1646  */
+  case 87: /* memory_rules: CMD_MEMMAPSHOW opt_sep expression address_opt_range end_cmd  */
+#line 372 "mon_parse.y"
+              { mon_memmap_show((yyvsp[-2].i),(yyvsp[-1].range)[0],(yyvsp[-1].range)[1]); }
+#line 2526 "mon_parse.c"
     break;
 
-  case 88:
-#line 374 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 2788 "mon_parse.c" /* yacc.c:1646  */
+  case 88: /* memory_rules: CMD_MEMMAPSAVE filename opt_sep expression end_cmd  */
+#line 374 "mon_parse.y"
+              { mon_memmap_save((yyvsp[-3].str),(yyvsp[-1].i)); }
+#line 2532 "mon_parse.c"
     break;
 
-  case 89:
-#line 378 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 89: /* checkpoint_rules: CMD_BREAK opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 378 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2797,32 +2541,32 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2801 "mon_parse.c" /* yacc.c:1646  */
+#line 2545 "mon_parse.c"
     break;
 
-  case 90:
-#line 387 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2807 "mon_parse.c" /* yacc.c:1646  */
+  case 90: /* checkpoint_rules: CMD_BREAK end_cmd  */
+#line 387 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2551 "mon_parse.c"
     break;
 
-  case 91:
-#line 390 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 91: /* checkpoint_rules: CMD_UNTIL address_opt_range end_cmd  */
+#line 390 "mon_parse.y"
+                  {
                       mon_breakpoint_add_checkpoint((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE, e_exec, TRUE);
                   }
-#line 2815 "mon_parse.c" /* yacc.c:1646  */
+#line 2559 "mon_parse.c"
     break;
 
-  case 92:
-#line 394 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2821 "mon_parse.c" /* yacc.c:1646  */
+  case 92: /* checkpoint_rules: CMD_UNTIL end_cmd  */
+#line 394 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2565 "mon_parse.c"
     break;
 
-  case 93:
-#line 397 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 93: /* checkpoint_rules: CMD_WATCH opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 397 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2830,18 +2574,18 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2834 "mon_parse.c" /* yacc.c:1646  */
+#line 2578 "mon_parse.c"
     break;
 
-  case 94:
-#line 406 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2840 "mon_parse.c" /* yacc.c:1646  */
+  case 94: /* checkpoint_rules: CMD_WATCH end_cmd  */
+#line 406 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2584 "mon_parse.c"
     break;
 
-  case 95:
-#line 409 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 95: /* checkpoint_rules: CMD_TRACE opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 409 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], FALSE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2849,105 +2593,105 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2853 "mon_parse.c" /* yacc.c:1646  */
+#line 2597 "mon_parse.c"
     break;
 
-  case 96:
-#line 418 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2859 "mon_parse.c" /* yacc.c:1646  */
+  case 96: /* checkpoint_rules: CMD_TRACE end_cmd  */
+#line 418 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2603 "mon_parse.c"
     break;
 
-  case 97:
-#line 423 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_ON, (yyvsp[-1].i)); }
-#line 2865 "mon_parse.c" /* yacc.c:1646  */
+  case 97: /* checkpoint_control_rules: CMD_CHECKPT_ON checkpt_num end_cmd  */
+#line 423 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_ON, (yyvsp[-1].i)); }
+#line 2609 "mon_parse.c"
     break;
 
-  case 98:
-#line 425 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_ON, -1); }
-#line 2871 "mon_parse.c" /* yacc.c:1646  */
+  case 98: /* checkpoint_control_rules: CMD_CHECKPT_ON end_cmd  */
+#line 425 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_ON, -1); }
+#line 2615 "mon_parse.c"
     break;
 
-  case 99:
-#line 427 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_OFF, (yyvsp[-1].i)); }
-#line 2877 "mon_parse.c" /* yacc.c:1646  */
+  case 99: /* checkpoint_control_rules: CMD_CHECKPT_OFF checkpt_num end_cmd  */
+#line 427 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_OFF, (yyvsp[-1].i)); }
+#line 2621 "mon_parse.c"
     break;
 
-  case 100:
-#line 429 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_OFF, -1); }
-#line 2883 "mon_parse.c" /* yacc.c:1646  */
+  case 100: /* checkpoint_control_rules: CMD_CHECKPT_OFF end_cmd  */
+#line 429 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_OFF, -1); }
+#line 2627 "mon_parse.c"
     break;
 
-  case 101:
-#line 431 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_ignore_count((yyvsp[-1].i), -1); }
-#line 2889 "mon_parse.c" /* yacc.c:1646  */
+  case 101: /* checkpoint_control_rules: CMD_IGNORE checkpt_num end_cmd  */
+#line 431 "mon_parse.y"
+                          { mon_breakpoint_set_ignore_count((yyvsp[-1].i), -1); }
+#line 2633 "mon_parse.c"
     break;
 
-  case 102:
-#line 433 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_ignore_count((yyvsp[-3].i), (yyvsp[-1].i)); }
-#line 2895 "mon_parse.c" /* yacc.c:1646  */
+  case 102: /* checkpoint_control_rules: CMD_IGNORE checkpt_num opt_sep expression end_cmd  */
+#line 433 "mon_parse.y"
+                          { mon_breakpoint_set_ignore_count((yyvsp[-3].i), (yyvsp[-1].i)); }
+#line 2639 "mon_parse.c"
     break;
 
-  case 103:
-#line 435 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_delete_checkpoint((yyvsp[-1].i)); }
-#line 2901 "mon_parse.c" /* yacc.c:1646  */
+  case 103: /* checkpoint_control_rules: CMD_DELETE checkpt_num end_cmd  */
+#line 435 "mon_parse.y"
+                          { mon_breakpoint_delete_checkpoint((yyvsp[-1].i)); }
+#line 2645 "mon_parse.c"
     break;
 
-  case 104:
-#line 437 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_delete_checkpoint(-1); }
-#line 2907 "mon_parse.c" /* yacc.c:1646  */
+  case 104: /* checkpoint_control_rules: CMD_DELETE end_cmd  */
+#line 437 "mon_parse.y"
+                          { mon_breakpoint_delete_checkpoint(-1); }
+#line 2651 "mon_parse.c"
     break;
 
-  case 105:
-#line 439 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_checkpoint_condition((yyvsp[-3].i), (yyvsp[-1].cond_node)); }
-#line 2913 "mon_parse.c" /* yacc.c:1646  */
+  case 105: /* checkpoint_control_rules: CMD_CONDITION checkpt_num IF cond_expr end_cmd  */
+#line 439 "mon_parse.y"
+                          { mon_breakpoint_set_checkpoint_condition((yyvsp[-3].i), (yyvsp[-1].cond_node)); }
+#line 2657 "mon_parse.c"
     break;
 
-  case 106:
-#line 441 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_checkpoint_command((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2919 "mon_parse.c" /* yacc.c:1646  */
+  case 106: /* checkpoint_control_rules: CMD_COMMAND checkpt_num opt_sep STRING end_cmd  */
+#line 441 "mon_parse.y"
+                          { mon_breakpoint_set_checkpoint_command((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2663 "mon_parse.c"
     break;
 
-  case 107:
-#line 443 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_STRING; }
-#line 2925 "mon_parse.c" /* yacc.c:1646  */
+  case 107: /* checkpoint_control_rules: CMD_COMMAND checkpt_num error end_cmd  */
+#line 443 "mon_parse.y"
+                          { return ERR_EXPECT_STRING; }
+#line 2669 "mon_parse.c"
     break;
 
-  case 108:
-#line 447 "mon_parse.y" /* yacc.c:1646  */
-    { sidefx = (((yyvsp[-1].action) == e_TOGGLE) ? (sidefx ^ 1) : (yyvsp[-1].action)); }
-#line 2931 "mon_parse.c" /* yacc.c:1646  */
+  case 108: /* monitor_state_rules: CMD_SIDEFX TOGGLE end_cmd  */
+#line 447 "mon_parse.y"
+                     { sidefx = (((yyvsp[-1].action) == e_TOGGLE) ? (sidefx ^ 1) : (yyvsp[-1].action)); }
+#line 2675 "mon_parse.c"
     break;
 
-  case 109:
-#line 449 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 109: /* monitor_state_rules: CMD_SIDEFX end_cmd  */
+#line 449 "mon_parse.y"
+                     {
                          mon_out("I/O side effects are %s\n",
                                    sidefx ? "enabled" : "disabled");
                      }
-#line 2940 "mon_parse.c" /* yacc.c:1646  */
+#line 2684 "mon_parse.c"
     break;
 
-  case 110:
-#line 454 "mon_parse.y" /* yacc.c:1646  */
-    { default_radix = (yyvsp[-1].rt); }
-#line 2946 "mon_parse.c" /* yacc.c:1646  */
+  case 110: /* monitor_state_rules: CMD_RADIX RADIX_TYPE end_cmd  */
+#line 454 "mon_parse.y"
+                     { default_radix = (yyvsp[-1].rt); }
+#line 2690 "mon_parse.c"
     break;
 
-  case 111:
-#line 456 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 111: /* monitor_state_rules: CMD_RADIX end_cmd  */
+#line 456 "mon_parse.y"
+                     {
                          const char *p;
 
                          if (default_radix == e_hexadecimal)
@@ -2963,766 +2707,784 @@ yyreduce:
 
                          mon_out("Default radix is %s\n", p);
                      }
-#line 2967 "mon_parse.c" /* yacc.c:1646  */
+#line 2711 "mon_parse.c"
     break;
 
-  case 112:
-#line 474 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_change_device((yyvsp[-1].i)); }
-#line 2973 "mon_parse.c" /* yacc.c:1646  */
+  case 112: /* monitor_state_rules: CMD_DEVICE memspace end_cmd  */
+#line 474 "mon_parse.y"
+                     { monitor_change_device((yyvsp[-1].i)); }
+#line 2717 "mon_parse.c"
     break;
 
-  case 113:
-#line 476 "mon_parse.y" /* yacc.c:1646  */
-    { mon_export(); }
-#line 2979 "mon_parse.c" /* yacc.c:1646  */
+  case 113: /* monitor_state_rules: CMD_EXPORT end_cmd  */
+#line 476 "mon_parse.y"
+                     { mon_export(); }
+#line 2723 "mon_parse.c"
     break;
 
-  case 114:
-#line 478 "mon_parse.y" /* yacc.c:1646  */
-    { mon_quit(); YYACCEPT; }
-#line 2985 "mon_parse.c" /* yacc.c:1646  */
+  case 114: /* monitor_state_rules: CMD_QUIT end_cmd  */
+#line 478 "mon_parse.y"
+                     { mon_quit(); YYACCEPT; }
+#line 2729 "mon_parse.c"
     break;
 
-  case 115:
-#line 480 "mon_parse.y" /* yacc.c:1646  */
-    { mon_exit(); YYACCEPT; }
-#line 2991 "mon_parse.c" /* yacc.c:1646  */
+  case 115: /* monitor_state_rules: CMD_EXIT end_cmd  */
+#line 480 "mon_parse.y"
+                     { mon_exit(); YYACCEPT; }
+#line 2735 "mon_parse.c"
     break;
 
-  case 116:
-#line 482 "mon_parse.y" /* yacc.c:1646  */
-    { mon_maincpu_toggle_trace((yyvsp[-1].action)); }
-#line 2997 "mon_parse.c" /* yacc.c:1646  */
+  case 116: /* monitor_state_rules: CMD_MAINCPU_TRACE TOGGLE end_cmd  */
+#line 482 "mon_parse.y"
+                     { mon_maincpu_toggle_trace((yyvsp[-1].action)); }
+#line 2741 "mon_parse.c"
     break;
 
-  case 117:
-#line 486 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_execute_disk_cmd((yyvsp[-1].str)); }
-#line 3003 "mon_parse.c" /* yacc.c:1646  */
+  case 117: /* monitor_misc_rules: CMD_DISK rest_of_line end_cmd  */
+#line 486 "mon_parse.y"
+                    { mon_drive_execute_disk_cmd((yyvsp[-1].str)); }
+#line 2747 "mon_parse.c"
     break;
 
-  case 118:
-#line 488 "mon_parse.y" /* yacc.c:1646  */
-    { mon_out("\t%d\n",(yyvsp[-1].i)); }
-#line 3009 "mon_parse.c" /* yacc.c:1646  */
+  case 118: /* monitor_misc_rules: CMD_PRINT expression end_cmd  */
+#line 488 "mon_parse.y"
+                    { mon_out("\t%d\n",(yyvsp[-1].i)); }
+#line 2753 "mon_parse.c"
     break;
 
-  case 119:
-#line 490 "mon_parse.y" /* yacc.c:1646  */
-    { mon_command_print_help(NULL); }
-#line 3015 "mon_parse.c" /* yacc.c:1646  */
+  case 119: /* monitor_misc_rules: CMD_HELP end_cmd  */
+#line 490 "mon_parse.y"
+                    { mon_command_print_help(NULL); }
+#line 2759 "mon_parse.c"
     break;
 
-  case 120:
-#line 492 "mon_parse.y" /* yacc.c:1646  */
-    { mon_command_print_help((yyvsp[-1].str)); }
-#line 3021 "mon_parse.c" /* yacc.c:1646  */
+  case 120: /* monitor_misc_rules: CMD_HELP rest_of_line end_cmd  */
+#line 492 "mon_parse.y"
+                    { mon_command_print_help((yyvsp[-1].str)); }
+#line 2765 "mon_parse.c"
     break;
 
-  case 121:
-#line 494 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_convert((yyvsp[-1].i)); }
-#line 3027 "mon_parse.c" /* yacc.c:1646  */
+  case 121: /* monitor_misc_rules: CONVERT_OP expression end_cmd  */
+#line 494 "mon_parse.y"
+                    { mon_print_convert((yyvsp[-1].i)); }
+#line 2771 "mon_parse.c"
     break;
 
-  case 122:
-#line 496 "mon_parse.y" /* yacc.c:1646  */
-    { mon_change_dir((yyvsp[-1].str)); }
-#line 3033 "mon_parse.c" /* yacc.c:1646  */
+  case 122: /* monitor_misc_rules: CMD_CHDIR rest_of_line end_cmd  */
+#line 496 "mon_parse.y"
+                    { mon_change_dir((yyvsp[-1].str)); }
+#line 2777 "mon_parse.c"
     break;
 
-  case 123:
-#line 498 "mon_parse.y" /* yacc.c:1646  */
-    { mon_keyboard_feed((yyvsp[-1].str)); }
-#line 3039 "mon_parse.c" /* yacc.c:1646  */
+  case 123: /* monitor_misc_rules: CMD_KEYBUF rest_of_line end_cmd  */
+#line 498 "mon_parse.y"
+                    { mon_keyboard_feed((yyvsp[-1].str)); }
+#line 2783 "mon_parse.c"
     break;
 
-  case 124:
-#line 500 "mon_parse.y" /* yacc.c:1646  */
-    { mon_backtrace(); }
-#line 3045 "mon_parse.c" /* yacc.c:1646  */
+  case 124: /* monitor_misc_rules: CMD_BACKTRACE end_cmd  */
+#line 500 "mon_parse.y"
+                    { mon_backtrace(); }
+#line 2789 "mon_parse.c"
     break;
 
-  case 125:
-#line 502 "mon_parse.y" /* yacc.c:1646  */
-    { mon_show_dir((yyvsp[-1].str)); }
-#line 3051 "mon_parse.c" /* yacc.c:1646  */
+  case 125: /* monitor_misc_rules: CMD_DIR opt_rest_of_line end_cmd  */
+#line 502 "mon_parse.y"
+                     { mon_show_dir((yyvsp[-1].str)); }
+#line 2795 "mon_parse.c"
     break;
 
-  case 126:
-#line 504 "mon_parse.y" /* yacc.c:1646  */
-    { mon_show_pwd(); }
-#line 3057 "mon_parse.c" /* yacc.c:1646  */
+  case 126: /* monitor_misc_rules: CMD_PWD end_cmd  */
+#line 504 "mon_parse.y"
+                     { mon_show_pwd(); }
+#line 2801 "mon_parse.c"
     break;
 
-  case 127:
-#line 506 "mon_parse.y" /* yacc.c:1646  */
-    { mon_screenshot_save((yyvsp[-1].str),-1); }
-#line 3063 "mon_parse.c" /* yacc.c:1646  */
+  case 127: /* monitor_misc_rules: CMD_SCREENSHOT filename end_cmd  */
+#line 506 "mon_parse.y"
+                    { mon_screenshot_save((yyvsp[-1].str),-1); }
+#line 2807 "mon_parse.c"
     break;
 
-  case 128:
-#line 508 "mon_parse.y" /* yacc.c:1646  */
-    { mon_screenshot_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 3069 "mon_parse.c" /* yacc.c:1646  */
+  case 128: /* monitor_misc_rules: CMD_SCREENSHOT filename opt_sep expression end_cmd  */
+#line 508 "mon_parse.y"
+                    { mon_screenshot_save((yyvsp[-3].str),(yyvsp[-1].i)); }
+#line 2813 "mon_parse.c"
     break;
 
-  case 129:
-#line 510 "mon_parse.y" /* yacc.c:1646  */
-    { mon_resource_get((yyvsp[-1].str)); }
-#line 3075 "mon_parse.c" /* yacc.c:1646  */
+  case 129: /* monitor_misc_rules: CMD_RESOURCE_GET STRING end_cmd  */
+#line 510 "mon_parse.y"
+                    { mon_resource_get((yyvsp[-1].str)); }
+#line 2819 "mon_parse.c"
     break;
 
-  case 130:
-#line 512 "mon_parse.y" /* yacc.c:1646  */
-    { mon_resource_set((yyvsp[-2].str),(yyvsp[-1].str)); }
-#line 3081 "mon_parse.c" /* yacc.c:1646  */
+  case 130: /* monitor_misc_rules: CMD_RESOURCE_SET STRING STRING end_cmd  */
+#line 512 "mon_parse.y"
+                    { mon_resource_set((yyvsp[-2].str),(yyvsp[-1].str)); }
+#line 2825 "mon_parse.c"
     break;
 
-  case 131:
-#line 514 "mon_parse.y" /* yacc.c:1646  */
-    { resources_load((yyvsp[-1].str)); }
-#line 3087 "mon_parse.c" /* yacc.c:1646  */
+  case 131: /* monitor_misc_rules: CMD_LOAD_RESOURCES filename end_cmd  */
+#line 514 "mon_parse.y"
+                    { resources_load((yyvsp[-1].str)); }
+#line 2831 "mon_parse.c"
     break;
 
-  case 132:
-#line 516 "mon_parse.y" /* yacc.c:1646  */
-    { resources_save((yyvsp[-1].str)); }
-#line 3093 "mon_parse.c" /* yacc.c:1646  */
+  case 132: /* monitor_misc_rules: CMD_SAVE_RESOURCES filename end_cmd  */
+#line 516 "mon_parse.y"
+                    { resources_save((yyvsp[-1].str)); }
+#line 2837 "mon_parse.c"
     break;
 
-  case 133:
-#line 518 "mon_parse.y" /* yacc.c:1646  */
-    { mon_reset_machine(-1); }
-#line 3099 "mon_parse.c" /* yacc.c:1646  */
+  case 133: /* monitor_misc_rules: CMD_MON_RESET end_cmd  */
+#line 518 "mon_parse.y"
+                    { mon_reset_machine(-1); }
+#line 2843 "mon_parse.c"
     break;
 
-  case 134:
-#line 520 "mon_parse.y" /* yacc.c:1646  */
-    { mon_reset_machine((yyvsp[-1].i)); }
-#line 3105 "mon_parse.c" /* yacc.c:1646  */
+  case 134: /* monitor_misc_rules: CMD_MON_RESET opt_sep expression end_cmd  */
+#line 520 "mon_parse.y"
+                    { mon_reset_machine((yyvsp[-1].i)); }
+#line 2849 "mon_parse.c"
     break;
 
-  case 135:
-#line 522 "mon_parse.y" /* yacc.c:1646  */
-    { mon_tape_ctrl((yyvsp[-1].i)); }
-#line 3111 "mon_parse.c" /* yacc.c:1646  */
+  case 135: /* monitor_misc_rules: CMD_TAPECTRL opt_sep expression end_cmd  */
+#line 522 "mon_parse.y"
+                    { mon_tape_ctrl((yyvsp[-1].i)); }
+#line 2855 "mon_parse.c"
     break;
 
-  case 136:
-#line 524 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cart_freeze(); }
-#line 3117 "mon_parse.c" /* yacc.c:1646  */
+  case 136: /* monitor_misc_rules: CMD_CARTFREEZE end_cmd  */
+#line 524 "mon_parse.y"
+                    { mon_cart_freeze(); }
+#line 2861 "mon_parse.c"
     break;
 
-  case 137:
-#line 526 "mon_parse.y" /* yacc.c:1646  */
-    { }
-#line 3123 "mon_parse.c" /* yacc.c:1646  */
+  case 137: /* monitor_misc_rules: CMD_COMMENT opt_rest_of_line end_cmd  */
+#line 526 "mon_parse.y"
+                     { }
+#line 2867 "mon_parse.c"
     break;
 
-  case 138:
-#line 528 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stopwatch_reset(); }
-#line 3129 "mon_parse.c" /* yacc.c:1646  */
+  case 138: /* monitor_misc_rules: CMD_STOPWATCH RESET end_cmd  */
+#line 528 "mon_parse.y"
+                     { mon_stopwatch_reset(); }
+#line 2873 "mon_parse.c"
     break;
 
-  case 139:
-#line 530 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stopwatch_show("Stopwatch: ", "\n"); }
-#line 3135 "mon_parse.c" /* yacc.c:1646  */
+  case 139: /* monitor_misc_rules: CMD_STOPWATCH end_cmd  */
+#line 530 "mon_parse.y"
+                     { mon_stopwatch_show("Stopwatch: ", "\n"); }
+#line 2879 "mon_parse.c"
     break;
 
-  case 140:
-#line 534 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
-#line 3141 "mon_parse.c" /* yacc.c:1646  */
+  case 140: /* monitor_misc_rules: CMD_PROFILE RESET end_cmd  */
+#line 532 "mon_parse.y"
+                     { mon_profile_reset(); }
+#line 2885 "mon_parse.c"
     break;
 
-  case 141:
-#line 536 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
-#line 3147 "mon_parse.c" /* yacc.c:1646  */
+  case 141: /* monitor_misc_rules: CMD_PROFILE STRING end_cmd  */
+#line 534 "mon_parse.y"
+                     { mon_profile_dump((yyvsp[-1].str)); }
+#line 2891 "mon_parse.c"
     break;
 
-  case 142:
-#line 538 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
-#line 3153 "mon_parse.c" /* yacc.c:1646  */
+  case 142: /* monitor_misc_rules: CMD_PROFILE end_cmd  */
+#line 536 "mon_parse.y"
+                     { mon_profile_show(); }
+#line 2897 "mon_parse.c"
     break;
 
-  case 143:
-#line 540 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_DEVICE_NUM; }
-#line 3159 "mon_parse.c" /* yacc.c:1646  */
+  case 143: /* disk_rules: CMD_LOAD filename device_num opt_address end_cmd  */
+#line 540 "mon_parse.y"
+            { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
+#line 2903 "mon_parse.c"
     break;
 
-  case 144:
-#line 542 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3165 "mon_parse.c" /* yacc.c:1646  */
+  case 144: /* disk_rules: CMD_BLOAD filename device_num opt_address end_cmd  */
+#line 542 "mon_parse.y"
+            { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
+#line 2909 "mon_parse.c"
     break;
 
-  case 145:
-#line 544 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
-#line 3171 "mon_parse.c" /* yacc.c:1646  */
+  case 145: /* disk_rules: CMD_SAVE filename device_num address_range end_cmd  */
+#line 544 "mon_parse.y"
+            { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
+#line 2915 "mon_parse.c"
     break;
 
-  case 146:
-#line 546 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3177 "mon_parse.c" /* yacc.c:1646  */
+  case 146: /* disk_rules: CMD_SAVE filename error  */
+#line 546 "mon_parse.y"
+            { return ERR_EXPECT_DEVICE_NUM; }
+#line 2921 "mon_parse.c"
     break;
 
-  case 147:
-#line 548 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3183 "mon_parse.c" /* yacc.c:1646  */
+  case 147: /* disk_rules: CMD_SAVE filename device_num error  */
+#line 548 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 2927 "mon_parse.c"
     break;
 
-  case 148:
-#line 550 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3189 "mon_parse.c" /* yacc.c:1646  */
+  case 148: /* disk_rules: CMD_BSAVE filename device_num address_range end_cmd  */
+#line 550 "mon_parse.y"
+            { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
+#line 2933 "mon_parse.c"
     break;
 
-  case 149:
-#line 552 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3195 "mon_parse.c" /* yacc.c:1646  */
+  case 149: /* disk_rules: CMD_BSAVE filename device_num error  */
+#line 552 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 2939 "mon_parse.c"
     break;
 
-  case 150:
-#line 554 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3201 "mon_parse.c" /* yacc.c:1646  */
+  case 150: /* disk_rules: CMD_VERIFY filename device_num address end_cmd  */
+#line 554 "mon_parse.y"
+            { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 2945 "mon_parse.c"
     break;
 
-  case 151:
-#line 556 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list(-1); }
-#line 3207 "mon_parse.c" /* yacc.c:1646  */
+  case 151: /* disk_rules: CMD_VERIFY filename device_num error  */
+#line 556 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 2951 "mon_parse.c"
     break;
 
-  case 152:
-#line 558 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list((yyvsp[-1].i)); }
-#line 3213 "mon_parse.c" /* yacc.c:1646  */
+  case 152: /* disk_rules: CMD_BLOCK_READ expression expression opt_address end_cmd  */
+#line 558 "mon_parse.y"
+            { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 2957 "mon_parse.c"
     break;
 
-  case 153:
-#line 560 "mon_parse.y" /* yacc.c:1646  */
-    { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
-#line 3219 "mon_parse.c" /* yacc.c:1646  */
+  case 153: /* disk_rules: CMD_BLOCK_WRITE expression expression address end_cmd  */
+#line 560 "mon_parse.y"
+            { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 2963 "mon_parse.c"
     break;
 
-  case 154:
-#line 562 "mon_parse.y" /* yacc.c:1646  */
-    { mon_detach((yyvsp[-1].i)); }
-#line 3225 "mon_parse.c" /* yacc.c:1646  */
+  case 154: /* disk_rules: CMD_LIST end_cmd  */
+#line 562 "mon_parse.y"
+            { mon_drive_list(-1); }
+#line 2969 "mon_parse.c"
     break;
 
-  case 155:
-#line 564 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,1); }
-#line 3231 "mon_parse.c" /* yacc.c:1646  */
+  case 155: /* disk_rules: CMD_LIST device_num end_cmd  */
+#line 564 "mon_parse.y"
+            { mon_drive_list((yyvsp[-1].i)); }
+#line 2975 "mon_parse.c"
     break;
 
-  case 156:
-#line 566 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
-#line 3237 "mon_parse.c" /* yacc.c:1646  */
+  case 156: /* disk_rules: CMD_ATTACH filename expression end_cmd  */
+#line 566 "mon_parse.y"
+            { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
+#line 2981 "mon_parse.c"
     break;
 
-  case 157:
-#line 568 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,0); }
-#line 3243 "mon_parse.c" /* yacc.c:1646  */
+  case 157: /* disk_rules: CMD_DETACH expression end_cmd  */
+#line 568 "mon_parse.y"
+            { mon_detach((yyvsp[-1].i)); }
+#line 2987 "mon_parse.c"
     break;
 
-  case 158:
-#line 570 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
-#line 3249 "mon_parse.c" /* yacc.c:1646  */
+  case 158: /* disk_rules: CMD_AUTOSTART filename end_cmd  */
+#line 570 "mon_parse.y"
+            { mon_autostart((yyvsp[-1].str),0,1); }
+#line 2993 "mon_parse.c"
     break;
 
-  case 159:
-#line 574 "mon_parse.y" /* yacc.c:1646  */
-    { mon_record_commands((yyvsp[-1].str)); }
-#line 3255 "mon_parse.c" /* yacc.c:1646  */
+  case 159: /* disk_rules: CMD_AUTOSTART filename opt_sep number end_cmd  */
+#line 572 "mon_parse.y"
+            { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
+#line 2999 "mon_parse.c"
     break;
 
-  case 160:
-#line 576 "mon_parse.y" /* yacc.c:1646  */
-    { mon_end_recording(); }
-#line 3261 "mon_parse.c" /* yacc.c:1646  */
+  case 160: /* disk_rules: CMD_AUTOLOAD filename end_cmd  */
+#line 574 "mon_parse.y"
+            { mon_autostart((yyvsp[-1].str),0,0); }
+#line 3005 "mon_parse.c"
     break;
 
-  case 161:
-#line 578 "mon_parse.y" /* yacc.c:1646  */
-    { mon_playback_init((yyvsp[-1].str)); }
-#line 3267 "mon_parse.c" /* yacc.c:1646  */
+  case 161: /* disk_rules: CMD_AUTOLOAD filename opt_sep number end_cmd  */
+#line 576 "mon_parse.y"
+            { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
+#line 3011 "mon_parse.c"
     break;
 
-  case 162:
-#line 582 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
-#line 3273 "mon_parse.c" /* yacc.c:1646  */
+  case 162: /* cmd_file_rules: CMD_RECORD filename end_cmd  */
+#line 580 "mon_parse.y"
+                { mon_record_commands((yyvsp[-1].str)); }
+#line 3017 "mon_parse.c"
     break;
 
-  case 163:
-#line 584 "mon_parse.y" /* yacc.c:1646  */
-    { printf("Not yet.\n"); }
-#line 3279 "mon_parse.c" /* yacc.c:1646  */
+  case 163: /* cmd_file_rules: CMD_MON_STOP end_cmd  */
+#line 582 "mon_parse.y"
+                { mon_end_recording(); }
+#line 3023 "mon_parse.c"
     break;
 
-  case 164:
-#line 588 "mon_parse.y" /* yacc.c:1646  */
-    { yydebug = 1; }
-#line 3285 "mon_parse.c" /* yacc.c:1646  */
+  case 164: /* cmd_file_rules: CMD_PLAYBACK filename end_cmd  */
+#line 584 "mon_parse.y"
+                { mon_playback_init((yyvsp[-1].str)); }
+#line 3029 "mon_parse.c"
     break;
 
-  case 165:
-#line 591 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3291 "mon_parse.c" /* yacc.c:1646  */
+  case 165: /* data_entry_rules: CMD_ENTER_DATA address data_list end_cmd  */
+#line 588 "mon_parse.y"
+                  { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
+#line 3035 "mon_parse.c"
     break;
 
-  case 166:
-#line 594 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3297 "mon_parse.c" /* yacc.c:1646  */
+  case 166: /* data_entry_rules: CMD_ENTER_BIN_DATA end_cmd  */
+#line 590 "mon_parse.y"
+                  { printf("Not yet.\n"); }
+#line 3041 "mon_parse.c"
     break;
 
-  case 167:
-#line 595 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = NULL; }
-#line 3303 "mon_parse.c" /* yacc.c:1646  */
+  case 167: /* monitor_debug_rules: CMD_YYDEBUG end_cmd  */
+#line 594 "mon_parse.y"
+                     { yydebug = 1; }
+#line 3047 "mon_parse.c"
     break;
 
-  case 169:
-#line 599 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_FILENAME; }
-#line 3309 "mon_parse.c" /* yacc.c:1646  */
+  case 168: /* rest_of_line: R_O_L  */
+#line 597 "mon_parse.y"
+                    { (yyval.str) = (yyvsp[0].str); }
+#line 3053 "mon_parse.c"
     break;
 
-  case 171:
-#line 603 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_DEVICE_NUM; }
-#line 3315 "mon_parse.c" /* yacc.c:1646  */
+  case 169: /* opt_rest_of_line: R_O_L  */
+#line 600 "mon_parse.y"
+                        { (yyval.str) = (yyvsp[0].str); }
+#line 3059 "mon_parse.c"
     break;
 
-  case 172:
-#line 606 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-1].i) | (yyvsp[0].i); }
-#line 3321 "mon_parse.c" /* yacc.c:1646  */
+  case 170: /* opt_rest_of_line: %empty  */
+#line 601 "mon_parse.y"
+                    { (yyval.str) = NULL; }
+#line 3065 "mon_parse.c"
     break;
 
-  case 173:
-#line 607 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3327 "mon_parse.c" /* yacc.c:1646  */
+  case 172: /* filename: error  */
+#line 605 "mon_parse.y"
+                { return ERR_EXPECT_FILENAME; }
+#line 3071 "mon_parse.c"
     break;
 
-  case 174:
-#line 610 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3333 "mon_parse.c" /* yacc.c:1646  */
+  case 174: /* device_num: error  */
+#line 609 "mon_parse.y"
+              { return ERR_EXPECT_DEVICE_NUM; }
+#line 3077 "mon_parse.c"
     break;
 
-  case 175:
-#line 611 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 3339 "mon_parse.c" /* yacc.c:1646  */
+  case 175: /* mem_op: mem_op MEM_OP  */
+#line 612 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[-1].i) | (yyvsp[0].i); }
+#line 3083 "mon_parse.c"
     break;
 
-  case 176:
-#line 614 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 176: /* mem_op: MEM_OP  */
+#line 613 "mon_parse.y"
+               { (yyval.i) = (yyvsp[0].i); }
+#line 3089 "mon_parse.c"
+    break;
+
+  case 177: /* opt_mem_op: mem_op  */
+#line 616 "mon_parse.y"
+                   { (yyval.i) = (yyvsp[0].i); }
+#line 3095 "mon_parse.c"
+    break;
+
+  case 178: /* opt_mem_op: %empty  */
+#line 617 "mon_parse.y"
+            { (yyval.i) = 0; }
+#line 3101 "mon_parse.c"
+    break;
+
+  case 179: /* register: MON_REGISTER  */
+#line 620 "mon_parse.y"
+                                {
                                     if (!mon_register_valid(default_memspace, (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg(default_memspace, (yyvsp[0].reg));
                                 }
-#line 3350 "mon_parse.c" /* yacc.c:1646  */
+#line 3112 "mon_parse.c"
     break;
 
-  case 177:
-#line 620 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 180: /* register: memspace MON_REGISTER  */
+#line 626 "mon_parse.y"
+                                {
                                     if (!mon_register_valid((yyvsp[-1].i), (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg((yyvsp[-1].i), (yyvsp[0].reg));
                                 }
-#line 3361 "mon_parse.c" /* yacc.c:1646  */
+#line 3123 "mon_parse.c"
     break;
 
-  case 180:
-#line 633 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[reg_memspace((yyvsp[-2].i))]->mon_register_set_val)(reg_memspace((yyvsp[-2].i)), reg_regid((yyvsp[-2].i)), (uint16_t) (yyvsp[0].i)); }
-#line 3367 "mon_parse.c" /* yacc.c:1646  */
+  case 183: /* reg_asgn: register EQUALS number  */
+#line 639 "mon_parse.y"
+          { (monitor_cpu_for_memspace[reg_memspace((yyvsp[-2].i))]->mon_register_set_val)(reg_memspace((yyvsp[-2].i)), reg_regid((yyvsp[-2].i)), (uint16_t) (yyvsp[0].i)); }
+#line 3129 "mon_parse.c"
     break;
 
-  case 181:
-#line 636 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3373 "mon_parse.c" /* yacc.c:1646  */
+  case 184: /* checkpt_num: d_number  */
+#line 642 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[0].i); }
+#line 3135 "mon_parse.c"
     break;
 
-  case 182:
-#line 637 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_CHECKNUM; }
-#line 3379 "mon_parse.c" /* yacc.c:1646  */
+  case 185: /* checkpt_num: error  */
+#line 643 "mon_parse.y"
+                   { return ERR_EXPECT_CHECKNUM; }
+#line 3141 "mon_parse.c"
     break;
 
-  case 184:
-#line 641 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.range)[0] = (yyvsp[0].a); (yyval.range)[1] = BAD_ADDR; }
-#line 3385 "mon_parse.c" /* yacc.c:1646  */
+  case 187: /* address_opt_range: address  */
+#line 647 "mon_parse.y"
+                           { (yyval.range)[0] = (yyvsp[0].a); (yyval.range)[1] = BAD_ADDR; }
+#line 3147 "mon_parse.c"
     break;
 
-  case 185:
-#line 644 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.range)[0] = (yyvsp[-2].a); (yyval.range)[1] = (yyvsp[0].a); }
-#line 3391 "mon_parse.c" /* yacc.c:1646  */
+  case 188: /* address_range: address opt_sep address  */
+#line 650 "mon_parse.y"
+                                       { (yyval.range)[0] = (yyvsp[-2].a); (yyval.range)[1] = (yyvsp[0].a); }
+#line 3153 "mon_parse.c"
     break;
 
-  case 186:
-#line 646 "mon_parse.y" /* yacc.c:1646  */
-    { if (resolve_range(e_default_space, (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3397 "mon_parse.c" /* yacc.c:1646  */
+  case 189: /* address_range: H_RANGE_GUESS  */
+#line 652 "mon_parse.y"
+               { if (resolve_range(e_default_space, (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
+#line 3159 "mon_parse.c"
     break;
 
-  case 187:
-#line 648 "mon_parse.y" /* yacc.c:1646  */
-    { if (resolve_range((yyvsp[-2].i), (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3403 "mon_parse.c" /* yacc.c:1646  */
+  case 190: /* address_range: memspace opt_sep H_RANGE_GUESS  */
+#line 654 "mon_parse.y"
+               { if (resolve_range((yyvsp[-2].i), (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
+#line 3165 "mon_parse.c"
     break;
 
-  case 188:
-#line 651 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.a) = (yyvsp[0].a); }
-#line 3409 "mon_parse.c" /* yacc.c:1646  */
+  case 191: /* opt_address: opt_sep address  */
+#line 657 "mon_parse.y"
+                             { (yyval.a) = (yyvsp[0].a); }
+#line 3171 "mon_parse.c"
     break;
 
-  case 189:
-#line 652 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.a) = BAD_ADDR; }
-#line 3415 "mon_parse.c" /* yacc.c:1646  */
+  case 192: /* opt_address: %empty  */
+#line 658 "mon_parse.y"
+             { (yyval.a) = BAD_ADDR; }
+#line 3177 "mon_parse.c"
     break;
 
-  case 190:
-#line 656 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 193: /* address: memloc  */
+#line 662 "mon_parse.y"
+         {
              (yyval.a) = new_addr(e_default_space,(yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3424 "mon_parse.c" /* yacc.c:1646  */
+#line 3186 "mon_parse.c"
     break;
 
-  case 191:
-#line 661 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 194: /* address: memspace opt_sep memloc  */
+#line 667 "mon_parse.y"
+         {
              (yyval.a) = new_addr((yyvsp[-2].i), (yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3433 "mon_parse.c" /* yacc.c:1646  */
+#line 3195 "mon_parse.c"
     break;
 
-  case 192:
-#line 666 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 195: /* address: LABEL  */
+#line 672 "mon_parse.y"
+         {
              temp = mon_symbol_table_lookup_addr(e_default_space, (yyvsp[0].str));
              if (temp >= 0)
                  (yyval.a) = new_addr(e_default_space, temp);
              else
                  return ERR_UNDEFINED_LABEL;
          }
-#line 3445 "mon_parse.c" /* yacc.c:1646  */
+#line 3207 "mon_parse.c"
     break;
 
-  case 195:
-#line 679 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_comp_space; }
-#line 3451 "mon_parse.c" /* yacc.c:1646  */
+  case 198: /* memspace: MEM_COMP  */
+#line 685 "mon_parse.y"
+                   { (yyval.i) = e_comp_space; }
+#line 3213 "mon_parse.c"
     break;
 
-  case 196:
-#line 680 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk8_space; }
-#line 3457 "mon_parse.c" /* yacc.c:1646  */
+  case 199: /* memspace: MEM_DISK8  */
+#line 686 "mon_parse.y"
+                    { (yyval.i) = e_disk8_space; }
+#line 3219 "mon_parse.c"
     break;
 
-  case 197:
-#line 681 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk9_space; }
-#line 3463 "mon_parse.c" /* yacc.c:1646  */
+  case 200: /* memspace: MEM_DISK9  */
+#line 687 "mon_parse.y"
+                    { (yyval.i) = e_disk9_space; }
+#line 3225 "mon_parse.c"
     break;
 
-  case 198:
-#line 682 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk10_space; }
-#line 3469 "mon_parse.c" /* yacc.c:1646  */
+  case 201: /* memspace: MEM_DISK10  */
+#line 688 "mon_parse.y"
+                     { (yyval.i) = e_disk10_space; }
+#line 3231 "mon_parse.c"
     break;
 
-  case 199:
-#line 683 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk11_space; }
-#line 3475 "mon_parse.c" /* yacc.c:1646  */
+  case 202: /* memspace: MEM_DISK11  */
+#line 689 "mon_parse.y"
+                     { (yyval.i) = e_disk11_space; }
+#line 3237 "mon_parse.c"
     break;
 
-  case 200:
-#line 686 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); if (!CHECK_ADDR((yyvsp[0].i))) return ERR_ADDR_TOO_BIG; }
-#line 3481 "mon_parse.c" /* yacc.c:1646  */
+  case 203: /* memloc: memaddr  */
+#line 692 "mon_parse.y"
+                { (yyval.i) = (yyvsp[0].i); if (!CHECK_ADDR((yyvsp[0].i))) return ERR_ADDR_TOO_BIG; }
+#line 3243 "mon_parse.c"
     break;
 
-  case 201:
-#line 688 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3487 "mon_parse.c" /* yacc.c:1646  */
+  case 204: /* memaddr: number  */
+#line 694 "mon_parse.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 3249 "mon_parse.c"
     break;
 
-  case 202:
-#line 690 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
-#line 3493 "mon_parse.c" /* yacc.c:1646  */
+  case 205: /* expression: expression '+' expression  */
+#line 696 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
+#line 3255 "mon_parse.c"
     break;
 
-  case 203:
-#line 691 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
-#line 3499 "mon_parse.c" /* yacc.c:1646  */
+  case 206: /* expression: expression '-' expression  */
+#line 697 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
+#line 3261 "mon_parse.c"
     break;
 
-  case 204:
-#line 692 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
-#line 3505 "mon_parse.c" /* yacc.c:1646  */
+  case 207: /* expression: expression '*' expression  */
+#line 698 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
+#line 3267 "mon_parse.c"
     break;
 
-  case 205:
-#line 693 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = ((yyvsp[0].i)) ? ((yyvsp[-2].i) / (yyvsp[0].i)) : 1; }
-#line 3511 "mon_parse.c" /* yacc.c:1646  */
+  case 208: /* expression: expression '/' expression  */
+#line 699 "mon_parse.y"
+                                      { (yyval.i) = ((yyvsp[0].i)) ? ((yyvsp[-2].i) / (yyvsp[0].i)) : 1; }
+#line 3273 "mon_parse.c"
     break;
 
-  case 206:
-#line 694 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-1].i); }
-#line 3517 "mon_parse.c" /* yacc.c:1646  */
+  case 209: /* expression: '(' expression ')'  */
+#line 700 "mon_parse.y"
+                               { (yyval.i) = (yyvsp[-1].i); }
+#line 3279 "mon_parse.c"
     break;
 
-  case 207:
-#line 695 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_MISSING_CLOSE_PAREN; }
-#line 3523 "mon_parse.c" /* yacc.c:1646  */
+  case 210: /* expression: '(' expression error  */
+#line 701 "mon_parse.y"
+                                 { return ERR_MISSING_CLOSE_PAREN; }
+#line 3285 "mon_parse.c"
     break;
 
-  case 208:
-#line 696 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3529 "mon_parse.c" /* yacc.c:1646  */
+  case 211: /* expression: value  */
+#line 702 "mon_parse.y"
+                  { (yyval.i) = (yyvsp[0].i); }
+#line 3291 "mon_parse.c"
     break;
 
-  case 209:
-#line 699 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3535 "mon_parse.c" /* yacc.c:1646  */
+  case 212: /* opt_if_cond_expr: IF cond_expr  */
+#line 705 "mon_parse.y"
+                               { (yyval.cond_node) = (yyvsp[0].cond_node); }
+#line 3297 "mon_parse.c"
     break;
 
-  case 210:
-#line 700 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = 0; }
-#line 3541 "mon_parse.c" /* yacc.c:1646  */
+  case 213: /* opt_if_cond_expr: %empty  */
+#line 706 "mon_parse.y"
+                  { (yyval.cond_node) = 0; }
+#line 3303 "mon_parse.c"
     break;
 
-  case 211:
-#line 703 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 214: /* cond_expr: cond_expr COMPARE_OP cond_expr  */
+#line 709 "mon_parse.y"
+           {
                (yyval.cond_node) = new_cond; (yyval.cond_node)->is_parenthized = FALSE;
                (yyval.cond_node)->child1 = (yyvsp[-2].cond_node); (yyval.cond_node)->child2 = (yyvsp[0].cond_node); (yyval.cond_node)->operation = (yyvsp[-1].cond_op);
            }
-#line 3550 "mon_parse.c" /* yacc.c:1646  */
+#line 3312 "mon_parse.c"
     break;
 
-  case 212:
-#line 708 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_INCOMPLETE_COMPARE_OP; }
-#line 3556 "mon_parse.c" /* yacc.c:1646  */
+  case 215: /* cond_expr: cond_expr COMPARE_OP error  */
+#line 714 "mon_parse.y"
+           { return ERR_INCOMPLETE_COMPARE_OP; }
+#line 3318 "mon_parse.c"
     break;
 
-  case 213:
-#line 710 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[-1].cond_node); (yyval.cond_node)->is_parenthized = TRUE; }
-#line 3562 "mon_parse.c" /* yacc.c:1646  */
+  case 216: /* cond_expr: L_PAREN cond_expr R_PAREN  */
+#line 716 "mon_parse.y"
+           { (yyval.cond_node) = (yyvsp[-1].cond_node); (yyval.cond_node)->is_parenthized = TRUE; }
+#line 3324 "mon_parse.c"
     break;
 
-  case 214:
-#line 712 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_MISSING_CLOSE_PAREN; }
-#line 3568 "mon_parse.c" /* yacc.c:1646  */
+  case 217: /* cond_expr: L_PAREN cond_expr error  */
+#line 718 "mon_parse.y"
+           { return ERR_MISSING_CLOSE_PAREN; }
+#line 3330 "mon_parse.c"
     break;
 
-  case 215:
-#line 714 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3574 "mon_parse.c" /* yacc.c:1646  */
+  case 218: /* cond_expr: compare_operand  */
+#line 720 "mon_parse.y"
+           { (yyval.cond_node) = (yyvsp[0].cond_node); }
+#line 3336 "mon_parse.c"
     break;
 
-  case 216:
-#line 717 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = new_cond;
+  case 219: /* compare_operand: register  */
+#line 723 "mon_parse.y"
+                          { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->reg_num = (yyvsp[0].i); (yyval.cond_node)->is_reg = TRUE; (yyval.cond_node)->banknum=-1;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3585 "mon_parse.c" /* yacc.c:1646  */
+#line 3347 "mon_parse.c"
     break;
 
-  case 217:
-#line 723 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = new_cond;
+  case 220: /* compare_operand: number  */
+#line 729 "mon_parse.y"
+                          { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->value = (yyvsp[0].i); (yyval.cond_node)->is_reg = FALSE; (yyval.cond_node)->banknum=-1;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3596 "mon_parse.c" /* yacc.c:1646  */
+#line 3358 "mon_parse.c"
     break;
 
-  case 218:
-#line 729 "mon_parse.y" /* yacc.c:1646  */
-    {(yyval.cond_node)=new_cond;
+  case 221: /* compare_operand: '@' BANKNAME ':' address  */
+#line 735 "mon_parse.y"
+                                           {(yyval.cond_node)=new_cond;
                             (yyval.cond_node)->operation=e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->banknum=mon_banknum_from_bank(e_default_space,(yyvsp[-2].str)); (yyval.cond_node)->value = (yyvsp[0].a); (yyval.cond_node)->is_reg = FALSE;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;  
                         }
-#line 3607 "mon_parse.c" /* yacc.c:1646  */
+#line 3369 "mon_parse.c"
     break;
 
-  case 221:
-#line 741 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3613 "mon_parse.c" /* yacc.c:1646  */
+  case 224: /* data_element: number  */
+#line 747 "mon_parse.y"
+                     { mon_add_number_to_buffer((yyvsp[0].i)); }
+#line 3375 "mon_parse.c"
     break;
 
-  case 222:
-#line 742 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3619 "mon_parse.c" /* yacc.c:1646  */
+  case 225: /* data_element: STRING  */
+#line 748 "mon_parse.y"
+                     { mon_add_string_to_buffer((yyvsp[0].str)); }
+#line 3381 "mon_parse.c"
     break;
 
-  case 225:
-#line 749 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3625 "mon_parse.c" /* yacc.c:1646  */
+  case 228: /* hunt_element: number  */
+#line 755 "mon_parse.y"
+                     { mon_add_number_to_buffer((yyvsp[0].i)); }
+#line 3387 "mon_parse.c"
     break;
 
-  case 226:
-#line 750 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_masked_to_buffer((yyvsp[0].i), 0x00); }
-#line 3631 "mon_parse.c" /* yacc.c:1646  */
+  case 229: /* hunt_element: MASK  */
+#line 756 "mon_parse.y"
+                     { mon_add_number_masked_to_buffer((yyvsp[0].i), 0x00); }
+#line 3393 "mon_parse.c"
     break;
 
-  case 227:
-#line 751 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3637 "mon_parse.c" /* yacc.c:1646  */
+  case 230: /* hunt_element: STRING  */
+#line 757 "mon_parse.y"
+                     { mon_add_string_to_buffer((yyvsp[0].str)); }
+#line 3399 "mon_parse.c"
     break;
 
-  case 228:
-#line 754 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3643 "mon_parse.c" /* yacc.c:1646  */
+  case 231: /* value: number  */
+#line 760 "mon_parse.y"
+              { (yyval.i) = (yyvsp[0].i); }
+#line 3405 "mon_parse.c"
     break;
 
-  case 229:
-#line 755 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (monitor_cpu_for_memspace[reg_memspace((yyvsp[0].i))]->mon_register_get_val)(reg_memspace((yyvsp[0].i)), reg_regid((yyvsp[0].i))); }
-#line 3649 "mon_parse.c" /* yacc.c:1646  */
+  case 232: /* value: register  */
+#line 761 "mon_parse.y"
+                { (yyval.i) = (monitor_cpu_for_memspace[reg_memspace((yyvsp[0].i))]->mon_register_get_val)(reg_memspace((yyvsp[0].i)), reg_regid((yyvsp[0].i))); }
+#line 3411 "mon_parse.c"
     break;
 
-  case 230:
-#line 758 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3655 "mon_parse.c" /* yacc.c:1646  */
+  case 233: /* d_number: D_NUMBER  */
+#line 764 "mon_parse.y"
+                   { (yyval.i) = (yyvsp[0].i); }
+#line 3417 "mon_parse.c"
     break;
 
-  case 231:
-#line 759 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3661 "mon_parse.c" /* yacc.c:1646  */
+  case 234: /* d_number: B_NUMBER_GUESS  */
+#line 765 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3423 "mon_parse.c"
     break;
 
-  case 232:
-#line 760 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3667 "mon_parse.c" /* yacc.c:1646  */
+  case 235: /* d_number: O_NUMBER_GUESS  */
+#line 766 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3429 "mon_parse.c"
     break;
 
-  case 233:
-#line 761 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3673 "mon_parse.c" /* yacc.c:1646  */
+  case 236: /* d_number: D_NUMBER_GUESS  */
+#line 767 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3435 "mon_parse.c"
     break;
 
-  case 234:
-#line 764 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(B_NUMBER,(yyvsp[0].str)); }
-#line 3679 "mon_parse.c" /* yacc.c:1646  */
+  case 237: /* guess_default: B_NUMBER_GUESS  */
+#line 770 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(B_NUMBER,(yyvsp[0].str)); }
+#line 3441 "mon_parse.c"
     break;
 
-  case 235:
-#line 765 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(O_NUMBER,(yyvsp[0].str)); }
-#line 3685 "mon_parse.c" /* yacc.c:1646  */
+  case 238: /* guess_default: O_NUMBER_GUESS  */
+#line 771 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(O_NUMBER,(yyvsp[0].str)); }
+#line 3447 "mon_parse.c"
     break;
 
-  case 236:
-#line 766 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(D_NUMBER,(yyvsp[0].str)); }
-#line 3691 "mon_parse.c" /* yacc.c:1646  */
+  case 239: /* guess_default: D_NUMBER_GUESS  */
+#line 772 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(D_NUMBER,(yyvsp[0].str)); }
+#line 3453 "mon_parse.c"
     break;
 
-  case 237:
-#line 769 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3697 "mon_parse.c" /* yacc.c:1646  */
+  case 240: /* number: H_NUMBER  */
+#line 775 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3459 "mon_parse.c"
     break;
 
-  case 238:
-#line 770 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3703 "mon_parse.c" /* yacc.c:1646  */
+  case 241: /* number: D_NUMBER  */
+#line 776 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3465 "mon_parse.c"
     break;
 
-  case 239:
-#line 771 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3709 "mon_parse.c" /* yacc.c:1646  */
+  case 242: /* number: O_NUMBER  */
+#line 777 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3471 "mon_parse.c"
     break;
 
-  case 240:
-#line 772 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3715 "mon_parse.c" /* yacc.c:1646  */
+  case 243: /* number: B_NUMBER  */
+#line 778 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3477 "mon_parse.c"
     break;
 
-  case 241:
-#line 773 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3721 "mon_parse.c" /* yacc.c:1646  */
+  case 244: /* number: guess_default  */
+#line 779 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[0].i); }
+#line 3483 "mon_parse.c"
     break;
 
-  case 245:
-#line 781 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0;
+  case 248: /* assembly_instruction: OPCODE asm_operand_mode  */
+#line 787 "mon_parse.y"
+                                              { (yyval.i) = 0;
                                                 if ((yyvsp[-1].str)) {
                                                     (monitor_cpu_for_memspace[default_memspace]->mon_assemble_instr)((yyvsp[-1].str), (yyvsp[0].mode));
                                                 } else {
@@ -3731,30 +3493,30 @@ yyreduce:
                                                 }
                                                 opt_asm = 0;
                                               }
-#line 3735 "mon_parse.c" /* yacc.c:1646  */
+#line 3497 "mon_parse.c"
     break;
 
-  case 247:
-#line 792 "mon_parse.y" /* yacc.c:1646  */
-    { asm_mode = 0; }
-#line 3741 "mon_parse.c" /* yacc.c:1646  */
+  case 250: /* post_assemble: assembly_instr_list  */
+#line 798 "mon_parse.y"
+                                   { asm_mode = 0; }
+#line 3503 "mon_parse.c"
     break;
 
-  case 248:
-#line 795 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[0].i) > 0xff) {
+  case 251: /* asm_operand_mode: ARG_IMMEDIATE number  */
+#line 801 "mon_parse.y"
+                                       { if ((yyvsp[0].i) > 0xff) {
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE_16;
                           (yyval.mode).param = (yyvsp[0].i);
                         } else {
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE;
                           (yyval.mode).param = (yyvsp[0].i);
                         } }
-#line 3753 "mon_parse.c" /* yacc.c:1646  */
+#line 3515 "mon_parse.c"
     break;
 
-  case 249:
-#line 802 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[0].i) >= 0x10000) {
+  case 252: /* asm_operand_mode: number  */
+#line 808 "mon_parse.y"
+           { if ((yyvsp[0].i) >= 0x10000) {
                (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG;
                (yyval.mode).param = (yyvsp[0].i);
              } else if ((yyvsp[0].i) < 0x100) {
@@ -3765,12 +3527,12 @@ yyreduce:
                (yyval.mode).param = (yyvsp[0].i);
              }
            }
-#line 3769 "mon_parse.c" /* yacc.c:1646  */
+#line 3531 "mon_parse.c"
     break;
 
-  case 250:
-#line 813 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) >= 0x10000) {
+  case 253: /* asm_operand_mode: number COMMA REG_X  */
+#line 819 "mon_parse.y"
+                        { if ((yyvsp[-2].i) >= 0x10000) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG_X;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else if ((yyvsp[-2].i) < 0x100) { 
@@ -3781,12 +3543,12 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3785 "mon_parse.c" /* yacc.c:1646  */
+#line 3547 "mon_parse.c"
     break;
 
-  case 251:
-#line 824 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 254: /* asm_operand_mode: number COMMA REG_Y  */
+#line 830 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ZERO_PAGE_Y;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else {
@@ -3794,12 +3556,12 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3798 "mon_parse.c" /* yacc.c:1646  */
+#line 3560 "mon_parse.c"
     break;
 
-  case 252:
-#line 832 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 255: /* asm_operand_mode: number COMMA REG_S  */
+#line 838 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else { /* 6809 */
@@ -3818,23 +3580,23 @@ yyreduce:
                             }
                           }
                         }
-#line 3822 "mon_parse.c" /* yacc.c:1646  */
+#line 3584 "mon_parse.c"
     break;
 
-  case 253:
-#line 851 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 256: /* asm_operand_mode: number COMMA number  */
+#line 857 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_DOUBLE;
                             (yyval.mode).param = (yyvsp[0].i);
                             (yyval.mode).addr_submode = (yyvsp[-2].i);
                           }
                         }
-#line 3833 "mon_parse.c" /* yacc.c:1646  */
+#line 3595 "mon_parse.c"
     break;
 
-  case 254:
-#line 857 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-1].i) < 0x100) {
+  case 257: /* asm_operand_mode: L_PAREN number R_PAREN  */
+#line 863 "mon_parse.y"
+                           { if ((yyvsp[-1].i) < 0x100) {
                                (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT;
                                (yyval.mode).param = (yyvsp[-1].i);
                              } else {
@@ -3842,12 +3604,12 @@ yyreduce:
                                (yyval.mode).param = (yyvsp[-1].i);
                              }
                            }
-#line 3846 "mon_parse.c" /* yacc.c:1646  */
+#line 3608 "mon_parse.c"
     break;
 
-  case 255:
-#line 865 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-3].i) < 0x100) {
+  case 258: /* asm_operand_mode: L_PAREN number COMMA REG_X R_PAREN  */
+#line 871 "mon_parse.y"
+                                       { if ((yyvsp[-3].i) < 0x100) {
                                            (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_X;
                                            (yyval.mode).param = (yyvsp[-3].i);
                                          } else {
@@ -3855,204 +3617,204 @@ yyreduce:
                                            (yyval.mode).param = (yyvsp[-3].i);
                                          }
                                        }
-#line 3859 "mon_parse.c" /* yacc.c:1646  */
+#line 3621 "mon_parse.c"
     break;
 
-  case 256:
-#line 874 "mon_parse.y" /* yacc.c:1646  */
+  case 259: /* asm_operand_mode: L_PAREN number COMMA REG_S R_PAREN COMMA REG_Y  */
+#line 880 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE_Y; (yyval.mode).param = (yyvsp[-5].i); }
-#line 3865 "mon_parse.c" /* yacc.c:1646  */
+#line 3627 "mon_parse.c"
     break;
 
-  case 257:
-#line 876 "mon_parse.y" /* yacc.c:1646  */
+  case 260: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_Y  */
+#line 882 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_Y; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3871 "mon_parse.c" /* yacc.c:1646  */
+#line 3633 "mon_parse.c"
     break;
 
-  case 258:
-#line 877 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_BC; }
-#line 3877 "mon_parse.c" /* yacc.c:1646  */
+  case 261: /* asm_operand_mode: L_PAREN REG_BC R_PAREN  */
+#line 883 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_BC; }
+#line 3639 "mon_parse.c"
     break;
 
-  case 259:
-#line 878 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_DE; }
-#line 3883 "mon_parse.c" /* yacc.c:1646  */
+  case 262: /* asm_operand_mode: L_PAREN REG_DE R_PAREN  */
+#line 884 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_DE; }
+#line 3645 "mon_parse.c"
     break;
 
-  case 260:
-#line 879 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_HL; }
-#line 3889 "mon_parse.c" /* yacc.c:1646  */
+  case 263: /* asm_operand_mode: L_PAREN REG_HL R_PAREN  */
+#line 885 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_HL; }
+#line 3651 "mon_parse.c"
     break;
 
-  case 261:
-#line 880 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IX; }
-#line 3895 "mon_parse.c" /* yacc.c:1646  */
+  case 264: /* asm_operand_mode: L_PAREN REG_IX R_PAREN  */
+#line 886 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IX; }
+#line 3657 "mon_parse.c"
     break;
 
-  case 262:
-#line 881 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IY; }
-#line 3901 "mon_parse.c" /* yacc.c:1646  */
+  case 265: /* asm_operand_mode: L_PAREN REG_IY R_PAREN  */
+#line 887 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IY; }
+#line 3663 "mon_parse.c"
     break;
 
-  case 263:
-#line 882 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_SP; }
-#line 3907 "mon_parse.c" /* yacc.c:1646  */
+  case 266: /* asm_operand_mode: L_PAREN REG_SP R_PAREN  */
+#line 888 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_SP; }
+#line 3669 "mon_parse.c"
     break;
 
-  case 264:
-#line 884 "mon_parse.y" /* yacc.c:1646  */
+  case 267: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_A  */
+#line 890 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_A; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3913 "mon_parse.c" /* yacc.c:1646  */
+#line 3675 "mon_parse.c"
     break;
 
-  case 265:
-#line 886 "mon_parse.y" /* yacc.c:1646  */
+  case 268: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_HL  */
+#line 892 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_HL; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3919 "mon_parse.c" /* yacc.c:1646  */
+#line 3681 "mon_parse.c"
     break;
 
-  case 266:
-#line 888 "mon_parse.y" /* yacc.c:1646  */
+  case 269: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_IX  */
+#line 894 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IX; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3925 "mon_parse.c" /* yacc.c:1646  */
+#line 3687 "mon_parse.c"
     break;
 
-  case 267:
-#line 890 "mon_parse.y" /* yacc.c:1646  */
+  case 270: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_IY  */
+#line 896 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IY; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3931 "mon_parse.c" /* yacc.c:1646  */
+#line 3693 "mon_parse.c"
     break;
 
-  case 268:
-#line 891 "mon_parse.y" /* yacc.c:1646  */
+  case 271: /* asm_operand_mode: %empty  */
+#line 897 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_IMPLIED; }
-#line 3937 "mon_parse.c" /* yacc.c:1646  */
+#line 3699 "mon_parse.c"
     break;
 
-  case 269:
-#line 892 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_ACCUMULATOR; }
-#line 3943 "mon_parse.c" /* yacc.c:1646  */
+  case 272: /* asm_operand_mode: REG_A  */
+#line 898 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_ACCUMULATOR; }
+#line 3705 "mon_parse.c"
     break;
 
-  case 270:
-#line 893 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_B; }
-#line 3949 "mon_parse.c" /* yacc.c:1646  */
+  case 273: /* asm_operand_mode: REG_B  */
+#line 899 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_B; }
+#line 3711 "mon_parse.c"
     break;
 
-  case 271:
-#line 894 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_C; }
-#line 3955 "mon_parse.c" /* yacc.c:1646  */
+  case 274: /* asm_operand_mode: REG_C  */
+#line 900 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_C; }
+#line 3717 "mon_parse.c"
     break;
 
-  case 272:
-#line 895 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_D; }
-#line 3961 "mon_parse.c" /* yacc.c:1646  */
+  case 275: /* asm_operand_mode: REG_D  */
+#line 901 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_D; }
+#line 3723 "mon_parse.c"
     break;
 
-  case 273:
-#line 896 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_E; }
-#line 3967 "mon_parse.c" /* yacc.c:1646  */
+  case 276: /* asm_operand_mode: REG_E  */
+#line 902 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_E; }
+#line 3729 "mon_parse.c"
     break;
 
-  case 274:
-#line 897 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_H; }
-#line 3973 "mon_parse.c" /* yacc.c:1646  */
+  case 277: /* asm_operand_mode: REG_H  */
+#line 903 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_H; }
+#line 3735 "mon_parse.c"
     break;
 
-  case 275:
-#line 898 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXH; }
-#line 3979 "mon_parse.c" /* yacc.c:1646  */
+  case 278: /* asm_operand_mode: REG_IXH  */
+#line 904 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXH; }
+#line 3741 "mon_parse.c"
     break;
 
-  case 276:
-#line 899 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYH; }
-#line 3985 "mon_parse.c" /* yacc.c:1646  */
+  case 279: /* asm_operand_mode: REG_IYH  */
+#line 905 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYH; }
+#line 3747 "mon_parse.c"
     break;
 
-  case 277:
-#line 900 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_L; }
-#line 3991 "mon_parse.c" /* yacc.c:1646  */
+  case 280: /* asm_operand_mode: REG_L  */
+#line 906 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_L; }
+#line 3753 "mon_parse.c"
     break;
 
-  case 278:
-#line 901 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXL; }
-#line 3997 "mon_parse.c" /* yacc.c:1646  */
+  case 281: /* asm_operand_mode: REG_IXL  */
+#line 907 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXL; }
+#line 3759 "mon_parse.c"
     break;
 
-  case 279:
-#line 902 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYL; }
-#line 4003 "mon_parse.c" /* yacc.c:1646  */
+  case 282: /* asm_operand_mode: REG_IYL  */
+#line 908 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYL; }
+#line 3765 "mon_parse.c"
     break;
 
-  case 280:
-#line 903 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_AF; }
-#line 4009 "mon_parse.c" /* yacc.c:1646  */
+  case 283: /* asm_operand_mode: REG_AF  */
+#line 909 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_AF; }
+#line 3771 "mon_parse.c"
     break;
 
-  case 281:
-#line 904 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_BC; }
-#line 4015 "mon_parse.c" /* yacc.c:1646  */
+  case 284: /* asm_operand_mode: REG_BC  */
+#line 910 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_BC; }
+#line 3777 "mon_parse.c"
     break;
 
-  case 282:
-#line 905 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_DE; }
-#line 4021 "mon_parse.c" /* yacc.c:1646  */
+  case 285: /* asm_operand_mode: REG_DE  */
+#line 911 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_DE; }
+#line 3783 "mon_parse.c"
     break;
 
-  case 283:
-#line 906 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_HL; }
-#line 4027 "mon_parse.c" /* yacc.c:1646  */
+  case 286: /* asm_operand_mode: REG_HL  */
+#line 912 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_HL; }
+#line 3789 "mon_parse.c"
     break;
 
-  case 284:
-#line 907 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IX; }
-#line 4033 "mon_parse.c" /* yacc.c:1646  */
+  case 287: /* asm_operand_mode: REG_IX  */
+#line 913 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IX; }
+#line 3795 "mon_parse.c"
     break;
 
-  case 285:
-#line 908 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IY; }
-#line 4039 "mon_parse.c" /* yacc.c:1646  */
+  case 288: /* asm_operand_mode: REG_IY  */
+#line 914 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IY; }
+#line 3801 "mon_parse.c"
     break;
 
-  case 286:
-#line 909 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_SP; }
-#line 4045 "mon_parse.c" /* yacc.c:1646  */
+  case 289: /* asm_operand_mode: REG_SP  */
+#line 915 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_SP; }
+#line 3807 "mon_parse.c"
     break;
 
-  case 287:
-#line 911 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_DIRECT; (yyval.mode).param = (yyvsp[0].i); }
-#line 4051 "mon_parse.c" /* yacc.c:1646  */
+  case 290: /* asm_operand_mode: LESS_THAN number  */
+#line 917 "mon_parse.y"
+                     { (yyval.mode).addr_mode = ASM_ADDR_MODE_DIRECT; (yyval.mode).param = (yyvsp[0].i); }
+#line 3813 "mon_parse.c"
     break;
 
-  case 288:
-#line 912 "mon_parse.y" /* yacc.c:1646  */
-    {    /* Clash with addr,x addr,y addr,s modes! */
+  case 291: /* asm_operand_mode: number COMMA index_ureg  */
+#line 918 "mon_parse.y"
+                            {    /* Clash with addr,x addr,y addr,s modes! */
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-2].i) >= -16 && (yyvsp[-2].i) < 16) {
             (yyval.mode).addr_submode = (3 << 5) | ((yyvsp[-2].i) & 0x1F);
@@ -4067,84 +3829,84 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4071 "mon_parse.c" /* yacc.c:1646  */
+#line 3833 "mon_parse.c"
     break;
 
-  case 289:
-#line 927 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 292: /* asm_operand_mode: COMMA index_reg PLUS  */
+#line 933 "mon_parse.y"
+                         {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4080 "mon_parse.c" /* yacc.c:1646  */
+#line 3842 "mon_parse.c"
     break;
 
-  case 290:
-#line 931 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 293: /* asm_operand_mode: COMMA index_reg PLUS PLUS  */
+#line 937 "mon_parse.y"
+                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4089 "mon_parse.c" /* yacc.c:1646  */
+#line 3851 "mon_parse.c"
     break;
 
-  case 291:
-#line 935 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 294: /* asm_operand_mode: COMMA MINUS index_reg  */
+#line 941 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4098 "mon_parse.c" /* yacc.c:1646  */
+#line 3860 "mon_parse.c"
     break;
 
-  case 292:
-#line 939 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 295: /* asm_operand_mode: COMMA MINUS MINUS index_reg  */
+#line 945 "mon_parse.y"
+                                {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4107 "mon_parse.c" /* yacc.c:1646  */
+#line 3869 "mon_parse.c"
     break;
 
-  case 293:
-#line 943 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 296: /* asm_operand_mode: COMMA index_reg  */
+#line 949 "mon_parse.y"
+                    {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4116 "mon_parse.c" /* yacc.c:1646  */
+#line 3878 "mon_parse.c"
     break;
 
-  case 294:
-#line 947 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 297: /* asm_operand_mode: REG_B COMMA index_reg  */
+#line 953 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4125 "mon_parse.c" /* yacc.c:1646  */
+#line 3887 "mon_parse.c"
     break;
 
-  case 295:
-#line 951 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 298: /* asm_operand_mode: REG_A COMMA index_reg  */
+#line 957 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4134 "mon_parse.c" /* yacc.c:1646  */
+#line 3896 "mon_parse.c"
     break;
 
-  case 296:
-#line 955 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 299: /* asm_operand_mode: REG_D COMMA index_reg  */
+#line 961 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4143 "mon_parse.c" /* yacc.c:1646  */
+#line 3905 "mon_parse.c"
     break;
 
-  case 297:
-#line 959 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 300: /* asm_operand_mode: number COMMA REG_PC  */
+#line 965 "mon_parse.y"
+                        {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-2].i);
         if ((yyvsp[-2].i) >= -128 && (yyvsp[-2].i) < 128) {
@@ -4156,12 +3918,12 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4160 "mon_parse.c" /* yacc.c:1646  */
+#line 3922 "mon_parse.c"
     break;
 
-  case 298:
-#line 971 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 301: /* asm_operand_mode: L_BRACKET number COMMA index_reg R_BRACKET  */
+#line 977 "mon_parse.y"
+                                               {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-3].i) >= -16 && (yyvsp[-3].i) < 16) {
             (yyval.mode).addr_submode = (yyvsp[-3].i) & 0x1F;
@@ -4176,84 +3938,84 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4180 "mon_parse.c" /* yacc.c:1646  */
+#line 3942 "mon_parse.c"
     break;
 
-  case 299:
-#line 986 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 302: /* asm_operand_mode: L_BRACKET COMMA index_reg PLUS R_BRACKET  */
+#line 992 "mon_parse.y"
+                                             {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4189 "mon_parse.c" /* yacc.c:1646  */
+#line 3951 "mon_parse.c"
     break;
 
-  case 300:
-#line 990 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 303: /* asm_operand_mode: L_BRACKET COMMA index_reg PLUS PLUS R_BRACKET  */
+#line 996 "mon_parse.y"
+                                                  {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-3].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4198 "mon_parse.c" /* yacc.c:1646  */
+#line 3960 "mon_parse.c"
     break;
 
-  case 301:
-#line 994 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 304: /* asm_operand_mode: L_BRACKET COMMA MINUS index_reg R_BRACKET  */
+#line 1000 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4207 "mon_parse.c" /* yacc.c:1646  */
+#line 3969 "mon_parse.c"
     break;
 
-  case 302:
-#line 998 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 305: /* asm_operand_mode: L_BRACKET COMMA MINUS MINUS index_reg R_BRACKET  */
+#line 1004 "mon_parse.y"
+                                                    {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4216 "mon_parse.c" /* yacc.c:1646  */
+#line 3978 "mon_parse.c"
     break;
 
-  case 303:
-#line 1002 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 306: /* asm_operand_mode: L_BRACKET COMMA index_reg R_BRACKET  */
+#line 1008 "mon_parse.y"
+                                        {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4225 "mon_parse.c" /* yacc.c:1646  */
+#line 3987 "mon_parse.c"
     break;
 
-  case 304:
-#line 1006 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 307: /* asm_operand_mode: L_BRACKET REG_B COMMA index_reg R_BRACKET  */
+#line 1012 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4234 "mon_parse.c" /* yacc.c:1646  */
+#line 3996 "mon_parse.c"
     break;
 
-  case 305:
-#line 1010 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 308: /* asm_operand_mode: L_BRACKET REG_A COMMA index_reg R_BRACKET  */
+#line 1016 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4243 "mon_parse.c" /* yacc.c:1646  */
+#line 4005 "mon_parse.c"
     break;
 
-  case 306:
-#line 1014 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 309: /* asm_operand_mode: L_BRACKET REG_D COMMA index_reg R_BRACKET  */
+#line 1020 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4252 "mon_parse.c" /* yacc.c:1646  */
+#line 4014 "mon_parse.c"
     break;
 
-  case 307:
-#line 1018 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 310: /* asm_operand_mode: L_BRACKET number COMMA REG_PC R_BRACKET  */
+#line 1024 "mon_parse.y"
+                                            {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-3].i);
         if ((yyvsp[-3].i) >= -128 && (yyvsp[-3].i) < 128) {
@@ -4265,60 +4027,61 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4269 "mon_parse.c" /* yacc.c:1646  */
+#line 4031 "mon_parse.c"
     break;
 
-  case 308:
-#line 1030 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 311: /* asm_operand_mode: L_BRACKET number R_BRACKET  */
+#line 1036 "mon_parse.y"
+                               {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | ASM_ADDR_MODE_EXTENDED_INDIRECT;
         (yyval.mode).param = (yyvsp[-1].i);
         }
-#line 4279 "mon_parse.c" /* yacc.c:1646  */
+#line 4041 "mon_parse.c"
     break;
 
-  case 309:
-#line 1035 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 312: /* asm_operand_mode: L_BRACKET number R_BRACKET COMMA REG_Y  */
+#line 1041 "mon_parse.y"
+                                           {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_LONG_Y;
         (yyval.mode).param = (yyvsp[-3].i);
         }
-#line 4288 "mon_parse.c" /* yacc.c:1646  */
+#line 4050 "mon_parse.c"
     break;
 
-  case 310:
-#line 1043 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (0 << 5); printf("reg_x\n"); }
-#line 4294 "mon_parse.c" /* yacc.c:1646  */
+  case 313: /* index_reg: REG_X  */
+#line 1049 "mon_parse.y"
+          { (yyval.i) = (0 << 5); printf("reg_x\n"); }
+#line 4056 "mon_parse.c"
     break;
 
-  case 311:
-#line 1044 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (1 << 5); printf("reg_y\n"); }
-#line 4300 "mon_parse.c" /* yacc.c:1646  */
+  case 314: /* index_reg: REG_Y  */
+#line 1050 "mon_parse.y"
+          { (yyval.i) = (1 << 5); printf("reg_y\n"); }
+#line 4062 "mon_parse.c"
     break;
 
-  case 312:
-#line 1045 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 4306 "mon_parse.c" /* yacc.c:1646  */
+  case 315: /* index_reg: index_ureg  */
+#line 1051 "mon_parse.y"
+               { (yyval.i) = (yyvsp[0].i); }
+#line 4068 "mon_parse.c"
     break;
 
-  case 313:
-#line 1046 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (3 << 5); printf("reg_s\n"); }
-#line 4312 "mon_parse.c" /* yacc.c:1646  */
+  case 316: /* index_reg: REG_S  */
+#line 1052 "mon_parse.y"
+          { (yyval.i) = (3 << 5); printf("reg_s\n"); }
+#line 4074 "mon_parse.c"
     break;
 
-  case 314:
-#line 1050 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (2 << 5); printf("reg_u\n"); }
-#line 4318 "mon_parse.c" /* yacc.c:1646  */
+  case 317: /* index_ureg: REG_U  */
+#line 1056 "mon_parse.y"
+          { (yyval.i) = (2 << 5); printf("reg_u\n"); }
+#line 4080 "mon_parse.c"
     break;
 
 
-#line 4322 "mon_parse.c" /* yacc.c:1646  */
+#line 4084 "mon_parse.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4332,25 +4095,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -4361,50 +4122,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -4433,12 +4158,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -4455,13 +4179,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4475,7 +4200,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4487,7 +4212,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4498,26 +4223,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -4533,20 +4262,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 1054 "mon_parse.y" /* yacc.c:1906  */
+
+#line 1060 "mon_parse.y"
 
 
 void parse_and_execute_line(char *input)
@@ -80,6 +80,7 @@
 #include "monitor.h"
 #include "monitor_network.h"
 #include "montypes.h"
+#include "profile.h"
 #include "resources.h"
 #include "screenshot.h"
 #include "sysfile.h"
@@ -1009,6 +1010,59 @@ void mon_stopwatch_reset(void)
     mon_out("Stopwatch reset to 0.\n");
 }
 
+/* Average host time per frame of each section, over the frames recorded
+   since the last reset.  */
+void mon_profile_show(void)
+{
+    profile_frame_t total;
+    unsigned int frames, i;
+
+    if (!profile_enabled()) {
+        mon_out("Built without VICE_PROFILE.\n");
+        return;
+    }
+    frames = profile_frames_sum(PROFILE_FRAMES, &total);
+    if (frames == 0) {
+        mon_out("No frames profiled yet.\n");
+        return;
+    }
+
+    mon_out("Host time per frame over the last %u frames: %.3f ms\n",
+            frames, total.wall_ns / 1e6 / frames);
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        mon_out("  %-12s %8.3f ms %5.1f%% %8lu calls\n",
+                profile_section_name((profile_section_t)i),
+                total.ns[i] / 1e6 / frames,
+                total.wall_ns ? 100.0 * total.ns[i] / total.wall_ns : 0.0,
+                total.calls[i] / frames);
+    }
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        mon_out("  %-12s %8lu\n", profile_counter_name((profile_counter_t)i),
+                total.counts[i] / frames);
+    }
+}
+
+void mon_profile_reset(void)
+{
+    if (!profile_enabled()) {
+        mon_out("Built without VICE_PROFILE.\n");
+        return;
+    }
+    profile_reset();
+    mon_out("Profile reset.\n");
+}
+
+void mon_profile_dump(const char *filename)
+{
+    if (!profile_enabled()) {
+        mon_out("Built without VICE_PROFILE.\n");
+    } else if (profile_dump_csv(filename) < 0) {
+        mon_out("Cannot write `%s'.\n", filename);
+    } else {
+        mon_out("%u frames written to `%s'.\n", profile_frames(), filename);
+    }
+}
+
 /* Local helper functions for building the lists */
 static monitor_cpu_type_t* find_monitor_cpu_type(CPU_TYPE_t cputype)
 {
@@ -304,6 +304,10 @@ extern void mon_export(void);
 
 extern void mon_stopwatch_show(const char* prefix, const char* suffix);
 extern void mon_stopwatch_reset(void);
+
+extern void mon_profile_show(void);
+extern void mon_profile_reset(void);
+extern void mon_profile_dump(const char *filename);
 extern void mon_maincpu_toggle_trace(int state);
 
 #endif
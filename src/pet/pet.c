@@ -892,6 +892,17 @@ int machine_read_snapshot(const char *name, int event_mode)
     return pet_snapshot_read(name, event_mode);
 }
 
+/* Memory snapshots are only done for the C64 so far.  */
+int machine_write_snapshot_memory(struct snapshot_memory_s *mem, const struct snapshot_memory_s *base)
+{
+    return -1;
+}
+
+int machine_read_snapshot_memory(struct snapshot_memory_s *mem)
+{
+    return -1;
+}
+
 
 /* ------------------------------------------------------------------------- */
 
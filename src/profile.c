@@ -0,0 +1,400 @@
+/*
+ * profile.c - Host time accounting for the emulator hot paths.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef VICE_PROFILE
+#include <pthread.h>
+#endif
+
+#include "profile.h"
+#include "types.h"
+#include "vsyncapi.h"
+
+/* Deepest nesting of sections we keep track of; enter calls beyond that
+   are charged to the innermost tracked section.  */
+#define PROFILE_STACK_DEPTH 16
+
+typedef struct profile_total_s {
+    uint64_t ns;
+    unsigned long calls;
+} profile_total_t;
+
+static const char *section_names[PROFILE_NUM_SECTIONS] = {
+    "maincpu",
+    "vicii-draw",
+    "sid",
+    "sound-flush",
+    "drivecpu",
+    "render",
+    "present",
+    "vsync"
+};
+
+static const char *counter_names[PROFILE_NUM_COUNTERS] = {
+    "cycles",
+    "alarms",
+    "drive-cycles",
+    "drive-alarms"
+};
+
+unsigned long profile_counts[PROFILE_NUM_COUNTERS];
+
+static profile_total_t counters[PROFILE_NUM_SECTIONS];
+static profile_section_t stack[PROFILE_STACK_DEPTH];
+static int stack_depth = 1;
+static int stack_overflow = 0;
+static uint64_t last_ns = 0;
+
+/* What helper threads charged with profile_add(), only ever changed
+   atomically.  */
+static profile_total_t thread_counters[PROFILE_NUM_SECTIONS];
+
+#ifdef VICE_PROFILE
+static pthread_t owner;
+
+/* The frame records, `ring_next' is where the next one goes.  */
+static profile_frame_t ring[PROFILE_FRAMES];
+static unsigned int ring_next = 0;
+static unsigned int ring_used = 0;
+
+/* The totals when the current frame started.  */
+static profile_total_t frame_start[PROFILE_NUM_SECTIONS];
+static unsigned long frame_start_counts[PROFILE_NUM_COUNTERS];
+static uint64_t frame_start_ns = 0;
+static CLOCK frame_start_clk = 0;
+static int frame_started = 0;
+static unsigned long frame_number = 0;
+
+static profile_overlay_t overlay = NULL;
+static unsigned int overlay_frames = 0;
+#endif
+
+uint64_t profile_now_ns(void)
+{
+#if defined(CLOCK_MONOTONIC) && !defined(PSVITA)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#else
+    return (uint64_t)vsyncarch_gettime() * 1000000000 / vsyncarch_frequency();
+#endif
+}
+
+#ifdef VICE_PROFILE
+void profile_enter(profile_section_t section)
+{
+    uint64_t now;
+
+    if (!pthread_equal(pthread_self(), owner)) {
+        return;
+    }
+    now = profile_now_ns();
+
+    counters[stack[stack_depth - 1]].ns += now - last_ns;
+    last_ns = now;
+
+    if (stack_depth < PROFILE_STACK_DEPTH) {
+        stack[stack_depth++] = section;
+    } else {
+        stack_overflow++;
+    }
+}
+
+void profile_leave(void)
+{
+    uint64_t now;
+
+    if (!pthread_equal(pthread_self(), owner)) {
+        return;
+    }
+    now = profile_now_ns();
+
+    if (stack_overflow > 0) {
+        stack_overflow--;
+        return;
+    }
+
+    if (stack_depth > 1) {
+        profile_section_t section = stack[--stack_depth];
+
+        counters[section].ns += now - last_ns;
+        counters[section].calls++;
+    }
+    last_ns = now;
+}
+
+void profile_add(profile_section_t section, uint64_t ns)
+{
+    __atomic_fetch_add(&thread_counters[section].ns, ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&thread_counters[section].calls, 1, __ATOMIC_RELAXED);
+}
+
+static void overlay_update(void)
+{
+    profile_frame_t total;
+    char text[256];
+    unsigned int frames, i;
+    size_t len;
+
+    frames = profile_frames_sum(PROFILE_OVERLAY_FRAMES, &total);
+    if (frames == 0) {
+        return;
+    }
+
+    len = (size_t)snprintf(text, sizeof(text), "ms/frame %.2f:",
+                           total.wall_ns / 1e6 / frames);
+    /* leave out what takes less than 5 us a frame */
+    for (i = 0; i < PROFILE_NUM_SECTIONS && len < sizeof(text); i++) {
+        if (total.ns[i] >= 5000 * (uint64_t)frames) {
+            len += (size_t)snprintf(text + len, sizeof(text) - len, " %s %.2f",
+                                    section_names[i], total.ns[i] / 1e6 / frames);
+        }
+    }
+    overlay(text);
+}
+
+void profile_frame_end(CLOCK clk)
+{
+    uint64_t now = profile_now_ns();
+    profile_frame_t *frame;
+    profile_total_t totals[PROFILE_NUM_SECTIONS];
+    unsigned long counts[PROFILE_NUM_COUNTERS];
+    unsigned int i;
+
+    /* Charge what the open sections did so far to this frame.  */
+    counters[stack[stack_depth - 1]].ns += now - last_ns;
+    last_ns = now;
+
+    if (frame_started) {
+        /* across a clock overflow the cycles of the frame are lost */
+        if (clk > frame_start_clk) {
+            PROFILE_COUNT(PROFILE_COUNT_CYCLES, clk - frame_start_clk);
+        }
+    }
+
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        totals[i].ns = profile_section_ns((profile_section_t)i);
+        totals[i].calls = profile_section_calls((profile_section_t)i);
+    }
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        counts[i] = __atomic_load_n(&profile_counts[i], __ATOMIC_RELAXED);
+    }
+
+    if (frame_started) {
+        frame = &ring[ring_next];
+        frame->frame = frame_number++;
+        frame->wall_ns = now - frame_start_ns;
+        for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+            frame->ns[i] = totals[i].ns - frame_start[i].ns;
+            frame->calls[i] = totals[i].calls - frame_start[i].calls;
+        }
+        for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+            frame->counts[i] = counts[i] - frame_start_counts[i];
+        }
+        ring_next = (ring_next + 1) % PROFILE_FRAMES;
+        if (ring_used < PROFILE_FRAMES) {
+            ring_used++;
+        }
+
+        if (overlay != NULL && ++overlay_frames >= PROFILE_OVERLAY_FRAMES) {
+            overlay_frames = 0;
+            overlay_update();
+        }
+    }
+
+    memcpy(frame_start, totals, sizeof(frame_start));
+    memcpy(frame_start_counts, counts, sizeof(frame_start_counts));
+    frame_start_ns = now;
+    frame_start_clk = clk;
+    frame_started = 1;
+}
+#endif
+
+int profile_enabled(void)
+{
+#ifdef VICE_PROFILE
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Clear all counters.  Sections currently entered stay on the stack, so
+   this may be called from inside a profiled section.  */
+void profile_reset(void)
+{
+    unsigned int i;
+
+    memset(counters, 0, sizeof(counters));
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        __atomic_store_n(&thread_counters[i].ns, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&thread_counters[i].calls, 0, __ATOMIC_RELAXED);
+    }
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        __atomic_store_n(&profile_counts[i], 0, __ATOMIC_RELAXED);
+    }
+    stack[0] = PROFILE_MAINCPU;
+    last_ns = profile_now_ns();
+
+#ifdef VICE_PROFILE
+    owner = pthread_self();
+
+    /* The frame that is going on is recorded from here on.  */
+    memset(frame_start, 0, sizeof(frame_start));
+    memset(frame_start_counts, 0, sizeof(frame_start_counts));
+    frame_start_ns = last_ns;
+    frame_number = 0;
+    ring_next = 0;
+    ring_used = 0;
+    overlay_frames = 0;
+#endif
+}
+
+const char *profile_section_name(profile_section_t section)
+{
+    return section_names[section];
+}
+
+uint64_t profile_section_ns(profile_section_t section)
+{
+    return counters[section].ns + profile_section_thread_ns(section);
+}
+
+unsigned long profile_section_calls(profile_section_t section)
+{
+    return counters[section].calls
+           + __atomic_load_n(&thread_counters[section].calls, __ATOMIC_RELAXED);
+}
+
+uint64_t profile_section_thread_ns(profile_section_t section)
+{
+    return __atomic_load_n(&thread_counters[section].ns, __ATOMIC_RELAXED);
+}
+
+const char *profile_counter_name(profile_counter_t counter)
+{
+    return counter_names[counter];
+}
+
+unsigned long profile_counter_value(profile_counter_t counter)
+{
+    return __atomic_load_n(&profile_counts[counter], __ATOMIC_RELAXED);
+}
+
+unsigned int profile_frames(void)
+{
+#ifdef VICE_PROFILE
+    return ring_used;
+#else
+    return 0;
+#endif
+}
+
+int profile_frame_get(unsigned int age, profile_frame_t *frame)
+{
+#ifdef VICE_PROFILE
+    if (age >= ring_used) {
+        return -1;
+    }
+    *frame = ring[(ring_next + PROFILE_FRAMES - 1 - age) % PROFILE_FRAMES];
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/* `frame' of the total is the number of the newest frame.  */
+unsigned int profile_frames_sum(unsigned int count, profile_frame_t *total)
+{
+    profile_frame_t frame;
+    unsigned int age, i;
+
+    memset(total, 0, sizeof(*total));
+    for (age = 0; age < count && profile_frame_get(age, &frame) == 0; age++) {
+        if (age == 0) {
+            total->frame = frame.frame;
+        }
+        total->wall_ns += frame.wall_ns;
+        for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+            total->ns[i] += frame.ns[i];
+            total->calls[i] += frame.calls[i];
+        }
+        for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+            total->counts[i] += frame.counts[i];
+        }
+    }
+    return age;
+}
+
+int profile_dump_csv(const char *filename)
+{
+    profile_frame_t frame;
+    unsigned int age, i;
+    FILE *f;
+
+    if (!profile_enabled()) {
+        return -1;
+    }
+
+    f = fopen(filename, "w");
+    if (f == NULL) {
+        return -1;
+    }
+
+    fprintf(f, "frame,wall_ns");
+    for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+        fprintf(f, ",%s_ns,%s_calls", section_names[i], section_names[i]);
+    }
+    for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+        fprintf(f, ",%s", counter_names[i]);
+    }
+    fprintf(f, "\n");
+
+    for (age = profile_frames(); age-- > 0;) {
+        profile_frame_get(age, &frame);
+        fprintf(f, "%lu,%llu", frame.frame, (unsigned long long)frame.wall_ns);
+        for (i = 0; i < PROFILE_NUM_SECTIONS; i++) {
+            fprintf(f, ",%llu,%lu", (unsigned long long)frame.ns[i], frame.calls[i]);
+        }
+        for (i = 0; i < PROFILE_NUM_COUNTERS; i++) {
+            fprintf(f, ",%lu", frame.counts[i]);
+        }
+        fprintf(f, "\n");
+    }
+
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+void profile_set_overlay(profile_overlay_t callback)
+{
+#ifdef VICE_PROFILE
+    overlay = callback;
+    overlay_frames = 0;
+#endif
+}
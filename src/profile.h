@@ -0,0 +1,131 @@
+/*
+ * profile.h - Host time accounting for the emulator hot paths.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_PROFILE_H
+#define VICE_PROFILE_H
+
+#include "types.h"
+
+/* Sections are accounted exclusively: time spent in a nested section is
+   not charged to the enclosing one.  Everything outside of any other
+   section is charged to PROFILE_MAINCPU.  Only the thread that called
+   profile_reset() last is accounted, sections entered by presenter and
+   other helper threads are ignored.  A helper thread that runs a part of
+   the emulation, the drive thread, charges its time with PROFILE_ADD()
+   instead; that time overlaps the time of the accounted thread.  */
+typedef enum profile_section_e {
+    PROFILE_MAINCPU = 0,
+    PROFILE_VICII_DRAW,
+    PROFILE_SID,
+    PROFILE_SOUND_FLUSH,
+    PROFILE_DRIVECPU,
+    PROFILE_RENDER,
+    PROFILE_PRESENT,
+    PROFILE_VSYNC,
+    PROFILE_NUM_SECTIONS
+} profile_section_t;
+
+/* Events that are counted, not timed.  */
+typedef enum profile_counter_e {
+    PROFILE_COUNT_CYCLES = 0,
+    PROFILE_COUNT_ALARMS,
+    PROFILE_COUNT_DRIVE_CYCLES,
+    PROFILE_COUNT_DRIVE_ALARMS,
+    PROFILE_NUM_COUNTERS
+} profile_counter_t;
+
+/* Number of frames kept in the ring of frame records.  */
+#define PROFILE_FRAMES 256
+
+/* Frames the overlay text is averaged over.  */
+#define PROFILE_OVERLAY_FRAMES 50
+
+/* What one emulated frame cost.  `wall_ns' is the host time since the
+   frame before ended.  */
+typedef struct profile_frame_s {
+    unsigned long frame;
+    uint64_t wall_ns;
+    uint64_t ns[PROFILE_NUM_SECTIONS];
+    unsigned long calls[PROFILE_NUM_SECTIONS];
+    unsigned long counts[PROFILE_NUM_COUNTERS];
+} profile_frame_t;
+
+/* Gets a line of text with the average time of each section per frame.  */
+typedef void (*profile_overlay_t)(const char *text);
+
+/* PROFILE_COUNT() adds to a counter, from any thread.  PROFILE_ADD()
+   charges `ns' and one call to `section' from a helper thread.
+   PROFILE_FRAME_END() closes the
+   record of the current frame, `clk' is the main CPU clock; vsync_do_vsync()
+   does that once per frame.  Without VICE_PROFILE they are all gone.  */
+#ifdef VICE_PROFILE
+extern void profile_enter(profile_section_t section);
+extern void profile_leave(void);
+extern void profile_add(profile_section_t section, uint64_t ns);
+extern void profile_frame_end(CLOCK clk);
+extern unsigned long profile_counts[PROFILE_NUM_COUNTERS];
+
+#define PROFILE_ENTER(section)    profile_enter(section)
+#define PROFILE_LEAVE()           profile_leave()
+#define PROFILE_COUNT(counter, n) __atomic_fetch_add(&profile_counts[counter], (unsigned long)(n), __ATOMIC_RELAXED)
+#define PROFILE_ADD(section, ns)  profile_add(section, ns)
+#define PROFILE_FRAME_END(clk)    profile_frame_end(clk)
+#else
+#define PROFILE_ENTER(section)
+#define PROFILE_LEAVE()
+#define PROFILE_COUNT(counter, n)
+#define PROFILE_ADD(section, ns)
+#define PROFILE_FRAME_END(clk)
+#endif
+
+extern void profile_reset(void);
+extern int profile_enabled(void);
+extern const char *profile_section_name(profile_section_t section);
+extern uint64_t profile_section_ns(profile_section_t section);
+extern unsigned long profile_section_calls(profile_section_t section);
+
+/* The part of profile_section_ns() that was charged by helper threads.  */
+extern uint64_t profile_section_thread_ns(profile_section_t section);
+extern uint64_t profile_now_ns(void);
+
+extern const char *profile_counter_name(profile_counter_t counter);
+extern unsigned long profile_counter_value(profile_counter_t counter);
+
+/* Number of frame records kept, at most PROFILE_FRAMES.  */
+extern unsigned int profile_frames(void);
+
+/* The frame record `age' frames back, 0 is the last complete frame.
+   Returns -1 if there is no such record.  */
+extern int profile_frame_get(unsigned int age, profile_frame_t *frame);
+
+/* Sum up the last `count' frame records into `total', returns how many
+   there were.  */
+extern unsigned int profile_frames_sum(unsigned int count, profile_frame_t *total);
+
+/* Write the frame records oldest first as CSV.  */
+extern int profile_dump_csv(const char *filename);
+
+/* Call `overlay' every PROFILE_OVERLAY_FRAMES frames, NULL turns it off.  */
+extern void profile_set_overlay(profile_overlay_t overlay);
+
+#endif
@@ -32,6 +32,28 @@
 
 #include "types.h"
 
+/* Compare `length' bytes eight at a time, returns the offset of the first
+   byte that differs, or `length' if there is none.  */
+inline static unsigned int raster_cache_data_diff(const uint8_t *a,
+                                                  const uint8_t *b,
+                                                  const unsigned int length)
+{
+    unsigned int i;
+    uint64_t wa, wb;
+
+    for (i = 0; i + 8 <= length; i += 8) {
+        memcpy(&wa, a + i, 8);
+        memcpy(&wb, b + i, 8);
+        if (wa != wb) {
+            break;
+        }
+    }
+    for (; i < length && a[i] == b[i]; i++) {
+        /* do nothing */
+    }
+    return i;
+}
+
 inline static int raster_cache_data_fill(uint8_t *dest,
                                          const uint8_t *src,
                                          const unsigned int length,
@@ -47,24 +69,7 @@ inline static int raster_cache_data_fill(uint8_t *dest,
     } else {
         unsigned int x = 0, i;
 
-#if defined(ALLOW_UNALIGNED_ACCESS)
-        for (i = 0; i < (length & ~3) && *((uint32_t *)(dest + i)) == *((uint32_t *)(src + i)); i += 4) {
-            /* do nothing */
-        }
-        if (i == length) {
-            return 0;
-        }
-        if (i < (length & ~1) && *((uint16_t *)(dest + i)) == *((uint16_t *)(src + i))) {
-            i += 2;
-        }
-        if (i < length && dest[i] == src[i]) {
-            i++;
-        }
-#else
-        for (i = 0; i < length && dest[i] == src[i]; i++) {
-            /* do nothing */
-        }
-#endif
+        i = raster_cache_data_diff(dest, src, length);
         if (i < length) {
             if (*xs > i) {
                 *xs = i;
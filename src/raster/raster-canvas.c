@@ -39,6 +39,22 @@
 #include "viewport.h"
 
 
+/* Forget the changes collected since the last refresh.  */
+static void clear_area(raster_canvas_area_t *area)
+{
+    unsigned int y;
+
+    if (area->is_null) {
+        return;
+    }
+
+    for (y = area->ys; y <= area->ye && y < area->num_lines; y++) {
+        area->lines[y].xs = 1;
+        area->lines[y].xe = 0;
+    }
+    area->is_null = 1;
+}
+
 inline static void refresh_canvas(raster_t *raster)
 {
     raster_canvas_area_t *update_area;
@@ -97,12 +113,14 @@ inline static void refresh_canvas(raster_t *raster)
 
     if ((int)(raster->canvas->draw_buffer->canvas_height) >= yy
         && (int)(raster->canvas->draw_buffer->canvas_width) >= xx) {
+        raster->canvas->draw_buffer->dirty_lines = update_area->lines;
         video_canvas_refresh(raster->canvas, x, y, xx, yy,
                              MIN(w, (int)(raster->canvas->draw_buffer->canvas_width - xx)),
                              MIN(h, (int)(raster->canvas->draw_buffer->canvas_height - yy)));
+        raster->canvas->draw_buffer->dirty_lines = NULL;
     }
 
-    update_area->is_null = 1;
+    clear_area(update_area);
 }
 
 void raster_canvas_handle_end_of_frame(raster_t *raster)
@@ -121,6 +139,7 @@ void raster_canvas_handle_end_of_frame(raster_t *raster)
 
     if (raster->dont_cache) {
         video_canvas_refresh_all(raster->canvas);
+        clear_area(raster->update_area);
     } else {
         refresh_canvas(raster);
     }
@@ -131,9 +150,28 @@ void raster_canvas_init(raster_t *raster)
     raster->update_area = lib_malloc(sizeof(raster_canvas_area_t));
 
     raster->update_area->is_null = 1;
+    raster->update_area->lines = NULL;
+    raster->update_area->num_lines = 0;
+}
+
+/* Called whenever the frame buffer is reallocated.  */
+void raster_canvas_resize(raster_t *raster, unsigned int num_lines)
+{
+    raster_canvas_area_t *area = raster->update_area;
+    unsigned int y;
+
+    lib_free(area->lines);
+    area->lines = num_lines ? lib_malloc(num_lines * sizeof(video_dirty_span_t)) : NULL;
+    area->num_lines = num_lines;
+    for (y = 0; y < num_lines; y++) {
+        area->lines[y].xs = 1;
+        area->lines[y].xe = 0;
+    }
+    area->is_null = 1;
 }
 
 void raster_canvas_shutdown(raster_t *raster)
 {
+    lib_free(raster->update_area->lines);
     lib_free(raster->update_area);
 }
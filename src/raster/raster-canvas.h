@@ -28,19 +28,24 @@
 #define VICE_RASTER_CANVAS_H
 
 struct raster_s;
+struct video_dirty_span_s;
 
-/* A simple convenience type for defining a rectangular area on the screen.  */
+/* A simple convenience type for defining a rectangular area on the screen.
+   `lines' keeps the changed columns of each line inside the rectangle.  */
 struct raster_canvas_area_s {
     unsigned int xs;
     unsigned int ys;
     unsigned int xe;
     unsigned int ye;
     int is_null;
+    struct video_dirty_span_s *lines;
+    unsigned int num_lines;
 };
 typedef struct raster_canvas_area_s raster_canvas_area_t;
 
 extern void raster_canvas_init(struct raster_s *raster);
 extern void raster_canvas_shutdown(struct raster_s *raster);
+extern void raster_canvas_resize(struct raster_s *raster, unsigned int num_lines);
 
 extern void raster_canvas_handle_end_of_frame(struct raster_s *raster);
 extern void raster_canvas_update_all(struct raster_s *raster);
@@ -41,6 +41,7 @@
 #include "raster-sprite-status.h"
 #include "raster-sprite.h"
 #include "raster.h"
+#include "video.h"
 #include "viewport.h"
 
 
@@ -57,6 +58,18 @@ unsigned int raster_line_get_real_mode(raster_t *raster)
 inline static void add_line_to_area(raster_canvas_area_t *area, unsigned int y,
                                     unsigned int xs, unsigned int xe)
 {
+    if (y < area->num_lines) {
+        video_dirty_span_t *span = &area->lines[y];
+
+        if (span->xs > span->xe) {
+            span->xs = xs;
+            span->xe = xe;
+        } else {
+            span->xs = MIN(xs, span->xs);
+            span->xe = MAX(xe, span->xe);
+        }
+    }
+
     if (area->is_null) {
         area->ys = area->ye = y;
         area->xs = xs;
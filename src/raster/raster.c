@@ -142,6 +142,7 @@ static int raster_realize_frame_buffer(raster_t *raster)
 
     raster->fake_draw_buffer_line = lib_realloc(raster->fake_draw_buffer_line,
                                                 fb_width);
+    raster_canvas_resize(raster, fb_height);
 
     memset(raster->fake_draw_buffer_line, 0, fb_width);
 
@@ -45,6 +45,7 @@ public:
 
   void clock();
   void clock(cycle_count delta_t);
+  bool clock_idle(cycle_count delta_t);
   void reset();
 
   void writeCONTROL_REG(reg8);
@@ -193,6 +194,29 @@ void EnvelopeGenerator::clock()
 }
 
 
+// ----------------------------------------------------------------------------
+// SID clocking - delta_t cycles in which nothing but the rate counter moves.
+// Unlike clock(delta_t) this gives the same state as delta_t calls of
+// clock(). If the envelope would have to do anything else, nothing is
+// clocked and false is returned.
+// ----------------------------------------------------------------------------
+RESID_INLINE
+bool EnvelopeGenerator::clock_idle(cycle_count delta_t)
+{
+  if (unlikely(state_pipeline) || unlikely(envelope_pipeline) ||
+      unlikely(exponential_pipeline) || unlikely(reset_rate_counter) ||
+      rate_counter >= rate_period || rate_period - rate_counter < delta_t)
+  {
+    return false;
+  }
+
+  env3 = envelope_counter;
+  rate_counter += delta_t;
+
+  return true;
+}
+
+
 // ----------------------------------------------------------------------------
 // SID clocking - delta_t cycles.
 // ----------------------------------------------------------------------------
@@ -26,6 +26,15 @@
 
 #include "sid.h"
 #include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define RESID_FIR_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RESID_FIR_NEON 1
+#include <arm_neon.h>
+#endif
 
 #ifndef round
 #define round(x) (x>=0.0?floor(x+0.5):ceil(x-0.5))
@@ -47,6 +56,8 @@ SID::SID()
   fir_beta = 0;
   fir_f_cycles_per_sample = 0;
   fir_filter_scale = 0;
+  fir_simd = false;
+  fast_accurate = false;
 
   sid_model = MOS6581;
   voice[0].set_sync_source(&voice[2]);
@@ -663,6 +674,30 @@ void SID::adjust_sampling_frequency(double sample_freq)
 }
 
 
+// ----------------------------------------------------------------------------
+// Use SSE2 or NEON for the resampling convolutions.
+// ----------------------------------------------------------------------------
+bool SID::enable_fir_simd(bool enable)
+{
+#if RESID_FIR_SSE2 || RESID_FIR_NEON
+  fir_simd = enable;
+  return true;
+#else
+  fir_simd = false;
+  return !enable;
+#endif
+}
+
+
+// ----------------------------------------------------------------------------
+// Clock the resampling methods block by block where possible.
+// ----------------------------------------------------------------------------
+void SID::enable_fast_accurate(bool enable)
+{
+  fast_accurate = enable;
+}
+
+
 // ----------------------------------------------------------------------------
 // SID clocking - delta_t cycles.
 // ----------------------------------------------------------------------------
@@ -786,6 +821,112 @@ int SID::clock(cycle_count& delta_t, short* buf, int n, int interleave)
 }
 
 
+// ----------------------------------------------------------------------------
+// SID clocking with audio sampling and register writes.
+// The writes are sorted by their delta_t, which counts from the start of
+// the run, and each one is applied at exactly that cycle.  This produces
+// the same samples as clocking up to every write and writing the register
+// in between, without going through the caller for each of them.
+// If the buffer fills up, the remaining cycles are not clocked but the
+// writes are still applied; delta_t returns the cycles that were skipped.
+// ----------------------------------------------------------------------------
+int SID::clock(cycle_count& delta_t, const RegWrite* writes, int num_writes,
+               short* buf, int n, int interleave)
+{
+  int (SID::*clock_sampling)(cycle_count&, short*, int, int);
+  cycle_count done = 0;
+  cycle_count skipped = 0;
+  cycle_count run;
+  int s = 0;
+  int i;
+
+  switch (sampling) {
+  default:
+  case SAMPLE_FAST:
+    clock_sampling = &SID::clock_fast;
+    break;
+  case SAMPLE_INTERPOLATE:
+    clock_sampling = &SID::clock_interpolate;
+    break;
+  case SAMPLE_RESAMPLE:
+    clock_sampling = &SID::clock_resample;
+    break;
+  case SAMPLE_RESAMPLE_FASTMEM:
+    clock_sampling = &SID::clock_resample_fastmem;
+    break;
+  }
+
+  for (i = 0; i <= num_writes; i++) {
+    run = (i < num_writes ? writes[i].delta_t : delta_t) - done;
+    if (run > 0) {
+      done += run;
+      s += (this->*clock_sampling)(run, buf + s*interleave, n - s, interleave);
+      skipped += run;
+    }
+    if (i < num_writes) {
+      write(writes[i].offset, writes[i].value);
+    }
+  }
+
+  delta_t = skipped;
+  return s;
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking without audio output - delta_t cycles.
+// Everything the CPU can read (OSC3, ENV3 and the bus value) goes cycle by
+// cycle exactly as with clock(); only the filters, which feed nothing but
+// the audio output, are left alone. The output picks up where it was when
+// sampling starts again.
+// ----------------------------------------------------------------------------
+void SID::clock_silent(cycle_count delta_t)
+{
+  int i;
+
+  for (; delta_t > 0; delta_t--) {
+    for (i = 0; i < 3; i++) {
+      voice[i].envelope.clock();
+    }
+    for (i = 0; i < 3; i++) {
+      voice[i].wave.clock();
+    }
+    for (i = 0; i < 3; i++) {
+      voice[i].wave.synchronize();
+    }
+    for (i = 0; i < 3; i++) {
+      voice[i].wave.set_waveform_output();
+    }
+
+    if (unlikely(write_pipeline)) {
+      write();
+    }
+
+    if (unlikely(!--bus_value_ttl)) {
+      bus_value = 0;
+    }
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking without audio output, applying register writes on the way
+// like the batch clock() above.
+// ----------------------------------------------------------------------------
+void SID::clock_silent(cycle_count delta_t, const RegWrite* writes, int num_writes)
+{
+  cycle_count done = 0;
+  int i;
+
+  for (i = 0; i < num_writes; i++) {
+    clock_silent(writes[i].delta_t - done);
+    done = writes[i].delta_t > done ? writes[i].delta_t : done;
+    write(writes[i].offset, writes[i].value);
+  }
+  clock_silent(delta_t - done);
+}
+
+
 // ----------------------------------------------------------------------------
 // SID clocking with audio sampling - delta clocking picking nearest sample.
 // ----------------------------------------------------------------------------
@@ -908,11 +1049,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
       delta_t_sample = delta_t;
     }
 
-    for (int i = 0; i < delta_t_sample; i++) {
-      clock();
-      sample[sample_index] = sample[sample_index + RINGSIZE] = output();
-      ++sample_index &= RINGMASK;
-    }
+    clock_samples(delta_t_sample);
 
     if ((delta_t -= delta_t_sample) == 0) {
       sample_offset -= delta_t_sample << FIXP_SHIFT;
@@ -923,14 +1060,11 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
 
     int fir_offset = sample_offset*fir_RES >> FIXP_SHIFT;
     int fir_offset_rmd = sample_offset*fir_RES & FIXP_MASK;
-    short* fir_start = fir + fir_offset*fir_N;
-    short* sample_start = sample + sample_index - fir_N - 1 + RINGSIZE;
+    const short* fir_start = fir + fir_offset*fir_N;
+    const short* sample_start = sample + sample_index - fir_N - 1 + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v1 = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v1 += sample_start[j]*fir_start[j];
-    }
+    int v1 = convolve(sample_start, fir_start, fir_N);
 
     // Use next FIR table, wrap around to first FIR table using
     // next sample.
@@ -941,10 +1075,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     fir_start = fir + fir_offset*fir_N;
 
     // Convolution with filter impulse response.
-    int v2 = 0;
-    for (int k = 0; k < fir_N; k++) {
-      v2 += sample_start[k]*fir_start[k];
-    }
+    int v2 = convolve(sample_start, fir_start, fir_N);
 
     // Linear interpolation.
     // fir_offset_rmd is equal for all samples, it can thus be factorized out:
@@ -984,11 +1115,7 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
       delta_t_sample = delta_t;
     }
 
-    for (int i = 0; i < delta_t_sample; i++) {
-      clock();
-      sample[sample_index] = sample[sample_index + RINGSIZE] = output();
-      ++sample_index &= RINGMASK;
-    }
+    clock_samples(delta_t_sample);
 
     if ((delta_t -= delta_t_sample) == 0) {
       sample_offset -= delta_t_sample << FIXP_SHIFT;
@@ -998,14 +1125,11 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
     sample_offset = next_sample_offset & FIXP_MASK;
 
     int fir_offset = sample_offset*fir_RES >> FIXP_SHIFT;
-    short* fir_start = fir + fir_offset*fir_N;
-    short* sample_start = sample + sample_index - fir_N + RINGSIZE;
+    const short* fir_start = fir + fir_offset*fir_N;
+    const short* sample_start = sample + sample_index - fir_N + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v += sample_start[j]*fir_start[j];
-    }
+    int v = convolve(sample_start, fir_start, fir_N);
 
     v >>= FIR_SHIFT;
 
@@ -1024,4 +1148,261 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
   return s;
 }
 
+
+// ----------------------------------------------------------------------------
+// Convolution of n samples with a FIR table.
+// The vector versions sum in a different order, which gives the same result
+// since all sums are 32 bit integer sums.
+// ----------------------------------------------------------------------------
+#if RESID_FIR_SSE2
+static int convolve_sse2(const short* a, const short* b, int n)
+{
+  __m128i v1 = _mm_setzero_si128();
+  __m128i v2 = _mm_setzero_si128();
+  int j = 0;
+
+  for (; j + 16 <= n; j += 16) {
+    v1 = _mm_add_epi32(v1,
+      _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(a + j)),
+                     _mm_loadu_si128((const __m128i*)(b + j))));
+    v2 = _mm_add_epi32(v2,
+      _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(a + j + 8)),
+                     _mm_loadu_si128((const __m128i*)(b + j + 8))));
+  }
+  for (; j + 8 <= n; j += 8) {
+    v1 = _mm_add_epi32(v1,
+      _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(a + j)),
+                     _mm_loadu_si128((const __m128i*)(b + j))));
+  }
+
+  v1 = _mm_add_epi32(v1, v2);
+  v1 = _mm_add_epi32(v1, _mm_shuffle_epi32(v1, _MM_SHUFFLE(1, 0, 3, 2)));
+  v1 = _mm_add_epi32(v1, _mm_shuffle_epi32(v1, _MM_SHUFFLE(2, 3, 0, 1)));
+  int v = _mm_cvtsi128_si32(v1);
+
+  for (; j < n; j++) {
+    v += a[j]*b[j];
+  }
+
+  return v;
+}
+#endif
+
+#if RESID_FIR_NEON
+static int convolve_neon(const short* a, const short* b, int n)
+{
+  int32x4_t v1 = vdupq_n_s32(0);
+  int32x4_t v2 = vdupq_n_s32(0);
+  int j = 0;
+
+  for (; j + 8 <= n; j += 8) {
+    int16x8_t x = vld1q_s16(a + j);
+    int16x8_t y = vld1q_s16(b + j);
+    v1 = vmlal_s16(v1, vget_low_s16(x), vget_low_s16(y));
+    v2 = vmlal_s16(v2, vget_high_s16(x), vget_high_s16(y));
+  }
+
+  v1 = vaddq_s32(v1, v2);
+  int32x2_t v12 = vadd_s32(vget_low_s32(v1), vget_high_s32(v1));
+  int v = vget_lane_s32(vpadd_s32(v12, v12), 0);
+
+  for (; j < n; j++) {
+    v += a[j]*b[j];
+  }
+
+  return v;
+}
+#endif
+
+int SID::convolve(const short* a, const short* b, int n)
+{
+#if RESID_FIR_SSE2
+  if (fir_simd) {
+    return convolve_sse2(a, b, n);
+  }
+#elif RESID_FIR_NEON
+  if (fir_simd) {
+    return convolve_neon(a, b, n);
+  }
+#endif
+
+  int v = 0;
+  for (int j = 0; j < n; j++) {
+    v += a[j]*b[j];
+  }
+
+  return v;
+}
+
+
+// ----------------------------------------------------------------------------
+// Clock delta_t cycles into the sample ring buffer of the resampling methods.
+// ----------------------------------------------------------------------------
+void SID::clock_samples(cycle_count delta_t)
+{
+  if (!fast_accurate) {
+    for (int i = 0; i < delta_t; i++) {
+      clock();
+      sample[sample_index] = sample[sample_index + RINGSIZE] = output();
+      ++sample_index &= RINGMASK;
+    }
+    return;
+  }
+
+  // The write pipelined on the MOS8580 is done by the first cycle.
+  if (unlikely(write_pipeline) && likely(delta_t > 0)) {
+    clock();
+    sample[sample_index] = sample[sample_index + RINGSIZE] = output();
+    ++sample_index &= RINGMASK;
+    delta_t--;
+  }
+
+  while (delta_t > 0) {
+    int n = delta_t < BLOCK_CYCLES ? delta_t : BLOCK_CYCLES;
+
+    if (!clock_block(n)) {
+      for (int i = 0; i < n; i++) {
+        clock();
+        sample[sample_index] = sample[sample_index + RINGSIZE] = output();
+        ++sample_index &= RINGMASK;
+      }
+    }
+
+    delta_t -= n;
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking - n cycles into the sample ring buffer, in three passes.
+//
+// clock() does all the work for one cycle before it goes on to the next.
+// Here the envelopes and oscillators are clocked for the whole block first,
+// keeping the state of each cycle in one array per voice. The waveform
+// outputs are then calculated voice by voice, and finally the filters are
+// clocked with the voice outputs. Each pass runs over a few variables which
+// the compiler can keep in registers, and the result is the same as that of
+// n calls of clock().
+//
+// The combined waveforms which modify the accumulator or the shift register,
+// the test bit and the floating DAC input are left to clock(); false is
+// returned if any voice uses them.
+// ----------------------------------------------------------------------------
+bool SID::clock_block(int n)
+{
+  int i, c;
+
+  for (i = 0; i < 3; i++) {
+    WaveformGenerator& wave = voice[i].wave;
+
+    if (unlikely(wave.test) || unlikely(!wave.waveform) ||
+        unlikely(wave.waveform > 0x8) ||
+        ((wave.waveform & 0x2) && (wave.waveform & 0xd) &&
+         wave.sid_model == MOS6581))
+    {
+      return false;
+    }
+  }
+
+  // Clock envelopes.
+  for (i = 0; i < 3; i++) {
+    EnvelopeGenerator& envelope = voice[i].envelope;
+
+    if (envelope.clock_idle(n)) {
+      memset(block_envelope[i], envelope.envelope_counter, n);
+      continue;
+    }
+
+    for (c = 0; c < n; c++) {
+      envelope.clock();
+      block_envelope[i][c] = envelope.envelope_counter;
+    }
+  }
+
+  // Clock oscillators. Unless there is hard sync they are independent and
+  // can be clocked one by one.
+  if (likely(!voice[0].wave.sync && !voice[1].wave.sync && !voice[2].wave.sync)) {
+    for (i = 0; i < 3; i++) {
+      voice[i].wave.clock(n, block_accumulator[i], block_noise[i]);
+    }
+  }
+  else {
+    for (c = 0; c < n; c++) {
+      for (i = 0; i < 3; i++) {
+        voice[i].wave.clock();
+      }
+      for (i = 0; i < 3; i++) {
+        voice[i].wave.synchronize();
+      }
+      for (i = 0; i < 3; i++) {
+        block_accumulator[i][c] = voice[i].wave.accumulator;
+        block_noise[i][c] = voice[i].wave.no_noise_or_noise_output;
+      }
+    }
+  }
+
+  // Calculate waveform outputs, see WaveformGenerator::set_waveform_output().
+  for (i = 0; i < 3; i++) {
+    WaveformGenerator& wave = voice[i].wave;
+    const reg24* accumulator = block_accumulator[i];
+    // Voice 1 is synced by voice 3, voice 2 by voice 1, voice 3 by voice 2.
+    const reg24* sync_accumulator = block_accumulator[(i + 2) % 3];
+    const unsigned short* noise = block_noise[i];
+    const unsigned char* envelope = block_envelope[i];
+    const unsigned short* wave_table = wave.wave;
+    const unsigned short* wave_dac = WaveformGenerator::model_dac[wave.sid_model];
+    const unsigned short* env_dac =
+      EnvelopeGenerator::model_dac[voice[i].envelope.sid_model];
+    reg24 ring_msb_mask = wave.ring_msb_mask;
+    unsigned short no_pulse = wave.no_pulse;
+    reg12 pw = wave.pw;
+    int wave_zero = voice[i].wave_zero;
+    int* out = block_voice[i];
+
+    reg12 pulse_output = wave.pulse_output;
+    reg12 waveform_output = wave.waveform_output;
+    reg12 mask = 0;
+    int ix = 0;
+    int ix_prev = -1;
+
+    for (c = 0; c < n; c++) {
+      ix_prev = ix;
+      ix = (accumulator[c] ^ (~sync_accumulator[c] & ring_msb_mask)) >> 12;
+      mask = (no_pulse | pulse_output) & noise[c];
+      waveform_output = wave_table[ix] & mask;
+      pulse_output = -((accumulator[c] >> 12) >= pw) & 0xfff;
+
+      out[c] = (wave_dac[waveform_output] - wave_zero)*env_dac[envelope[c]];
+    }
+
+    // Triangle/Sawtooth output is delayed half cycle on 8580.
+    if ((wave.waveform & 3) && (wave.sid_model == MOS8580)) {
+      wave.osc3 = (n > 1 ? wave_table[ix_prev] : wave.tri_saw_pipeline) & mask;
+      wave.tri_saw_pipeline = wave_table[ix];
+    }
+    else {
+      wave.osc3 = waveform_output;
+    }
+
+    wave.waveform_output = waveform_output;
+    wave.pulse_output = pulse_output;
+  }
+
+  // Clock filters.
+  for (c = 0; c < n; c++) {
+    filter.clock(block_voice[0][c], block_voice[1][c], block_voice[2][c]);
+    extfilt.clock(filter.output());
+    sample[sample_index] = sample[sample_index + RINGSIZE] = output();
+    ++sample_index &= RINGMASK;
+  }
+
+  // Age bus value.
+  if (bus_value_ttl > 0 && bus_value_ttl <= n) {
+    bus_value = 0;
+  }
+  bus_value_ttl -= n;
+
+  return true;
+}
+
 } // namespace reSID
@@ -47,11 +47,33 @@ public:
   double filter_scale = 0.97);
   void adjust_sampling_frequency(double sample_freq);
 
+  // The resampling methods can compute their convolutions with SSE2 or
+  // NEON; false if this build has neither. They can also clock the chip
+  // block by block instead of cycle by cycle, see clock_block().
+  bool enable_fir_simd(bool enable);
+  void enable_fast_accurate(bool enable);
+
+  // A register write delta_t cycles into a run of clock() below.
+  struct RegWrite
+  {
+    cycle_count delta_t;
+    reg8 offset;
+    reg8 value;
+  };
+
   void clock();
   void clock(cycle_count delta_t);
   int clock(cycle_count& delta_t, short* buf, int n, int interleave = 1);
+  int clock(cycle_count& delta_t, const RegWrite* writes, int num_writes,
+            short* buf, int n, int interleave = 1);
+  // Clocking for when nobody listens, see sid.cc.
+  void clock_silent(cycle_count delta_t);
+  void clock_silent(cycle_count delta_t, const RegWrite* writes, int num_writes);
   void reset();
 
+  // Cycles a written value can be read back from the write-only registers.
+  cycle_count databus_ttl_cycles() const { return databus_ttl; }
+
   // Read/write registers.
   reg8 read(reg8 offset);
   void write(reg8 offset, reg8 value);
@@ -102,6 +124,9 @@ public:
   int clock_interpolate(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_resample(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int interleave);
+  void clock_samples(cycle_count delta_t);
+  bool clock_block(int n);
+  int convolve(const short* a, const short* b, int n);
   void write();
 
   chip_model sid_model;
@@ -141,7 +166,10 @@ public:
 
     // Fixed point constants (16.16 bits).
     FIXP_SHIFT = 16,
-    FIXP_MASK = 0xffff
+    FIXP_MASK = 0xffff,
+
+    // Cycles clocked in one go by clock_block().
+    BLOCK_CYCLES = 64
   };
 
   // Sampling variables.
@@ -161,6 +189,15 @@ public:
 
   // FIR_RES filter tables (FIR_N*FIR_RES).
   short* fir;
+
+  bool fir_simd;
+  bool fast_accurate;
+
+  // Voice state of each cycle of a block, one row per voice.
+  reg24 block_accumulator[3][BLOCK_CYCLES];
+  unsigned short block_noise[3][BLOCK_CYCLES];
+  unsigned char block_envelope[3][BLOCK_CYCLES];
+  int block_voice[3][BLOCK_CYCLES];
 };
 
 
@@ -43,6 +43,7 @@ public:
 
   void clock();
   void clock(cycle_count delta_t);
+  void clock(int n, reg24* accumulators, unsigned short* noise);
   void synchronize();
   void reset();
 
@@ -170,6 +171,41 @@ void WaveformGenerator::clock()
   }
 }
 
+// ----------------------------------------------------------------------------
+// SID clocking - n cycles, keeping the accumulator and the noise output mask
+// of each cycle. This is the same as n calls of clock(), and can only be used
+// when the test bit is off and no oscillator is synced.
+// ----------------------------------------------------------------------------
+RESID_INLINE
+void WaveformGenerator::clock(int n, reg24* accumulators, unsigned short* noise)
+{
+  // Work on copies, the compiler cannot tell that the arrays are not members.
+  reg24 acc = accumulator;
+  reg24 acc_freq = freq;
+  reg24 accumulator_bits_set = 0;
+  unsigned short noise_mask = no_noise_or_noise_output;
+
+  for (int i = 0; i < n; i++) {
+    reg24 accumulator_next = (acc + acc_freq) & 0xffffff;
+    accumulator_bits_set = ~acc & accumulator_next;
+    acc = accumulator_next;
+
+    if (unlikely(accumulator_bits_set & 0x080000)) {
+      shift_pipeline = 2;
+    }
+    else if (unlikely(shift_pipeline) && !--shift_pipeline) {
+      clock_shift_register();
+      noise_mask = no_noise_or_noise_output;
+    }
+
+    accumulators[i] = acc;
+    noise[i] = noise_mask;
+  }
+
+  accumulator = acc;
+  msb_rising = (accumulator_bits_set & 0x800000) ? true : false;
+}
+
 // ----------------------------------------------------------------------------
 // SID clocking - delta_t cycles.
 // ----------------------------------------------------------------------------
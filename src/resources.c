@@ -48,6 +48,7 @@
 #endif
 
 #include "archdep.h"
+#include "crc32.h"
 #include "ioutil.h"
 #include "lib.h"
 #include "log.h"
@@ -928,6 +929,39 @@ void resources_get_event_safe_list(event_list_state_t *list)
     event_record_in_list(list, EVENT_LIST_END, NULL, 0);
 }
 
+uint32_t resources_get_event_crc(const char * const *skip)
+{
+    unsigned int i, j;
+    char *event_data;
+    int data_size;
+    uint32_t crc = 0;
+    resource_value_t value;
+
+    for (i = 0; i < num_resources; i++) {
+        if (resources[i].event_relevant == RES_EVENT_NO) {
+            continue;
+        }
+        for (j = 0; skip != NULL && skip[j] != NULL; j++) {
+            if (!strcasecmp(resources[i].name, skip[j])) {
+                break;
+            }
+        }
+        if (skip != NULL && skip[j] != NULL) {
+            continue;
+        }
+        value = *(resources[i].value_ptr);
+        if (resources[i].type == RES_STRING && value == NULL) {
+            value = (resource_value_t)"";
+        }
+        resource_create_event_data(&event_data, &data_size,
+                                   &resources[i], value);
+        crc = ((crc << 1) | (crc >> 31)) ^ crc32_buf(event_data, (unsigned int)data_size);
+        lib_free(event_data);
+    }
+
+    return crc;
+}
+
 int resources_toggle(const char *name, int *new_value_return)
 {
     resource_ram_t *r = lookup(name);
@@ -30,6 +30,7 @@
 
 #include <stdio.h>
 
+#include "types.h"
 
 typedef enum resource_type_s {
     RES_INTEGER,
@@ -166,6 +167,11 @@ extern int resources_set_default_string(const char *name, char *value);
 extern int resources_set_event_safe(void);
 extern void resources_get_event_safe_list(struct event_list_state_s *list);
 
+/* A CRC over the values of the resources that matter for recording events,
+   which are the ones that change the emulated machine.  Resources named in
+   the NULL terminated `skip' list are left out.  */
+extern uint32_t resources_get_event_crc(const char * const *skip);
+
 /* Register a callback for a resource; use name=NULL to register a callback for all.
    Resource-specific callbacks are always called with a valid resource name as parameter.
    Global callbacks may be called with NULL as resource name if many resources changed. */
@@ -0,0 +1,544 @@
+/*
+ * rewind.c - Go back in time through keyframes and recorded input.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * Every RewindInterval frames a memory snapshot is taken on top of the
+ * one before, so it only costs the RAM pages that changed.  Between two
+ * keyframes the keyboard, joystick and datasette input goes through
+ * event_record() into a list that belongs to the older one.  The oldest
+ * keyframes are dropped when the memory snapshots together need more
+ * than RewindBufferSize kB.
+ *
+ * Stepping back restores the last keyframe before the target frame and
+ * plays its input again, in warp mode and with the host input ignored,
+ * until the target frame is reached.  The input recorded after that is
+ * thrown away and recording goes on from there.  Going back one frame
+ * therefore costs up to RewindInterval frames of emulation; fewer frames
+ * between keyframes make that faster but need more memory.
+ *
+ * Recorded clocks are those of the emulation at that time.  Restoring a
+ * keyframe brings back its clock, so they can be replayed as they are.
+ * Clock overflows are recorded too: after one, the replay skips to the
+ * input recorded after it.  A reset starts over with a new keyframe,
+ * and so does the end of an autostart or of pasted text, which go into
+ * RAM without being recorded.  Disk and tape images are not part of the
+ * keyframes.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "alarm.h"
+#include "autostart.h"
+#include "clkguard.h"
+#include "cmdline.h"
+#include "datasette.h"
+#include "interrupt.h"
+#include "joystick.h"
+#include "kbdbuf.h"
+#include "keyboard.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "maincpu.h"
+#include "profile.h"
+#include "resources.h"
+#include "rewind.h"
+#include "snapshot.h"
+#include "types.h"
+#include "vice-event.h"
+
+#define REWIND_INTERVAL_MAX 3000
+
+typedef struct rewind_keyframe_s {
+    snapshot_memory_t *mem;
+    unsigned long frame;
+    event_list_state_t input;   /* recorded until the next keyframe */
+} rewind_keyframe_t;
+
+static int rewind_enabled = 0;
+static int rewind_interval = 50;
+static int rewind_buffer_size = 16384;
+
+static log_t rewind_log = LOG_DEFAULT;
+static alarm_t *rewind_alarm = NULL;
+
+static rewind_keyframe_t *keyframes = NULL;
+static unsigned int num_keyframes = 0;
+static unsigned int max_keyframes = 0;
+
+static unsigned long frame = 0;
+static unsigned long next_keyframe = 0;
+
+/* There is only one CPU trap at a time; if somebody else takes it, ours
+   are asked for again at the next frame.  */
+static int keyframe_pending = 0;
+static int restore_pending = 0;
+
+/* Replay.  */
+static int replaying = 0;
+static unsigned long replay_target;
+static event_list_t *replay_current = NULL;
+static rewind_keyframe_t *replay_keyframe = NULL;
+static int replay_warp;
+static uint64_t replay_start_ns;
+
+/* Statistics.  */
+static unsigned long keyframes_taken = 0;
+static unsigned long keyframes_dropped = 0;
+static uint64_t keyframe_ns = 0;
+static unsigned long rewinds = 0;
+static unsigned long replayed_frames = 0;
+static uint64_t latency_sum_ns = 0;
+static uint64_t latency_max_ns = 0;
+
+/* ------------------------------------------------------------------------- */
+
+static void keyframe_free(rewind_keyframe_t *kf)
+{
+    snapshot_memory_destroy(kf->mem);
+    event_clear_list(&kf->input);
+}
+
+static void keyframes_clear(void)
+{
+    unsigned int i;
+
+    event_record_rewind_list(NULL);
+    for (i = 0; i < num_keyframes; i++) {
+        keyframe_free(&keyframes[i]);
+    }
+    num_keyframes = 0;
+}
+
+/* Keep the newest keyframe in any case.  */
+static void keyframes_limit(void)
+{
+    unsigned int drop = 0;
+
+    while (num_keyframes - drop > 1
+           && snapshot_memory_in_use() > (size_t)rewind_buffer_size * 1024) {
+        keyframe_free(&keyframes[drop++]);
+    }
+    if (drop > 0) {
+        num_keyframes -= drop;
+        memmove(keyframes, keyframes + drop, num_keyframes * sizeof(rewind_keyframe_t));
+        keyframes_dropped += drop;
+        /* event_list_state_t points into its own list, it can move.  */
+        event_record_rewind_list(&keyframes[num_keyframes - 1].input);
+    }
+}
+
+static void rewind_keyframe_take(void)
+{
+    rewind_keyframe_t *kf;
+    uint64_t start;
+
+    if (replaying) {
+        return;
+    }
+
+    if (num_keyframes == max_keyframes) {
+        max_keyframes = max_keyframes ? max_keyframes * 2 : 64;
+        keyframes = lib_realloc(keyframes, max_keyframes * sizeof(rewind_keyframe_t));
+        if (num_keyframes > 0) {
+            event_record_rewind_list(&keyframes[num_keyframes - 1].input);
+        }
+    }
+
+    start = profile_now_ns();
+    kf = &keyframes[num_keyframes];
+    kf->mem = snapshot_memory_new();
+    if (machine_write_snapshot_memory(kf->mem,
+                                      num_keyframes ? keyframes[num_keyframes - 1].mem : NULL) < 0) {
+        log_error(rewind_log, "Cannot take a keyframe, rewind disabled.");
+        snapshot_memory_destroy(kf->mem);
+        resources_set_int("Rewind", 0);
+        return;
+    }
+    keyframe_ns += profile_now_ns() - start;
+    keyframes_taken++;
+
+    kf->frame = frame;
+    event_register_event_list(&kf->input);
+    num_keyframes++;
+    event_record_rewind_list(&kf->input);
+
+    keyframes_limit();
+}
+
+/* ------------------------------------------------------------------------- */
+
+/* Throw away `at' and what comes after it.  */
+static void input_cut(event_list_state_t *input, event_list_t *at)
+{
+    event_list_t *e, *next;
+
+    for (e = at->next; e != NULL; e = next) {
+        next = e->next;
+        lib_free(e->data);
+        lib_free(e);
+    }
+    lib_free(at->data);
+    memset(at, 0, sizeof(event_list_t));
+    at->type = EVENT_LIST_END;
+    input->current = at;
+}
+
+/* After an overflow marker, wait for the clock overflow to be replayed.  */
+static void replay_next(void)
+{
+    if (replay_current->type != EVENT_LIST_END
+        && replay_current->type != EVENT_OVERFLOW) {
+        alarm_set(rewind_alarm, replay_current->clk);
+    }
+}
+
+static void rewind_alarm_handler(CLOCK offset, void *data)
+{
+    alarm_unset(rewind_alarm);
+
+    switch (replay_current->type) {
+        case EVENT_KEYBOARD_MATRIX:
+            keyboard_event_playback(offset, replay_current->data);
+            break;
+        case EVENT_KEYBOARD_RESTORE:
+            keyboard_restore_event_playback(offset, replay_current->data);
+            break;
+        case EVENT_JOYSTICK_VALUE:
+            joystick_event_playback(offset, replay_current->data);
+            break;
+        case EVENT_DATASETTE:
+            datasette_event_playback(offset, replay_current->data);
+            break;
+        default:
+            break;
+    }
+
+    replay_current = replay_current->next;
+    replay_next();
+}
+
+static void replay_stop(void)
+{
+    uint64_t ns = profile_now_ns() - replay_start_ns;
+    rewind_keyframe_t *kf = replay_keyframe;
+
+    alarm_unset(rewind_alarm);
+    replaying = 0;
+
+    /* What was recorded after the target is gone now.  */
+    input_cut(&kf->input, replay_current != NULL ? replay_current : kf->input.base);
+    event_record_rewind_list(&kf->input);
+
+    if (!replay_warp) {
+        resources_set_int("WarpMode", 0);
+    }
+
+    latency_sum_ns += ns;
+    if (ns > latency_max_ns) {
+        latency_max_ns = ns;
+    }
+}
+
+static void rewind_restore(void)
+{
+    rewind_keyframe_t *kf;
+    unsigned int i;
+
+    if (num_keyframes == 0) {
+        return;
+    }
+
+    /* The last keyframe at or before the target, the oldest if they are
+       all newer.  */
+    for (i = num_keyframes - 1; i > 0 && keyframes[i].frame > replay_target; i--) {
+    }
+    kf = &keyframes[i];
+    if (replay_target < kf->frame) {
+        replay_target = kf->frame;
+    }
+
+    for (i++; i < num_keyframes; i++) {
+        keyframe_free(&keyframes[i]);
+    }
+    num_keyframes = (unsigned int)(kf - keyframes) + 1;
+    event_record_rewind_list(NULL);
+
+    if (machine_read_snapshot_memory(kf->mem) < 0) {
+        log_error(rewind_log, "Cannot restore a keyframe, rewind disabled.");
+        resources_set_int("Rewind", 0);
+        return;
+    }
+
+    if (!replaying) {
+        resources_get_int("WarpMode", &replay_warp);
+    }
+    alarm_unset(rewind_alarm);
+
+    frame = kf->frame;
+    next_keyframe = frame + rewind_interval;
+    replay_keyframe = kf;
+    replay_current = kf->input.base;
+    replaying = 1;
+    rewinds++;
+
+    if (frame == replay_target) {
+        replay_current = NULL;
+        replay_stop();
+        return;
+    }
+
+    resources_set_int("WarpMode", 1);
+    replay_next();
+}
+
+static void rewind_trap(uint16_t addr, void *data)
+{
+    if (!rewind_enabled) {
+        return;
+    }
+
+    /* A keyframe due now would be one of those going away.  */
+    if (restore_pending) {
+        restore_pending = 0;
+        keyframe_pending = 0;
+        rewind_restore();
+    } else if (keyframe_pending) {
+        keyframe_pending = 0;
+        rewind_keyframe_take();
+    }
+}
+
+int rewind_step_back(unsigned int frames)
+{
+    unsigned long from;
+
+    if (!rewind_enabled || num_keyframes == 0) {
+        return -1;
+    }
+
+    from = replaying ? replay_target : frame;
+    replay_target = from > frames ? from - frames : 0;
+    if (!replaying) {
+        replay_start_ns = profile_now_ns();
+    }
+
+    restore_pending = 1;
+    interrupt_maincpu_trigger_trap(rewind_trap, NULL);
+
+    return 0;
+}
+
+int rewind_replay_active(void)
+{
+    return replaying;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void rewind_vsync(void)
+{
+    if (!rewind_enabled) {
+        return;
+    }
+
+    frame++;
+
+    if (replaying) {
+        replayed_frames++;
+        if (frame >= replay_target) {
+            replay_stop();
+        }
+    }
+
+    /* Autostart and pasted text go into RAM behind the input recording's
+       back, there is no going back to before them.  */
+    if (!replaying && (autostart_in_progress() || kbdbuf_queue_is_pending())) {
+        keyframes_clear();
+        keyframe_pending = 0;
+        next_keyframe = frame + 1;
+    } else if (!replaying && frame >= next_keyframe) {
+        keyframe_pending = 1;
+        next_keyframe = frame + rewind_interval;
+    }
+    if (keyframe_pending || restore_pending) {
+        interrupt_maincpu_trigger_trap(rewind_trap, NULL);
+    }
+}
+
+void rewind_reset(void)
+{
+    if (!rewind_enabled) {
+        return;
+    }
+
+    if (replaying) {
+        replay_current = NULL;
+        replay_stop();
+    }
+    keyframes_clear();
+    keyframe_pending = 0;
+    restore_pending = 0;
+    next_keyframe = frame + 1;
+}
+
+static void clk_overflow_callback(CLOCK sub, void *data)
+{
+    if (replaying) {
+        if (replay_current->type == EVENT_OVERFLOW) {
+            replay_current = replay_current->next;
+            replay_next();
+        }
+    } else if (num_keyframes > 0) {
+        event_record_in_list(&keyframes[num_keyframes - 1].input, EVENT_OVERFLOW, NULL, 0);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void rewind_get_stats(rewind_stats_t *stats)
+{
+    memset(stats, 0, sizeof(rewind_stats_t));
+
+    stats->frame = frame;
+    stats->keyframes = num_keyframes;
+    if (num_keyframes > 0) {
+        stats->frames = frame - keyframes[0].frame;
+    }
+    stats->memory = (unsigned long)snapshot_memory_in_use();
+    stats->keyframes_taken = keyframes_taken;
+    stats->keyframes_dropped = keyframes_dropped;
+    stats->rewinds = rewinds;
+    stats->replayed_frames = replayed_frames;
+    if (keyframes_taken) {
+        stats->keyframe_avg_ms = keyframe_ns / 1e6 / keyframes_taken;
+    }
+    if (rewinds) {
+        stats->latency_avg_ms = latency_sum_ns / 1e6 / rewinds;
+    }
+    stats->latency_max_ms = latency_max_ns / 1e6;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int set_rewind_enabled(int val, void *param)
+{
+    val = val ? 1 : 0;
+    if (val == rewind_enabled) {
+        return 0;
+    }
+
+    if (replaying) {
+        replay_current = NULL;
+        replay_stop();
+    }
+    keyframes_clear();
+    keyframe_pending = 0;
+    restore_pending = 0;
+    rewind_enabled = val;
+    next_keyframe = frame + 1;
+
+    return 0;
+}
+
+static int set_rewind_interval(int val, void *param)
+{
+    if (val < 1 || val > REWIND_INTERVAL_MAX) {
+        return -1;
+    }
+    rewind_interval = val;
+
+    return 0;
+}
+
+static int set_rewind_buffer_size(int val, void *param)
+{
+    if (val < 64) {
+        return -1;
+    }
+    rewind_buffer_size = val;
+    if (rewind_enabled && !replaying) {
+        keyframes_limit();
+    }
+
+    return 0;
+}
+
+static const resource_int_t resources_int[] = {
+    { "Rewind", 0, RES_EVENT_NO, NULL,
+      &rewind_enabled, set_rewind_enabled, NULL },
+    { "RewindInterval", 50, RES_EVENT_NO, NULL,
+      &rewind_interval, set_rewind_interval, NULL },
+    { "RewindBufferSize", 16384, RES_EVENT_NO, NULL,
+      &rewind_buffer_size, set_rewind_buffer_size, NULL },
+    RESOURCE_INT_LIST_END
+};
+
+int rewind_resources_init(void)
+{
+    return resources_register_int(resources_int);
+}
+
+static const cmdline_option_t cmdline_options[] =
+{
+    { "-rewind", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "Rewind", (resource_value_t)1,
+      NULL, "Keep keyframes and input to go back in time" },
+    { "+rewind", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "Rewind", (resource_value_t)0,
+      NULL, "Do not keep anything to go back in time" },
+    { "-rewindinterval", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
+      NULL, NULL, "RewindInterval", NULL,
+      "<frames>", "Set the number of frames between rewind keyframes" },
+    { "-rewindbuffer", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
+      NULL, NULL, "RewindBufferSize", NULL,
+      "<kB>", "Set the memory rewind keyframes may take" },
+    CMDLINE_LIST_END
+};
+
+int rewind_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
+
+void rewind_init(void)
+{
+    rewind_log = log_open("Rewind");
+
+    rewind_alarm = alarm_new(maincpu_alarm_context, "Rewind",
+                             rewind_alarm_handler, NULL);
+
+    clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
+}
+
+void rewind_shutdown(void)
+{
+    keyframes_clear();
+    lib_free(keyframes);
+    keyframes = NULL;
+    max_keyframes = 0;
+}
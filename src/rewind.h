@@ -0,0 +1,63 @@
+/*
+ * rewind.h - Go back in time through keyframes and recorded input.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_REWIND_H
+#define VICE_REWIND_H
+
+#include "types.h"
+
+typedef struct rewind_stats_s {
+    unsigned long frame;            /* frames since rewind was switched on */
+    unsigned int keyframes;         /* kept right now */
+    unsigned long frames;           /* how far back the oldest one is */
+    unsigned long memory;           /* bytes of memory snapshots in use */
+    unsigned long keyframes_taken;
+    unsigned long keyframes_dropped;    /* to stay below the memory limit */
+    unsigned long rewinds;
+    unsigned long replayed_frames;
+    double keyframe_avg_ms;
+    double latency_avg_ms;          /* step back called to target reached */
+    double latency_max_ms;
+} rewind_stats_t;
+
+extern int rewind_resources_init(void);
+extern int rewind_cmdline_options_init(void);
+extern void rewind_init(void);
+extern void rewind_shutdown(void);
+
+/* Called at the end of every frame and after every reset.  */
+extern void rewind_vsync(void);
+extern void rewind_reset(void);
+
+/* Go back `frames' frames, as far as the keyframes reach.  The machine
+   goes back to the keyframe before and runs forward in warp mode with the
+   recorded input until it gets there.  Returns -1 if rewind is off or
+   nothing has been recorded yet.  */
+extern int rewind_step_back(unsigned int frames);
+
+/* Whether the emulation is on its way to a step back target.  */
+extern int rewind_replay_active(void);
+
+extern void rewind_get_stats(rewind_stats_t *stats);
+
+#endif
@@ -92,6 +92,10 @@ typedef struct sound_s sound_t;
 static short *buf = NULL;
 static int blen = 0;
 
+/* register writes handed to reSID by resid_calculate_samples_batch() */
+static SID::RegWrite *regwrites = NULL;
+static int regwrites_size = 0;
+
 static short *getbuf(int len)
 {
     if ((buf == NULL) || (blen < len)) {
@@ -126,6 +130,7 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
     char method_text[100];
     double passband, gain;
     int filters_enabled, model, sampling, passband_percentage, gain_percentage, filter_bias_mV;
+    int fast_accurate;
 
     if (resources_get_int("SidFilters", &filters_enabled) < 0) {
         return 0;
@@ -139,6 +144,10 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
         return 0;
     }
 
+    if (resources_get_int("SidResidFastAccurate", &fast_accurate) < 0) {
+        return 0;
+    }
+
     if ((model == 1) || (model == 2)) {
         /* 8580 */
         if (resources_get_int("SidResid8580Passband", &passband_percentage) < 0) {
@@ -208,6 +217,8 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
     psid->sid->enable_filter(filters_enabled ? true : false);
     psid->sid->adjust_filter_bias(filter_bias_mV / 1000.0);
     psid->sid->enable_external_filter(filters_enabled ? true : false);
+    psid->sid->enable_fir_simd(true);
+    psid->sid->enable_fast_accurate(fast_accurate ? true : false);
 
     switch (sampling) {
       default:
@@ -221,11 +232,13 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
         break;
       case 2:
         method = SAMPLE_RESAMPLE;
-        sprintf(method_text, "resampling, pass to %dHz", (int)passband);
+        sprintf(method_text, "resampling, pass to %dHz%s", (int)passband,
+                fast_accurate ? ", clocked by block" : "");
         break;
       case 3:
         method = SAMPLE_RESAMPLE_FASTMEM;
-        sprintf(method_text, "fast resampling, pass to %dHz", (int)passband);
+        sprintf(method_text, "fast resampling, pass to %dHz%s", (int)passband,
+                fast_accurate ? ", clocked by block" : "");
         break;
     }
 
@@ -253,6 +266,9 @@ static void resid_close(sound_t *psid)
         lib_free(buf);
         buf = NULL;
     }
+    lib_free(regwrites);
+    regwrites = NULL;
+    regwrites_size = 0;
 }
 
 static uint8_t resid_read(sound_t *psid, uint16_t addr)
@@ -285,6 +301,51 @@ static int resid_calculate_samples(sound_t *psid, short *pbuf, int nr,
     return retval;
 }
 
+static SID::RegWrite *resid_regwrites(const sid_write_t *writes, int num_writes)
+{
+    int i;
+
+    if (num_writes > regwrites_size) {
+        regwrites_size = num_writes * 2;
+        regwrites = (SID::RegWrite *)lib_realloc(regwrites, regwrites_size * sizeof(SID::RegWrite));
+    }
+    for (i = 0; i < num_writes; i++) {
+        regwrites[i].delta_t = writes[i].delta_t;
+        regwrites[i].offset = writes[i].addr;
+        regwrites[i].value = writes[i].val;
+    }
+    return regwrites;
+}
+
+static int resid_calculate_samples_batch(sound_t *psid, short *pbuf, int nr,
+                                         int interleave, int *delta_t,
+                                         const sid_write_t *writes, int num_writes)
+{
+    short *tmp_buf;
+    int retval;
+
+    resid_regwrites(writes, num_writes);
+
+    if (psid->factor == 1000) {
+        return psid->sid->clock(*delta_t, regwrites, num_writes, pbuf, nr, interleave);
+    }
+    tmp_buf = getbuf(2 * nr * psid->factor / 1000);
+    retval = psid->sid->clock(*delta_t, regwrites, num_writes, tmp_buf, nr * psid->factor / 1000, interleave) * 1000 / psid->factor;
+    memcpy(pbuf, tmp_buf, 2 * nr);
+    return retval;
+}
+
+static void resid_clock_silent(sound_t *psid, int delta_t,
+                               const sid_write_t *writes, int num_writes)
+{
+    psid->sid->clock_silent(delta_t, resid_regwrites(writes, num_writes), num_writes);
+}
+
+static CLOCK resid_bus_ttl(sound_t *psid)
+{
+    return (CLOCK)psid->sid->databus_ttl_cycles();
+}
+
 static void resid_prevent_clk_overflow(sound_t *psid, CLOCK sub)
 {
 }
@@ -381,7 +442,10 @@ sid_engine_t resid_hooks =
     resid_prevent_clk_overflow,
     resid_dump_state,
     resid_state_read,
-    resid_state_write
+    resid_state_write,
+    resid_calculate_samples_batch,
+    resid_clock_silent,
+    resid_bus_ttl
 };
 
 } // extern "C"
@@ -191,6 +191,12 @@ static const cmdline_option_t resid_cmdline_options[] =
     { "-resid8580filterbias", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
       NULL, NULL, "SidResid8580FilterBias", NULL,
       "<number>", "reSID 8580 filter bias setting, which can be used to adjust DAC bias in millivolts.", },
+    { "-residfastaccurate", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SidResidFastAccurate", (void *)1,
+      NULL, "Clock reSID block by block when resampling" },
+    { "+residfastaccurate", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SidResidFastAccurate", (void *)0,
+      NULL, "Clock reSID cycle by cycle when resampling" },
     CMDLINE_LIST_END
 };
 #endif
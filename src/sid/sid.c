@@ -449,6 +449,22 @@ void sid_sound_machine_reset(sound_t *psid, CLOCK cpu_clk)
     sid_engine.reset(psid, cpu_clk);
 }
 
+/* The writes of each chip while sid_sound_machine_calculate_samples_batch()
+   runs, NULL otherwise.  */
+static sid_write_t *batch_writes[SOUND_SIDS_MAX];
+static int batch_num_writes[SOUND_SIDS_MAX];
+static int batch_size = 0;
+static int batching = 0;
+
+static int sid_calculate(sound_t **psid, int chipno, int16_t *pbuf, int nr, int interleave, int *delta_t)
+{
+    if (batching) {
+        return sid_engine.calculate_samples_batch(psid[chipno], pbuf, nr, interleave, delta_t,
+                                                  batch_writes[chipno], batch_num_writes[chipno]);
+    }
+    return sid_engine.calculate_samples(psid[chipno], pbuf, nr, interleave, delta_t);
+}
+
 int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, int soc, int scc, int *delta_t)
 {
     int i;
@@ -459,12 +475,12 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
     int tmp_delta_t = *delta_t;
 
     if (soc == 1 && scc == 1) {
-        return sid_engine.calculate_samples(psid[0], pbuf, nr, 1, delta_t);
+        return sid_calculate(psid, 0, pbuf, nr, 1, delta_t);
     }
     if (soc == 1 && scc == 2) {
         tmp_buf1 = getbuf1(2 * nr);
-        tmp_nr = sid_engine.calculate_samples(psid[0], tmp_buf1, nr, 1, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf, nr, 1, delta_t);
+        tmp_nr = sid_calculate(psid, 0, tmp_buf1, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf, nr, 1, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[i] = sound_audio_mix(pbuf[i], tmp_buf1[i]);
         }
@@ -473,10 +489,10 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
     if (soc == 1 && scc == 3) {
         tmp_buf1 = getbuf1(2 * nr);
         tmp_buf2 = getbuf2(2 * nr);
-        tmp_nr = sid_engine.calculate_samples(psid[0], tmp_buf1, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 0, tmp_buf1, nr, 1, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[2], tmp_buf2, nr, 1, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf, nr, 1, delta_t);
+        tmp_nr = sid_calculate(psid, 2, tmp_buf2, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf, nr, 1, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[i] = sound_audio_mix(pbuf[i], tmp_buf1[i]);
             pbuf[i] = sound_audio_mix(pbuf[i], tmp_buf2[i]);
@@ -487,12 +503,12 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
         tmp_buf1 = getbuf1(2 * nr);
         tmp_buf2 = getbuf2(2 * nr);
         tmp_buf3 = getbuf3(2 * nr);
-        tmp_nr = sid_engine.calculate_samples(psid[0], tmp_buf1, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 0, tmp_buf1, nr, 1, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[2], tmp_buf2, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 2, tmp_buf2, nr, 1, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[3], tmp_buf3, nr, 1, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf, nr, 1, delta_t);
+        tmp_nr = sid_calculate(psid, 3, tmp_buf3, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf, nr, 1, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[i] = sound_audio_mix(pbuf[i], tmp_buf1[i]);
             pbuf[i] = sound_audio_mix(pbuf[i], tmp_buf2[i]);
@@ -501,23 +517,23 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
         return tmp_nr;
     }
     if (soc == 2 && scc == 1) {
-        tmp_nr = sid_engine.calculate_samples(psid[0], pbuf, nr, 2, delta_t);
+        tmp_nr = sid_calculate(psid, 0, pbuf, nr, 2, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[(i * 2) + 1] = pbuf[i * 2];
         }
         return tmp_nr;
     }
     if (soc == 2 && scc == 2) {
-        tmp_nr = sid_engine.calculate_samples(psid[0], pbuf, nr, 2, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf + 1, nr, 2, delta_t);
+        tmp_nr = sid_calculate(psid, 0, pbuf, nr, 2, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf + 1, nr, 2, delta_t);
         return tmp_nr;
     }
     if (soc == 2 && scc == 3) {
         tmp_buf1 = getbuf1(2 * nr);
-        tmp_nr = sid_engine.calculate_samples(psid[2], tmp_buf1, nr, 1, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 2, tmp_buf1, nr, 1, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[0], pbuf, nr, 2, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf + 1, nr, 2, delta_t);
+        tmp_nr = sid_calculate(psid, 0, pbuf, nr, 2, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf + 1, nr, 2, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[i * 2] = sound_audio_mix(pbuf[i * 2], tmp_buf1[i]);
             pbuf[(i * 2) + 1] = sound_audio_mix(pbuf[(i * 2) + 1], tmp_buf1[i]);
@@ -525,12 +541,12 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
     }
     if (soc == 2 && scc == 4) {
         tmp_buf1 = getbuf1(2 * nr);
-        tmp_nr = sid_engine.calculate_samples(psid[2], tmp_buf1, nr, 2, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 2, tmp_buf1, nr, 2, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[3], tmp_buf1 + 1, nr, 2, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 3, tmp_buf1 + 1, nr, 2, &tmp_delta_t);
         tmp_delta_t = *delta_t;
-        tmp_nr = sid_engine.calculate_samples(psid[0], pbuf, nr, 2, &tmp_delta_t);
-        tmp_nr = sid_engine.calculate_samples(psid[1], pbuf + 1, nr, 2, delta_t);
+        tmp_nr = sid_calculate(psid, 0, pbuf, nr, 2, &tmp_delta_t);
+        tmp_nr = sid_calculate(psid, 1, pbuf + 1, nr, 2, delta_t);
         for (i = 0; i < tmp_nr; i++) {
             pbuf[i * 2] = sound_audio_mix(pbuf[i * 2], tmp_buf1[i * 2]);
             pbuf[(i * 2) + 1] = sound_audio_mix(pbuf[(i * 2) + 1], tmp_buf1[(i * 2) + 1]);
@@ -539,6 +555,92 @@ int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, i
     return tmp_nr;
 }
 
+/* Render `events' in one go: split the SID stores among the chips, with
+   the cycle each happens at, and let the engine apply them while it
+   clocks.  Events of other chips must not be in the list.  Returns -1 if
+   the engine cannot do that.  */
+/* Sort the stores in `events' into `batch_writes' by chip, each with the
+   cycles since the first event.  Returns the cycles they take.  */
+static int sid_collect_writes(const sound_event_t *events, int num_events, int scc)
+{
+    int i, c, clk = 0;
+    sid_write_t *write;
+
+    if (num_events > batch_size) {
+        batch_size = num_events * 2;
+        for (c = 0; c < SOUND_SIDS_MAX; c++) {
+            batch_writes[c] = lib_realloc(batch_writes[c], batch_size * sizeof(sid_write_t));
+        }
+    }
+
+    for (c = 0; c < SOUND_SIDS_MAX; c++) {
+        batch_num_writes[c] = 0;
+    }
+    for (i = 0; i < num_events; i++) {
+        clk += events[i].run;
+        c = events[i].chipno;
+        if (c < 0 || c >= scc) {
+            continue;
+        }
+        write = &batch_writes[c][batch_num_writes[c]++];
+        write->delta_t = clk;
+        write->addr = (uint8_t)(events[i].addr & 0x1f);
+        write->val = events[i].val;
+    }
+
+    return clk;
+}
+
+int sid_sound_machine_calculate_samples_batch(sound_t **psid, int16_t *pbuf, int nr, int soc, int scc,
+                                              const sound_event_t *events, int num_events, int *delta_t)
+{
+    int retval;
+
+    if (sid_engine.calculate_samples_batch == NULL) {
+        return -1;
+    }
+
+    *delta_t += sid_collect_writes(events, num_events, scc);
+
+    batching = 1;
+    retval = sid_sound_machine_calculate_samples(psid, pbuf, nr, soc, scc, delta_t);
+    batching = 0;
+
+    return retval;
+}
+
+/* Nobody listens: clock the chips through `events' and `delta_t' cycles
+   after them as far as the CPU can tell, without making samples.  Returns
+   -1 if the engine cannot do that; asking with nothing to do touches
+   nothing.  */
+int sid_sound_machine_clock_silent(sound_t **psid, int scc, const sound_event_t *events,
+                                   int num_events, int delta_t)
+{
+    int c;
+
+    if (sid_engine.clock_silent == NULL) {
+        return -1;
+    }
+    if (num_events == 0 && delta_t == 0) {
+        return 0;
+    }
+
+    delta_t += sid_collect_writes(events, num_events, scc);
+    for (c = 0; c < scc; c++) {
+        sid_engine.clock_silent(psid[c], delta_t, batch_writes[c], batch_num_writes[c]);
+    }
+
+    return 0;
+}
+
+CLOCK sid_sound_machine_bus_ttl(sound_t *psid)
+{
+    if (sid_engine.bus_ttl == NULL) {
+        return 0;
+    }
+    return sid_engine.bus_ttl(psid);
+}
+
 void sid_sound_machine_prevent_clk_overflow(sound_t *psid, CLOCK sub)
 {
     sid_engine.prevent_clk_overflow(psid, sub);
@@ -97,6 +97,13 @@ extern void sid_state_read(unsigned int channel,
 extern void sid_state_write(unsigned int channel,
                             struct sid_snapshot_state_s *sid_state);
 
+/* A register write `delta_t' cycles into a batch.  */
+typedef struct sid_write_s {
+    int delta_t;
+    uint8_t addr;
+    uint8_t val;
+} sid_write_t;
+
 struct sid_engine_s {
     struct sound_s *(*open)(uint8_t *sidstate);
     int (*init)(struct sound_s *psid, int speed, int cycles_per_sec, int factor);
@@ -112,6 +119,18 @@ struct sid_engine_s {
                        struct sid_snapshot_state_s *sid_state);
     void (*state_write)(struct sound_s *psid,
                         struct sid_snapshot_state_s *sid_state);
+    /* optional, like calculate_samples() but applies `writes' (sorted by
+       delta_t) on the way */
+    int (*calculate_samples_batch)(struct sound_s *psid, short *pbuf, int nr,
+                                   int interleave, int *delta_t,
+                                   const sid_write_t *writes, int num_writes);
+    /* optional, clock `delta_t' cycles applying `writes' on the way, but
+       only what can be read back; no samples */
+    void (*clock_silent)(struct sound_s *psid, int delta_t,
+                         const sid_write_t *writes, int num_writes);
+    /* optional, cycles a stored value stays on the data bus for reads of
+       the write-only registers */
+    CLOCK (*bus_ttl)(struct sound_s *psid);
 };
 typedef struct sid_engine_s sid_engine_t;
 
@@ -129,6 +148,9 @@ extern uint8_t sid_sound_machine_read(sound_t *psid, uint16_t addr);
 extern void sid_sound_machine_store(sound_t *psid, uint16_t addr, uint8_t byte);
 extern void sid_sound_machine_reset(sound_t *psid, CLOCK cpu_clk);
 extern int sid_sound_machine_calculate_samples(sound_t **psid, int16_t *pbuf, int nr, int sound_output_channels, int sound_chip_channels, int *delta_t);
+extern int sid_sound_machine_calculate_samples_batch(sound_t **psid, int16_t *pbuf, int nr, int sound_output_channels, int sound_chip_channels, const sound_event_t *events, int num_events, int *delta_t);
+extern int sid_sound_machine_clock_silent(sound_t **psid, int sound_chip_channels, const sound_event_t *events, int num_events, int delta_t);
+extern CLOCK sid_sound_machine_bus_ttl(sound_t *psid);
 extern void sid_sound_machine_prevent_clk_overflow(sound_t *psid, CLOCK sub);
 extern char *sid_sound_machine_dump_state(sound_t *psid);
 extern int sid_sound_machine_cycle_based(void);
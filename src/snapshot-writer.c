@@ -0,0 +1,369 @@
+/*
+ * snapshot-writer.c - Compress and write memory snapshots in the background.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * Saving a snapshot to a file stops the emulation for as long as all
+ * modules take to go through stdio.  Taking it into memory is a lot
+ * quicker; this writes such a snapshot out afterwards.  The snapshot is
+ * flattened, deflated into a gzip stream in memory and written with a
+ * single fwrite(), all on the writer thread.
+ *
+ * Snapshots are written in the order they were handed over.  Reading a
+ * snapshot file waits for the writer first, so a file that is still on
+ * its way is never read half written.  Each one goes to `<file>.tmp'
+ * first and is renamed over `<file>' once it is complete, so a failed
+ * save leaves whatever was there before.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef USE_SNAPSHOT_THREAD
+#include <pthread.h>
+#endif
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "archdep.h"
+#include "ioutil.h"
+#include "lib.h"
+#include "log.h"
+#include "profile.h"
+#include "snapshot.h"
+#include "snapshot-writer.h"
+#include "types.h"
+#include "util.h"
+
+typedef struct snapshot_writer_job_s {
+    snapshot_memory_t *mem;
+    char *filename;
+    int compress;
+    struct snapshot_writer_job_s *next;
+} snapshot_writer_job_t;
+
+static snapshot_writer_stats_t writer_stats;
+static int failed_since_wait = 0;
+static int last_result = 0;
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef HAVE_ZLIB
+/* Deflate `size' bytes into a gzip stream, `*out_size' bytes long.  */
+static uint8_t *snapshot_writer_deflate(const uint8_t *buf, size_t size, size_t *out_size)
+{
+    z_stream zs;
+    uint8_t *out;
+    uLong bound;
+
+    memset(&zs, 0, sizeof(zs));
+    /* 16: gzip header and trailer.  Level 1 compresses RAM about as well
+       as the higher ones and is several times faster.  */
+    if (deflateInit2(&zs, Z_BEST_SPEED, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return NULL;
+    }
+
+    /* deflateBound() does not count the gzip header.  */
+    bound = deflateBound(&zs, (uLong)size) + 32;
+    out = lib_malloc(bound);
+
+    zs.next_in = (Bytef *)buf;
+    zs.avail_in = (uInt)size;
+    zs.next_out = out;
+    zs.avail_out = (uInt)bound;
+    if (deflate(&zs, Z_FINISH) != Z_STREAM_END) {
+        deflateEnd(&zs);
+        lib_free(out);
+        return NULL;
+    }
+    *out_size = zs.total_out;
+    deflateEnd(&zs);
+
+    return out;
+}
+#endif
+
+/* Runs on the writer thread if there is one.  */
+static int snapshot_writer_write(snapshot_writer_job_t *job, size_t *size, size_t *file_size)
+{
+    uint8_t *buf, *out;
+    char *tmp_name;
+    FILE *f;
+    int retval = 0;
+
+    *size = snapshot_memory_size(job->mem);
+    buf = lib_malloc(*size);
+    snapshot_memory_flatten(job->mem, buf);
+    snapshot_memory_destroy(job->mem);
+    job->mem = NULL;
+
+    out = buf;
+    *file_size = *size;
+#ifdef HAVE_ZLIB
+    if (job->compress) {
+        out = snapshot_writer_deflate(buf, *size, file_size);
+        if (out == NULL) {
+            lib_free(buf);
+            return -1;
+        }
+    }
+#endif
+
+    tmp_name = util_concat(job->filename, ".tmp", NULL);
+    f = fopen(tmp_name, MODE_WRITE);
+    if (f == NULL) {
+        retval = -1;
+    } else {
+        if (fwrite(out, 1, *file_size, f) != *file_size) {
+            retval = -1;
+        }
+        if (fclose(f) == EOF) {
+            retval = -1;
+        }
+        /* Where rename() does not replace an existing file, the old one
+           has to go first.  */
+        if (retval == 0 && ioutil_rename(tmp_name, job->filename) < 0
+            && (ioutil_remove(job->filename) < 0
+                || ioutil_rename(tmp_name, job->filename) < 0)) {
+            retval = -1;
+        }
+        if (retval < 0) {
+            ioutil_remove(tmp_name);
+        }
+    }
+    lib_free(tmp_name);
+
+    if (out != buf) {
+        lib_free(out);
+    }
+    lib_free(buf);
+
+    return retval;
+}
+
+/* Bookkeeping after a job, with the lock held if there is a thread.  */
+static void snapshot_writer_done(int result, size_t size, size_t file_size, uint64_t ns)
+{
+    if (result < 0) {
+        writer_stats.failed++;
+        failed_since_wait++;
+    } else {
+        writer_stats.saved++;
+        writer_stats.bytes += size;
+        writer_stats.file_bytes += file_size;
+    }
+    writer_stats.writer_ns += ns;
+    last_result = result;
+}
+
+static void snapshot_writer_job_run(snapshot_writer_job_t *job, int *result,
+                                    size_t *size, size_t *file_size, uint64_t *ns)
+{
+    uint64_t start = profile_now_ns();
+
+    *size = *file_size = 0;
+    *result = snapshot_writer_write(job, size, file_size);
+    *ns = profile_now_ns() - start;
+
+    lib_free(job->filename);
+    lib_free(job);
+}
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef USE_SNAPSHOT_THREAD
+
+static pthread_t writer_thread;
+static pthread_mutex_t writer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t writer_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t writer_idle = PTHREAD_COND_INITIALIZER;
+static int writer_running = 0;
+static int writer_failed_to_start = 0;
+static int writer_quit = 0;
+static snapshot_writer_job_t *queue_head = NULL;
+static snapshot_writer_job_t *queue_tail = NULL;
+
+static void *snapshot_writer_main(void *arg)
+{
+    snapshot_writer_job_t *job;
+    size_t size, file_size;
+    uint64_t ns;
+    int result;
+
+    pthread_mutex_lock(&writer_lock);
+    for (;;) {
+        while (queue_head == NULL && !writer_quit) {
+            pthread_cond_wait(&writer_wakeup, &writer_lock);
+        }
+        if (queue_head == NULL) {
+            break;
+        }
+        job = queue_head;
+        queue_head = job->next;
+        if (queue_head == NULL) {
+            queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&writer_lock);
+
+        snapshot_writer_job_run(job, &result, &size, &file_size, &ns);
+
+        pthread_mutex_lock(&writer_lock);
+        snapshot_writer_done(result, size, file_size, ns);
+        writer_stats.pending--;
+        if (writer_stats.pending == 0) {
+            pthread_cond_broadcast(&writer_idle);
+        }
+    }
+    pthread_mutex_unlock(&writer_lock);
+
+    return NULL;
+}
+
+static int snapshot_writer_start(void)
+{
+    if (writer_running) {
+        return 0;
+    }
+    if (writer_failed_to_start) {
+        return -1;
+    }
+
+    writer_quit = 0;
+    if (pthread_create(&writer_thread, NULL, snapshot_writer_main, NULL) != 0) {
+        log_error(LOG_DEFAULT, "Cannot start the snapshot writer thread, writing snapshots right away.");
+        writer_failed_to_start = 1;
+        return -1;
+    }
+    writer_running = 1;
+    return 0;
+}
+
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+int snapshot_writer_save(snapshot_memory_t *mem, const char *filename, int compress)
+{
+    snapshot_writer_job_t *job;
+    size_t size, file_size;
+    uint64_t ns;
+    int result;
+
+    if (mem == NULL || filename == NULL) {
+        return -1;
+    }
+
+    job = lib_malloc(sizeof(snapshot_writer_job_t));
+    job->mem = mem;
+    job->filename = lib_stralloc(filename);
+    job->compress = compress;
+    job->next = NULL;
+
+#ifdef USE_SNAPSHOT_THREAD
+    if (snapshot_writer_start() == 0) {
+        pthread_mutex_lock(&writer_lock);
+        if (queue_tail != NULL) {
+            queue_tail->next = job;
+        } else {
+            queue_head = job;
+        }
+        queue_tail = job;
+        writer_stats.pending++;
+        pthread_cond_signal(&writer_wakeup);
+        pthread_mutex_unlock(&writer_lock);
+        return 0;
+    }
+#endif
+
+    snapshot_writer_job_run(job, &result, &size, &file_size, &ns);
+    snapshot_writer_done(result, size, file_size, ns);
+    return result;
+}
+
+int snapshot_writer_wait(void)
+{
+    int failed;
+
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_lock(&writer_lock);
+    while (writer_stats.pending > 0) {
+        pthread_cond_wait(&writer_idle, &writer_lock);
+    }
+#endif
+    failed = failed_since_wait;
+    failed_since_wait = 0;
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_unlock(&writer_lock);
+#endif
+    if (failed > 0) {
+        log_error(LOG_DEFAULT, "%d snapshot(s) could not be written.", failed);
+    }
+    return failed;
+}
+
+int snapshot_writer_wait_last(void)
+{
+    int result;
+
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_lock(&writer_lock);
+    while (writer_stats.pending > 0) {
+        pthread_cond_wait(&writer_idle, &writer_lock);
+    }
+#endif
+    result = last_result;
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_unlock(&writer_lock);
+#endif
+    return result;
+}
+
+void snapshot_writer_get_stats(snapshot_writer_stats_t *stats)
+{
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_lock(&writer_lock);
+#endif
+    *stats = writer_stats;
+#ifdef USE_SNAPSHOT_THREAD
+    pthread_mutex_unlock(&writer_lock);
+#endif
+}
+
+void snapshot_writer_shutdown(void)
+{
+    snapshot_writer_wait();
+
+#ifdef USE_SNAPSHOT_THREAD
+    if (writer_running) {
+        pthread_mutex_lock(&writer_lock);
+        writer_quit = 1;
+        pthread_cond_signal(&writer_wakeup);
+        pthread_mutex_unlock(&writer_lock);
+        pthread_join(writer_thread, NULL);
+        writer_running = 0;
+    }
+#endif
+}
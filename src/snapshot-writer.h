@@ -0,0 +1,61 @@
+/*
+ * snapshot-writer.h - Compress and write memory snapshots in the background.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_SNAPSHOT_WRITER_H
+#define VICE_SNAPSHOT_WRITER_H
+
+#include "types.h"
+
+struct snapshot_memory_s;
+
+typedef struct snapshot_writer_stats_s {
+    unsigned long saved;
+    unsigned long failed;
+    unsigned long pending;      /* queued or being written right now */
+    uint64_t bytes;             /* size of the snapshots written */
+    uint64_t file_bytes;        /* what they took in the files */
+    uint64_t writer_ns;         /* spent compressing and writing */
+} snapshot_writer_stats_t;
+
+/* Write a memory snapshot to `filename', gzip compressed if `compress' is
+   set (snapshot_open() takes both).  The writer owns the snapshot from
+   now on and destroys it when done, so it must not be the base of
+   another one.  With USE_SNAPSHOT_THREAD this only queues it; otherwise,
+   or if the thread cannot be started, it is written right away.  */
+extern int snapshot_writer_save(struct snapshot_memory_s *mem, const char *filename,
+                                int compress);
+
+/* Wait until everything queued is written.  Returns the number of
+   snapshots that could not be written since the last call.  */
+extern int snapshot_writer_wait(void);
+
+/* Wait until everything queued is written and return the result of the
+   last snapshot handed over: 0 if it made it into its file, -1 if not.
+   Unlike snapshot_writer_wait() this does not count as having seen the
+   failures.  */
+extern int snapshot_writer_wait_last(void);
+
+extern void snapshot_writer_get_stats(snapshot_writer_stats_t *stats);
+extern void snapshot_writer_shutdown(void);
+
+#endif
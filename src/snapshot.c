@@ -36,6 +36,7 @@
 #include "ioutil.h"
 #include "log.h"
 #include "snapshot.h"
+#include "snapshot-writer.h"
 #ifdef USE_SVN_REVISION
 #include "svnversion.h"
 #endif
@@ -45,6 +46,10 @@
 #include "vsync.h"
 #include "zfile.h"
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 static int snapshot_error = SNAPSHOT_NO_ERROR;
 static char *current_module = NULL;
 static char read_name[SNAPSHOT_MACHINE_NAME_LEN];
@@ -57,9 +62,11 @@ char snapshot_version_magic_string[] = "VICE Version\032";
 #define SNAPSHOT_MAGIC_LEN              19
 #define SNAPSHOT_VERSION_MAGIC_LEN      13
 
+typedef struct snapshot_stream_s snapshot_stream_t;
+
 struct snapshot_module_s {
-    /* File descriptor.  */
-    FILE *file;
+    /* File or memory it is in.  */
+    snapshot_stream_t *file;
 
     /* Flag: are we writing it?  */
     int write_mode;
@@ -75,8 +82,8 @@ struct snapshot_module_s {
 };
 
 struct snapshot_s {
-    /* File descriptor.  */
-    FILE *file;
+    /* File or memory it is in.  */
+    snapshot_stream_t *file;
 
     /* Offset of the first module.  */
     long first_module_offset;
@@ -87,9 +94,373 @@ struct snapshot_s {
 
 /* ------------------------------------------------------------------------- */
 
-static int snapshot_write_byte(FILE *f, uint8_t data)
+/* A memory snapshot keeps what would be the file as a list of segments.
+   Small items go to an arena that grows as needed.  Byte arrays of a
+   page or more (RAM, color RAM, drive RAM, ...) go to reference counted
+   pages instead.  A snapshot taken with a base compares each such array
+   with the one at the same place in the base and shares the pages that
+   did not change.  */
+
+#define SNAPSHOT_PAGE_SIZE 256
+
+typedef struct snapshot_page_s {
+    unsigned int refs;
+    uint8_t data[SNAPSHOT_PAGE_SIZE];
+} snapshot_page_t;
+
+typedef struct snapshot_segment_s {
+    /* Where it would be in the file.  */
+    size_t start;
+    size_t len;
+
+    /* Small items: where they are in the arena.  */
+    size_t arena_offset;
+
+    /* A byte array: its pages, or NULL.  */
+    snapshot_page_t **pages;
+} snapshot_segment_t;
+
+struct snapshot_memory_s {
+    uint8_t *arena;
+    size_t arena_len;
+    size_t arena_size;
+
+    snapshot_segment_t *segments;
+    int num_segments;
+    int max_segments;
+
+    /* Size of the file it would be.  */
+    size_t size;
+};
+
+struct snapshot_stream_s {
+    /* File snapshots.  */
+    FILE *file;
+
+    /* Memory snapshots, and the one to share pages with when writing.  */
+    snapshot_memory_t *mem;
+    int mem_owned;
+    const snapshot_memory_t *base;
+    int base_segment;
+
+    /* Position, and the segment it is probably in.  */
+    size_t pos;
+    int segment;
+};
+
+static const char snapshot_memory_name[] = "(memory)";
+
+/* Bytes held by all memory snapshots together.  The snapshot writer
+   thread destroys the ones it has written, so this is updated atomically.  */
+static size_t memory_in_use = 0;
+
+#define MEMORY_IN_USE_ADD(n) __atomic_add_fetch(&memory_in_use, (n), __ATOMIC_RELAXED)
+#define MEMORY_IN_USE_SUB(n) __atomic_sub_fetch(&memory_in_use, (n), __ATOMIC_RELAXED)
+
+static void snapshot_memory_clear(snapshot_memory_t *mem)
+{
+    snapshot_segment_t *seg;
+    size_t i;
+    int j;
+
+    for (j = 0; j < mem->num_segments; j++) {
+        seg = &mem->segments[j];
+        if (seg->pages != NULL) {
+            for (i = 0; i < (seg->len + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE; i++) {
+                if (--seg->pages[i]->refs == 0) {
+                    lib_free(seg->pages[i]);
+                    MEMORY_IN_USE_SUB(sizeof(snapshot_page_t));
+                }
+            }
+            lib_free(seg->pages);
+        }
+    }
+    MEMORY_IN_USE_SUB(mem->arena_size);
+
+    lib_free(mem->arena);
+    lib_free(mem->segments);
+    memset(mem, 0, sizeof(snapshot_memory_t));
+}
+
+snapshot_memory_t *snapshot_memory_new(void)
+{
+    return lib_calloc(1, sizeof(snapshot_memory_t));
+}
+
+void snapshot_memory_destroy(snapshot_memory_t *mem)
+{
+    if (mem != NULL) {
+        snapshot_memory_clear(mem);
+        lib_free(mem);
+    }
+}
+
+size_t snapshot_memory_size(const snapshot_memory_t *mem)
 {
-    if (fputc(data, f) == EOF) {
+    return mem->size;
+}
+
+size_t snapshot_memory_in_use(void)
+{
+    return __atomic_load_n(&memory_in_use, __ATOMIC_RELAXED);
+}
+
+void snapshot_memory_flatten(const snapshot_memory_t *mem, uint8_t *buf)
+{
+    const snapshot_segment_t *seg;
+    size_t i, n;
+    int j;
+
+    for (j = 0; j < mem->num_segments; j++) {
+        seg = &mem->segments[j];
+        if (seg->pages == NULL) {
+            memcpy(buf + seg->start, mem->arena + seg->arena_offset, seg->len);
+            continue;
+        }
+        for (i = 0; i < seg->len; i += n) {
+            n = seg->len - i < SNAPSHOT_PAGE_SIZE ? seg->len - i : SNAPSHOT_PAGE_SIZE;
+            memcpy(buf + seg->start + i, seg->pages[i / SNAPSHOT_PAGE_SIZE]->data, n);
+        }
+    }
+}
+
+static snapshot_segment_t *snapshot_memory_add_segment(snapshot_memory_t *mem, size_t len)
+{
+    snapshot_segment_t *seg;
+
+    if (mem->num_segments == mem->max_segments) {
+        mem->max_segments = mem->max_segments ? mem->max_segments * 2 : 64;
+        mem->segments = lib_realloc(mem->segments, mem->max_segments * sizeof(snapshot_segment_t));
+    }
+    seg = &mem->segments[mem->num_segments++];
+    seg->start = mem->size;
+    seg->len = len;
+    seg->arena_offset = mem->arena_len;
+    seg->pages = NULL;
+    mem->size += len;
+
+    return seg;
+}
+
+/* The segment holding `pos', or -1.  */
+static int snapshot_memory_find(const snapshot_memory_t *mem, size_t pos, int hint)
+{
+    int i;
+
+    for (i = hint; i < mem->num_segments; i++) {
+        if (pos < mem->segments[i].start) {
+            break;
+        }
+        if (pos < mem->segments[i].start + mem->segments[i].len) {
+            return i;
+        }
+    }
+    for (i = 0; i < mem->num_segments && i < hint; i++) {
+        if (pos >= mem->segments[i].start && pos < mem->segments[i].start + mem->segments[i].len) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int snapshot_memory_append(snapshot_memory_t *mem, const uint8_t *data, size_t num)
+{
+    snapshot_segment_t *seg = mem->num_segments ? &mem->segments[mem->num_segments - 1] : NULL;
+
+    if (mem->arena_len + num > mem->arena_size) {
+        size_t size = mem->arena_size ? mem->arena_size : 0x1000;
+
+        while (size < mem->arena_len + num) {
+            size *= 2;
+        }
+        mem->arena = lib_realloc(mem->arena, size);
+        MEMORY_IN_USE_ADD(size - mem->arena_size);
+        mem->arena_size = size;
+    }
+
+    if (seg != NULL && seg->pages == NULL && seg->arena_offset + seg->len == mem->arena_len) {
+        seg->len += num;
+        mem->size += num;
+    } else {
+        snapshot_memory_add_segment(mem, num);
+    }
+    memcpy(mem->arena + mem->arena_len, data, num);
+    mem->arena_len += num;
+
+    return 0;
+}
+
+/* A byte array at the end: share the pages the base has at the same
+   place, if they are the same.  */
+static int snapshot_memory_append_pages(snapshot_stream_t *f, const uint8_t *data, size_t num)
+{
+    snapshot_memory_t *mem = f->mem;
+    const snapshot_segment_t *base_seg = NULL;
+    snapshot_segment_t *seg;
+    size_t i, n, count = (num + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE;
+    snapshot_page_t **pages;
+
+    if (f->base != NULL) {
+        while (f->base_segment < f->base->num_segments) {
+            base_seg = &f->base->segments[f->base_segment++];
+            if (base_seg->pages != NULL) {
+                break;
+            }
+            base_seg = NULL;
+        }
+        if (base_seg != NULL && base_seg->len != num) {
+            base_seg = NULL;
+        }
+    }
+
+    pages = lib_malloc(count * sizeof(snapshot_page_t *));
+    for (i = 0; i < count; i++, data += SNAPSHOT_PAGE_SIZE) {
+        n = num - i * SNAPSHOT_PAGE_SIZE;
+        if (n > SNAPSHOT_PAGE_SIZE) {
+            n = SNAPSHOT_PAGE_SIZE;
+        }
+        if (base_seg != NULL && memcmp(base_seg->pages[i]->data, data, n) == 0) {
+            pages[i] = base_seg->pages[i];
+        } else {
+            pages[i] = lib_malloc(sizeof(snapshot_page_t));
+            pages[i]->refs = 0;
+            memcpy(pages[i]->data, data, n);
+            MEMORY_IN_USE_ADD(sizeof(snapshot_page_t));
+        }
+        pages[i]->refs++;
+    }
+
+    seg = snapshot_memory_add_segment(mem, num);
+    seg->pages = pages;
+
+    return 0;
+}
+
+/* Copy between `buf' and the snapshot at `pos'.  Only small items can be
+   written over, which is all the module headers need.  */
+static int snapshot_memory_copy(snapshot_stream_t *f, uint8_t *buf, size_t num, int write)
+{
+    snapshot_memory_t *mem = f->mem;
+    snapshot_segment_t *seg;
+    size_t offset, n;
+    int i;
+
+    while (num > 0) {
+        i = snapshot_memory_find(mem, f->pos, f->segment);
+        if (i < 0) {
+            return -1;
+        }
+        f->segment = i;
+        seg = &mem->segments[i];
+        offset = f->pos - seg->start;
+        n = seg->len - offset;
+        if (n > num) {
+            n = num;
+        }
+
+        if (seg->pages == NULL) {
+            if (write) {
+                memcpy(mem->arena + seg->arena_offset + offset, buf, n);
+            } else {
+                memcpy(buf, mem->arena + seg->arena_offset + offset, n);
+            }
+        } else {
+            size_t done = 0, part;
+
+            if (write) {
+                return -1;
+            }
+            while (done < n) {
+                part = SNAPSHOT_PAGE_SIZE - (offset + done) % SNAPSHOT_PAGE_SIZE;
+                if (part > n - done) {
+                    part = n - done;
+                }
+                memcpy(buf + done,
+                       seg->pages[(offset + done) / SNAPSHOT_PAGE_SIZE]->data + (offset + done) % SNAPSHOT_PAGE_SIZE,
+                       part);
+                done += part;
+            }
+        }
+
+        buf += n;
+        num -= n;
+        f->pos += n;
+    }
+
+    return 0;
+}
+
+static int snapshot_stream_write(snapshot_stream_t *f, const uint8_t *data, size_t num)
+{
+    if (f->file != NULL) {
+        return fwrite(data, num, 1, f->file) < 1 ? -1 : 0;
+    }
+
+    if (f->pos == f->mem->size) {
+        snapshot_memory_append(f->mem, data, num);
+        f->pos += num;
+        return 0;
+    }
+    return snapshot_memory_copy(f, (uint8_t *)data, num, 1);
+}
+
+static int snapshot_stream_write_array(snapshot_stream_t *f, const uint8_t *data, size_t num)
+{
+    if (f->file == NULL && num >= SNAPSHOT_PAGE_SIZE && f->pos == f->mem->size) {
+        snapshot_memory_append_pages(f, data, num);
+        f->pos += num;
+        return 0;
+    }
+    return snapshot_stream_write(f, data, num);
+}
+
+static int snapshot_stream_read(snapshot_stream_t *f, uint8_t *data, size_t num)
+{
+    if (f->file != NULL) {
+        return fread(data, num, 1, f->file) < 1 ? -1 : 0;
+    }
+
+    if (f->pos + num > f->mem->size) {
+        return -1;
+    }
+    return snapshot_memory_copy(f, data, num, 0);
+}
+
+static int snapshot_stream_getc(snapshot_stream_t *f)
+{
+    uint8_t c;
+
+    if (f->file != NULL) {
+        return fgetc(f->file);
+    }
+    return snapshot_stream_read(f, &c, 1) < 0 ? EOF : c;
+}
+
+static long snapshot_stream_tell(snapshot_stream_t *f)
+{
+    if (f->file != NULL) {
+        return ftell(f->file);
+    }
+    return (long)f->pos;
+}
+
+static int snapshot_stream_seek(snapshot_stream_t *f, long offset)
+{
+    if (f->file != NULL) {
+        return fseek(f->file, offset, SEEK_SET);
+    }
+    if (offset < 0) {
+        return -1;
+    }
+    f->pos = (size_t)offset;
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int snapshot_write_byte(snapshot_stream_t *f, uint8_t data)
+{
+    if (snapshot_stream_write(f, &data, 1) < 0) {
         snapshot_error = SNAPSHOT_WRITE_EOF_ERROR;
         return -1;
     }
@@ -97,7 +468,7 @@ static int snapshot_write_byte(FILE *f, uint8_t data)
     return 0;
 }
 
-static int snapshot_write_word(FILE *f, uint16_t data)
+static int snapshot_write_word(snapshot_stream_t *f, uint16_t data)
 {
     if (snapshot_write_byte(f, (uint8_t)(data & 0xff)) < 0
         || snapshot_write_byte(f, (uint8_t)(data >> 8)) < 0) {
@@ -107,7 +478,7 @@ static int snapshot_write_word(FILE *f, uint16_t data)
     return 0;
 }
 
-static int snapshot_write_dword(FILE *f, uint32_t data)
+static int snapshot_write_dword(snapshot_stream_t *f, uint32_t data)
 {
     if (snapshot_write_word(f, (uint16_t)(data & 0xffff)) < 0
         || snapshot_write_word(f, (uint16_t)(data >> 16)) < 0) {
@@ -117,7 +488,7 @@ static int snapshot_write_dword(FILE *f, uint32_t data)
     return 0;
 }
 
-static int snapshot_write_double(FILE *f, double data)
+static int snapshot_write_double(snapshot_stream_t *f, double data)
 {
     uint8_t *byte_data = (uint8_t *)&data;
     int i;
@@ -130,7 +501,7 @@ static int snapshot_write_double(FILE *f, double data)
     return 0;
 }
 
-static int snapshot_write_padded_string(FILE *f, const char *s, uint8_t pad_char,
+static int snapshot_write_padded_string(snapshot_stream_t *f, const char *s, uint8_t pad_char,
                                         int len)
 {
     int i, found_zero;
@@ -149,9 +520,9 @@ static int snapshot_write_padded_string(FILE *f, const char *s, uint8_t pad_char
     return 0;
 }
 
-static int snapshot_write_byte_array(FILE *f, const uint8_t *data, unsigned int num)
+static int snapshot_write_byte_array(snapshot_stream_t *f, const uint8_t *data, unsigned int num)
 {
-    if (num > 0 && fwrite(data, (size_t)num, 1, f) < 1) {
+    if (num > 0 && snapshot_stream_write_array(f, data, num) < 0) {
         snapshot_error = SNAPSHOT_WRITE_BYTE_ARRAY_ERROR;
         return -1;
     }
@@ -159,7 +530,7 @@ static int snapshot_write_byte_array(FILE *f, const uint8_t *data, unsigned int
     return 0;
 }
 
-static int snapshot_write_word_array(FILE *f, const uint16_t *data, unsigned int num)
+static int snapshot_write_word_array(snapshot_stream_t *f, const uint16_t *data, unsigned int num)
 {
     unsigned int i;
 
@@ -172,7 +543,7 @@ static int snapshot_write_word_array(FILE *f, const uint16_t *data, unsigned int
     return 0;
 }
 
-static int snapshot_write_dword_array(FILE *f, const uint32_t *data, unsigned int num)
+static int snapshot_write_dword_array(snapshot_stream_t *f, const uint32_t *data, unsigned int num)
 {
     unsigned int i;
 
@@ -186,7 +557,7 @@ static int snapshot_write_dword_array(FILE *f, const uint32_t *data, unsigned in
 }
 
 
-static int snapshot_write_string(FILE *f, const char *s)
+static int snapshot_write_string(snapshot_stream_t *f, const char *s)
 {
     size_t len, i;
 
@@ -205,11 +576,11 @@ static int snapshot_write_string(FILE *f, const char *s)
     return (int)(len + sizeof(uint16_t));
 }
 
-static int snapshot_read_byte(FILE *f, uint8_t *b_return)
+static int snapshot_read_byte(snapshot_stream_t *f, uint8_t *b_return)
 {
     int c;
 
-    c = fgetc(f);
+    c = snapshot_stream_getc(f);
     if (c == EOF) {
         snapshot_error = SNAPSHOT_READ_EOF_ERROR;
         return -1;
@@ -218,7 +589,7 @@ static int snapshot_read_byte(FILE *f, uint8_t *b_return)
     return 0;
 }
 
-static int snapshot_read_word(FILE *f, uint16_t *w_return)
+static int snapshot_read_word(snapshot_stream_t *f, uint16_t *w_return)
 {
     uint8_t lo, hi;
 
@@ -230,7 +601,7 @@ static int snapshot_read_word(FILE *f, uint16_t *w_return)
     return 0;
 }
 
-static int snapshot_read_dword(FILE *f, uint32_t *dw_return)
+static int snapshot_read_dword(snapshot_stream_t *f, uint32_t *dw_return)
 {
     uint16_t lo, hi;
 
@@ -242,7 +613,7 @@ static int snapshot_read_dword(FILE *f, uint32_t *dw_return)
     return 0;
 }
 
-static int snapshot_read_double(FILE *f, double *d_return)
+static int snapshot_read_double(snapshot_stream_t *f, double *d_return)
 {
     int i;
     int c;
@@ -250,7 +621,7 @@ static int snapshot_read_double(FILE *f, double *d_return)
     uint8_t *byte_val = (uint8_t *)&val;
 
     for (i = 0; i < sizeof(double); i++) {
-        c = fgetc(f);
+        c = snapshot_stream_getc(f);
         if (c == EOF) {
             snapshot_error = SNAPSHOT_READ_EOF_ERROR;
             return -1;
@@ -261,9 +632,9 @@ static int snapshot_read_double(FILE *f, double *d_return)
     return 0;
 }
 
-static int snapshot_read_byte_array(FILE *f, uint8_t *b_return, unsigned int num)
+static int snapshot_read_byte_array(snapshot_stream_t *f, uint8_t *b_return, unsigned int num)
 {
-    if (num > 0 && fread(b_return, (size_t)num, 1, f) < 1) {
+    if (num > 0 && snapshot_stream_read(f, b_return, num) < 0) {
         snapshot_error = SNAPSHOT_READ_BYTE_ARRAY_ERROR;
         return -1;
     }
@@ -271,7 +642,7 @@ static int snapshot_read_byte_array(FILE *f, uint8_t *b_return, unsigned int num
     return 0;
 }
 
-static int snapshot_read_word_array(FILE *f, uint16_t *w_return, unsigned int num)
+static int snapshot_read_word_array(snapshot_stream_t *f, uint16_t *w_return, unsigned int num)
 {
     unsigned int i;
 
@@ -284,7 +655,7 @@ static int snapshot_read_word_array(FILE *f, uint16_t *w_return, unsigned int nu
     return 0;
 }
 
-static int snapshot_read_dword_array(FILE *f, uint32_t *dw_return, unsigned int num)
+static int snapshot_read_dword_array(snapshot_stream_t *f, uint32_t *dw_return, unsigned int num)
 {
     unsigned int i;
 
@@ -297,7 +668,7 @@ static int snapshot_read_dword_array(FILE *f, uint32_t *dw_return, unsigned int
     return 0;
 }
 
-static int snapshot_read_string(FILE *f, char **s)
+static int snapshot_read_string(snapshot_stream_t *f, char **s)
 {
     int i, len;
     uint16_t w;
@@ -427,7 +798,7 @@ int snapshot_module_write_string(snapshot_module_t *m, const char *s)
 
 int snapshot_module_read_byte(snapshot_module_t *m, uint8_t *b_return)
 {
-    if (ftell(m->file) + sizeof(uint8_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint8_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -437,7 +808,7 @@ int snapshot_module_read_byte(snapshot_module_t *m, uint8_t *b_return)
 
 int snapshot_module_read_word(snapshot_module_t *m, uint16_t *w_return)
 {
-    if (ftell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -447,7 +818,7 @@ int snapshot_module_read_word(snapshot_module_t *m, uint16_t *w_return)
 
 int snapshot_module_read_dword(snapshot_module_t *m, uint32_t *dw_return)
 {
-    if (ftell(m->file) + sizeof(uint32_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint32_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -457,7 +828,7 @@ int snapshot_module_read_dword(snapshot_module_t *m, uint32_t *dw_return)
 
 int snapshot_module_read_double(snapshot_module_t *m, double *db_return)
 {
-    if (ftell(m->file) + sizeof(double) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(double) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -467,7 +838,7 @@ int snapshot_module_read_double(snapshot_module_t *m, double *db_return)
 
 int snapshot_module_read_byte_array(snapshot_module_t *m, uint8_t *b_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -477,7 +848,7 @@ int snapshot_module_read_byte_array(snapshot_module_t *m, uint8_t *b_return, uns
 
 int snapshot_module_read_word_array(snapshot_module_t *m, uint16_t *w_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num * sizeof(uint16_t)) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num * sizeof(uint16_t)) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -487,7 +858,7 @@ int snapshot_module_read_word_array(snapshot_module_t *m, uint16_t *w_return, un
 
 int snapshot_module_read_dword_array(snapshot_module_t *m, uint32_t *dw_return, unsigned int num)
 {
-    if ((long)(ftell(m->file) + num * sizeof(uint32_t)) > (long)(m->offset + m->size)) {
+    if ((long)(snapshot_stream_tell(m->file) + num * sizeof(uint32_t)) > (long)(m->offset + m->size)) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -497,7 +868,7 @@ int snapshot_module_read_dword_array(snapshot_module_t *m, uint32_t *dw_return,
 
 int snapshot_module_read_string(snapshot_module_t *m, char **charp_return)
 {
-    if (ftell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
+    if (snapshot_stream_tell(m->file) + sizeof(uint16_t) > m->offset + m->size) {
         snapshot_error = SNAPSHOT_READ_OUT_OF_BOUNDS_ERROR;
         return -1;
     }
@@ -570,7 +941,7 @@ snapshot_module_t *snapshot_module_create(snapshot_t *s, const char *name, uint8
 
     m = lib_malloc(sizeof(snapshot_module_t));
     m->file = s->file;
-    m->offset = ftell(s->file);
+    m->offset = snapshot_stream_tell(s->file);
     if (m->offset == -1) {
         snapshot_error = SNAPSHOT_ILLEGAL_OFFSET_ERROR;
         lib_free(m);
@@ -585,8 +956,8 @@ snapshot_module_t *snapshot_module_create(snapshot_t *s, const char *name, uint8
         return NULL;
     }
 
-    m->size = ftell(s->file) - m->offset;
-    m->size_offset = ftell(s->file) - sizeof(uint32_t);
+    m->size = snapshot_stream_tell(s->file) - m->offset;
+    m->size_offset = snapshot_stream_tell(s->file) - sizeof(uint32_t);
 
     return m;
 }
@@ -599,7 +970,7 @@ snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t
 
     current_module = (char *)name;
 
-    if (fseek(s->file, s->first_module_offset, SEEK_SET) < 0) {
+    if (snapshot_stream_seek(s->file, s->first_module_offset) < 0) {
         snapshot_error = SNAPSHOT_FIRST_MODULE_NOT_FOUND_ERROR;
         return NULL;
     }
@@ -629,7 +1000,7 @@ snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t
         }
 
         m->offset += m->size;
-        if (fseek(s->file, m->offset, SEEK_SET) < 0) {
+        if (snapshot_stream_seek(s->file, m->offset) < 0) {
             snapshot_error = SNAPSHOT_MODULE_NOT_FOUND_ERROR;
             goto fail;
         }
@@ -641,12 +1012,12 @@ snapshot_module_t *snapshot_module_open(snapshot_t *s, const char *name, uint8_t
 		}
     }
 
-    m->size_offset = ftell(s->file) - sizeof(uint32_t);
+    m->size_offset = snapshot_stream_tell(s->file) - sizeof(uint32_t);
 
     return m;
 
 fail:
-    fseek(s->file, s->first_module_offset, SEEK_SET);
+    snapshot_stream_seek(s->file, s->first_module_offset);
     lib_free(m);
     return NULL;
 }
@@ -655,14 +1026,14 @@ int snapshot_module_close(snapshot_module_t *m)
 {
     /* Backpatch module size if writing.  */
     if (m->write_mode
-        && (fseek(m->file, m->size_offset, SEEK_SET) < 0
+        && (snapshot_stream_seek(m->file, m->size_offset) < 0
             || snapshot_write_dword(m->file, m->size) < 0)) {
         snapshot_error = SNAPSHOT_MODULE_CLOSE_ERROR;
         return -1;
     }
 
     /* Skip module.  */
-    if (fseek(m->file, m->offset + m->size, SEEK_SET) < 0) {
+    if (snapshot_stream_seek(m->file, m->offset + m->size) < 0) {
         snapshot_error = SNAPSHOT_MODULE_SKIP_ERROR;
         return -1;
     }
@@ -673,43 +1044,33 @@ int snapshot_module_close(snapshot_module_t *m)
 
 /* ------------------------------------------------------------------------- */
 
-snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
+static int snapshot_write_header(snapshot_stream_t *f, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
 {
-    FILE *f;
-    snapshot_t *s;
     unsigned char viceversion[4] = { VERSION_RC_NUMBER };
 
-    current_filename = (char *)filename;
-
-    f = fopen(filename, MODE_WRITE);
-    if (f == NULL) {
-        snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
-        return NULL;
-    }
-
     /* Magic string.  */
     if (snapshot_write_padded_string(f, snapshot_magic_string, (uint8_t)0, SNAPSHOT_MAGIC_LEN) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_WRITE_MAGIC_STRING_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* Version number.  */
     if (snapshot_write_byte(f, major_version) < 0
         || snapshot_write_byte(f, minor_version) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_WRITE_VERSION_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* Machine.  */
     if (snapshot_write_padded_string(f, snapshot_machine_name, (uint8_t)0, SNAPSHOT_MACHINE_NAME_LEN) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_WRITE_MACHINE_NAME_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* VICE version and revision */
     if (snapshot_write_padded_string(f, snapshot_version_magic_string, (uint8_t)0, SNAPSHOT_VERSION_MAGIC_LEN) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_WRITE_MAGIC_STRING_ERROR;
-        goto fail;
+        return -1;
     }
 
     if (snapshot_write_byte(f, viceversion[0]) < 0
@@ -722,62 +1083,112 @@ snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t
         || snapshot_write_dword(f, 0) < 0) {
 #endif
         snapshot_error = SNAPSHOT_CANNOT_WRITE_VERSION_ERROR;
-        goto fail;
+        return -1;
     }
 
+    return 0;
+}
+
+static snapshot_t *snapshot_new(snapshot_stream_t *f, int write_mode)
+{
+    snapshot_t *s;
+
     s = lib_malloc(sizeof(snapshot_t));
     s->file = f;
-    s->first_module_offset = ftell(f);
-    s->write_mode = 1;
+    s->first_module_offset = snapshot_stream_tell(f);
+    s->write_mode = write_mode;
 
     return s;
+}
 
-fail:
-    fclose(f);
-    ioutil_remove(filename);
-    return NULL;
+snapshot_t *snapshot_create(const char *filename, uint8_t major_version, uint8_t minor_version, const char *snapshot_machine_name)
+{
+    FILE *f;
+    snapshot_stream_t *stream;
+
+    current_filename = (char *)filename;
+
+    f = fopen(filename, MODE_WRITE);
+    if (f == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_CREATE_SNAPSHOT_ERROR;
+        return NULL;
+    }
+    stream = lib_calloc(1, sizeof(snapshot_stream_t));
+    stream->file = f;
+
+    if (snapshot_write_header(stream, major_version, minor_version, snapshot_machine_name) < 0) {
+        fclose(f);
+        lib_free(stream);
+        ioutil_remove(filename);
+        return NULL;
+    }
+
+    return snapshot_new(stream, 1);
+}
+
+snapshot_t *snapshot_memory_create(snapshot_memory_t *mem, const snapshot_memory_t *base,
+                                   uint8_t major_version, uint8_t minor_version,
+                                   const char *snapshot_machine_name)
+{
+    snapshot_stream_t *stream;
+
+    current_filename = (char *)snapshot_memory_name;
+
+    snapshot_memory_clear(mem);
+    stream = lib_calloc(1, sizeof(snapshot_stream_t));
+    stream->mem = mem;
+    stream->base = base != mem ? base : NULL;
+
+    if (snapshot_write_header(stream, major_version, minor_version, snapshot_machine_name) < 0) {
+        snapshot_memory_clear(mem);
+        lib_free(stream);
+        return NULL;
+    }
+
+    return snapshot_new(stream, 1);
+}
+
+snapshot_t *snapshot_memory_append_modules(snapshot_memory_t *mem)
+{
+    snapshot_stream_t *stream;
+
+    current_filename = (char *)snapshot_memory_name;
+
+    stream = lib_calloc(1, sizeof(snapshot_stream_t));
+    stream->mem = mem;
+    stream->pos = mem->size;
+
+    return snapshot_new(stream, 1);
 }
 
 /* informal only, used by the error message created below */
 static unsigned char snapshot_viceversion[4];
 static uint32_t snapshot_vicerevision;
 
-snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
+static int snapshot_read_header(snapshot_stream_t *f, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
 {
-    FILE *f;
     char magic[SNAPSHOT_MAGIC_LEN];
-    snapshot_t *s = NULL;
     int machine_name_len;
     size_t offs;
 
-    current_machine_name = (char *)snapshot_machine_name;
-    current_filename = (char *)filename;
-    current_module = NULL;
-
-    f = zfile_fopen(filename, MODE_READ);
-    if (f == NULL) {
-        snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
-        return NULL;
-    }
-
     /* Magic string.  */
     if (snapshot_read_byte_array(f, (uint8_t *)magic, SNAPSHOT_MAGIC_LEN) < 0
         || memcmp(magic, snapshot_magic_string, SNAPSHOT_MAGIC_LEN) != 0) {
         snapshot_error = SNAPSHOT_MAGIC_STRING_MISMATCH_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* Version number.  */
     if (snapshot_read_byte(f, major_version_return) < 0
         || snapshot_read_byte(f, minor_version_return) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_READ_VERSION_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* Machine.  */
     if (snapshot_read_byte_array(f, (uint8_t *)read_name, SNAPSHOT_MACHINE_NAME_LEN) < 0) {
         snapshot_error = SNAPSHOT_CANNOT_READ_MACHINE_NAME_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* Check machine name.  */
@@ -786,18 +1197,18 @@ snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, u
         || (machine_name_len != SNAPSHOT_MODULE_NAME_LEN
             && read_name[machine_name_len] != 0)) {
         snapshot_error = SNAPSHOT_MACHINE_MISMATCH_ERROR;
-        goto fail;
+        return -1;
     }
 
     /* VICE version and revision */
     memset(snapshot_viceversion, 0, 4);
     snapshot_vicerevision = 0;
-    offs = ftell(f);
+    offs = snapshot_stream_tell(f);
 
     if (snapshot_read_byte_array(f, (uint8_t *)magic, SNAPSHOT_VERSION_MAGIC_LEN) < 0
         || memcmp(magic, snapshot_version_magic_string, SNAPSHOT_VERSION_MAGIC_LEN) != 0) {
         /* old snapshots do not contain VICE version */
-        fseek(f, offs, SEEK_SET);
+        snapshot_stream_seek(f, offs);
         log_warning(LOG_DEFAULT, "attempting to load pre 2.4.30 snapshot");
     } else {
         /* actually read the version */
@@ -807,43 +1218,161 @@ snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, u
             || snapshot_read_byte(f, &snapshot_viceversion[3]) < 0
             || snapshot_read_dword(f, &snapshot_vicerevision) < 0) {
             snapshot_error = SNAPSHOT_CANNOT_READ_VERSION_ERROR;
-            goto fail;
+            return -1;
         }
     }
 
-    s = lib_malloc(sizeof(snapshot_t));
-    s->file = f;
-    s->first_module_offset = ftell(f);
-    s->write_mode = 0;
+    return 0;
+}
+
+#ifdef HAVE_ZLIB
+/* Snapshots written compressed by snapshot_writer_save() are gzip files
+   without a .gz name, which zfile leaves alone.  They are inflated into
+   a memory snapshot and read from there.  */
+static snapshot_memory_t *snapshot_inflate(FILE *f)
+{
+    snapshot_memory_t *mem;
+    z_stream zs;
+    uint8_t in[0x4000], out[0x4000];
+    int ret = Z_OK;
+
+    memset(&zs, 0, sizeof(zs));
+    /* 16: gzip header and trailer.  */
+    if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK) {
+        return NULL;
+    }
+
+    mem = snapshot_memory_new();
+    while (ret != Z_STREAM_END) {
+        zs.avail_in = (uInt)fread(in, 1, sizeof(in), f);
+        if (zs.avail_in == 0) {
+            break;
+        }
+        zs.next_in = in;
+        do {
+            zs.next_out = out;
+            zs.avail_out = sizeof(out);
+            ret = inflate(&zs, Z_NO_FLUSH);
+            if (ret != Z_OK && ret != Z_STREAM_END) {
+                break;
+            }
+            snapshot_memory_append(mem, out, sizeof(out) - zs.avail_out);
+        } while (zs.avail_out == 0 && ret == Z_OK);
+        if (ret != Z_OK && ret != Z_STREAM_END) {
+            break;
+        }
+    }
+    inflateEnd(&zs);
+
+    if (ret != Z_STREAM_END) {
+        snapshot_memory_destroy(mem);
+        return NULL;
+    }
+    return mem;
+}
+
+static int snapshot_is_gzip(FILE *f)
+{
+    int c1 = fgetc(f);
+    int c2 = fgetc(f);
+
+    rewind(f);
+    return c1 == 0x1f && c2 == 0x8b;
+}
+#endif
+
+snapshot_t *snapshot_open(const char *filename, uint8_t *major_version_return, uint8_t *minor_version_return, const char *snapshot_machine_name)
+{
+    FILE *f;
+    snapshot_stream_t *stream;
+
+    current_machine_name = (char *)snapshot_machine_name;
+    current_filename = (char *)filename;
+    current_module = NULL;
+
+    /* It might still be on its way to the file.  */
+    snapshot_writer_wait();
+
+    f = zfile_fopen(filename, MODE_READ);
+    if (f == NULL) {
+        snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
+        return NULL;
+    }
+    stream = lib_calloc(1, sizeof(snapshot_stream_t));
+    stream->file = f;
+
+#ifdef HAVE_ZLIB
+    if (snapshot_is_gzip(f)) {
+        stream->file = NULL;
+        stream->mem = snapshot_inflate(f);
+        stream->mem_owned = 1;
+        zfile_fclose(f);
+        if (stream->mem == NULL) {
+            snapshot_error = SNAPSHOT_CANNOT_OPEN_FOR_READ_ERROR;
+            lib_free(stream);
+            return NULL;
+        }
+    }
+#endif
+
+    if (snapshot_read_header(stream, major_version_return, minor_version_return, snapshot_machine_name) < 0) {
+        if (stream->file != NULL) {
+            zfile_fclose(f);
+        } else {
+            snapshot_memory_destroy(stream->mem);
+        }
+        lib_free(stream);
+        return NULL;
+    }
 
     vsync_suspend_speed_eval();
-    return s;
+    return snapshot_new(stream, 0);
+}
 
-fail:
-    fclose(f);
-    return NULL;
+snapshot_t *snapshot_memory_open(snapshot_memory_t *mem, uint8_t *major_version_return,
+                                 uint8_t *minor_version_return,
+                                 const char *snapshot_machine_name)
+{
+    snapshot_stream_t *stream;
+
+    current_machine_name = (char *)snapshot_machine_name;
+    current_filename = (char *)snapshot_memory_name;
+    current_module = NULL;
+
+    stream = lib_calloc(1, sizeof(snapshot_stream_t));
+    stream->mem = mem;
+
+    if (snapshot_read_header(stream, major_version_return, minor_version_return, snapshot_machine_name) < 0) {
+        lib_free(stream);
+        return NULL;
+    }
+
+    vsync_suspend_speed_eval();
+    return snapshot_new(stream, 0);
 }
 
 int snapshot_close(snapshot_t *s)
 {
-    int retval;
+    int retval = 0;
 
-    if (!s->write_mode) {
-        if (zfile_fclose(s->file) == EOF) {
+    if (s->file->file == NULL) {
+        /* memory */
+        if (s->file->mem_owned) {
+            snapshot_memory_destroy(s->file->mem);
+        }
+    } else if (!s->write_mode) {
+        if (zfile_fclose(s->file->file) == EOF) {
             snapshot_error = SNAPSHOT_READ_CLOSE_EOF_ERROR;
             retval = -1;
-        } else {
-            retval = 0;
         }
     } else {
-        if (fclose(s->file) == EOF) {
+        if (fclose(s->file->file) == EOF) {
             snapshot_error = SNAPSHOT_WRITE_CLOSE_EOF_ERROR;
             retval = -1;
-        } else {
-            retval = 0;
         }
     }
 
+    lib_free(s->file);
     lib_free(s);
     return retval;
 }
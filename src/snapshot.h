@@ -28,6 +28,8 @@
 #ifndef SNAPSHOT_H
 #define SNAPSHOT_H
 
+#include <stddef.h>
+
 #include "types.h"
 
 #define SNAPSHOT_MACHINE_NAME_LEN       16
@@ -62,6 +64,7 @@
 
 typedef struct snapshot_module_s snapshot_module_t;
 typedef struct snapshot_s snapshot_t;
+typedef struct snapshot_memory_s snapshot_memory_t;
 
 extern void snapshot_display_error(void);
 
@@ -145,6 +148,34 @@ extern snapshot_t *snapshot_open(const char *filename,
                                  const char *snapshot_machine_name);
 extern int snapshot_close(snapshot_t *s);
 
+/* Snapshots kept in memory instead of a file.  Creating one with a
+   `base' shares the parts of RAM arrays that did not change since that
+   snapshot was taken; the base can be destroyed at any time after.  */
+extern snapshot_memory_t *snapshot_memory_new(void);
+extern void snapshot_memory_destroy(snapshot_memory_t *mem);
+extern snapshot_t *snapshot_memory_create(snapshot_memory_t *mem,
+                                          const snapshot_memory_t *base,
+                                          uint8_t major_version,
+                                          uint8_t minor_version,
+                                          const char *snapshot_machine_name);
+extern snapshot_t *snapshot_memory_open(snapshot_memory_t *mem,
+                                        uint8_t *major_version_return,
+                                        uint8_t *minor_version_return,
+                                        const char *snapshot_machine_name);
+
+/* Add modules at the end of a memory snapshot, such as a thumbnail a UI
+   wants to keep with it.  */
+extern snapshot_t *snapshot_memory_append_modules(snapshot_memory_t *mem);
+
+/* The size of the file a memory snapshot would be, and the bytes all
+   memory snapshots take together.  */
+extern size_t snapshot_memory_size(const snapshot_memory_t *mem);
+extern size_t snapshot_memory_in_use(void);
+
+/* Copy a memory snapshot into `buf' as it would be in a file, which
+   takes snapshot_memory_size() bytes.  */
+extern void snapshot_memory_flatten(const snapshot_memory_t *mem, uint8_t *buf);
+
 extern void snapshot_set_error(int error);
 
 extern int snapshot_version_at_least(uint8_t major_version, uint8_t minor_version, uint8_t major_version_required, uint8_t minor_version_required);
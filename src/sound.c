@@ -35,6 +35,11 @@
 #include <string.h>
 #include <time.h>
 #include <assert.h>
+#ifdef USE_SOUND_THREAD
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#endif
 
 #ifdef HAVE_STRINGS_H
 #include <strings.h>
@@ -50,6 +55,7 @@
 #include "machine.h"
 #include "maincpu.h"
 #include "monitor.h"
+#include "profile.h"
 #include "resources.h"
 #include "sound.h"
 #include "types.h"
@@ -72,6 +78,10 @@ static log_t sound_log = LOG_ERR;
 #define FALSE 0
 #endif
 
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
 /* ------------------------------------------------------------------------- */
 
 typedef struct sound_register_devices_s {
@@ -499,6 +509,38 @@ static int set_speed_adjustment_setting(int val, void *param)
     return 0;
 }
 
+static int sound_batch_enabled;
+
+static int set_sound_batch(int val, void *param)
+{
+    val = val ? 1 : 0;
+
+    if (val != sound_batch_enabled) {
+        sound_state_changed = TRUE;
+    }
+
+    sound_batch_enabled = val;
+
+    return 0;
+}
+
+#ifdef USE_SOUND_THREAD
+static int sound_thread_enabled;
+
+static int set_sound_thread(int val, void *param)
+{
+    val = val ? 1 : 0;
+
+    if (val != sound_thread_enabled) {
+        sound_state_changed = TRUE;
+    }
+
+    sound_thread_enabled = val;
+
+    return 0;
+}
+#endif
+
 static int set_volume(int val, void *param)
 {
     volume = val;
@@ -547,6 +589,12 @@ static const resource_int_t resources_int[] = {
       (void *)&volume, set_volume, NULL },
     { "SoundOutput", ARCHDEP_SOUND_OUTPUT_MODE, RES_EVENT_NO, NULL,
       (void *)&output_option, set_output_option, NULL },
+    { "SoundBatch", 0, RES_EVENT_NO, NULL,
+      (void *)&sound_batch_enabled, set_sound_batch, NULL },
+#ifdef USE_SOUND_THREAD
+    { "SoundThread", 0, RES_EVENT_NO, NULL,
+      (void *)&sound_thread_enabled, set_sound_thread, NULL },
+#endif
     RESOURCE_INT_LIST_END
 };
 
@@ -600,6 +648,20 @@ static const cmdline_option_t cmdline_options[] =
     { "-soundvolume", SET_RESOURCE, CMDLINE_ATTRIB_NEED_ARGS,
       NULL, NULL, "SoundVolume", NULL,
       "<Volume>", "Specify the sound volume (0..100)" },
+    { "-soundbatch", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SoundBatch", (resource_value_t)1,
+      NULL, "Log SID stores and render them a frame at a time" },
+    { "+soundbatch", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SoundBatch", (resource_value_t)0,
+      NULL, "Render sound up to every SID store" },
+#ifdef USE_SOUND_THREAD
+    { "-soundthread", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SoundThread", (resource_value_t)1,
+      NULL, "Render sound on a separate thread" },
+    { "+soundthread", SET_RESOURCE, CMDLINE_ATTRIB_NONE,
+      NULL, NULL, "SoundThread", (resource_value_t)0,
+      NULL, "Render sound on the emulation thread" },
+#endif
     CMDLINE_LIST_END
 };
 
@@ -771,6 +833,481 @@ const char *sound_device_name(unsigned int num)
     return sound_devices[num]->name;
 }
 
+/* ------------------------------------------------------------------------- */
+
+/* Batched rendering.  Clocking the engines up to every store splits a
+   frame into as many short runs as the music routine writes registers.
+   Instead sound_store() logs the stores of the chip registered first,
+   each with the cycles before it, and sound_batch_flush() hands the whole
+   log to that chip's calculate_samples_batch(), which applies them at
+   the same cycles while it clocks.  The log is flushed whenever the
+   engines have to be up to date: reads, stores to other chips, the end of
+   the frame and so on.
+
+   Reading one of the write-only SID registers gives the value last put on
+   the data bus for as long as the chip's bus_ttl() says.  Indexed stores
+   read their target first, so sound_read() answers those from the log
+   instead of flushing it.  */
+
+#define SOUND_BATCH_EVENTS  1024
+#define SOUND_BATCH_FRAMES  512     /* most samples of a sound thread batch */
+
+static int batch_possible = 0;      /* the engines take batches */
+static int batch_active = 0;        /* sound_store() logs into `batch' */
+static int batch_max_run = 0;       /* cycles giving SOUND_BATCH_FRAMES samples */
+static sound_event_t batch[SOUND_BATCH_EVENTS];
+static int batch_num = 0;
+static int pending_run = 0;         /* time since the last logged event */
+static CLOCK batch_bus_clk[SOUND_SIDS_MAX];
+static int batch_bus_value[SOUND_SIDS_MAX];     /* -1 without a logged store */
+
+/* In warp mode sound_flush() throws the samples away unless they are
+   recorded.  Making them is most of what the SID costs, so while the tape
+   turbo has warp mode on the chip registered first is only clocked as far
+   as the CPU can tell, through its clock_silent(), as long as it is the
+   only one enabled.  Warp mode the user asked for clocks it as usual.
+   Set by the emulation, read by the sound thread too.  */
+static int sound_silent = 0;
+
+/* Set by vsync_set_tape_turbo().  */
+static int tape_turbo = 0;
+
+static void sound_update_silent(void)
+{
+    int i, silent;
+
+    silent = tape_turbo
+             && warp_mode_enabled
+             && snddata.recdev == NULL
+             && cycle_based
+             && offset > 0
+             && sound_calls[0]->cycle_based()
+             && sound_calls[0]->clock_silent != NULL
+             && sound_calls[0]->clock_silent(snddata.psid, snddata.sound_chip_channels,
+                                             NULL, 0, 0) >= 0;
+    for (i = 1; silent && i < (offset >> 5); i++) {
+        if (sound_calls[i]->chip_enabled) {
+            silent = 0;
+        }
+    }
+
+    __atomic_store_n(&sound_silent, silent, __ATOMIC_RELEASE);
+}
+
+static int sound_is_silent(void)
+{
+    return __atomic_load_n(&sound_silent, __ATOMIC_ACQUIRE);
+}
+
+static void sound_clock_silent(const sound_event_t *events, int num, int run)
+{
+    sound_calls[0]->clock_silent(snddata.psid, snddata.sound_chip_channels,
+                                 events, num, run);
+}
+
+/* Render `num' events and `run' cycles after them into pbuf.  Returns the
+   number of sample frames, -1 if the engines cannot do that.  */
+static int sound_render_batch(const sound_event_t *events, int num, int run,
+                              int16_t *pbuf, int max)
+{
+    int nr, i, delta_t = run;
+
+    if (sound_is_silent()) {
+        sound_clock_silent(events, num, run);
+        return 0;
+    }
+
+    nr = sound_calls[0]->calculate_samples_batch(snddata.psid, pbuf, max,
+                                                 snddata.sound_output_channels,
+                                                 snddata.sound_chip_channels,
+                                                 events, num, &delta_t);
+    if (nr <= 0) {
+        return nr;
+    }
+
+    for (i = 1; i < (offset >> 5); i++) {
+        if (sound_calls[i]->chip_enabled) {
+            sound_calls[i]->calculate_samples(snddata.psid, pbuf, nr,
+                                              snddata.sound_output_channels,
+                                              snddata.sound_chip_channels,
+                                              &delta_t);
+        }
+    }
+
+    if (amp < 4096) {
+        for (i = 0; i < nr * snddata.sound_output_channels; i++) {
+            pbuf[i] = pbuf[i] * amp / 4096;
+        }
+    }
+
+    return nr;
+}
+
+static void sound_batch_forget_bus(void)
+{
+    int c;
+
+    for (c = 0; c < SOUND_SIDS_MAX; c++) {
+        batch_bus_value[c] = -1;
+    }
+}
+
+/* Called by sid_init().  Rendering an empty batch tells whether the
+   engine supports them at all.  */
+static void sound_batch_init(int speed)
+{
+    int16_t dummy[SOUND_CHANNELS_MAX];
+
+    batch_possible = sound_batch_enabled
+                     && cycle_based
+                     && sound_calls[0]->cycle_based()
+                     && sound_calls[0]->calculate_samples_batch != NULL
+                     && sound_render_batch(NULL, 0, 0, dummy, 0) >= 0;
+    batch_max_run = (int)((double)SOUND_BATCH_FRAMES * cycles_per_sec / speed);
+    batch_num = 0;
+    pending_run = 0;
+    sound_batch_forget_bus();
+}
+
+static void sound_batch_flush(void)
+{
+    int nr;
+
+    if (!batch_active || (batch_num == 0 && pending_run == 0)) {
+        return;
+    }
+
+    PROFILE_ENTER(PROFILE_SID);
+    nr = sound_render_batch(batch, batch_num, pending_run,
+                            snddata.buffer + snddata.bufptr * snddata.sound_output_channels,
+                            SOUND_BUFSIZE - snddata.bufptr);
+    PROFILE_LEAVE();
+
+    /* like sound_run_sound(), what did not fit is lost */
+    if (nr > 0) {
+        snddata.bufptr += nr;
+    }
+    batch_num = 0;
+    pending_run = 0;
+    sound_batch_forget_bus();
+}
+
+static void sound_batch_push(int chipno, uint16_t addr, uint8_t val)
+{
+    sound_event_t *event = &batch[batch_num++];
+
+    event->run = pending_run;
+    event->chipno = chipno;
+    event->addr = addr;
+    event->val = val;
+    pending_run = 0;
+
+    batch_bus_clk[chipno] = maincpu_clk;
+    batch_bus_value[chipno] = val;
+
+    if (batch_num == SOUND_BATCH_EVENTS) {
+        sound_batch_flush();
+    }
+}
+
+#ifdef USE_SOUND_THREAD
+/* ------------------------------------------------------------------------- */
+
+/* Threaded sound.  sound_store() and friends only log the register writes,
+   each with the number of cycles (samples for sample based engines) to
+   run before it, into `events'.  The sound thread clocks the engines
+   through that log and leaves the samples in `samples', from where
+   sound_flush() takes them for the device.  Both are single producer,
+   single consumer rings indexed by free running counters, so neither side
+   takes a lock.  The engines' state belongs to the thread while it runs;
+   anything else that touches it calls sound_thread_sync() first.  */
+
+#define SOUND_EVENTS        4096    /* power of two */
+#define SOUND_THREAD_CHUNK  1024    /* sample frames rendered at a time */
+
+static int sound_thread_running = 0;
+static int sound_thread_quit = 0;
+static pthread_t sound_thread;
+static sem_t sound_thread_wakeup;
+
+static sound_event_t sound_events[SOUND_EVENTS];
+static unsigned int events_head = 0;    /* written by the emulation */
+static unsigned int events_tail = 0;    /* written by the sound thread */
+static unsigned int last_frame_head = 0;
+
+static int16_t *samples = NULL;         /* SOUND_BUFSIZE frames */
+static unsigned int samples_head = 0;   /* written by the sound thread */
+static unsigned int samples_tail = 0;   /* written by the emulation */
+static unsigned long samples_dropped = 0;
+
+static void sound_thread_put_samples(const int16_t *pbuf, unsigned int nr)
+{
+    unsigned int soc = (unsigned int)snddata.sound_output_channels;
+    unsigned int head = samples_head;
+    unsigned int space = SOUND_BUFSIZE - (head - __atomic_load_n(&samples_tail, __ATOMIC_ACQUIRE));
+    unsigned int i, pos, n;
+
+    /* Nobody flushed for a long time, drop what does not fit like
+       sound_run_sound() does.  */
+    if (nr > space) {
+        samples_dropped += nr - space;
+        nr = space;
+    }
+
+    for (i = 0; i < nr; i += n) {
+        pos = (head + i) & (SOUND_BUFSIZE - 1);
+        n = MIN(nr - i, SOUND_BUFSIZE - pos);
+        memcpy(samples + pos * soc, pbuf + i * soc, n * soc * sizeof(int16_t));
+    }
+
+    __atomic_store_n(&samples_head, head + nr, __ATOMIC_RELEASE);
+}
+
+static int sound_thread_get_samples(int16_t *pbuf, unsigned int max)
+{
+    unsigned int soc = (unsigned int)snddata.sound_output_channels;
+    unsigned int tail = samples_tail;
+    unsigned int nr = __atomic_load_n(&samples_head, __ATOMIC_ACQUIRE) - tail;
+    unsigned int i, pos, n;
+
+    nr = MIN(nr, max);
+    for (i = 0; i < nr; i += n) {
+        pos = (tail + i) & (SOUND_BUFSIZE - 1);
+        n = MIN(nr - i, SOUND_BUFSIZE - pos);
+        memcpy(pbuf + i * soc, samples + pos * soc, n * soc * sizeof(int16_t));
+    }
+
+    __atomic_store_n(&samples_tail, tail + nr, __ATOMIC_RELEASE);
+
+    return (int)nr;
+}
+
+/* The part of sound_run_sound() that clocks the engines.  */
+static void sound_thread_render(int run)
+{
+    int16_t chunk[SOUND_THREAD_CHUNK * SOUND_CHANNELS_MAX];
+    int nr, i, delta_t;
+
+    if (cycle_based && sound_is_silent()) {
+        sound_clock_silent(NULL, 0, run);
+        return;
+    }
+
+    while (run > 0) {
+        if (cycle_based) {
+            delta_t = run;
+            nr = sound_machine_calculate_samples(snddata.psid, chunk, SOUND_THREAD_CHUNK,
+                                                 snddata.sound_output_channels,
+                                                 snddata.sound_chip_channels,
+                                                 &delta_t);
+            if (delta_t == run) {
+                break;
+            }
+            run = delta_t;
+        } else {
+            nr = MIN(run, SOUND_THREAD_CHUNK);
+            delta_t = 0;
+            sound_machine_calculate_samples(snddata.psid, chunk, nr,
+                                            snddata.sound_output_channels,
+                                            snddata.sound_chip_channels,
+                                            &delta_t);
+            run -= nr;
+        }
+
+        if (amp < 4096) {
+            for (i = 0; i < nr * snddata.sound_output_channels; i++) {
+                chunk[i] = chunk[i] * amp / 4096;
+            }
+        }
+
+        sound_thread_put_samples(chunk, (unsigned int)nr);
+    }
+}
+
+/* Process the events from `tail' on, as many as possible in one batch.
+   Returns how many were done.  */
+static unsigned int sound_thread_process(unsigned int tail, unsigned int head)
+{
+    int16_t chunk[SOUND_THREAD_CHUNK * SOUND_CHANNELS_MAX];
+    sound_event_t *event = &sound_events[tail & (SOUND_EVENTS - 1)];
+    unsigned int n, max;
+    int run = 0, nr;
+
+    if (batch_possible) {
+        /* up to the end of the ring and no stores to other chips */
+        max = MIN(head - tail, SOUND_EVENTS - (tail & (SOUND_EVENTS - 1)));
+        for (n = 0; n < max; n++) {
+            if ((event[n].chipno >= 0 && (event[n].addr >> 5))
+                || run + event[n].run > batch_max_run) {
+                break;
+            }
+            run += event[n].run;
+        }
+        if (n > 0) {
+            nr = sound_render_batch(event, (int)n, 0, chunk, SOUND_THREAD_CHUNK);
+            if (nr >= 0) {
+                sound_thread_put_samples(chunk, (unsigned int)nr);
+                return n;
+            }
+        }
+    }
+
+    sound_thread_render(event->run);
+    if (event->chipno >= 0) {
+        sound_machine_store(snddata.psid[event->chipno], event->addr, event->val);
+    }
+
+    return 1;
+}
+
+static void *sound_thread_main(void *arg)
+{
+    unsigned int tail, head;
+
+    for (;;) {
+        sem_wait(&sound_thread_wakeup);
+
+        tail = events_tail;
+        while (tail != (head = __atomic_load_n(&events_head, __ATOMIC_ACQUIRE))) {
+            tail += sound_thread_process(tail, head);
+            __atomic_store_n(&events_tail, tail, __ATOMIC_RELEASE);
+        }
+
+        if (__atomic_load_n(&sound_thread_quit, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/* Log a store, or with chipno < 0 just the time that passed.  The thread
+   is only woken when the log fills up, sound_flush() and
+   sound_thread_sync() wake it otherwise.  */
+static void sound_thread_push(int chipno, uint16_t addr, uint8_t val)
+{
+    sound_event_t *event;
+    unsigned int head = events_head;
+
+    while (head - __atomic_load_n(&events_tail, __ATOMIC_ACQUIRE) == SOUND_EVENTS) {
+        sem_post(&sound_thread_wakeup);
+        sched_yield();
+    }
+
+    event = &sound_events[head & (SOUND_EVENTS - 1)];
+    event->run = pending_run;
+    event->chipno = chipno;
+    event->addr = addr;
+    event->val = val;
+    pending_run = 0;
+
+    __atomic_store_n(&events_head, head + 1, __ATOMIC_RELEASE);
+
+    if (head - __atomic_load_n(&events_tail, __ATOMIC_RELAXED) == SOUND_EVENTS / 2) {
+        sem_post(&sound_thread_wakeup);
+    }
+}
+
+/* Wait until the thread has processed the events before `head'.  */
+static void sound_thread_wait(unsigned int head)
+{
+    if ((int)(__atomic_load_n(&events_tail, __ATOMIC_ACQUIRE) - head) < 0) {
+        sem_post(&sound_thread_wakeup);
+        while ((int)(__atomic_load_n(&events_tail, __ATOMIC_ACQUIRE) - head) < 0) {
+            sched_yield();
+        }
+    }
+}
+
+/* Hand the thread what is pending and wait until it has processed it, so
+   the engines' state can be used here.  */
+static void sound_thread_sync(void)
+{
+    if (!sound_thread_running) {
+        return;
+    }
+
+    if (pending_run) {
+        sound_thread_push(-1, 0, 0);
+    }
+
+    sound_thread_wait(events_head);
+}
+
+/* Called once per frame by sound_flush().  The thread renders this frame
+   while the next one is emulated; the emulation waits only if it would
+   get further ahead than that, which keeps the latency at one frame and
+   the sample ring from overflowing.  */
+static int sound_thread_flush(int16_t *pbuf, unsigned int max)
+{
+    sound_thread_wait(last_frame_head);
+
+    sound_thread_push(-1, 0, 0);
+    last_frame_head = events_head;
+    sem_post(&sound_thread_wakeup);
+
+    return sound_thread_get_samples(pbuf, max);
+}
+
+static void sound_thread_start(void)
+{
+    if (sound_thread_running) {
+        return;
+    }
+
+    if (samples == NULL) {
+        samples = lib_malloc(SOUND_BUFSIZE * SOUND_CHANNELS_MAX * sizeof(int16_t));
+    }
+    events_head = events_tail = last_frame_head = 0;
+    samples_head = samples_tail = 0;
+    pending_run = 0;
+    sound_thread_quit = 0;
+
+    sem_init(&sound_thread_wakeup, 0, 0);
+    if (pthread_create(&sound_thread, NULL, sound_thread_main, NULL) != 0) {
+        log_error(sound_log, "Cannot start the sound thread, rendering on the emulation thread.");
+        sem_destroy(&sound_thread_wakeup);
+        return;
+    }
+
+    sound_thread_running = 1;
+    batch_active = 0;
+    log_message(sound_log, "Rendering on a separate thread.");
+}
+
+static void sound_thread_stop(void)
+{
+    if (!sound_thread_running) {
+        return;
+    }
+
+    sound_thread_sync();
+
+    __atomic_store_n(&sound_thread_quit, 1, __ATOMIC_RELEASE);
+    sem_post(&sound_thread_wakeup);
+    pthread_join(sound_thread, NULL);
+    sem_destroy(&sound_thread_wakeup);
+
+    sound_thread_running = 0;
+    if (samples_dropped) {
+        log_warning(sound_log, "%lu samples dropped by the sound thread", samples_dropped);
+        samples_dropped = 0;
+    }
+}
+
+#else
+
+#define sound_thread_sync()
+
+#endif /* USE_SOUND_THREAD */
+
+/* Bring the engines up to date before anything else uses them.  */
+static void sound_sync(void)
+{
+    sound_batch_flush();
+    sound_thread_sync();
+}
+
 
 /* code to disable sid for a given number of seconds if needed */
 static time_t disabletime;
@@ -907,6 +1444,13 @@ static int sid_init(void)
         }
     }
 
+    sound_batch_init(speed);
+#ifdef USE_SOUND_THREAD
+    batch_active = batch_possible && !sound_thread_running;
+#else
+    batch_active = batch_possible;
+#endif
+
     snddata.clkstep = SOUNDCLK_CONSTANT(cycles_per_sec) / sample_rate;
 
     snddata.origclkstep = snddata.clkstep;
@@ -932,6 +1476,7 @@ static void sid_close(void)
 
 sound_t *sound_get_psid(unsigned int channel)
 {
+    sound_sync();
     return snddata.psid[channel];
 }
 
@@ -1050,6 +1595,9 @@ int sound_open(void)
             } else {
                 snddata.sound_output_channels = channels;
             }
+        } else {
+            /* devices without init (dummy) take whatever we give them */
+            snddata.sound_output_channels = channels;
         }
         snddata.issuspended = 0;
 
@@ -1077,6 +1625,12 @@ int sound_open(void)
 
         sid_state_changed = FALSE;
 
+#ifdef USE_SOUND_THREAD
+        if (sound_thread_enabled) {
+            sound_thread_start();
+        }
+#endif
+
         /* Fill up the sound hardware buffer. */
         if (pdev->bufferspace) {
             /* Fill to bufsize - fragsize. */
@@ -1141,12 +1695,19 @@ int sound_open(void)
             }
         }
     }
+    sound_update_silent();
     return 0;
 }
 
 /* close sid */
 void sound_close(void)
 {
+#ifdef USE_SOUND_THREAD
+    sound_thread_stop();
+#endif
+    sound_batch_flush();
+    batch_active = 0;
+
     if (snddata.playdev) {
         log_message(sound_log, "Closing device `%s'", snddata.playdev->name);
         if (snddata.playdev->close) {
@@ -1200,16 +1761,45 @@ static int sound_run_sound(void)
         }
     }
 
+    /* Only note the time that passed, it is rendered with the next batch.  */
+    if (batch_active) {
+        pending_run += maincpu_clk - snddata.lastclk;
+        snddata.lastclk = maincpu_clk;
+        return 0;
+    }
+
+#ifdef USE_SOUND_THREAD
+    /* Only note the time that passed, the sound thread renders it.  */
+    if (sound_thread_running) {
+        if (cycle_based) {
+            pending_run += maincpu_clk - snddata.lastclk;
+        } else {
+            nr = (int)((SOUNDCLK_CONSTANT(maincpu_clk) - snddata.fclk)
+                       / snddata.clkstep);
+            pending_run += nr;
+            snddata.fclk += nr * snddata.clkstep;
+        }
+        snddata.lastclk = maincpu_clk;
+        return 0;
+    }
+#endif
+
     /* Handling of cycle based sound engines. */
-    if (cycle_based) {
+    if (cycle_based && sound_is_silent()) {
+        PROFILE_ENTER(PROFILE_SID);
+        sound_clock_silent(NULL, 0, (int)(maincpu_clk - snddata.lastclk));
+        PROFILE_LEAVE();
+    } else if (cycle_based) {
         delta_t = maincpu_clk - snddata.lastclk;
         bufferptr = snddata.buffer + snddata.bufptr * snddata.sound_output_channels;
+        PROFILE_ENTER(PROFILE_SID);
         nr = sound_machine_calculate_samples(snddata.psid,
                                              bufferptr,
                                              SOUND_BUFSIZE - snddata.bufptr,
                                              snddata.sound_output_channels,
                                              snddata.sound_chip_channels,
                                              &delta_t);
+        PROFILE_LEAVE();
         if (delta_t) {
             if (overflow_warning_count < 25) {
                 log_warning(sound_log, "%s", "Sound buffer overflow (cycle based)");
@@ -1236,12 +1826,14 @@ static int sound_run_sound(void)
 #endif
         }
         bufferptr = snddata.buffer + snddata.bufptr * snddata.sound_output_channels;
+        PROFILE_ENTER(PROFILE_SID);
         sound_machine_calculate_samples(snddata.psid,
                                         bufferptr,
                                         nr,
                                         snddata.sound_output_channels,
                                         snddata.sound_chip_channels,
                                         &delta_t);
+        PROFILE_LEAVE();
         snddata.fclk += nr * snddata.clkstep;
     }
 
@@ -1266,6 +1858,8 @@ void sound_reset(void)
 {
     int c;
 
+    sound_sync();
+
     snddata.fclk = SOUNDCLK_CONSTANT(maincpu_clk);
     snddata.wclk = maincpu_clk;
     snddata.lastclk = maincpu_clk;
@@ -1281,6 +1875,8 @@ static void prevent_clk_overflow_callback(CLOCK sub, void *data)
 {
     int c;
 
+    sound_sync();
+
     snddata.lastclk -= sub;
     snddata.fclk -= SOUNDCLK_CONSTANT(sub);
     snddata.wclk -= sub;
@@ -1323,13 +1919,23 @@ double sound_flush()
         return 0;
     }
 
+    sound_batch_flush();
+#ifdef USE_SOUND_THREAD
+    if (sound_thread_running) {
+        snddata.bufptr += sound_thread_flush(snddata.buffer + snddata.bufptr * snddata.sound_output_channels,
+                                             (unsigned int)(SOUND_BUFSIZE - snddata.bufptr));
+    }
+#endif
+
     if (sid_state_changed) {
+        sound_sync();
         if (sid_init() != 0) {
             return 0;
         }
         sid_state_changed = FALSE;
     }
 
+    sound_update_silent();
     if (warp_mode_enabled && snddata.recdev == NULL) {
         snddata.bufptr = 0;
         return 0;
@@ -1593,6 +2199,7 @@ int sound_dump(int chipno)
     if (chipno >= snddata.sound_chip_channels) {
         return -1;
     }
+    sound_sync();
     mon_out("%s\n", sound_machine_dump_state(snddata.psid[chipno]));
     return 0;
 }
@@ -1607,6 +2214,16 @@ int sound_read(uint16_t addr, int chipno)
         return -1;
     }
 
+    if (batch_active && (addr >> 5) == 0 && (addr & 0x1f) < 0x19
+        && batch_bus_value[chipno] >= 0
+        && sound_calls[0]->bus_ttl != NULL
+        && maincpu_clk - batch_bus_clk[chipno] < sound_calls[0]->bus_ttl(snddata.psid[chipno])) {
+        return batch_bus_value[chipno];
+    }
+
+    /* reads like OSC3 need the engine clocked up to now */
+    sound_sync();
+
     return sound_machine_read(snddata.psid[chipno], addr);
 }
 
@@ -1622,7 +2239,25 @@ void sound_store(uint16_t addr, uint8_t val, int chipno)
         return;
     }
 
-    sound_machine_store(snddata.psid[chipno], addr, val);
+    if (batch_active) {
+        if (addr >> 5) {
+            /* another chip, catch up with the batch first */
+            sound_batch_flush();
+            sound_machine_store(snddata.psid[chipno], addr, val);
+        } else {
+            sound_batch_push(chipno, addr, val);
+        }
+    } else {
+#ifdef USE_SOUND_THREAD
+        if (sound_thread_running) {
+            sound_thread_push(chipno, addr, val);
+        } else {
+            sound_machine_store(snddata.psid[chipno], addr, val);
+        }
+#else
+        sound_machine_store(snddata.psid[chipno], addr, val);
+#endif
+    }
 
     if (!snddata.playdev->dump) {
         return;
@@ -1647,9 +2282,16 @@ void sound_set_relative_speed(int value)
     speed_percent = value;
 }
 
+void sound_set_tape_turbo(int value)
+{
+    tape_turbo = value;
+    sound_update_silent();
+}
+
 void sound_set_warp_mode(int value)
 {
     warp_mode_enabled = value;
+    sound_update_silent();
 
     if (value) {
         sound_suspend();
@@ -1662,6 +2304,7 @@ void sound_snapshot_prepare(void)
 {
     /* Update lastclk.  */
     sound_run_sound();
+    sound_sync();
 }
 
 void sound_snapshot_finish(void)
@@ -167,6 +167,7 @@ extern int sound_open(void);
 extern void sound_close(void);
 extern void sound_set_relative_speed(int value);
 extern void sound_set_warp_mode(int value);
+extern void sound_set_tape_turbo(int value);
 extern void sound_set_machine_parameter(long clock_rate, long ticks_per_frame);
 extern void sound_snapshot_prepare(void);
 extern void sound_snapshot_finish(void);
@@ -232,6 +233,15 @@ extern const char *sound_device_name(unsigned int num);
 
 extern sound_t *sound_get_psid(unsigned int channel);
 
+/* A register store and the time before it, as logged by the sound thread
+   and by batched rendering.  */
+typedef struct sound_event_s {
+    int run;                /* cycles or samples to render before the store */
+    int chipno;             /* -1 if there is nothing to store */
+    uint16_t addr;
+    uint8_t val;
+} sound_event_t;
+
 typedef struct sound_chip_s {
     sound_t *(*open)(int chipno);
     int (*init)(sound_t *psid, int speed, int cycles_per_sec);
@@ -243,6 +253,18 @@ typedef struct sound_chip_s {
     int (*cycle_based)(void);
     int (*channels)(void);
     int chip_enabled;
+    /* optional, for the cycle based chip registered first: render the
+       stores in `events' and `*delta_t' cycles after them in one call.
+       Returns -1 if that is not possible.  */
+    int (*calculate_samples_batch)(sound_t **psid, int16_t *pbuf, int nr, int sound_output_channels, int sound_chip_channels, const sound_event_t *events, int num_events, int *delta_t);
+    /* optional, for the cycle based chip registered first: like
+       calculate_samples_batch() but for when the samples would be thrown
+       away, so only what the CPU can read back is clocked.  Returns -1 if
+       that is not possible.  */
+    int (*clock_silent)(sound_t **psid, int sound_chip_channels, const sound_event_t *events, int num_events, int delta_t);
+    /* optional: for how many cycles reading a write-only register gives
+       the value stored last, 0 if it does not.  */
+    CLOCK (*bus_ttl)(sound_t *psid);
 } sound_chip_t;
 
 extern uint16_t sound_chip_register(sound_chip_t *chip);
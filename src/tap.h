@@ -41,6 +41,7 @@
 
 struct tape_init_s;
 struct tape_file_record_s;
+struct tap_index_s;
 
 typedef struct tap_s {
     /* File name.  */
@@ -49,6 +50,21 @@ typedef struct tap_s {
     /* File descriptor.  */
     FILE *fd;
 
+    /* The whole file, header included, so positions in it are file
+       offsets.  Pulses are read from here, and written here as well as
+       to the file.  */
+    uint8_t *data;
+    size_t data_size;
+    size_t data_alloc;
+
+    /* Where the decoder in tap.c reads next.  */
+    long data_pos;
+
+    /* The files found on the tape when it was opened, or NULL once the
+       tape has been written to.  */
+    struct tap_index_s *index;
+    int index_count;
+
     /* Size of the image.  */
     int size;
 
@@ -109,5 +125,6 @@ extern void tap_get_header(tap_t *tap, uint8_t *name);
 extern struct tape_file_record_s *tap_get_current_file_record(tap_t *tap);
 
 extern int tap_read(tap_t *tap, uint8_t *buf, size_t size);
+extern int tap_write(tap_t *tap, const uint8_t *buf, size_t size);
 
 #endif
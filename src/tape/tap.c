@@ -76,6 +76,44 @@ static int tap_pulse_tt_long_min = 0x23;
 static int tap_pulse_tt_long_max = 0x36;
 
 
+typedef struct tap_index_s {
+    /* Where tap_find_header() found the file.  */
+    long pos;
+    tape_file_record_t record;
+} tap_index_t;
+
+/* ------------------------------------------------------------------------- */
+
+static size_t tap_data_read(tap_t *tap, uint8_t *buf, size_t len)
+{
+    if (tap->data_pos < 0 || (size_t)tap->data_pos >= tap->data_size) {
+        return 0;
+    }
+    if (len > tap->data_size - (size_t)tap->data_pos) {
+        len = tap->data_size - (size_t)tap->data_pos;
+    }
+    memcpy(buf, tap->data + tap->data_pos, len);
+    tap->data_pos += (long)len;
+
+    return len;
+}
+
+static int tap_data_load(tap_t *tap)
+{
+    size_t len = tap->offset + (size_t)tap->size;
+
+    tap->data = lib_malloc(len);
+    tap->data_size = tap->data_alloc = len;
+    tap->data_pos = tap->offset;
+    if (fseek(tap->fd, 0, SEEK_SET) != 0
+        || fread(tap->data, 1, len, tap->fd) != len) {
+        return -1;
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
 static int tap_header_read(tap_t *tap, FILE *fd)
 {
     uint8_t buf[TAP_HDR_SIZE];
@@ -116,6 +154,8 @@ static tap_t *tap_new(void)
     return tap;
 }
 
+static void tap_index_build(tap_t *tap);
+
 tap_t *tap_open(const char *name, unsigned int *read_only)
 {
     FILE *fd;
@@ -156,12 +196,21 @@ tap_t *tap_open(const char *name, unsigned int *read_only)
         return NULL;
     }
 
+    if (tap_data_load(new) < 0) {
+        zfile_fclose(new->fd);
+        lib_free(new->data);
+        lib_free(new);
+        return NULL;
+    }
+
     new->file_name = lib_stralloc(name);
     new->tap_file_record = lib_calloc(1, sizeof(tape_file_record_t));
     new->current_file_number = -1;
     new->current_file_data = NULL;
     new->current_file_size = 0;
 
+    tap_index_build(new);
+
     return new;
 }
 
@@ -182,6 +231,8 @@ int tap_close(tap_t *tap)
     }
 
     lib_free(tap->current_file_data);
+    lib_free(tap->data);
+    lib_free(tap->index);
     lib_free(tap->file_name);
     lib_free(tap->tap_file_record);
     lib_free(tap);
@@ -233,7 +284,7 @@ inline static int tap_get_pulse(tap_t *tap, int *pos_advance)
     size_t res;
 
     *pos_advance = 0;
-    res = fread(&data, 1, 1, tap->fd);
+    res = tap_data_read(tap, &data, 1);
 
     if (res == 0) {
         return -1;
@@ -246,8 +297,8 @@ inline static int tap_get_pulse(tap_t *tap, int *pos_advance)
             pulse_length = 256;
         } else if ((tap->version == 1) || (tap->version == 2)) {
             uint8_t size[3];
-            res = fread(size, 3, 1, tap->fd);
-            if (res == 0) {
+            res = tap_data_read(tap, size, 3);
+            if (res < 3) {
                 return -1;
             }
             *pos_advance += 3;
@@ -261,7 +312,7 @@ inline static int tap_get_pulse(tap_t *tap, int *pos_advance)
     if (tap->version == 2) {
         uint32_t pulse_length2;
 
-        res = fread(&data, 1, 1, tap->fd);
+        res = tap_data_read(tap, &data, 1);
 
         if (res == 0) {
             return -1;
@@ -269,8 +320,8 @@ inline static int tap_get_pulse(tap_t *tap, int *pos_advance)
         *pos_advance += (int)res;
         if (data == 0) {
             uint8_t size[3];
-            res = fread(size, 3, 1, tap->fd);
-            if (res == 0) {
+            res = tap_data_read(tap, size, 3);
+            if (res < 3) {
                 return -1;
             }
             *pos_advance += 3;
@@ -382,7 +433,7 @@ static int tap_cbm_skip_pilot(tap_t *tap)
 
     errors = 0;
     counter = 0;
-    current_filepos = ftell(tap->fd);
+    current_filepos = tap->data_pos;
     while (1) {
         /*  Save file position */
         fpos = current_filepos;
@@ -391,7 +442,7 @@ static int tap_cbm_skip_pilot(tap_t *tap)
         fpos2 = current_filepos;
         if (TAP_PULSE_LONG(data)) {
             /* found an L pulse, try to read a byte */
-            fseek(tap->fd, fpos, SEEK_SET);
+            tap->data_pos = fpos;
             current_filepos = fpos;
             data = tap_cbm_read_byte(tap);
             if (data == -1) {
@@ -404,12 +455,12 @@ static int tap_cbm_skip_pilot(tap_t *tap)
                 }
 
                 /* Start over after the L pulse */
-                fseek(tap->fd, fpos2, SEEK_SET);
+                tap->data_pos = fpos2;
                 current_filepos = fpos2;
                 counter = 0;
             } else {
                 /* success.  Go back to start of byte and return */
-                fseek(tap->fd, fpos, SEEK_SET);
+                tap->data_pos = fpos;
                 current_filepos = fpos;
                 return 0;
             }
@@ -766,13 +817,13 @@ static int tap_cbm_skip_file(tap_t *tap)
         int ret;
 
         while (1) {
-            fpos = ftell(tap->fd);
+            fpos = tap->data_pos;
 
             /* find next pilot */
             ret = tap_find_pilot(tap, PILOT_TYPE_CBM);
             if (ret < 0) {
                 /* no more pilot found => end of data */
-                fseek(tap->fd, fpos, SEEK_SET);
+                tap->data_pos = fpos;
                 break;
             }
 
@@ -780,7 +831,7 @@ static int tap_cbm_skip_file(tap_t *tap)
             ret = tap_cbm_read_block(tap, buffer, 193);
             if (ret < 1 || buffer[0] != 2) {
                 /* next block is not a data continuation block => end of data */
-                fseek(tap->fd, fpos, SEEK_SET);
+                tap->data_pos = fpos;
                 break;
             }
         }
@@ -847,7 +898,7 @@ static int tap_tt_skip_pilot(tap_t *tap)
     int data;
 
 #if TAP_DEBUG > 1
-    log_debug("\nTAP_TT_SKIP_PILOT(0x%X", ftell(tap->fd));
+    log_debug("\nTAP_TT_SKIP_PILOT(0x%X", tap->data_pos);
 #endif
 
     /* turbo-tape pilot is just repeats of value 0x02 */
@@ -860,12 +911,12 @@ static int tap_tt_skip_pilot(tap_t *tap)
         if (data != 2) {
             /* value != 0x02, we found the end of the pilot.  Go back
                so byte can be read again */
-            fseek(tap->fd, -8, SEEK_CUR);
+            tap->data_pos -= 8;
         }
     } while (data == 2);
 
 #if TAP_DEBUG > 1
-    log_debug("-0x%X) ", ftell(tap->fd));
+    log_debug("-0x%X) ", tap->data_pos);
 #endif
 
     return 0;
@@ -1103,7 +1154,7 @@ static int tap_find_pilot(tap_t *tap, int type)
        file */
     minCBM = (type == PILOT_TYPE_ANY) ? 1000 : PILOT_MIN_LENGTH_CBM;
 
-    startCBM = ftell(tap->fd);
+    startCBM = tap->data_pos;
     startTT = startCBM;
     countCBM = 0;
     countTT = 0;
@@ -1114,8 +1165,8 @@ static int tap_find_pilot(tap_t *tap, int type)
 
     while ((countCBM < minCBM) && (countTT < PILOT_MIN_LENGTH_TT * 8)) {
 /*        count = fread(&data, 1, 256, tap->fd); */
-        int startpos = ftell(tap->fd);
-        int readlen = (int)fread(buffer, 1, 256, tap->fd);
+        int startpos = tap->data_pos;
+        int readlen = (int)tap_data_read(tap, buffer, 256);
         uint32_t pulse_length = 0;
         int j = 0;
         int needed;
@@ -1136,7 +1187,7 @@ static int tap_find_pilot(tap_t *tap, int type)
                         /* There is not enough in the buffer
                            Read some more */
                         memcpy(buffer, buffer + i + 1, still_in_buffer);
-                        res = (int)fread(buffer + still_in_buffer, 1, needed, tap->fd);
+                        res = (int)tap_data_read(tap, buffer + still_in_buffer, needed);
                         i = readlen;
                         if (res == 0) {
                             continue;
@@ -1154,7 +1205,7 @@ static int tap_find_pilot(tap_t *tap, int type)
                 uint32_t pulse_length2;
                 /*  Read one more byte if run out of buffer */
                 if (i == readlen) {
-                    readlen = (int)fread(buffer, 1, 1, tap->fd);
+                    readlen = (int)tap_data_read(tap, buffer, 1);
                     if (readlen == 0) {
                         continue;
                     }
@@ -1170,7 +1221,7 @@ static int tap_find_pilot(tap_t *tap, int type)
                         /* There is not enough in the buffer
                            Read some more */
                         memcpy(buffer, buffer + i + 1, still_in_buffer);
-                        res = (int)fread(buffer + still_in_buffer, 1, needed, tap->fd);
+                        res = (int)tap_data_read(tap, buffer + still_in_buffer, needed);
                         i = readlen;
                         if (res == 0) {
                             continue;
@@ -1186,7 +1237,7 @@ static int tap_find_pilot(tap_t *tap, int type)
             j++;
         }
         count = j;
-        pos[j] = ftell(tap->fd);
+        pos[j] = tap->data_pos;
 
 /*        for (i = 0, count = 0; i < 256; i++, count++) {
             pos[i] = ftell(tap->fd);
@@ -1254,10 +1305,10 @@ static int tap_find_pilot(tap_t *tap, int type)
         /* startTT points to a '1' bit which we assume to be part of the
            value 00000010.  Skip over the 1 and following 0 so we start
            at the beginning of a 00000010 sequence */
-        fseek(tap->fd, startTT + 2, SEEK_SET);
+        tap->data_pos = startTT + 2;
         return 1;
     } else {
-        fseek(tap->fd, startCBM, SEEK_SET);
+        tap->data_pos = startCBM;
         return 0;
     }
 }
@@ -1277,21 +1328,21 @@ static int tap_find_header(tap_t *tap)
         }
 
         /* store current position in TAP file */
-        fpos = ftell(tap->fd);
+        fpos = tap->data_pos;
 
         /* try to read a header */
         if (type == PILOT_TYPE_CBM) {
             res = tap_cbm_read_header(tap);
             if (res < 0) {
                 int pos_advance;
-                fseek(tap->fd, fpos, SEEK_SET);
+                tap->data_pos = fpos;
                 while (TAP_PULSE_SHORT(tap_get_pulse(tap, &pos_advance))) {
                 }
             }
         } else if (type == PILOT_TYPE_TT) {
             res = tap_tt_read_header(tap);
             if (res < 0) {
-                fseek(tap->fd, fpos, SEEK_SET);
+                tap->data_pos = fpos;
                 tap_tt_skip_pilot(tap);
             }
         } else {
@@ -1305,7 +1356,7 @@ static int tap_find_header(tap_t *tap)
             }
 
             /* success.  Rewind to start of header and return. */
-            fseek(tap->fd, fpos, SEEK_SET);
+            tap->data_pos = fpos;
             tap->current_file_seek_position = fpos;
             return type;
         }
@@ -1323,7 +1374,7 @@ static int tap_read_file(tap_t *tap)
 #endif
 
     /* store current position in TAP file */
-    fpos = ftell(tap->fd);
+    fpos = tap->data_pos;
 
     /* clear old file data */
     tap->current_file_size = 0;
@@ -1349,7 +1400,7 @@ static int tap_read_file(tap_t *tap)
     }
 
     /* go back to previous position in TAP file */
-    fseek(tap->fd, fpos, SEEK_SET);
+    tap->data_pos = fpos;
 
 #if TAP_DEBUG > 0
     log_debug("\nTAP_READ_FILE(END%i)\n", ret);
@@ -1407,13 +1458,64 @@ int tap_seek_start(tap_t *tap)
 
     tap->current_file_number = -1;
     tap->current_file_seek_position = 0;
-    fseek(tap->fd, tap->offset, SEEK_SET);
+    tap->data_pos = tap->offset;
     return 0;
 }
 
+/* Go to file `n' of the index, where tap_find_header() would have left
+   the tape.  */
+static void tap_index_seek(tap_t *tap, int n)
+{
+    tap->data_pos = tap->index[n].pos;
+    tap->current_file_seek_position = (int)tap->index[n].pos;
+    *tap->tap_file_record = tap->index[n].record;
+    tap->current_file_number = n;
+}
+
+/* Nothing more on the tape, as when scanning for a header has run into
+   its end.  */
+static void tap_index_seek_end(tap_t *tap)
+{
+    tap->data_pos = (long)tap->data_size;
+}
+
+/* Scan the tape for files once, so that seeking does not have to.  */
+static void tap_index_build(tap_t *tap)
+{
+    int count = 0, alloc = 16;
+    tap_index_t *index = lib_malloc(alloc * sizeof(tap_index_t));
+
+    tap_seek_start(tap);
+    while (tap_seek_to_next_file(tap, 0) >= 0) {
+        if (count == alloc) {
+            alloc *= 2;
+            index = lib_realloc(index, alloc * sizeof(tap_index_t));
+        }
+        index[count].pos = tap->current_file_seek_position;
+        index[count].record = *tap->tap_file_record;
+        count++;
+    }
+    tap_seek_start(tap);
+    memset(tap->tap_file_record, 0, sizeof(tape_file_record_t));
+
+    tap->index = index;
+    tap->index_count = count;
+}
+
 int tap_seek_to_file(tap_t *tap, unsigned int file_number)
 {
     tap_seek_start(tap);
+    if (tap->index != NULL) {
+        if ((int)file_number < tap->index_count) {
+            tap_index_seek(tap, (int)file_number);
+            return 0;
+        }
+        if (tap->index_count > 0) {
+            tap_index_seek(tap, tap->index_count - 1);
+        }
+        tap_index_seek_end(tap);
+        return -1;
+    }
     while ((int) file_number > tap->current_file_number) {
         if (tap_seek_to_next_file(tap, 0) < 0) {
             return -1;
@@ -1434,6 +1536,21 @@ int tap_seek_to_next_file(tap_t *tap, unsigned int allow_rewind)
     lib_free(tap->current_file_data);
     tap->current_file_data = NULL;
 
+    if (tap->index != NULL) {
+        if (tap->current_file_number + 1 < tap->index_count) {
+            tap_index_seek(tap, tap->current_file_number + 1);
+        } else if (allow_rewind && tap->index_count > 0) {
+            tap_index_seek(tap, 0);
+        } else {
+            if (allow_rewind) {
+                tap_seek_start(tap);
+            }
+            tap_index_seek_end(tap);
+            return -1;
+        }
+        return 0;
+    }
+
     /* skip over current and find NEXT pilot
        (only if not at beginning of tape) */
     if (tap->current_file_number >= 0) {
@@ -1492,6 +1609,39 @@ int tap_read(tap_t *tap, uint8_t *buf, size_t size)
 }
 
 
+/* Write `size' bytes of pulses at the current datasette position and move
+   past them.  */
+int tap_write(tap_t *tap, const uint8_t *buf, size_t size)
+{
+    long pos = tap->offset + tap->current_file_seek_position;
+
+    /* Where the files are may have changed.  */
+    lib_free(tap->index);
+    tap->index = NULL;
+    tap->index_count = 0;
+
+    if (ftell(tap->fd) != pos && fseek(tap->fd, pos, SEEK_SET) != 0) {
+        return -1;
+    }
+    size = fwrite(buf, 1, size, tap->fd);
+
+    if ((size_t)pos + size > tap->data_alloc) {
+        tap->data_alloc = ((size_t)pos + size) * 2;
+        tap->data = lib_realloc(tap->data, tap->data_alloc);
+    }
+    memcpy(tap->data + pos, buf, size);
+    if ((size_t)pos + size > tap->data_size) {
+        tap->data_size = (size_t)pos + size;
+    }
+    tap->current_file_seek_position += (int)size;
+    if (tap->size < tap->current_file_seek_position) {
+        tap->size = tap->current_file_seek_position;
+    }
+    tap->has_changed = 1;
+
+    return (int)size;
+}
+
 void tap_get_header(tap_t *tap, uint8_t *name)
 {
     memcpy(name, tap->name, 12);
@@ -675,10 +675,12 @@ int tapeport_snapshot_read_module(snapshot_t *s)
     snapshot_module_t *m;
     int amount = 0;
     char **detach_resource_list = NULL;
+    int *detach_device_list = NULL;
+    int num_detached;
     tapeport_device_list_t *current = tapeport_head.next;
     int *devices = NULL;
     tapeport_snapshot_list_t *c = NULL;
-    int i = 0;
+    int i = 0, j;
 
     /* detach all tapeport devices */
     while (current) {
@@ -686,23 +688,28 @@ int tapeport_snapshot_read_module(snapshot_t *s)
         current = current->next;
     }
 
+    /* remember them, those in the snapshot are attached again below */
+    num_detached = amount;
     if (amount) {
         detach_resource_list = lib_malloc(sizeof(char *) * (amount + 1));
+        detach_device_list = lib_malloc(sizeof(int) * (amount + 1));
         memset(detach_resource_list, 0, sizeof(char *) * (amount + 1));
         current = tapeport_head.next;
         while (current) {
+            detach_device_list[i] = current->device->device_id;
             detach_resource_list[i++] = current->device->resource;
             current = current->next;
         }
         for (i = 0; i < amount; ++i) {
             resources_set_int(detach_resource_list[i], 0);
         }
-        lib_free(detach_resource_list);
     }
 
     m = snapshot_module_open(s, snap_module_name, &major_version, &minor_version);
 
     if (m == NULL) {
+        lib_free(detach_resource_list);
+        lib_free(detach_device_list);
         return -1;
     }
 
@@ -727,6 +734,15 @@ int tapeport_snapshot_read_module(snapshot_t *s)
             }
         }
         snapshot_module_close(m);
+        for (i = 0; i < amount; ++i) {
+            for (j = 0; j < num_detached; ++j) {
+                if (detach_device_list[j] == devices[i]) {
+                    resources_set_int(detach_resource_list[j], 1);
+                }
+            }
+        }
+        lib_free(detach_resource_list);
+        lib_free(detach_device_list);
         for (i = 0; i < amount; ++i) {
             c = tapeport_snapshot_head.next;
             while (c) {
@@ -745,9 +761,13 @@ int tapeport_snapshot_read_module(snapshot_t *s)
         return 0;
     }
 
+    lib_free(detach_resource_list);
+    lib_free(detach_device_list);
     return snapshot_module_close(m);
 
 fail:
+    lib_free(detach_resource_list);
+    lib_free(detach_device_list);
     snapshot_module_close(m);
     return -1;
 }
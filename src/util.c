@@ -49,6 +49,7 @@
 #include "lib.h"
 #include "log.h"
 #include "util.h"
+#include "zfile.h"
 
 /* #define DBGUTIL */
 
@@ -443,7 +444,7 @@ int util_file_load(const char *name, uint8_t *dest, size_t size,
         return -1;
     }
 
-    fd = fopen(name, MODE_READ);
+    fd = zfile_fopen(name, MODE_READ);
 
     if (fd == NULL) {
         return -1;
@@ -457,12 +458,12 @@ int util_file_load(const char *name, uint8_t *dest, size_t size,
     }
 
     if (length > size) {
-        fclose(fd);
+        zfile_fclose(fd);
         return -1;
     }
 
     if ((load_flag & UTIL_FILE_LOAD_FILL) == 0 && length != size) {
-        fclose(fd);
+        zfile_fclose(fd);
         return -1;
     }
 
@@ -478,7 +479,7 @@ int util_file_load(const char *name, uint8_t *dest, size_t size,
         }
     }
 
-    fclose(fd);
+    zfile_fclose(fd);
 
     if (r < 1) {
         return -1;
@@ -756,6 +757,10 @@ int util_file_exists(const char *name)
 {
     FILE *f;
 
+    if (zfile_memory_exists(name)) {
+        return 1;
+    }
+
     f = fopen(name, MODE_READ);
     if (f != NULL) {
         fclose(f);
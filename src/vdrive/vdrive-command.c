@@ -252,6 +252,9 @@ int vdrive_command_execute(vdrive_t *vdrive, const uint8_t *buf,
 
     vdrive_command_set_error(vdrive, status, 0, 0);
 
+    /* The drive is done with the command, so is the image.  */
+    disk_image_flush(vdrive->image);
+
     lib_free((char *)p);
     return status;
 }
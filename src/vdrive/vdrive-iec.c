@@ -666,6 +666,8 @@ int vdrive_iec_close(vdrive_t *vdrive, unsigned int secondary)
             log_error(vdrive_iec_log, "Fatal: unknown floppy-close-mode: %i.", p->mode);
     }
 
+    disk_image_flush(vdrive->image);
+
     return status;
 }
 
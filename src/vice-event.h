@@ -93,6 +93,7 @@ extern void event_reset_ack(void);
 extern void event_record_in_list(event_list_state_t *list, unsigned int type,
                                  void *data, unsigned int size);
 extern void event_record(unsigned int type, void *data, unsigned int size);
+extern void event_record_rewind_list(event_list_state_t *list);
 extern void event_record_attach_in_list(event_list_state_t *list,
                                         unsigned int unit,
                                         const char *filename,
@@ -29,6 +29,7 @@
 
 #include <string.h>
 
+#include "profile.h"
 #include "raster-cache-fill.h"
 #include "raster-cache-fill-1fff.h"
 #include "raster-cache-fill-39ff.h"
@@ -39,6 +40,7 @@
 #include "raster.h"
 #include "types.h"
 #include "vicii-draw.h"
+#include "vicii-timing.h"
 #include "viciitypes.h"
 #include "viewport.h"
 
@@ -186,6 +188,261 @@ static uint8_t *const aligned_line_buffer = (uint8_t *)_aligned_line_buffer;
 #endif
 
 
+/* Whole lines.  With the raster cache off, or on lines it cannot be used
+   for, the graphics are drawn in full on every frame.  The pixels and the
+   foreground mask of each raster line are kept along with the colours
+   and the screen, colour and character or bitmap bytes they were drawn
+   from.  When all of those are the same on the next frame, the pixels
+   are copied instead of drawn again.  Mid-line register changes never
+   get here: such lines are drawn piece by piece in the background and
+   foreground functions.  */
+
+typedef struct line_record_s {
+    unsigned int video_mode;    /* VICII_NUM_VMODES if nothing is kept */
+    uint8_t colors[4];
+    uint8_t gfx[VICII_SCREEN_TEXTCOLS];
+    uint8_t vbuf[VICII_SCREEN_TEXTCOLS];
+    uint8_t cbuf[VICII_SCREEN_TEXTCOLS];
+    uint8_t msk[VICII_SCREEN_TEXTCOLS];
+    uint8_t pixels[VICII_SCREEN_XPIX];
+} line_record_t;
+
+static line_record_t line_records[VICII_PAL_SCREEN_HEIGHT];
+static line_record_t *line_pending = NULL;
+static int line_reuse = 1;
+
+static vicii_draw_stats_t stats[VICII_NUM_VMODES];
+static int stats_timing = 0;
+static uint64_t line_start_ns;
+
+inline static uint64_t stats_start(void)
+{
+    return stats_timing ? profile_now_ns() : 0;
+}
+
+inline static void stats_stop(unsigned int mode, uint64_t start)
+{
+    if (stats_timing) {
+        stats[mode].ns += profile_now_ns() - start;
+    }
+}
+
+inline static void cache_drawn(unsigned int mode, uint64_t start)
+{
+    stats[mode].cache_draws++;
+    stats_stop(mode, start);
+}
+
+inline static int cache_checked(unsigned int mode, int r)
+{
+    stats[mode].cache_lines++;
+    if (!r) {
+        stats[mode].cache_hits++;
+    }
+    return r;
+}
+
+/* The character or bitmap bytes of the line.  */
+static void line_gfx(unsigned int mode, uint8_t *gfx)
+{
+    uint8_t *char_ptr;
+    unsigned int i, j;
+
+    switch (mode) {
+        case VICII_NORMAL_TEXT_MODE:
+        case VICII_MULTICOLOR_TEXT_MODE:
+            char_ptr = vicii.chargen_ptr + vicii.raster.ycounter;
+            for (i = 0; i < VICII_SCREEN_TEXTCOLS; i++) {
+                gfx[i] = char_ptr[vicii.vbuf[i] * 8];
+            }
+            break;
+        case VICII_EXTENDED_TEXT_MODE:
+            char_ptr = vicii.chargen_ptr + vicii.raster.ycounter;
+            for (i = 0; i < VICII_SCREEN_TEXTCOLS; i++) {
+                gfx[i] = char_ptr[(vicii.vbuf[i] & 0x3f) * 8];
+            }
+            break;
+        default:
+            for (j = (vicii.memptr << 3) + vicii.raster.ycounter, i = 0;
+                 i < VICII_SCREEN_TEXTCOLS; i++, j += 8) {
+                if (j & 0x1000) {
+                    gfx[i] = vicii.bitmap_high_ptr[j & 0xfff];
+                } else {
+                    gfx[i] = vicii.bitmap_low_ptr[j & 0xfff];
+                }
+            }
+            break;
+    }
+}
+
+/* Like line_gfx(), but stops at the first byte that is not in `gfx'.  */
+static int line_same_gfx(unsigned int mode, const uint8_t *gfx)
+{
+    uint8_t *char_ptr;
+    unsigned int i, j;
+
+    switch (mode) {
+        case VICII_NORMAL_TEXT_MODE:
+        case VICII_MULTICOLOR_TEXT_MODE:
+            char_ptr = vicii.chargen_ptr + vicii.raster.ycounter;
+            for (i = 0; i < VICII_SCREEN_TEXTCOLS; i++) {
+                if (gfx[i] != char_ptr[vicii.vbuf[i] * 8]) {
+                    return 0;
+                }
+            }
+            break;
+        case VICII_EXTENDED_TEXT_MODE:
+            char_ptr = vicii.chargen_ptr + vicii.raster.ycounter;
+            for (i = 0; i < VICII_SCREEN_TEXTCOLS; i++) {
+                if (gfx[i] != char_ptr[(vicii.vbuf[i] & 0x3f) * 8]) {
+                    return 0;
+                }
+            }
+            break;
+        default:
+            for (j = (vicii.memptr << 3) + vicii.raster.ycounter, i = 0;
+                 i < VICII_SCREEN_TEXTCOLS; i++, j += 8) {
+                if (gfx[i] != ((j & 0x1000) ? vicii.bitmap_high_ptr[j & 0xfff]
+                                            : vicii.bitmap_low_ptr[j & 0xfff])) {
+                    return 0;
+                }
+            }
+            break;
+    }
+    return 1;
+}
+
+/* Copy the line from the frame before if nothing has changed, otherwise
+   get ready to keep it once it is drawn.  */
+static int line_reused(unsigned int mode)
+{
+    line_record_t *record;
+    uint8_t colors[4];
+
+    line_start_ns = stats_start();
+    stats[mode].lines++;
+    line_pending = NULL;
+
+    switch (mode) {
+        case VICII_NORMAL_TEXT_MODE:
+        case VICII_MULTICOLOR_TEXT_MODE:
+        case VICII_HIRES_BITMAP_MODE:
+        case VICII_MULTICOLOR_BITMAP_MODE:
+        case VICII_EXTENDED_TEXT_MODE:
+            break;
+        default:
+            /* Nothing worth keeping.  */
+            return 0;
+    }
+    if (!line_reuse || vicii.raster.current_line >= VICII_PAL_SCREEN_HEIGHT) {
+        return 0;
+    }
+
+    record = &line_records[vicii.raster.current_line];
+    colors[0] = (uint8_t)vicii.raster.background_color;
+    colors[1] = (uint8_t)vicii.ext_background_color[0];
+    colors[2] = (uint8_t)vicii.ext_background_color[1];
+    colors[3] = (uint8_t)vicii.ext_background_color[2];
+
+    if (record->video_mode == mode
+        && memcmp(record->colors, colors, sizeof(colors)) == 0
+        && raster_cache_data_diff(record->vbuf, vicii.vbuf, VICII_SCREEN_TEXTCOLS) == VICII_SCREEN_TEXTCOLS
+        && raster_cache_data_diff(record->cbuf, vicii.cbuf, VICII_SCREEN_TEXTCOLS) == VICII_SCREEN_TEXTCOLS
+        && line_same_gfx(mode, record->gfx)) {
+        memcpy(GFX_PTR(), record->pixels, VICII_SCREEN_XPIX);
+        memcpy(vicii.raster.gfx_msk + GFX_MSK_LEFTBORDER_SIZE, record->msk,
+               VICII_SCREEN_TEXTCOLS);
+        stats[mode].lines_reused++;
+        stats_stop(mode, line_start_ns);
+        return 1;
+    }
+
+    record->video_mode = mode;
+    memcpy(record->colors, colors, sizeof(colors));
+    memcpy(record->vbuf, vicii.vbuf, VICII_SCREEN_TEXTCOLS);
+    memcpy(record->cbuf, vicii.cbuf, VICII_SCREEN_TEXTCOLS);
+    line_gfx(mode, record->gfx);
+    line_pending = record;
+    return 0;
+}
+
+static void line_drawn(unsigned int mode)
+{
+    if (line_pending != NULL) {
+        memcpy(line_pending->pixels, GFX_PTR(), VICII_SCREEN_XPIX);
+        memcpy(line_pending->msk, vicii.raster.gfx_msk + GFX_MSK_LEFTBORDER_SIZE,
+               VICII_SCREEN_TEXTCOLS);
+        line_pending = NULL;
+    }
+    stats_stop(mode, line_start_ns);
+}
+
+static void line_records_clear(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < VICII_PAL_SCREEN_HEIGHT; i++) {
+        line_records[i].video_mode = VICII_NUM_VMODES;
+    }
+}
+
+/* What is kept stays good while it is off: it is only ever copied for
+   the same bytes it was drawn from.  */
+void vicii_draw_set_line_reuse(int enable)
+{
+    line_reuse = enable;
+}
+
+int vicii_draw_get_line_reuse(void)
+{
+    return line_reuse;
+}
+
+void vicii_draw_stats_reset(void)
+{
+    memset(stats, 0, sizeof(stats));
+}
+
+void vicii_draw_stats_timing(int enable)
+{
+    stats_timing = enable;
+}
+
+void vicii_draw_get_stats(unsigned int mode, vicii_draw_stats_t *s)
+{
+    if (mode < VICII_NUM_VMODES) {
+        *s = stats[mode];
+    } else {
+        memset(s, 0, sizeof(*s));
+    }
+}
+
+const char *vicii_draw_mode_name(unsigned int mode)
+{
+    switch (mode) {
+        case VICII_NORMAL_TEXT_MODE:
+            return "text";
+        case VICII_MULTICOLOR_TEXT_MODE:
+            return "mc text";
+        case VICII_HIRES_BITMAP_MODE:
+            return "bitmap";
+        case VICII_MULTICOLOR_BITMAP_MODE:
+            return "mc bitmap";
+        case VICII_EXTENDED_TEXT_MODE:
+            return "ecm text";
+        case VICII_ILLEGAL_TEXT_MODE:
+            return "illegal text";
+        case VICII_ILLEGAL_BITMAP_MODE_1:
+            return "illegal bitmap 1";
+        case VICII_ILLEGAL_BITMAP_MODE_2:
+            return "illegal bitmap 2";
+        case VICII_IDLE_MODE:
+            return "idle";
+    }
+    return NULL;
+}
+
+
 /* Standard text mode.  */
 
 static int get_std_text(raster_cache_t *cache, unsigned int *xs,
@@ -212,7 +469,7 @@ static int get_std_text(raster_cache_t *cache, unsigned int *xs,
                                 VICII_SCREEN_TEXTCOLS,
                                 xs, xe,
                                 rr);
-    return r;
+    return cache_checked(VICII_NORMAL_TEXT_MODE, r);
 }
 
 inline static void _draw_std_text(uint8_t *p, unsigned int xs, unsigned int xe,
@@ -260,13 +517,19 @@ inline static void _draw_std_text_cached(uint8_t *p, unsigned int xs,
 static void draw_std_text_cached(raster_cache_t *cache, unsigned int xs,
                                  unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     ALIGN_DRAW_FUNC(_draw_std_text_cached, xs, xe, cache);
+    cache_drawn(VICII_NORMAL_TEXT_MODE, start);
 }
 
 static void draw_std_text(void)
 {
-    ALIGN_DRAW_FUNC(_draw_std_text, 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_NORMAL_TEXT_MODE)) {
+        ALIGN_DRAW_FUNC(_draw_std_text, 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_NORMAL_TEXT_MODE);
+    }
 }
 
 #define DRAW_STD_TEXT_BYTE(p, b, f) \
@@ -353,7 +616,7 @@ static int get_hires_bitmap(raster_cache_t *cache, unsigned int *xs, unsigned in
                                      VICII_SCREEN_TEXTCOLS,
                                      xs, xe,
                                      rr);
-    return r;
+    return cache_checked(VICII_HIRES_BITMAP_MODE, r);
 }
 
 inline static void _draw_hires_bitmap(uint8_t *p, unsigned int xs,
@@ -407,14 +670,20 @@ inline static void _draw_hires_bitmap_cached(uint8_t *p, unsigned int xs,
 
 static void draw_hires_bitmap(void)
 {
-    ALIGN_DRAW_FUNC(_draw_hires_bitmap, 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_HIRES_BITMAP_MODE)) {
+        ALIGN_DRAW_FUNC(_draw_hires_bitmap, 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_HIRES_BITMAP_MODE);
+    }
 }
 
 static void draw_hires_bitmap_cached(raster_cache_t *cache, unsigned int xs,
                                      unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     ALIGN_DRAW_FUNC(_draw_hires_bitmap_cached, xs, xe, cache);
+    cache_drawn(VICII_HIRES_BITMAP_MODE, start);
 }
 
 inline static void _draw_hires_bitmap_foreground(uint8_t *p, unsigned int xs,
@@ -492,7 +761,7 @@ static int get_mc_text(raster_cache_t *cache, unsigned int *xs,
                                 VICII_SCREEN_TEXTCOLS,
                                 xs, xe,
                                 rr);
-    return r;
+    return cache_checked(VICII_MULTICOLOR_TEXT_MODE, r);
 }
 
 inline static void _draw_mc_text(uint8_t *p, unsigned int xs, unsigned int xe,
@@ -577,14 +846,20 @@ inline static void _draw_mc_text_cached(uint8_t *p, unsigned int xs, unsigned in
 
 static void draw_mc_text(void)
 {
-    ALIGN_DRAW_FUNC(_draw_mc_text, 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_MULTICOLOR_TEXT_MODE)) {
+        ALIGN_DRAW_FUNC(_draw_mc_text, 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_MULTICOLOR_TEXT_MODE);
+    }
 }
 
 static void draw_mc_text_cached(raster_cache_t *cache, unsigned int xs,
                                 unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     ALIGN_DRAW_FUNC(_draw_mc_text_cached, xs, xe, cache);
+    cache_drawn(VICII_MULTICOLOR_TEXT_MODE, start);
 }
 
 /* FIXME: aligned/unaligned versions.  */
@@ -721,7 +996,7 @@ static int get_mc_bitmap(raster_cache_t *cache, unsigned int *xs,
                                      VICII_SCREEN_TEXTCOLS,
                                      xs, xe,
                                      rr);
-    return r;
+    return cache_checked(VICII_MULTICOLOR_BITMAP_MODE, r);
 }
 
 inline static void _draw_mc_bitmap(uint8_t *p, unsigned int xs, unsigned int xe,
@@ -803,14 +1078,20 @@ inline static void _draw_mc_bitmap_cached(uint8_t *p, unsigned int xs,
 
 static void draw_mc_bitmap(void)
 {
-    _draw_mc_bitmap(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_MULTICOLOR_BITMAP_MODE)) {
+        _draw_mc_bitmap(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_MULTICOLOR_BITMAP_MODE);
+    }
 }
 
 static void draw_mc_bitmap_cached(raster_cache_t *cache, unsigned int xs,
                                   unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     _draw_mc_bitmap_cached(GFX_PTR(), xs, xe, cache);
+    cache_drawn(VICII_MULTICOLOR_BITMAP_MODE, start);
 }
 
 static void draw_mc_bitmap_foreground(unsigned int start_char,
@@ -901,7 +1182,7 @@ static int get_ext_text(raster_cache_t *cache, unsigned int *xs,
                                 VICII_SCREEN_TEXTCOLS,
                                 xs, xe,
                                 rr);
-    return r;
+    return cache_checked(VICII_EXTENDED_TEXT_MODE, r);
 }
 
 inline static void _draw_ext_text(uint8_t *p, unsigned int xs, unsigned int xe,
@@ -965,14 +1246,20 @@ inline static void _draw_ext_text_cached(uint8_t *p, unsigned int xs,
 
 static void draw_ext_text(void)
 {
-    ALIGN_DRAW_FUNC(_draw_ext_text, 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_EXTENDED_TEXT_MODE)) {
+        ALIGN_DRAW_FUNC(_draw_ext_text, 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_EXTENDED_TEXT_MODE);
+    }
 }
 
 static void draw_ext_text_cached(raster_cache_t *cache, unsigned int xs,
                                  unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     ALIGN_DRAW_FUNC(_draw_ext_text_cached, xs, xe, cache);
+    cache_drawn(VICII_EXTENDED_TEXT_MODE, start);
 }
 
 static void draw_ext_text_foreground(unsigned int start_char,
@@ -1043,7 +1330,7 @@ static int get_illegal_text(raster_cache_t *cache, unsigned int *xs,
                                 VICII_SCREEN_TEXTCOLS,
                                 xs, xe,
                                 rr);
-    return r;
+    return cache_checked(VICII_ILLEGAL_TEXT_MODE, r);
 }
 
 inline static void _draw_illegal_text(uint8_t *p, unsigned int xs,
@@ -1090,14 +1377,20 @@ inline static void _draw_illegal_text_cached(uint8_t *p, unsigned int xs,
 
 static void draw_illegal_text(void)
 {
-    _draw_illegal_text(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
-                       vicii.raster.gfx_msk);
+    if (!line_reused(VICII_ILLEGAL_TEXT_MODE)) {
+        _draw_illegal_text(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
+                           vicii.raster.gfx_msk);
+        line_drawn(VICII_ILLEGAL_TEXT_MODE);
+    }
 }
 
 static void draw_illegal_text_cached(raster_cache_t *cache, unsigned int xs,
                                      unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     _draw_illegal_text_cached(GFX_PTR(), xs, xe, cache);
+    cache_drawn(VICII_ILLEGAL_TEXT_MODE, start);
 }
 
 static void draw_illegal_text_foreground(unsigned int start_char,
@@ -1142,7 +1435,7 @@ static int get_illegal_bitmap_mode1(raster_cache_t *cache, unsigned int *xs,
                                      8,
                                      xs, xe,
                                      rr);
-    return r;
+    return cache_checked(VICII_ILLEGAL_BITMAP_MODE_1, r);
 }
 
 inline static void _draw_illegal_bitmap_mode1(uint8_t *p, unsigned int xs,
@@ -1186,14 +1479,20 @@ inline static void _draw_illegal_bitmap_mode1_cached(uint8_t *p, unsigned int xs
 
 static void draw_illegal_bitmap_mode1(void)
 {
-    _draw_illegal_bitmap_mode1(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
-                               vicii.raster.gfx_msk);
+    if (!line_reused(VICII_ILLEGAL_BITMAP_MODE_1)) {
+        _draw_illegal_bitmap_mode1(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
+                                   vicii.raster.gfx_msk);
+        line_drawn(VICII_ILLEGAL_BITMAP_MODE_1);
+    }
 }
 
 static void draw_illegal_bitmap_mode1_cached(raster_cache_t *cache,
                                              unsigned int xs, unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     _draw_illegal_bitmap_mode1_cached(GFX_PTR(), xs, xe, cache);
+    cache_drawn(VICII_ILLEGAL_BITMAP_MODE_1, start);
 }
 
 static void draw_illegal_bitmap_mode1_foreground(unsigned int start_char,
@@ -1229,7 +1528,7 @@ static int get_illegal_bitmap_mode2(raster_cache_t *cache, unsigned int *xs,
                                      8,
                                      xs, xe,
                                      rr);
-    return r;
+    return cache_checked(VICII_ILLEGAL_BITMAP_MODE_2, r);
 }
 
 inline static void _draw_illegal_bitmap_mode2(uint8_t *p, unsigned int xs,
@@ -1277,14 +1576,20 @@ inline static void _draw_illegal_bitmap_mode2_cached(uint8_t *p, unsigned int xs
 
 static void draw_illegal_bitmap_mode2(void)
 {
-    _draw_illegal_bitmap_mode2(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
-                               vicii.raster.gfx_msk);
+    if (!line_reused(VICII_ILLEGAL_BITMAP_MODE_2)) {
+        _draw_illegal_bitmap_mode2(GFX_PTR(), 0, VICII_SCREEN_TEXTCOLS - 1,
+                                   vicii.raster.gfx_msk);
+        line_drawn(VICII_ILLEGAL_BITMAP_MODE_2);
+    }
 }
 
 static void draw_illegal_bitmap_mode2_cached(raster_cache_t *cache,
                                              unsigned int xs, unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     _draw_illegal_bitmap_mode2_cached(GFX_PTR(), xs, xe, cache);
+    cache_drawn(VICII_ILLEGAL_BITMAP_MODE_2, start);
 }
 
 static void draw_illegal_bitmap_mode2_foreground(unsigned int start_char,
@@ -1310,9 +1615,9 @@ static int get_idle(raster_cache_t *cache, unsigned int *xs, unsigned int *xe,
         cache->color_data_1[2] = vicii.raster.video_mode;
         *xs = 0;
         *xe = VICII_SCREEN_TEXTCOLS - 1;
-        return 1;
+        return cache_checked(VICII_IDLE_MODE, 1);
     } else {
-        return 0;
+        return cache_checked(VICII_IDLE_MODE, 0);
     }
 }
 
@@ -1378,14 +1683,20 @@ inline static void _draw_idle(uint8_t *p, unsigned int xs, unsigned int xe,
 
 static void draw_idle(void)
 {
-    ALIGN_DRAW_FUNC(_draw_idle, 0, VICII_SCREEN_TEXTCOLS - 1,
-                    vicii.raster.gfx_msk);
+    if (!line_reused(VICII_IDLE_MODE)) {
+        ALIGN_DRAW_FUNC(_draw_idle, 0, VICII_SCREEN_TEXTCOLS - 1,
+                        vicii.raster.gfx_msk);
+        line_drawn(VICII_IDLE_MODE);
+    }
 }
 
 static void draw_idle_cached(raster_cache_t *cache, unsigned int xs,
                              unsigned int xe)
 {
+    uint64_t start = stats_start();
+
     ALIGN_DRAW_FUNC(_draw_idle, xs, xe, cache->gfx_msk);
+    cache_drawn(VICII_IDLE_MODE, start);
 }
 
 static void draw_idle_foreground(unsigned int start_char,
@@ -1507,6 +1818,7 @@ static void init_drawing_tables(void)
 void vicii_draw_init(void)
 {
     init_drawing_tables();
+    line_records_clear();
 
     setup_modes();
 }
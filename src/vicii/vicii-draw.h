@@ -28,6 +28,37 @@
 #ifndef VICE_VICII_DRAW_H
 #define VICE_VICII_DRAW_H
 
+#include "types.h"
+
+/* What went into drawing the graphics of one video mode.  */
+typedef struct vicii_draw_stats_s {
+    /* Whole lines drawn while the raster cache is off or cannot be used,
+       and how many of them were copied from the same line the frame
+       before.  */
+    unsigned long lines;
+    unsigned long lines_reused;
+
+    /* Lines checked against the raster cache, and how many of them had
+       not changed and were not drawn at all.  */
+    unsigned long cache_lines;
+    unsigned long cache_hits;
+
+    /* Lines redrawn (in part) from the raster cache.  */
+    unsigned long cache_draws;
+
+    /* Time spent drawing, while timing is on.  */
+    uint64_t ns;
+} vicii_draw_stats_t;
+
 extern void vicii_draw_init(void);
 
+/* Copy unchanged lines from the frame before instead of drawing them.  */
+extern void vicii_draw_set_line_reuse(int enable);
+extern int vicii_draw_get_line_reuse(void);
+
+extern void vicii_draw_stats_reset(void);
+extern void vicii_draw_stats_timing(int enable);
+extern void vicii_draw_get_stats(unsigned int mode, vicii_draw_stats_t *stats);
+extern const char *vicii_draw_mode_name(unsigned int mode);
+
 #endif
@@ -0,0 +1,297 @@
+/*
+ * vicii-sprites-simd.c - Vectorized sprite compositing for the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * vicii-sprites.c works out which pixels of a sprite are set, trimmed or
+ * behind the graphics as bit masks, the way it always did, and expands
+ * them into one byte per pixel with tables.  What is left per pixel is
+ * done here 16 (and 8) at a time: the colour, the priority against the
+ * graphics and against sprites that are already in the line, and the
+ * sprite-sprite collision line.  It has to give exactly what the
+ * SPRITE_PIXEL() macro gives; `vicebench -spritecheck' compares them.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+#include "types.h"
+#include "vicii-sprites-simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SPRITES_SIMD_X86
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPRITES_SIMD_ARM
+#include <arm_neon.h>
+#endif
+
+vicii_sprites_composite_t vicii_sprites_composite = NULL;
+
+static int simd_level = VICII_SPRITES_SIMD_NONE;
+
+/* ------------------------------------------------------------------------- */
+/* The pixels that do not fill a whole vector.  */
+
+static inline
+uint8_t tail_composite(uint8_t *ptr, uint8_t *sptr, const uint8_t *idx,
+                       const uint8_t *fg, const uint8_t *colors,
+                       unsigned int i, unsigned int size, uint8_t sbit)
+{
+    uint8_t coll = 0;
+
+    for (; i < size; i++) {
+        if (idx[i]) {
+            if (!fg[i] && sptr[i] == 0) {
+                ptr[i] = colors[idx[i]];
+            }
+            coll |= sptr[i];
+            sptr[i] |= sbit;
+        }
+    }
+    return coll;
+}
+
+static inline uint8_t fold_bytes(uint64_t v)
+{
+    v |= v >> 32;
+    v |= v >> 16;
+    v |= v >> 8;
+    return (uint8_t)v;
+}
+
+/* ------------------------------------------------------------------------- */
+/* SSE2.  */
+
+#ifdef SPRITES_SIMD_X86
+
+__attribute__((target("sse2")))
+static inline
+__m128i sse2_pixels(__m128i img, __m128i *s, __m128i idx, __m128i fg,
+                    __m128i c1, __m128i c2, __m128i c3, __m128i sbit, __m128i *coll)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i none = _mm_cmpeq_epi8(idx, zero);
+    __m128i col, draw;
+
+    col = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(idx, _mm_set1_epi8(1)), c1),
+                                    _mm_and_si128(_mm_cmpeq_epi8(idx, _mm_set1_epi8(2)), c2)),
+                       _mm_and_si128(_mm_cmpeq_epi8(idx, _mm_set1_epi8(3)), c3));
+
+    /* Drawn where the sprite is set, not behind the graphics and the
+       first one on that pixel.  */
+    draw = _mm_andnot_si128(_mm_or_si128(none, fg), _mm_cmpeq_epi8(*s, zero));
+
+    *coll = _mm_or_si128(*coll, _mm_andnot_si128(none, *s));
+    *s = _mm_or_si128(*s, _mm_andnot_si128(none, sbit));
+
+    return _mm_or_si128(_mm_andnot_si128(draw, img), _mm_and_si128(draw, col));
+}
+
+__attribute__((target("sse2")))
+static uint8_t sse2_composite(uint8_t *ptr, uint8_t *sptr, const uint8_t *idx,
+                              const uint8_t *fg, const uint8_t *colors,
+                              unsigned int size, uint8_t sbit)
+{
+    const __m128i c1 = _mm_set1_epi8((char)colors[1]);
+    const __m128i c2 = _mm_set1_epi8((char)colors[2]);
+    const __m128i c3 = _mm_set1_epi8((char)colors[3]);
+    const __m128i sbitv = _mm_set1_epi8((char)sbit);
+    __m128i coll = _mm_setzero_si128();
+    __m128i img, s;
+    uint64_t folded;
+    unsigned int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        s = _mm_loadu_si128((const __m128i *)(sptr + i));
+        img = sse2_pixels(_mm_loadu_si128((const __m128i *)(ptr + i)), &s,
+                          _mm_loadu_si128((const __m128i *)(idx + i)),
+                          _mm_loadu_si128((const __m128i *)(fg + i)),
+                          c1, c2, c3, sbitv, &coll);
+        _mm_storeu_si128((__m128i *)(ptr + i), img);
+        _mm_storeu_si128((__m128i *)(sptr + i), s);
+    }
+    if (i + 8 <= size) {
+        s = _mm_loadl_epi64((const __m128i *)(sptr + i));
+        img = sse2_pixels(_mm_loadl_epi64((const __m128i *)(ptr + i)), &s,
+                          _mm_loadl_epi64((const __m128i *)(idx + i)),
+                          _mm_loadl_epi64((const __m128i *)(fg + i)),
+                          c1, c2, c3, sbitv, &coll);
+        _mm_storel_epi64((__m128i *)(ptr + i), img);
+        _mm_storel_epi64((__m128i *)(sptr + i), s);
+        i += 8;
+    }
+
+    /* The upper half of the 8 pixel step stays 0.  */
+    coll = _mm_or_si128(coll, _mm_srli_si128(coll, 8));
+    _mm_storel_epi64((__m128i *)&folded, coll);
+
+    return fold_bytes(folded) | tail_composite(ptr, sptr, idx, fg, colors, i, size, sbit);
+}
+
+#endif /* SPRITES_SIMD_X86 */
+
+/* ------------------------------------------------------------------------- */
+/* NEON.  */
+
+#ifdef SPRITES_SIMD_ARM
+
+static inline
+uint8x16_t neon_pixels(uint8x16_t img, uint8x16_t *s, uint8x16_t idx, uint8x16_t fg,
+                       uint8x16_t c1, uint8x16_t c2, uint8x16_t c3, uint8x16_t sbit,
+                       uint8x16_t *coll)
+{
+    uint8x16_t set = vtstq_u8(idx, idx);
+    uint8x16_t col, draw;
+
+    col = vorrq_u8(vorrq_u8(vandq_u8(vceqq_u8(idx, vdupq_n_u8(1)), c1),
+                            vandq_u8(vceqq_u8(idx, vdupq_n_u8(2)), c2)),
+                   vandq_u8(vceqq_u8(idx, vdupq_n_u8(3)), c3));
+
+    draw = vandq_u8(vbicq_u8(set, fg), vceqq_u8(*s, vdupq_n_u8(0)));
+
+    *coll = vorrq_u8(*coll, vandq_u8(set, *s));
+    *s = vorrq_u8(*s, vandq_u8(set, sbit));
+
+    return vbslq_u8(draw, col, img);
+}
+
+static uint8_t neon_composite(uint8_t *ptr, uint8_t *sptr, const uint8_t *idx,
+                              const uint8_t *fg, const uint8_t *colors,
+                              unsigned int size, uint8_t sbit)
+{
+    const uint8x16_t c1 = vdupq_n_u8(colors[1]);
+    const uint8x16_t c2 = vdupq_n_u8(colors[2]);
+    const uint8x16_t c3 = vdupq_n_u8(colors[3]);
+    const uint8x16_t sbitv = vdupq_n_u8(sbit);
+    uint8x16_t coll = vdupq_n_u8(0);
+    uint8x16_t img, s;
+    uint8x8_t half;
+    unsigned int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        s = vld1q_u8(sptr + i);
+        img = neon_pixels(vld1q_u8(ptr + i), &s, vld1q_u8(idx + i), vld1q_u8(fg + i),
+                          c1, c2, c3, sbitv, &coll);
+        vst1q_u8(ptr + i, img);
+        vst1q_u8(sptr + i, s);
+    }
+    if (i + 8 <= size) {
+        uint8x8_t zero = vdup_n_u8(0);
+
+        s = vcombine_u8(vld1_u8(sptr + i), zero);
+        img = neon_pixels(vcombine_u8(vld1_u8(ptr + i), zero), &s,
+                          vcombine_u8(vld1_u8(idx + i), zero),
+                          vcombine_u8(vld1_u8(fg + i), zero),
+                          c1, c2, c3, sbitv, &coll);
+        vst1_u8(ptr + i, vget_low_u8(img));
+        vst1_u8(sptr + i, vget_low_u8(s));
+        i += 8;
+    }
+
+    half = vorr_u8(vget_low_u8(coll), vget_high_u8(coll));
+
+    return fold_bytes(vget_lane_u64(vreinterpret_u64_u8(half), 0))
+           | tail_composite(ptr, sptr, idx, fg, colors, i, size, sbit);
+}
+
+#endif /* SPRITES_SIMD_ARM */
+
+/* ------------------------------------------------------------------------- */
+
+static int simd_supported(int level)
+{
+    switch (level) {
+        case VICII_SPRITES_SIMD_NONE:
+            return 1;
+#ifdef SPRITES_SIMD_X86
+        case VICII_SPRITES_SIMD_SSE2:
+            return __builtin_cpu_supports("sse2");
+#endif
+#ifdef SPRITES_SIMD_ARM
+        case VICII_SPRITES_SIMD_NEON:
+            return 1;
+#endif
+    }
+    return 0;
+}
+
+int vicii_sprites_simd_set(int level)
+{
+    if (!simd_supported(level)) {
+        return -1;
+    }
+
+    switch (level) {
+#ifdef SPRITES_SIMD_X86
+        case VICII_SPRITES_SIMD_SSE2:
+            vicii_sprites_composite = sse2_composite;
+            break;
+#endif
+#ifdef SPRITES_SIMD_ARM
+        case VICII_SPRITES_SIMD_NEON:
+            vicii_sprites_composite = neon_composite;
+            break;
+#endif
+        default:
+            vicii_sprites_composite = NULL;
+            break;
+    }
+
+    simd_level = level;
+    return 0;
+}
+
+int vicii_sprites_simd_get(void)
+{
+    return simd_level;
+}
+
+const char *vicii_sprites_simd_name(int level)
+{
+    switch (level) {
+        case VICII_SPRITES_SIMD_SSE2:
+            return "SSE2";
+        case VICII_SPRITES_SIMD_NEON:
+            return "NEON";
+    }
+    return "none";
+}
+
+/* 32 bytes of lanes do not gain anything from AVX2.  */
+void vicii_sprites_simd_init(void)
+{
+    static const int preferred[] = {
+        VICII_SPRITES_SIMD_SSE2, VICII_SPRITES_SIMD_NEON
+    };
+    unsigned int i;
+
+    for (i = 0; i < sizeof(preferred) / sizeof(preferred[0]); i++) {
+        if (vicii_sprites_simd_set(preferred[i]) == 0) {
+            return;
+        }
+    }
+    vicii_sprites_simd_set(VICII_SPRITES_SIMD_NONE);
+}
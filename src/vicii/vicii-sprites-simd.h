@@ -0,0 +1,60 @@
+/*
+ * vicii-sprites-simd.h - Vectorized sprite compositing for the VIC-II.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_VICII_SPRITES_SIMD_H
+#define VICE_VICII_SPRITES_SIMD_H
+
+#include "types.h"
+
+/* The longest run of pixels handed over at a time.  */
+#define VICII_SPRITES_SIMD_LANE 32
+
+/* Composite `size' pixels of one sprite into the line at `ptr'.  `idx'
+   has the colour index of each pixel, 0 where the sprite is transparent
+   or trimmed, and `fg' 0xff where the sprite is behind foreground
+   graphics.  `sptr' is the collision line: `sbit' is set where the
+   sprite has a pixel, and the bits of the sprites that were already
+   there are returned.  */
+typedef uint8_t (*vicii_sprites_composite_t)(uint8_t *ptr, uint8_t *sptr,
+                                             const uint8_t *idx, const uint8_t *fg,
+                                             const uint8_t *colors, unsigned int size,
+                                             uint8_t sbit);
+
+enum {
+    VICII_SPRITES_SIMD_NONE = 0,
+    VICII_SPRITES_SIMD_SSE2,
+    VICII_SPRITES_SIMD_NEON
+};
+
+/* NULL when the pixel by pixel code is used.  */
+extern vicii_sprites_composite_t vicii_sprites_composite;
+
+/* Pick the best instruction set the CPU supports.  */
+extern void vicii_sprites_simd_init(void);
+
+/* Force an instruction set, returns -1 if the CPU or build lacks it.  */
+extern int vicii_sprites_simd_set(int level);
+extern int vicii_sprites_simd_get(void);
+extern const char *vicii_sprites_simd_name(int level);
+
+#endif
@@ -37,6 +37,7 @@
 #include "raster-sprite-status.h"
 #include "raster-sprite.h"
 #include "types.h"
+#include "vicii-sprites-simd.h"
 #include "vicii-sprites.h"
 #include "viciitypes.h"
 #include "viewport.h"
@@ -387,9 +388,18 @@ static uint8_t *sprline = NULL;
 static uint16_t sprite_doubling_table[256];
 static uint8_t mcsprtable[256];
 
+/* Tables to expand a byte of a mask into one byte per pixel for
+   vicii_sprites_composite(), the first pixel from bit 7: 0xff for each
+   bit set, 1 for each bit set, and the colour index of each pair of
+   bits, for normal and x-expanded multicolor sprites.  */
+static uint8_t msk_lane_table[256][8];
+static uint8_t hires_lane_table[256][8];
+static uint8_t mc_lane_table[256][8];
+static uint8_t mc_expanded_lane_table[256][16];
+
 static void init_drawing_tables(void)
 {
-    unsigned int i;
+    unsigned int i, j;
     uint16_t w;
 
     for (w = i = 0; i <= 0xff; i++) {
@@ -398,6 +408,110 @@ static void init_drawing_tables(void)
         w++;
         w |= (w & 0x5555) << 1;
     }
+
+    for (i = 0; i <= 0xff; i++) {
+        for (j = 0; j < 8; j++) {
+            msk_lane_table[i][j] = (i & (0x80 >> j)) ? 0xff : 0;
+            hires_lane_table[i][j] = (i & (0x80 >> j)) ? 1 : 0;
+            mc_lane_table[i][j] = (uint8_t)((i >> (6 - (j & 6))) & 3);
+        }
+        for (j = 0; j < 16; j++) {
+            mc_expanded_lane_table[i][j] = (uint8_t)((i >> (6 - (j / 4) * 2)) & 3);
+        }
+    }
+}
+
+/* Expand the low `size' bits of `msk', the first pixel in bit size - 1,
+   into `dest'.  */
+static inline void msk_to_lane(uint8_t lane[][8], uint32_t msk, int size,
+                               uint8_t *dest)
+{
+    uint32_t m = msk << (32 - size);
+    int i;
+
+    for (i = 0; i < size; i += 8, m <<= 8) {
+        memcpy(dest + i, lane[m >> 24], 8);
+    }
+}
+
+/* Only the pixels from the first to the last bit set in the low `size'
+   bits of `msk' go to vicii_sprites_composite(): the trimmed ones around
+   them can be outside the line.  Returns 0 if there are none.  */
+static inline int lane_span(uint32_t msk, int size, int *first)
+{
+    uint32_t m = size < 32 ? msk & ((1U << size) - 1) : msk;
+
+    if (size <= 0 || m == 0) {
+        return 0;
+    }
+    *first = size - 32 + __builtin_clz(m);
+    return size - __builtin_ctz(m) - *first;
+}
+
+static inline uint8_t hires_lanes(uint32_t msk, uint32_t gfxmsk, int size,
+                                  uint8_t sbit, uint8_t *ptr, uint8_t *sptr,
+                                  uint8_t color)
+{
+    uint8_t idx[VICII_SPRITES_SIMD_LANE], fg[VICII_SPRITES_SIMD_LANE];
+    uint8_t colors[4] = { 0, 0, 0, 0 };
+    int first, n;
+
+    n = lane_span(msk, size, &first);
+    if (n == 0) {
+        return 0;
+    }
+    msk_to_lane(hires_lane_table, msk, size, idx);
+    if (gfxmsk) {
+        msk_to_lane(msk_lane_table, gfxmsk, size, fg);
+    } else {
+        memset(fg, 0, sizeof(fg));
+    }
+    colors[1] = color;
+
+    return vicii_sprites_composite(ptr + first, sptr + first, idx + first, fg + first,
+                                   colors, n, sbit);
+}
+
+/* The first pair of `mcmsk' is in bits 23 and 22, as in the
+   _MCSPRITE_*MASK() loops.  */
+static inline uint8_t mc_lanes(uint32_t mcmsk, uint32_t gfxmsk, uint32_t trmsk,
+                               int size, int expanded, uint8_t sbit,
+                               uint8_t *ptr, uint8_t *sptr, const uint32_t *c)
+{
+    uint8_t idx[VICII_SPRITES_SIMD_LANE], fg[VICII_SPRITES_SIMD_LANE];
+    uint8_t trim[VICII_SPRITES_SIMD_LANE];
+    uint8_t colors[4];
+    int i, first, n;
+
+    n = lane_span(trmsk, size, &first);
+    if (n == 0) {
+        return 0;
+    }
+    if (expanded) {
+        for (i = 0; i < size; i += 16, mcmsk <<= 8) {
+            memcpy(idx + i, mc_expanded_lane_table[(mcmsk >> 16) & 0xff], 16);
+        }
+    } else {
+        for (i = 0; i < size; i += 8, mcmsk <<= 8) {
+            memcpy(idx + i, mc_lane_table[(mcmsk >> 16) & 0xff], 8);
+        }
+    }
+    msk_to_lane(msk_lane_table, trmsk, size, trim);
+    for (i = 0; i < size; i++) {
+        idx[i] &= trim[i];
+    }
+    if (gfxmsk) {
+        msk_to_lane(msk_lane_table, gfxmsk, size, fg);
+    } else {
+        memset(fg, 0, sizeof(fg));
+    }
+    colors[0] = 0;
+    colors[1] = (uint8_t)c[1];
+    colors[2] = (uint8_t)c[2];
+    colors[3] = (uint8_t)c[3];
+
+    return vicii_sprites_composite(ptr + first, sptr + first, idx + first, fg + first,
+                                   colors, n, sbit);
 }
 
 /* Sprite drawing macros.  */
@@ -431,10 +545,20 @@ static void init_drawing_tables(void)
         }                                                        \
     } while (0)
 
-#define SPRITE_MASK(msk, gfxmsk, size, sprite_bit, imgptr,          \
-                    collmskptr, color, collmsk_return)              \
-    _SPRITE_MASK(msk, gfxmsk, size, sprite_bit, imgptr, collmskptr, \
-                 color, collmsk_return, SPRITE_PIXEL)
+#define SPRITE_MASK(msk, gfxmsk, size, sprite_bit, imgptr,              \
+                    collmskptr, color, collmsk_return)                  \
+    do {                                                                \
+        if (vicii_sprites_composite != NULL) {                          \
+            (collmsk_return) |= hires_lanes(msk, gfxmsk, size,          \
+                                            (uint8_t)(sprite_bit),      \
+                                            imgptr, collmskptr,         \
+                                            (uint8_t)(color));          \
+        } else {                                                        \
+            _SPRITE_MASK(msk, gfxmsk, size, sprite_bit, imgptr,         \
+                         collmskptr, color, collmsk_return,             \
+                         SPRITE_PIXEL);                                 \
+        }                                                               \
+    } while (0)
 
 /* Multicolor sprites */
 #define _MCSPRITE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, imgptr,   \
@@ -476,11 +600,23 @@ static void init_drawing_tables(void)
     } while (0)
 
 
-#define MCSPRITE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, imgptr, \
-                      collmskptr, pixel_table, collmsk_return)        \
-    _MCSPRITE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, imgptr,    \
-                   collmskptr, pixel_table, collmsk_return,           \
-                   SPRITE_PIXEL)
+/* With vicii_sprites_composite() `mcmsk' moves on the same way it does in
+   the loop; `trmsk' does not, it is never used again without being
+   trimmed anew.  */
+#define MCSPRITE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, imgptr,    \
+                      collmskptr, pixel_table, collmsk_return)           \
+    do {                                                                 \
+        if (vicii_sprites_composite != NULL) {                           \
+            (collmsk_return) |= mc_lanes(mcmsk, gfxmsk, trmsk, size, 0,  \
+                                         (uint8_t)(sprite_bit), imgptr,  \
+                                         collmskptr, pixel_table);       \
+            (mcmsk) <<= (size);                                          \
+        } else {                                                         \
+            _MCSPRITE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit,       \
+                           imgptr, collmskptr, pixel_table,              \
+                           collmsk_return, SPRITE_PIXEL);                \
+        }                                                                \
+    } while (0)
 
 
 #define _MCSPRITE_DOUBLE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, \
@@ -517,9 +653,18 @@ static void init_drawing_tables(void)
 #define MCSPRITE_DOUBLE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit,        \
                              imgptr, collmskptr, pixel_table,               \
                              collmsk_return)                                \
-    _MCSPRITE_DOUBLE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit, imgptr,   \
-                          collmskptr, pixel_table, collmsk_return,          \
-                          SPRITE_PIXEL)
+    do {                                                                    \
+        if (vicii_sprites_composite != NULL) {                              \
+            (collmsk_return) |= mc_lanes(mcmsk, gfxmsk, trmsk, size, 1,     \
+                                         (uint8_t)(sprite_bit), imgptr,     \
+                                         collmskptr, pixel_table);          \
+            (mcmsk) <<= (size) / 2;                                         \
+        } else {                                                            \
+            _MCSPRITE_DOUBLE_MASK(mcmsk, gfxmsk, trmsk, size, sprite_bit,   \
+                                  imgptr, collmskptr, pixel_table,          \
+                                  collmsk_return, SPRITE_PIXEL);            \
+        }                                                                   \
+    } while (0)
 
 
 #define TRIM_MSK(msk, size)                                                 \
@@ -1202,6 +1347,7 @@ static void update_cached_sprite_collisions(raster_cache_t *cache)
 void vicii_sprites_init(void)
 {
     init_drawing_tables();
+    vicii_sprites_simd_init();
 
     raster_sprite_status_set_draw_function(vicii.raster.sprite_status,
                                            draw_all_sprites);
@@ -1336,6 +1482,13 @@ void vicii_sprites_init_sprline(void)
     sprline = lib_realloc(sprline, vicii.sprite_wrap_x);
 }
 
+/* The sprite bits of the line for the sprite-sprite collisions,
+   `vicii.sprite_wrap_x' bytes.  */
+uint8_t *vicii_sprites_get_sprline(void)
+{
+    return sprline;
+}
+
 void vicii_sprites_shutdown(void)
 {
     lib_free(sprline);
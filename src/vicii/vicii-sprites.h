@@ -28,6 +28,8 @@
 #ifndef VICE_VICII_SPRITES_H
 #define VICE_VICII_SPRITES_H
 
+#include "types.h"
+
 /* This defines the stolen sprite cycles for all the values of `dma_msk'.  */
 /* The table derives from what Christian Bauer <bauec002@physik.uni-mainz.de>
    says in both the "VIC-Article" and Frodo's `VIC_SC.cpp' source file.  */
@@ -46,6 +48,7 @@ extern void vicii_sprites_shutdown(void);
 extern void vicii_sprites_set_x_position(unsigned int num, int new_x, int raster_x);
 extern void vicii_sprites_reset_sprline(void);
 extern void vicii_sprites_init_sprline(void);
+extern uint8_t *vicii_sprites_get_sprline(void);
 extern void vicii_sprites_reset_xshift(void);
 extern int vicii_sprite_offset(void);
 
@@ -65,6 +65,7 @@
 #include "maincpu.h"
 #include "mem.h"
 #include "monitor.h"
+#include "profile.h"
 #include "raster-changes.h"
 #include "raster-line.h"
 #include "raster-modes.h"
@@ -272,6 +273,17 @@ void vicii_handle_pending_alarms_external_write(void)
     }
 }
 
+/* The first clock at which vicii_handle_pending_alarms() has something to
+   do.  Until then, a DMA may move bytes without calling it after each
+   cycle.  */
+CLOCK vicii_pending_alarms_clk(void)
+{
+    if (!vicii.initialized) {
+        return CLOCK_MAX;
+    }
+    return vicii.fetch_clk < vicii.draw_clk ? vicii.fetch_clk : vicii.draw_clk;
+}
+
 /* return pixel aspect ratio for current video mode
  * based on http://codebase64.com/doku.php?id=base:pixel_aspect_ratio
  */
@@ -1204,6 +1216,8 @@ void vicii_raster_draw_alarm_handler(CLOCK offset, void *data)
     uint8_t prev_sprite_background_collisions;
     int in_visible_area;
 
+    PROFILE_ENTER(PROFILE_VICII_DRAW);
+
     prev_sprite_sprite_collisions = vicii.sprite_sprite_collisions;
     prev_sprite_background_collisions = vicii.sprite_background_collisions;
 
@@ -1389,6 +1403,8 @@ void vicii_raster_draw_alarm_handler(CLOCK offset, void *data)
     vicii.last_emulate_line_clk += vicii.cycles_per_line;
     vicii.draw_clk = vicii.last_emulate_line_clk + vicii.draw_cycle;
     alarm_set(vicii.raster_draw_alarm, vicii.draw_clk);
+
+    PROFILE_LEAVE();
 }
 
 void vicii_set_canvas_refresh(int enable)
@@ -69,6 +69,14 @@ struct canvas_refresh_s {
 };
 typedef struct canvas_refresh_s canvas_refresh_t;
 
+/* Columns of one draw buffer line that changed since the last refresh,
+   without extra_offscreen_border_left.  xs > xe if nothing changed.  */
+struct video_dirty_span_s {
+    unsigned int xs;
+    unsigned int xe;
+};
+typedef struct video_dirty_span_s video_dirty_span_t;
+
 struct draw_buffer_s {
     /* The memory buffer where the screen of the emulated machine is drawn. Palettized, 1 byte per pixel */
     uint8_t *draw_buffer;
@@ -93,6 +101,10 @@ struct draw_buffer_s {
     unsigned int visible_width;
     /* Height of the visible subset of draw_buffer, in pixels */
     unsigned int visible_height;
+    /* Changed columns of every draw buffer line, only set while the raster
+       calls video_canvas_refresh().  NULL means the whole refresh area has
+       to be redrawn.  */
+    video_dirty_span_t *dirty_lines;
 };
 typedef struct draw_buffer_s draw_buffer_t;
 
@@ -155,6 +167,7 @@ struct video_render_color_tables_s {
     int32_t line_yuv_0[VIDEO_MAX_OUTPUT_WIDTH * 3];
     int16_t prevrgbline[VIDEO_MAX_OUTPUT_WIDTH * 3];
     uint8_t rgbscratchbuffer[VIDEO_MAX_OUTPUT_WIDTH * 4];
+    int32_t yuvscratchbuffer[VIDEO_MAX_OUTPUT_WIDTH * 3]; /* one line for the SIMD stores */
 };
 typedef struct video_render_color_tables_s video_render_color_tables_t;
 
@@ -242,6 +255,14 @@ extern void video_canvas_resize(struct video_canvas_s *canvas, char resize_canva
 extern void video_canvas_render(struct video_canvas_s *canvas, uint8_t *trg,
                                 int width, int height, int xs, int ys,
                                 int xt, int yt, int pitcht, int depth);
+extern void video_canvas_render_dirty(struct video_canvas_s *canvas, uint8_t *trg,
+                                      int width, int height, int xs, int ys,
+                                      int xt, int yt, int pitcht, int depth);
+extern void video_canvas_render_frame(struct video_canvas_s *canvas, const uint8_t *src,
+                                      const uint8_t *map, uint8_t *trg,
+                                      int width, int height, int xs, int ys,
+                                      int xt, int yt, int pitcht, int depth);
+extern uint64_t video_canvas_render_bytes(void);
 extern void video_canvas_refresh_all(struct video_canvas_s *canvas);
 extern char video_canvas_can_resize(struct video_canvas_s *canvas);
 extern void video_viewport_get(struct video_canvas_s *canvas,
@@ -0,0 +1,588 @@
+/*
+ * render-simd.c - Vectorized YUV to RGB stores for the PAL and CRT renderers.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * The delay line and blur of the PAL and CRT renderers are running sums
+ * over table lookups and stay scalar.  What is vectorized is the second
+ * half of the work: YUV to RGB, the gamma table lookups (gathers with
+ * AVX2, scalar otherwise), the scanline blend with the previous line and
+ * the packing into 16 or 32 bit pixels.  Every function here has to give
+ * exactly the bytes the store_line_and_scanline_*() and store_pixel_*()
+ * helpers of the scalar renderers give; `vicebench -rendercheck' compares
+ * them.
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+
+#include "render-simd.h"
+#include "types.h"
+#include "video-color.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RENDER_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RENDER_SIMD_ARM
+#include <arm_neon.h>
+#endif
+
+#define S RENDER_SIMD_STRIDE
+
+render_simd_line_and_scanline_t render_simd_line_and_scanline_2 = NULL;
+render_simd_line_and_scanline_t render_simd_line_and_scanline_4 = NULL;
+render_simd_line_t render_simd_line_2 = NULL;
+render_simd_line_t render_simd_line_4 = NULL;
+
+static int simd_level = RENDER_SIMD_NONE;
+
+/* ------------------------------------------------------------------------- */
+/* Scalar code for the pixels that do not fill a whole vector.  */
+
+static inline
+void yuv_to_rgb(int32_t y, int32_t u, int32_t v, int32_t *red, int32_t *grn, int32_t *blu)
+{
+    *red = (y + v) >> 16;
+    *blu = (y + u) >> 16;
+    *grn = (y - ((50 * u + 130 * v) >> 8)) >> 16;
+}
+
+static inline
+void tail_line_and_scanline(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                            const int32_t *yuv, unsigned int i, unsigned int n,
+                            int pixelstride)
+{
+    int32_t red, grn, blu;
+    uint32_t tmp1, tmp2;
+
+    for (; i < n; i++) {
+        yuv_to_rgb(yuv[i], yuv[S + i], yuv[2 * S + i], &red, &grn, &blu);
+
+        tmp1 = gamma_red_fac[512 + red + prevline[i]]
+               | gamma_grn_fac[512 + grn + prevline[S + i]]
+               | gamma_blu_fac[512 + blu + prevline[2 * S + i]];
+        tmp2 = gamma_red[256 + red] | gamma_grn[256 + grn] | gamma_blu[256 + blu];
+
+        if (pixelstride == 2) {
+            ((uint16_t *)scanline)[i] = (uint16_t)tmp1;
+            ((uint16_t *)line)[i] = (uint16_t)tmp2;
+        } else {
+            ((uint32_t *)scanline)[i] = tmp1 | alpha;
+            ((uint32_t *)line)[i] = tmp2 | alpha;
+        }
+
+        prevline[i] = (int16_t)red;
+        prevline[S + i] = (int16_t)grn;
+        prevline[2 * S + i] = (int16_t)blu;
+    }
+}
+
+static inline
+void tail_line(uint8_t *line, const int32_t *yuv, unsigned int i, unsigned int n,
+               int pixelstride)
+{
+    int32_t red, grn, blu;
+    uint32_t tmp;
+
+    for (; i < n; i++) {
+        yuv_to_rgb(yuv[i], yuv[S + i], yuv[2 * S + i], &red, &grn, &blu);
+        tmp = gamma_red[256 + red] | gamma_grn[256 + grn] | gamma_blu[256 + blu];
+        if (pixelstride == 2) {
+            ((uint16_t *)line)[i] = (uint16_t)tmp;
+        } else {
+            ((uint32_t *)line)[i] = tmp | alpha;
+        }
+    }
+}
+
+/* Table lookups for four pixels whose table indices have been computed
+   with vector code: red, green and blue for the line, then the same for
+   the scanline.  */
+static inline
+void lookup_4(uint8_t *line, uint8_t *scanline, const int32_t *idx,
+              unsigned int i, int pixelstride)
+{
+    unsigned int k;
+    uint32_t tmp1, tmp2;
+
+    for (k = 0; k < 4; k++) {
+        tmp2 = gamma_red[idx[k]] | gamma_grn[idx[4 + k]] | gamma_blu[idx[8 + k]];
+        if (scanline != NULL) {
+            tmp1 = gamma_red_fac[idx[12 + k]]
+                   | gamma_grn_fac[idx[16 + k]]
+                   | gamma_blu_fac[idx[20 + k]];
+            if (pixelstride == 2) {
+                ((uint16_t *)scanline)[i + k] = (uint16_t)tmp1;
+            } else {
+                ((uint32_t *)scanline)[i + k] = tmp1 | alpha;
+            }
+        }
+        if (pixelstride == 2) {
+            ((uint16_t *)line)[i + k] = (uint16_t)tmp2;
+        } else {
+            ((uint32_t *)line)[i + k] = tmp2 | alpha;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* SSE2 and AVX2.  */
+
+#ifdef RENDER_SIMD_X86
+
+/* 50 * u + 130 * v without SSE4.1 multiplies; wraps like the C code.  */
+#define SSE2_UV_MIX(u, v)                                                    \
+    _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(u, 5),          \
+                                              _mm_slli_epi32(u, 4)),         \
+                                _mm_slli_epi32(u, 1)),                       \
+                  _mm_add_epi32(_mm_slli_epi32(v, 7), _mm_slli_epi32(v, 1)))
+
+__attribute__((target("sse2")))
+static inline
+void sse2_rgb_4(const int32_t *yuv, unsigned int i,
+                __m128i *red, __m128i *grn, __m128i *blu)
+{
+    __m128i y = _mm_loadu_si128((const __m128i *)(yuv + i));
+    __m128i u = _mm_loadu_si128((const __m128i *)(yuv + S + i));
+    __m128i v = _mm_loadu_si128((const __m128i *)(yuv + 2 * S + i));
+
+    *red = _mm_srai_epi32(_mm_add_epi32(y, v), 16);
+    *blu = _mm_srai_epi32(_mm_add_epi32(y, u), 16);
+    *grn = _mm_srai_epi32(_mm_sub_epi32(y, _mm_srai_epi32(SSE2_UV_MIX(u, v), 8)), 16);
+}
+
+__attribute__((target("sse2")))
+static inline
+__m128i sse2_load_prev_4(const int16_t *p)
+{
+    __m128i x = _mm_loadl_epi64((const __m128i *)p);
+
+    return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+}
+
+__attribute__((target("sse2")))
+static inline
+void sse2_store_prev_4(int16_t *p, __m128i x)
+{
+    _mm_storel_epi64((__m128i *)p, _mm_packs_epi32(x, x));
+}
+
+__attribute__((target("sse2")))
+static inline
+void sse2_line_and_scanline(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                            const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const __m128i c256 = _mm_set1_epi32(256);
+    const __m128i c512 = _mm_set1_epi32(512);
+    int32_t idx[24] __attribute__((aligned(16)));
+    __m128i red, grn, blu;
+    unsigned int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        sse2_rgb_4(yuv, i, &red, &grn, &blu);
+
+        _mm_store_si128((__m128i *)&idx[0], _mm_add_epi32(red, c256));
+        _mm_store_si128((__m128i *)&idx[4], _mm_add_epi32(grn, c256));
+        _mm_store_si128((__m128i *)&idx[8], _mm_add_epi32(blu, c256));
+        _mm_store_si128((__m128i *)&idx[12],
+                        _mm_add_epi32(_mm_add_epi32(red, c512), sse2_load_prev_4(prevline + i)));
+        _mm_store_si128((__m128i *)&idx[16],
+                        _mm_add_epi32(_mm_add_epi32(grn, c512), sse2_load_prev_4(prevline + S + i)));
+        _mm_store_si128((__m128i *)&idx[20],
+                        _mm_add_epi32(_mm_add_epi32(blu, c512), sse2_load_prev_4(prevline + 2 * S + i)));
+
+        sse2_store_prev_4(prevline + i, red);
+        sse2_store_prev_4(prevline + S + i, grn);
+        sse2_store_prev_4(prevline + 2 * S + i, blu);
+
+        lookup_4(line, scanline, idx, i, pixelstride);
+    }
+    tail_line_and_scanline(line, scanline, prevline, yuv, i, n, pixelstride);
+}
+
+__attribute__((target("sse2")))
+static inline
+void sse2_line(uint8_t *line, const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const __m128i c256 = _mm_set1_epi32(256);
+    int32_t idx[12] __attribute__((aligned(16)));
+    __m128i red, grn, blu;
+    unsigned int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        sse2_rgb_4(yuv, i, &red, &grn, &blu);
+
+        _mm_store_si128((__m128i *)&idx[0], _mm_add_epi32(red, c256));
+        _mm_store_si128((__m128i *)&idx[4], _mm_add_epi32(grn, c256));
+        _mm_store_si128((__m128i *)&idx[8], _mm_add_epi32(blu, c256));
+
+        lookup_4(line, NULL, idx, i, pixelstride);
+    }
+    tail_line(line, yuv, i, n, pixelstride);
+}
+
+__attribute__((target("sse2")))
+static void sse2_line_and_scanline_2(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    sse2_line_and_scanline(line, scanline, prevline, yuv, n, 2);
+}
+
+__attribute__((target("sse2")))
+static void sse2_line_and_scanline_4(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    sse2_line_and_scanline(line, scanline, prevline, yuv, n, 4);
+}
+
+__attribute__((target("sse2")))
+static void sse2_line_2(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    sse2_line(line, yuv, n, 2);
+}
+
+__attribute__((target("sse2")))
+static void sse2_line_4(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    sse2_line(line, yuv, n, 4);
+}
+
+#define AVX2_UV_MIX(u, v)                                                          \
+    _mm256_add_epi32(_mm256_mullo_epi32(u, _mm256_set1_epi32(50)),                 \
+                     _mm256_mullo_epi32(v, _mm256_set1_epi32(130)))
+
+#define AVX2_GATHER(table, index) \
+    _mm256_i32gather_epi32((const int *)(table), index, 4)
+
+__attribute__((target("avx2")))
+static inline
+void avx2_rgb_8(const int32_t *yuv, unsigned int i,
+                __m256i *red, __m256i *grn, __m256i *blu)
+{
+    __m256i y = _mm256_loadu_si256((const __m256i *)(yuv + i));
+    __m256i u = _mm256_loadu_si256((const __m256i *)(yuv + S + i));
+    __m256i v = _mm256_loadu_si256((const __m256i *)(yuv + 2 * S + i));
+
+    *red = _mm256_srai_epi32(_mm256_add_epi32(y, v), 16);
+    *blu = _mm256_srai_epi32(_mm256_add_epi32(y, u), 16);
+    *grn = _mm256_srai_epi32(_mm256_sub_epi32(y, _mm256_srai_epi32(AVX2_UV_MIX(u, v), 8)), 16);
+}
+
+/* Low 16 bits of each lane, in order.  */
+__attribute__((target("avx2")))
+static inline
+__m128i avx2_narrow_8(__m256i x)
+{
+    x = _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+    x = _mm256_packs_epi32(x, x);
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(x, 0x08));
+}
+
+__attribute__((target("avx2")))
+static inline
+void avx2_store_8(uint8_t *trg, unsigned int i, __m256i x, int pixelstride)
+{
+    if (pixelstride == 2) {
+        _mm_storeu_si128((__m128i *)(trg + i * 2), avx2_narrow_8(x));
+    } else {
+        _mm256_storeu_si256((__m256i *)(trg + i * 4),
+                            _mm256_or_si256(x, _mm256_set1_epi32((int)alpha)));
+    }
+}
+
+__attribute__((target("avx2")))
+static inline
+void avx2_line_and_scanline(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                            const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const __m256i c256 = _mm256_set1_epi32(256);
+    const __m256i c512 = _mm256_set1_epi32(512);
+    __m256i red, grn, blu, pr, pg, pb, x;
+    unsigned int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        avx2_rgb_8(yuv, i, &red, &grn, &blu);
+
+        pr = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(prevline + i)));
+        pg = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(prevline + S + i)));
+        pb = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(prevline + 2 * S + i)));
+
+        x = _mm256_or_si256(_mm256_or_si256(
+                AVX2_GATHER(gamma_red_fac, _mm256_add_epi32(_mm256_add_epi32(red, pr), c512)),
+                AVX2_GATHER(gamma_grn_fac, _mm256_add_epi32(_mm256_add_epi32(grn, pg), c512))),
+                AVX2_GATHER(gamma_blu_fac, _mm256_add_epi32(_mm256_add_epi32(blu, pb), c512)));
+        avx2_store_8(scanline, i, x, pixelstride);
+
+        x = _mm256_or_si256(_mm256_or_si256(
+                AVX2_GATHER(gamma_red, _mm256_add_epi32(red, c256)),
+                AVX2_GATHER(gamma_grn, _mm256_add_epi32(grn, c256))),
+                AVX2_GATHER(gamma_blu, _mm256_add_epi32(blu, c256)));
+        avx2_store_8(line, i, x, pixelstride);
+
+        _mm_storeu_si128((__m128i *)(prevline + i), avx2_narrow_8(red));
+        _mm_storeu_si128((__m128i *)(prevline + S + i), avx2_narrow_8(grn));
+        _mm_storeu_si128((__m128i *)(prevline + 2 * S + i), avx2_narrow_8(blu));
+    }
+    tail_line_and_scanline(line, scanline, prevline, yuv, i, n, pixelstride);
+}
+
+__attribute__((target("avx2")))
+static inline
+void avx2_line(uint8_t *line, const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const __m256i c256 = _mm256_set1_epi32(256);
+    __m256i red, grn, blu, x;
+    unsigned int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        avx2_rgb_8(yuv, i, &red, &grn, &blu);
+
+        x = _mm256_or_si256(_mm256_or_si256(
+                AVX2_GATHER(gamma_red, _mm256_add_epi32(red, c256)),
+                AVX2_GATHER(gamma_grn, _mm256_add_epi32(grn, c256))),
+                AVX2_GATHER(gamma_blu, _mm256_add_epi32(blu, c256)));
+        avx2_store_8(line, i, x, pixelstride);
+    }
+    tail_line(line, yuv, i, n, pixelstride);
+}
+
+__attribute__((target("avx2")))
+static void avx2_line_and_scanline_2(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    avx2_line_and_scanline(line, scanline, prevline, yuv, n, 2);
+}
+
+__attribute__((target("avx2")))
+static void avx2_line_and_scanline_4(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    avx2_line_and_scanline(line, scanline, prevline, yuv, n, 4);
+}
+
+__attribute__((target("avx2")))
+static void avx2_line_2(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    avx2_line(line, yuv, n, 2);
+}
+
+__attribute__((target("avx2")))
+static void avx2_line_4(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    avx2_line(line, yuv, n, 4);
+}
+
+#endif /* RENDER_SIMD_X86 */
+
+/* ------------------------------------------------------------------------- */
+/* NEON.  */
+
+#ifdef RENDER_SIMD_ARM
+
+static inline
+void neon_rgb_4(const int32_t *yuv, unsigned int i,
+                int32x4_t *red, int32x4_t *grn, int32x4_t *blu)
+{
+    int32x4_t y = vld1q_s32(yuv + i);
+    int32x4_t u = vld1q_s32(yuv + S + i);
+    int32x4_t v = vld1q_s32(yuv + 2 * S + i);
+    int32x4_t t = vaddq_s32(vmulq_n_s32(u, 50), vmulq_n_s32(v, 130));
+
+    *red = vshrq_n_s32(vaddq_s32(y, v), 16);
+    *blu = vshrq_n_s32(vaddq_s32(y, u), 16);
+    *grn = vshrq_n_s32(vsubq_s32(y, vshrq_n_s32(t, 8)), 16);
+}
+
+static inline
+void neon_line_and_scanline(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                            const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const int32x4_t c256 = vdupq_n_s32(256);
+    const int32x4_t c512 = vdupq_n_s32(512);
+    int32_t idx[24];
+    int32x4_t red, grn, blu;
+    unsigned int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        neon_rgb_4(yuv, i, &red, &grn, &blu);
+
+        vst1q_s32(&idx[0], vaddq_s32(red, c256));
+        vst1q_s32(&idx[4], vaddq_s32(grn, c256));
+        vst1q_s32(&idx[8], vaddq_s32(blu, c256));
+        vst1q_s32(&idx[12], vaddq_s32(vaddq_s32(red, c512), vmovl_s16(vld1_s16(prevline + i))));
+        vst1q_s32(&idx[16], vaddq_s32(vaddq_s32(grn, c512), vmovl_s16(vld1_s16(prevline + S + i))));
+        vst1q_s32(&idx[20], vaddq_s32(vaddq_s32(blu, c512), vmovl_s16(vld1_s16(prevline + 2 * S + i))));
+
+        vst1_s16(prevline + i, vmovn_s32(red));
+        vst1_s16(prevline + S + i, vmovn_s32(grn));
+        vst1_s16(prevline + 2 * S + i, vmovn_s32(blu));
+
+        lookup_4(line, scanline, idx, i, pixelstride);
+    }
+    tail_line_and_scanline(line, scanline, prevline, yuv, i, n, pixelstride);
+}
+
+static inline
+void neon_line(uint8_t *line, const int32_t *yuv, unsigned int n, int pixelstride)
+{
+    const int32x4_t c256 = vdupq_n_s32(256);
+    int32_t idx[12];
+    int32x4_t red, grn, blu;
+    unsigned int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        neon_rgb_4(yuv, i, &red, &grn, &blu);
+
+        vst1q_s32(&idx[0], vaddq_s32(red, c256));
+        vst1q_s32(&idx[4], vaddq_s32(grn, c256));
+        vst1q_s32(&idx[8], vaddq_s32(blu, c256));
+
+        lookup_4(line, NULL, idx, i, pixelstride);
+    }
+    tail_line(line, yuv, i, n, pixelstride);
+}
+
+static void neon_line_and_scanline_2(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    neon_line_and_scanline(line, scanline, prevline, yuv, n, 2);
+}
+
+static void neon_line_and_scanline_4(uint8_t *line, uint8_t *scanline, int16_t *prevline,
+                                     const int32_t *yuv, unsigned int n)
+{
+    neon_line_and_scanline(line, scanline, prevline, yuv, n, 4);
+}
+
+static void neon_line_2(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    neon_line(line, yuv, n, 2);
+}
+
+static void neon_line_4(uint8_t *line, const int32_t *yuv, unsigned int n)
+{
+    neon_line(line, yuv, n, 4);
+}
+
+#endif /* RENDER_SIMD_ARM */
+
+/* ------------------------------------------------------------------------- */
+
+static int simd_supported(int level)
+{
+    switch (level) {
+        case RENDER_SIMD_NONE:
+            return 1;
+#ifdef RENDER_SIMD_X86
+        case RENDER_SIMD_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case RENDER_SIMD_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#ifdef RENDER_SIMD_ARM
+        case RENDER_SIMD_NEON:
+            return 1;
+#endif
+    }
+    return 0;
+}
+
+int render_simd_set(int level)
+{
+    if (!simd_supported(level)) {
+        return -1;
+    }
+
+    render_simd_line_and_scanline_2 = NULL;
+    render_simd_line_and_scanline_4 = NULL;
+    render_simd_line_2 = NULL;
+    render_simd_line_4 = NULL;
+
+    switch (level) {
+#ifdef RENDER_SIMD_X86
+        case RENDER_SIMD_SSE2:
+            render_simd_line_and_scanline_2 = sse2_line_and_scanline_2;
+            render_simd_line_and_scanline_4 = sse2_line_and_scanline_4;
+            render_simd_line_2 = sse2_line_2;
+            render_simd_line_4 = sse2_line_4;
+            break;
+        case RENDER_SIMD_AVX2:
+            render_simd_line_and_scanline_2 = avx2_line_and_scanline_2;
+            render_simd_line_and_scanline_4 = avx2_line_and_scanline_4;
+            render_simd_line_2 = avx2_line_2;
+            render_simd_line_4 = avx2_line_4;
+            break;
+#endif
+#ifdef RENDER_SIMD_ARM
+        case RENDER_SIMD_NEON:
+            render_simd_line_and_scanline_2 = neon_line_and_scanline_2;
+            render_simd_line_and_scanline_4 = neon_line_and_scanline_4;
+            render_simd_line_2 = neon_line_2;
+            render_simd_line_4 = neon_line_4;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    simd_level = level;
+    return 0;
+}
+
+int render_simd_get(void)
+{
+    return simd_level;
+}
+
+const char *render_simd_name(int level)
+{
+    switch (level) {
+        case RENDER_SIMD_SSE2:
+            return "SSE2";
+        case RENDER_SIMD_AVX2:
+            return "AVX2";
+        case RENDER_SIMD_NEON:
+            return "NEON";
+    }
+    return "none";
+}
+
+/* SSE2 has no gather and ends up behind the scalar stores, it is only
+   there to be selected by hand.  */
+void render_simd_init(void)
+{
+    static const int preferred[] = {
+        RENDER_SIMD_AVX2, RENDER_SIMD_NEON
+    };
+    unsigned int i;
+
+    for (i = 0; i < sizeof(preferred) / sizeof(preferred[0]); i++) {
+        if (render_simd_set(preferred[i]) == 0) {
+            return;
+        }
+    }
+    render_simd_set(RENDER_SIMD_NONE);
+}
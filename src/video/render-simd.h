@@ -0,0 +1,64 @@
+/*
+ * render-simd.h - Vectorized YUV to RGB stores for the PAL and CRT renderers.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_RENDER_SIMD_H
+#define VICE_RENDER_SIMD_H
+
+#include "types.h"
+#include "video.h"
+
+/* The renderers queue one output line of Y, U and V values in
+   `yuvscratchbuffer', one plane of RENDER_SIMD_STRIDE entries each, and
+   hand the line to one of the functions below.  The scanline variants
+   keep the RGB values of the previous line in `prevrgbline', again as
+   three planes.  */
+#define RENDER_SIMD_STRIDE VIDEO_MAX_OUTPUT_WIDTH
+
+typedef void (*render_simd_line_and_scanline_t)(uint8_t *line, uint8_t *scanline,
+                                                int16_t *prevline, const int32_t *yuv,
+                                                unsigned int n);
+typedef void (*render_simd_line_t)(uint8_t *line, const int32_t *yuv, unsigned int n);
+
+enum {
+    RENDER_SIMD_NONE = 0,
+    RENDER_SIMD_SSE2,
+    RENDER_SIMD_AVX2,
+    RENDER_SIMD_NEON
+};
+
+/* Line stores for 16 and 32 bit targets, NULL when the scalar code has to
+   be used.  */
+extern render_simd_line_and_scanline_t render_simd_line_and_scanline_2;
+extern render_simd_line_and_scanline_t render_simd_line_and_scanline_4;
+extern render_simd_line_t render_simd_line_2;
+extern render_simd_line_t render_simd_line_4;
+
+/* Pick the best instruction set the CPU supports.  */
+extern void render_simd_init(void);
+
+/* Force an instruction set, returns -1 if the CPU or build lacks it.  */
+extern int render_simd_set(int level);
+extern int render_simd_get(void);
+extern const char *render_simd_name(int level);
+
+#endif
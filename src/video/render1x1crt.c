@@ -27,6 +27,9 @@
 
 #include "vice.h"
 
+#include <stdio.h>
+
+#include "render-simd.h"
 #include "render1x1crt.h"
 #include "types.h"
 #include "video-color.h"
@@ -157,8 +160,11 @@ render_generic_1x1_crt(video_render_color_tables_t *color_tab, const uint8_t *sr
                         void (*store_func)(uint8_t *trg,
                                            int32_t y1, int32_t u1, int32_t v1,
                                            int32_t y2, int32_t u2, int32_t v2),
+                        render_simd_line_t simd_store,
                         int yuvtarget)
 {
+    int32_t *yuv = color_tab->yuvscratchbuffer;
+    unsigned int n;
     const int32_t *cbtable = color_tab->cbtable;
     const int32_t *crtable = color_tab->crtable;
     const int32_t *ytablel = color_tab->ytablel;
@@ -191,6 +197,8 @@ render_generic_1x1_crt(video_render_color_tables_t *color_tab, const uint8_t *sr
         cbtable = yuvtarget ? color_tab->cutable : color_tab->cbtable;
         crtable = yuvtarget ? color_tab->cvtable : color_tab->crtable;
 
+        n = 0;
+
         /* one scanline */
         for (x = 0; x < width; x++) {
             cl0 = tmpsrc[0];
@@ -215,9 +223,22 @@ render_generic_1x1_crt(video_render_color_tables_t *color_tab, const uint8_t *sr
             u2 = (unew) * off_flip;
             v2 = (vnew) * off_flip;
 
-            store_func(tmptrg, l1, u1, v1, l2, u2, v2);
+            if (simd_store) {
+                yuv[n] = l1;
+                yuv[RENDER_SIMD_STRIDE + n] = u1;
+                yuv[2 * RENDER_SIMD_STRIDE + n] = v1;
+                yuv[n + 1] = l2;
+                yuv[RENDER_SIMD_STRIDE + n + 1] = u2;
+                yuv[2 * RENDER_SIMD_STRIDE + n + 1] = v2;
+                n += 2;
+            } else {
+                store_func(tmptrg, l1, u1, v1, l2, u2, v2);
+            }
             tmptrg += pixelstride;
         }
+        if (simd_store) {
+            simd_store(trg, yuv, n);
+        }
 
         src += pitchs;
         trg += pitcht;
@@ -234,7 +255,7 @@ render_UYVY_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            4, store_pixel_UYVY, 1);
+                            4, store_pixel_UYVY, NULL, 1);
 }
 
 void
@@ -247,7 +268,7 @@ render_YUY2_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            4, store_pixel_YUY2, 1);
+                            4, store_pixel_YUY2, NULL, 1);
 }
 
 void
@@ -260,7 +281,7 @@ render_YVYU_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            4, store_pixel_YVYU, 1);
+                            4, store_pixel_YVYU, NULL, 1);
 }
 
 void
@@ -273,7 +294,7 @@ render_16_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            4, store_pixel_2, 0);
+                            4, store_pixel_2, render_simd_line_2, 0);
 }
 
 void
@@ -286,7 +307,7 @@ render_24_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            6, store_pixel_3, 0);
+                            6, store_pixel_3, NULL, 0);
 }
 
 void
@@ -299,5 +320,5 @@ render_32_1x1_crt(video_render_color_tables_t *color_tab,
 {
     render_generic_1x1_crt(color_tab, src, trg, width, height, xs, ys, xt, yt,
                             pitchs, pitcht,
-                            8, store_pixel_4, 0);
+                            8, store_pixel_4, render_simd_line_4, 0);
 }
@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 
+#include "render-simd.h"
 #include "render2x2.h"
 #include "render2x2pal.h"
 #include "types.h"
@@ -255,6 +256,16 @@ void store_line_and_scanline_YVYU(
 #endif
 }
 
+/* Collect one output pixel for the SIMD line stores.  */
+static inline
+void queue_yuv(int32_t *yuv, unsigned int *n, int32_t y, int32_t u, int32_t v)
+{
+    yuv[*n] = y;
+    yuv[RENDER_SIMD_STRIDE + *n] = u;
+    yuv[2 * RENDER_SIMD_STRIDE + *n] = v;
+    (*n)++;
+}
+
 static inline
 void get_yuv_from_video(
     const int32_t unew, const int32_t vnew,
@@ -279,8 +290,12 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
                                 uint8_t *const line, uint8_t *const scanline,
                                 int16_t *const prevline, const int shade,
                                 int32_t l, int32_t u, int32_t v),
+                            render_simd_line_and_scanline_t simd_store,
                             const int write_interpolated_pixels, video_render_config_t *config)
 {
+    int32_t *yuv = color_tab->yuvscratchbuffer;
+    uint8_t *linetrg, *linetrgscanline;
+    unsigned int n;
     int16_t *prevrgblineptr;
     const int32_t *ytablel = color_tab->ytablel;
     const int32_t *ytableh = color_tab->ytableh;
@@ -392,6 +407,9 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
 
         /* actual line */
         prevrgblineptr = &color_tab->prevrgbline[0];
+        linetrg = tmptrg;
+        linetrgscanline = tmptrgscanline;
+        n = 0;
         if (wfirst) {
             l2 = ytablel[tmpsrc[1]] + ytableh[tmpsrc[2]] + ytablel[tmpsrc[3]];
             unew += cbtable[tmpsrc[3]];
@@ -403,7 +421,11 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
             line += 2;
 
             if (write_interpolated_pixels) {
-                store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                if (simd_store) {
+                    queue_yuv(yuv, &n, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                } else {
+                    store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                }
                 tmptrgscanline += pixelstride;
                 tmptrg += pixelstride;
                 prevrgblineptr += 3;
@@ -414,7 +436,11 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
             v = v2;
         }
         for (x = 0; x < width; x++) {
-            store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, l, u, v);
+            if (simd_store) {
+                queue_yuv(yuv, &n, l, u, v);
+            } else {
+                store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, l, u, v);
+            }
             tmptrgscanline += pixelstride;
             tmptrg += pixelstride;
             prevrgblineptr += 3;
@@ -429,7 +455,11 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
             line += 2;
 
             if (write_interpolated_pixels) {
-                store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                if (simd_store) {
+                    queue_yuv(yuv, &n, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                } else {
+                    store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, (l + l2) >> 1, (u + u2) >> 1, (v + v2) >> 1);
+                }
                 tmptrgscanline += pixelstride;
                 tmptrg += pixelstride;
                 prevrgblineptr += 3;
@@ -440,7 +470,14 @@ void render_generic_2x2_pal(video_render_color_tables_t *color_tab,
             v = v2;
         }
         if (wlast) {
-            store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, l, u, v);
+            if (simd_store) {
+                queue_yuv(yuv, &n, l, u, v);
+            } else {
+                store_func(tmptrg, tmptrgscanline, prevrgblineptr, shade, l, u, v);
+            }
+        }
+        if (simd_store) {
+            simd_store(linetrg, linetrgscanline, color_tab->prevrgbline, yuv, n);
         }
 
         src += pitchs;
@@ -458,7 +495,7 @@ void render_UYVY_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           4, store_line_and_scanline_UYVY, 0, config);
+                           4, store_line_and_scanline_UYVY, NULL, 0, config);
 }
 
 void render_YUY2_2x2_pal(video_render_color_tables_t *color_tab,
@@ -471,7 +508,7 @@ void render_YUY2_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           4, store_line_and_scanline_YUY2, 0, config);
+                           4, store_line_and_scanline_YUY2, NULL, 0, config);
 }
 
 void render_YVYU_2x2_pal(video_render_color_tables_t *color_tab,
@@ -484,7 +521,7 @@ void render_YVYU_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           4, store_line_and_scanline_YVYU, 0, config);
+                           4, store_line_and_scanline_YVYU, NULL, 0, config);
 }
 
 void render_16_2x2_pal(video_render_color_tables_t *color_tab,
@@ -497,7 +534,8 @@ void render_16_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           2, store_line_and_scanline_2, 1, config);
+                           2, store_line_and_scanline_2,
+                           render_simd_line_and_scanline_2, 1, config);
 }
 
 void render_24_2x2_pal(video_render_color_tables_t *color_tab,
@@ -510,7 +548,7 @@ void render_24_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           3, store_line_and_scanline_3, 1, config);
+                           3, store_line_and_scanline_3, NULL, 1, config);
 }
 
 void render_32_2x2_pal(video_render_color_tables_t *color_tab,
@@ -523,5 +561,6 @@ void render_32_2x2_pal(video_render_color_tables_t *color_tab,
 {
     render_generic_2x2_pal(color_tab, src, trg, width, height, xs, ys,
                            xt, yt, pitchs, pitcht, viewport,
-                           4, store_line_and_scanline_4, 1, config);
+                           4, store_line_and_scanline_4,
+                           render_simd_line_and_scanline_4, 1, config);
 }
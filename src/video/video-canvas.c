@@ -54,6 +54,11 @@
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+static uint64_t render_bytes = 0;
 
 /* called from raster/raster-resources.c:raster_resources_chip_init */
 video_canvas_t *video_canvas_init(void)
@@ -86,18 +91,12 @@ void video_canvas_shutdown(video_canvas_t *canvas)
     }
 }
 
-void video_canvas_render(video_canvas_t *canvas, uint8_t *trg, int width,
-                         int height, int xs, int ys, int xt, int yt,
-                         int pitcht, int depth)
+/* when the color encoding changed, the palette must be recalculated */
+static void update_colors(video_canvas_t *canvas)
 {
     static int lastmode = -1;
     viewport_t *viewport = canvas->viewport;
-#ifdef VIDEO_SCALE_SOURCE
-    xs /= canvas->videoconfig->scalex;
-    ys /= canvas->videoconfig->scaley;
-#endif
 
-    /* when the color encoding changed, the palette must be recalculated */
     if (viewport->crt_type != lastmode) {
         canvas->videoconfig->color_tables.updated = 0;
         lastmode = viewport->crt_type;
@@ -106,10 +105,127 @@ void video_canvas_render(video_canvas_t *canvas, uint8_t *trg, int width,
     if (!canvas->videoconfig->color_tables.updated) { /* update colors as necessary */
         video_color_update_palette(canvas);
     }
-    video_render_main(canvas->videoconfig, canvas->draw_buffer->draw_buffer,
+}
+
+static void render_from(video_canvas_t *canvas, const uint8_t *src, uint8_t *trg,
+                        int width, int height, int xs, int ys, int xt, int yt,
+                        int pitcht, int depth)
+{
+#ifdef VIDEO_SCALE_SOURCE
+    xs /= canvas->videoconfig->scalex;
+    ys /= canvas->videoconfig->scaley;
+#endif
+
+    video_render_main(canvas->videoconfig, (uint8_t *)src,
                       trg, width, height, xs, ys, xt, yt,
                       canvas->draw_buffer->draw_buffer_width, pitcht, depth,
-                      viewport);
+                      canvas->viewport);
+
+    render_bytes += (uint64_t)width * height * ((depth + 7) / 8);
+}
+
+/* Convert bands of adjacent changed lines, given either as `spans' or as a
+   `map' with one byte per line.  */
+static void render_bands(video_canvas_t *canvas, const uint8_t *src,
+                         const video_dirty_span_t *spans, const uint8_t *map,
+                         uint8_t *trg, int width, int height, int xs, int ys,
+                         int xt, int yt, int pitcht, int depth)
+{
+    int scalex = canvas->videoconfig->scalex;
+    int scaley = canvas->videoconfig->scaley;
+    int border = (int)canvas->geometry->extra_offscreen_border_left;
+    int pad = canvas->videoconfig->filter == VIDEO_FILTER_CRT ? 1 : 0;
+    int xend, yend, y, y0, y1, bxs, bxe;
+
+    xend = xs + width / scalex;
+    yend = MIN(ys + height / scaley, (int)canvas->draw_buffer->draw_buffer_height);
+
+#define LINE_CHANGED(l) (spans ? spans[l].xs <= spans[l].xe : map[l] != 0)
+#define LINE_XS(l)      (spans ? (int)spans[l].xs : xs - border)
+#define LINE_XE(l)      (spans ? (int)spans[l].xe : xend - 1 - border)
+
+    for (y = ys; y < yend; y++) {
+        if (!LINE_CHANGED(y)) {
+            continue;
+        }
+
+        bxs = LINE_XS(y);
+        bxe = LINE_XE(y);
+        for (y1 = y; y1 + 1 < yend && LINE_CHANGED(y1 + 1); y1++) {
+            bxs = MIN(bxs, LINE_XS(y1 + 1));
+            bxe = MAX(bxe, LINE_XE(y1 + 1));
+        }
+
+        /* the CRT emulation blurs into the neighbouring pixels and lines,
+           see refresh_canvas() in raster-canvas.c */
+        y0 = MAX(y - pad, ys);
+        y = MIN(y1 + pad, yend - 1);
+        bxs = MAX(bxs + border - 4 * pad, xs);
+        bxe = MIN(bxe + border + 4 * pad, xend - 1);
+
+        if (bxs <= bxe) {
+            render_from(canvas, src, trg,
+                        (bxe - bxs + 1) * scalex, (y - y0 + 1) * scaley,
+                        bxs, y0,
+                        xt + (bxs - xs) * scalex, yt + (y0 - ys) * scaley,
+                        pitcht, depth);
+        }
+    }
+
+#undef LINE_CHANGED
+#undef LINE_XS
+#undef LINE_XE
+}
+
+void video_canvas_render(video_canvas_t *canvas, uint8_t *trg, int width,
+                         int height, int xs, int ys, int xt, int yt,
+                         int pitcht, int depth)
+{
+    update_colors(canvas);
+    render_from(canvas, canvas->draw_buffer->draw_buffer, trg,
+                width, height, xs, ys, xt, yt, pitcht, depth);
+}
+
+/* Like video_canvas_render(), but only convert the lines that changed since
+   the last refresh, as bands of adjacent dirty lines.  Meant to be called
+   from video_canvas_refresh(); outside of it everything is converted.  */
+void video_canvas_render_dirty(video_canvas_t *canvas, uint8_t *trg,
+                               int width, int height, int xs, int ys,
+                               int xt, int yt, int pitcht, int depth)
+{
+    video_dirty_span_t *lines = canvas->draw_buffer->dirty_lines;
+
+    if (lines == NULL) {
+        video_canvas_render(canvas, trg, width, height, xs, ys, xt, yt, pitcht, depth);
+        return;
+    }
+
+    update_colors(canvas);
+    render_bands(canvas, canvas->draw_buffer->draw_buffer, lines, NULL,
+                 trg, width, height, xs, ys, xt, yt, pitcht, depth);
+}
+
+/* Convert from `src', a copy of the draw buffer handed to a presenter
+   thread, only the lines set in `map' (all of them if it is NULL).  The
+   color tables are left alone here, the emulation thread keeps them up to
+   date.  */
+void video_canvas_render_frame(video_canvas_t *canvas, const uint8_t *src,
+                               const uint8_t *map, uint8_t *trg,
+                               int width, int height, int xs, int ys,
+                               int xt, int yt, int pitcht, int depth)
+{
+    if (map == NULL) {
+        render_from(canvas, src, trg, width, height, xs, ys, xt, yt, pitcht, depth);
+        return;
+    }
+
+    render_bands(canvas, src, NULL, map, trg, width, height, xs, ys, xt, yt, pitcht, depth);
+}
+
+/* Bytes video_canvas_render() has written to arch frame buffers.  */
+uint64_t video_canvas_render_bytes(void)
+{
+    return render_bytes;
 }
 
 void video_canvas_refresh_all(video_canvas_t *canvas)
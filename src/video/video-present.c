@@ -0,0 +1,304 @@
+/*
+ * video-present.c - Hand finished frames to a presenter thread.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * A triple buffer.  The emulation thread owns the back buffer and the
+ * presenter the front buffer; the third one sits in `middle', together
+ * with a flag telling whether it holds a frame the presenter has not
+ * taken yet.  Both sides trade their buffer for the middle one with a
+ * single atomic exchange, so neither ever waits for the other.  If the
+ * emulation publishes again before the presenter took the last frame,
+ * that frame is dropped.
+ *
+ * The buffers are 8 bit copies of the draw buffer.  Each one remembers
+ * which lines changed since it was last filled, so publishing only copies
+ * those.  For presenters that convert into a surface of their own, the
+ * lines each frame changed are kept for the last VIDEO_PRESENT_HISTORY
+ * frames.  The emulation may overwrite those while the presenter reads
+ * them; `writing' tells the presenter when that can have happened.
+ */
+
+#include "vice.h"
+
+#include <string.h>
+
+#include "lib.h"
+#include "types.h"
+#include "video-present.h"
+#include "video.h"
+#include "vsyncapi.h"
+
+#define PRESENT_FRESH 4
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+struct video_present_s {
+    video_present_frame_t frames[VIDEO_PRESENT_BUFFERS];
+    int own_buffers;
+    unsigned int pitch;
+    unsigned int num_lines;
+
+    /* emulation thread */
+    int back;
+    uint8_t *missing[VIDEO_PRESENT_BUFFERS];
+    unsigned long seq;
+
+    /* presenter thread */
+    int front;
+    unsigned long shown_seq;
+
+    /* shared */
+    int middle;
+    unsigned long writing;
+    uint8_t *history;
+
+    unsigned long published;
+    unsigned long dropped;
+    unsigned long presented;
+    uint64_t latency_sum;
+    unsigned long latency_max;
+    unsigned long period_latency_max;
+};
+
+static video_present_t *active_present = NULL;
+static video_present_stats_t period_base;
+static uint64_t period_base_latency_sum;
+
+video_present_t *video_present_new(uint8_t **buffers, unsigned int pitch,
+                                   unsigned int num_lines)
+{
+    video_present_t *present = lib_calloc(1, sizeof(video_present_t));
+    int i;
+
+    present->own_buffers = buffers == NULL;
+    present->pitch = pitch;
+    present->num_lines = num_lines;
+
+    for (i = 0; i < VIDEO_PRESENT_BUFFERS; i++) {
+        if (buffers == NULL) {
+            present->frames[i].pixels = lib_calloc(num_lines, pitch);
+        } else {
+            present->frames[i].pixels = buffers[i];
+        }
+        /* a new buffer lacks everything */
+        present->missing[i] = lib_malloc(num_lines);
+        memset(present->missing[i], 1, num_lines);
+    }
+    present->history = lib_calloc(VIDEO_PRESENT_HISTORY, num_lines);
+
+    present->back = 0;
+    present->middle = 1;
+    present->front = 2;
+
+    active_present = present;
+    memset(&period_base, 0, sizeof(period_base));
+    period_base_latency_sum = 0;
+
+    return present;
+}
+
+void video_present_destroy(video_present_t *present)
+{
+    int i;
+
+    if (present == active_present) {
+        active_present = NULL;
+    }
+
+    for (i = 0; i < VIDEO_PRESENT_BUFFERS; i++) {
+        if (present->own_buffers) {
+            lib_free(present->frames[i].pixels);
+        }
+        lib_free(present->missing[i]);
+    }
+    lib_free(present->history);
+    lib_free(present);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void video_present_publish(video_present_t *present, const uint8_t *draw_buffer,
+                           const video_dirty_span_t *dirty,
+                           unsigned int ys, unsigned int h, unsigned long now)
+{
+    unsigned long seq = present->seq + 1;
+    uint8_t *changed = present->history + (seq % VIDEO_PRESENT_HISTORY) * present->num_lines;
+    uint8_t *missing;
+    unsigned int y, ye;
+    int i, old;
+
+    __atomic_store_n(&present->writing, seq, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memset(changed, 0, present->num_lines);
+    ye = MIN(ys + h, present->num_lines);
+    for (y = ys; y < ye; y++) {
+        if (dirty == NULL || dirty[y].xs <= dirty[y].xe) {
+            changed[y] = 1;
+            for (i = 0; i < VIDEO_PRESENT_BUFFERS; i++) {
+                present->missing[i][y] = 1;
+            }
+        }
+    }
+
+    missing = present->missing[present->back];
+    for (y = 0; y < present->num_lines; y++) {
+        if (missing[y]) {
+            memcpy(present->frames[present->back].pixels + y * present->pitch,
+                   draw_buffer + y * present->pitch, present->pitch);
+            missing[y] = 0;
+        }
+    }
+
+    present->frames[present->back].seq = seq;
+    present->frames[present->back].stamp = now;
+    present->seq = seq;
+
+    old = __atomic_exchange_n(&present->middle, present->back | PRESENT_FRESH, __ATOMIC_ACQ_REL);
+    present->back = old & ~PRESENT_FRESH;
+
+    __atomic_store_n(&present->published, present->published + 1, __ATOMIC_RELAXED);
+    if (old & PRESENT_FRESH) {
+        __atomic_store_n(&present->dropped, present->dropped + 1, __ATOMIC_RELAXED);
+    }
+}
+
+video_present_frame_t *video_present_acquire(video_present_t *present)
+{
+    int old;
+
+    if (!(__atomic_load_n(&present->middle, __ATOMIC_ACQUIRE) & PRESENT_FRESH)) {
+        return NULL;
+    }
+
+    old = __atomic_exchange_n(&present->middle, present->front, __ATOMIC_ACQ_REL);
+    present->front = old & ~PRESENT_FRESH;
+
+    return &present->frames[present->front];
+}
+
+int video_present_changed_lines(video_present_t *present,
+                                const video_present_frame_t *frame, uint8_t *map)
+{
+    unsigned long seq;
+    unsigned int y;
+    const uint8_t *changed;
+
+    if (present->shown_seq == 0
+        || frame->seq - present->shown_seq >= VIDEO_PRESENT_HISTORY) {
+        return -1;
+    }
+
+    memset(map, 0, present->num_lines);
+    for (seq = present->shown_seq + 1; seq != frame->seq + 1; seq++) {
+        changed = present->history + (seq % VIDEO_PRESENT_HISTORY) * present->num_lines;
+        for (y = 0; y < present->num_lines; y++) {
+            map[y] |= changed[y];
+        }
+    }
+
+    /* Were any of those maps reused while we read them?  */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&present->writing, __ATOMIC_RELAXED) - present->shown_seq
+        > VIDEO_PRESENT_HISTORY) {
+        return -1;
+    }
+
+    return 0;
+}
+
+void video_present_done(video_present_t *present,
+                        const video_present_frame_t *frame, unsigned long now)
+{
+    unsigned long latency = now - frame->stamp;
+
+    present->shown_seq = frame->seq;
+
+    __atomic_store_n(&present->latency_sum, present->latency_sum + latency, __ATOMIC_RELAXED);
+    if (latency > present->latency_max) {
+        __atomic_store_n(&present->latency_max, latency, __ATOMIC_RELAXED);
+    }
+    if (latency > __atomic_load_n(&present->period_latency_max, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&present->period_latency_max, latency, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&present->presented, present->presented + 1, __ATOMIC_RELAXED);
+}
+
+/* ------------------------------------------------------------------------- */
+
+static double ticks_to_ms(double ticks)
+{
+    return ticks * 1000.0 / vsyncarch_frequency();
+}
+
+void video_present_get_totals(video_present_stats_t *stats)
+{
+    video_present_t *present = active_present;
+    uint64_t latency_sum;
+
+    memset(stats, 0, sizeof(video_present_stats_t));
+    if (present == NULL) {
+        return;
+    }
+
+    stats->published = __atomic_load_n(&present->published, __ATOMIC_RELAXED);
+    stats->dropped = __atomic_load_n(&present->dropped, __ATOMIC_RELAXED);
+    stats->presented = __atomic_load_n(&present->presented, __ATOMIC_RELAXED);
+    latency_sum = __atomic_load_n(&present->latency_sum, __ATOMIC_RELAXED);
+    if (stats->presented) {
+        stats->latency_avg_ms = ticks_to_ms((double)latency_sum / stats->presented);
+    }
+    stats->latency_max_ms = ticks_to_ms(__atomic_load_n(&present->latency_max, __ATOMIC_RELAXED));
+}
+
+void video_present_get_period(video_present_stats_t *stats)
+{
+    video_present_t *present = active_present;
+    uint64_t latency_sum;
+    unsigned long presented;
+
+    memset(stats, 0, sizeof(video_present_stats_t));
+    if (present == NULL) {
+        return;
+    }
+
+    presented = __atomic_load_n(&present->presented, __ATOMIC_RELAXED);
+    latency_sum = __atomic_load_n(&present->latency_sum, __ATOMIC_RELAXED);
+
+    stats->published = __atomic_load_n(&present->published, __ATOMIC_RELAXED) - period_base.published;
+    stats->dropped = __atomic_load_n(&present->dropped, __ATOMIC_RELAXED) - period_base.dropped;
+    stats->presented = presented - period_base.presented;
+    if (stats->presented) {
+        stats->latency_avg_ms = ticks_to_ms((double)(latency_sum - period_base_latency_sum)
+                                            / stats->presented);
+    }
+    stats->latency_max_ms = ticks_to_ms(__atomic_exchange_n(&present->period_latency_max, 0,
+                                                            __ATOMIC_RELAXED));
+
+    period_base.published += stats->published;
+    period_base.dropped += stats->dropped;
+    period_base.presented = presented;
+    period_base_latency_sum = latency_sum;
+}
@@ -0,0 +1,88 @@
+/*
+ * video-present.h - Hand finished frames to a presenter thread.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_VIDEO_PRESENT_H
+#define VICE_VIDEO_PRESENT_H
+
+#include "types.h"
+
+#define VIDEO_PRESENT_BUFFERS 3
+
+/* Per-frame change maps kept for the presenter.  If it falls further
+   behind than this it has to redraw everything.  */
+#define VIDEO_PRESENT_HISTORY 8
+
+struct video_dirty_span_s;
+
+typedef struct video_present_frame_s {
+    uint8_t *pixels;            /* copy of the draw buffer */
+    unsigned long seq;          /* number of the emulated frame */
+    unsigned long stamp;        /* vsyncarch_gettime() when it was published */
+} video_present_frame_t;
+
+typedef struct video_present_stats_s {
+    unsigned long published;    /* frames handed over by the emulation */
+    unsigned long presented;    /* frames the presenter got to show */
+    unsigned long dropped;      /* frames replaced before they were shown */
+    double latency_avg_ms;      /* publish to end of present */
+    double latency_max_ms;
+} video_present_stats_t;
+
+typedef struct video_present_s video_present_t;
+
+/* `buffers' are VIDEO_PRESENT_BUFFERS areas of `pitch' * `num_lines' bytes
+   owned by the caller (textures, for instance); NULL allocates them.  The
+   newest presenter is the one vsync reports on.  */
+extern video_present_t *video_present_new(uint8_t **buffers, unsigned int pitch,
+                                          unsigned int num_lines);
+extern void video_present_destroy(video_present_t *present);
+
+/* Emulation thread: copy the lines of `draw_buffer' the back buffer is
+   missing and make it the newest frame.  `dirty' are the spans of the
+   current refresh or NULL if lines ys..ys+h-1 all changed.  */
+extern void video_present_publish(video_present_t *present, const uint8_t *draw_buffer,
+                                  const struct video_dirty_span_s *dirty,
+                                  unsigned int ys, unsigned int h, unsigned long now);
+
+/* Presenter thread: take the newest frame, NULL if there is none since
+   the last call.  The frame stays valid until the next acquire.  */
+extern video_present_frame_t *video_present_acquire(video_present_t *present);
+
+/* Presenter thread: set map[line] for every line of `frame' that differs
+   from the frame acquired before it.  Returns -1 if that is not known
+   and everything has to be redrawn.  */
+extern int video_present_changed_lines(video_present_t *present,
+                                       const video_present_frame_t *frame,
+                                       uint8_t *map);
+
+/* Presenter thread: `frame' is on screen now.  */
+extern void video_present_done(video_present_t *present,
+                               const video_present_frame_t *frame, unsigned long now);
+
+/* Totals since the presenter was created, and the numbers since the last
+   call of the latter (vsync's speed display).  All zero without a
+   presenter.  */
+extern void video_present_get_totals(video_present_stats_t *stats);
+extern void video_present_get_period(video_present_stats_t *stats);
+
+#endif
@@ -33,6 +33,7 @@
 
 #include "log.h"
 #include "machine.h"
+#include "render-simd.h"
 #include "render1x1.h"
 #include "render1x1crt.h"
 #include "render1x1pal.h"
@@ -262,5 +263,6 @@ static void video_render_crt_main(video_render_config_t *config,
 
 void video_render_crt_init(void)
 {
+    render_simd_init();
     video_render_crtfunc_set(video_render_crt_main);
 }
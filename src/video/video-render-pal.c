@@ -32,6 +32,7 @@
 
 #include "log.h"
 #include "machine.h"
+#include "render-simd.h"
 #include "render1x1.h"
 #include "render1x1pal.h"
 #include "render1x1ntsc.h"
@@ -221,5 +222,6 @@ static void video_render_pal_main(video_render_config_t *config,
 
 void video_render_pal_init(void)
 {
+    render_simd_init();
     video_render_palfunc_set(video_render_pal_main);
 }
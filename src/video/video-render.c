@@ -30,6 +30,7 @@
 #include <stdio.h>
 
 #include "log.h"
+#include "profile.h"
 #include "render1x1.h"
 #include "render1x1pal.h"
 #include "render1x1ntsc.h"
@@ -98,9 +99,9 @@ void video_render_setphysicalcolor(video_render_config_t *config, int index,
 
 static int rendermode_error = -1;
 
-void video_render_main(video_render_config_t *config, uint8_t *src, uint8_t *trg,
-                       int width, int height, int xs, int ys, int xt, int yt,
-                       int pitchs, int pitcht, int depth, viewport_t *viewport)
+static void render_main(video_render_config_t *config, uint8_t *src, uint8_t *trg,
+                        int width, int height, int xs, int ys, int xt, int yt,
+                        int pitchs, int pitcht, int depth, viewport_t *viewport)
 {
     const video_render_color_tables_t *colortab;
     int rendermode;
@@ -175,6 +176,16 @@ void video_render_main(video_render_config_t *config, uint8_t *src, uint8_t *trg
     rendermode_error = rendermode;
 }
 
+void video_render_main(video_render_config_t *config, uint8_t *src, uint8_t *trg,
+                       int width, int height, int xs, int ys, int xt, int yt,
+                       int pitchs, int pitcht, int depth, viewport_t *viewport)
+{
+    PROFILE_ENTER(PROFILE_RENDER);
+    render_main(config, src, trg, width, height, xs, ys, xt, yt,
+                pitchs, pitcht, depth, viewport);
+    PROFILE_LEAVE();
+}
+
 void video_render_1x2func_set(void (*func)(video_render_config_t *,
                                            const uint8_t *, uint8_t *,
                                            unsigned int, const unsigned int,
@@ -61,9 +61,12 @@ int vsync_frame_counter;
 #include "monitor_network.h"
 #endif
 #include "network.h"
+#include "profile.h"
 #include "resources.h"
+#include "rewind.h"
 #include "sound.h"
 #include "types.h"
+#include "video-present.h"
 #include "vsync.h"
 #include "vsyncapi.h"
 
@@ -80,6 +83,10 @@ static int refresh_rate;
 /* "Warp mode".  If nonzero, attempt to run as fast as possible. */
 static int warp_mode_enabled;
 
+/* Warp mode for the tape turbo.  It is kept apart from the resource, so
+   whatever the user sets there while a tape loads stays as it is.  */
+static int tape_turbo_warp = 0;
+
 
 static int set_relative_speed(int val, void *param)
 {
@@ -105,7 +112,7 @@ static int set_warp_mode(int val, void *param)
 {
     warp_mode_enabled = val ? 1 : 0;
 
-    sound_set_warp_mode(warp_mode_enabled);
+    sound_set_warp_mode(warp_mode_enabled || tape_turbo_warp);
     set_timer_speed(relative_speed);
 
     return 0;
@@ -234,6 +241,13 @@ static int set_timer_speed(int speed)
     return 0;
 }
 
+static video_present_stats_t present_stats;
+
+void vsync_get_present_stats(video_present_stats_t *stats)
+{
+    *stats = present_stats;
+}
+
 /* Display speed (percentage) and frame rate (frames per second). */
 static void display_speed(int num_frames)
 {
@@ -253,8 +267,10 @@ static void display_speed(int num_frames)
     frame_rate = num_frames / diff_sec;
     speed_index = 100.0 * diff_clk / (cycles_per_sec * diff_sec);
 
+    video_present_get_period(&present_stats);
+
     if (!console_mode && machine_class != VICE_MACHINE_VSID) {
-        vsyncarch_display_speed(speed_index, frame_rate, warp_mode_enabled);
+        vsyncarch_display_speed(speed_index, frame_rate, vsync_warp_active());
     }
 
     speed_eval_prev_clk = maincpu_clk;
@@ -279,6 +295,23 @@ double vsync_get_refresh_frequency(void)
     return refresh_frequency;
 }
 
+void vsync_set_tape_turbo(int on)
+{
+    on = on ? 1 : 0;
+    if (on == tape_turbo_warp) {
+        return;
+    }
+    tape_turbo_warp = on;
+
+    sound_set_tape_turbo(tape_turbo_warp);
+    sound_set_warp_mode(warp_mode_enabled || tape_turbo_warp);
+}
+
+int vsync_warp_active(void)
+{
+    return warp_mode_enabled || tape_turbo_warp;
+}
+
 void vsync_init(void (*hook)(void))
 {
     vsync_hook = hook;
@@ -348,6 +381,9 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
     long frame_ticks_remainder, frame_ticks_integer;
     long compval;
 
+    PROFILE_FRAME_END(maincpu_clk);
+    PROFILE_ENTER(PROFILE_VSYNC);
+
 #ifdef HAVE_NETWORK
     /* check if someone wants to connect remotely to the monitor */
     monitor_check_remote();
@@ -368,6 +404,8 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
 
     vsync_hook();
 
+    rewind_vsync();
+
     if (network_connected()) {
         network_hook_time = vsyncarch_gettime() - network_hook_time;
 
@@ -408,7 +446,9 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
     }
 
     /* Flush sound buffer, get delay in seconds. */
+    PROFILE_ENTER(PROFILE_SOUND_FLUSH);
     sound_delay = sound_flush();
+    PROFILE_LEAVE();
 
     /* Get current time, directly after getting the sound delay. */
     now = vsyncarch_gettime();
@@ -451,7 +491,7 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
      * We could optimize by sleeping only if a frame is to be output.
      */
     /*log_debug("vsync_do_vsync: sound_delay=%f  frame_ticks=%d  delay=%d", sound_delay, frame_ticks, delay);*/
-    if (!warp_mode_enabled && timer_speed && (skipped_redraw == 0) && (delay < 0)) {
+    if (!vsync_warp_active() && timer_speed && (skipped_redraw == 0) && (delay < 0)) {
         /* FIXME: this is likely implemented as a regular sleep(), which means
            it will wait *at least* the given time (but may just as well wait
            much longer. its doomed to break on those archs - we should instead
@@ -482,7 +522,7 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
               + ((frame_ticks_remainder * 3 * timer_speed) / 100);
 
     if ((skipped_redraw < MAX_SKIPPED_FRAMES)
-        && (warp_mode_enabled
+        && (vsync_warp_active()
             || (skipped_redraw < (refresh_rate - 1))
             || ((!timer_speed || delay > compval) && !refresh_rate))
         ) {
@@ -549,6 +589,8 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
 
     vsyncarch_postsync();
 
+    PROFILE_LEAVE();
+
 #ifdef VSYNC_DEBUG
     log_debug("vsync: start:%lu  delay:%ld  sound-delay:%lf  end:%lu  next-frame:%lu  frame-ticks:%lu", 
                 now, delay, sound_delay * 1000000, vsyncarch_gettime(), next_frame_start, frame_ticks);
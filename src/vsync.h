@@ -44,6 +44,12 @@ extern int vsync_cmdline_options_init(void);
 extern void vsync_init(void (*hook)(void));
 extern void vsync_set_machine_parameter(double refresh_rate, long cycles);
 extern double vsync_get_refresh_frequency(void);
+
+/* Warp mode while the tape turbo plays a tape, on top of WarpMode.  */
+extern void vsync_set_tape_turbo(int on);
+
+/* Whether the emulation runs in warp mode, for either reason.  */
+extern int vsync_warp_active(void);
 extern int vsync_do_vsync(struct video_canvas_s *c, int been_skipped);
 extern int vsync_disable_timer(void);
 
@@ -45,6 +45,12 @@ extern void vsyncarch_init(void);
 /* display speed(%) and framerate(fps) */
 extern void vsyncarch_display_speed(double speed, double fps, int warp_enabled);
 
+/* Presented and dropped frames and presentation latency of the period the
+   last speed display was about; only meaningful for ports that present
+   from a thread of their own (video-present.h).  */
+struct video_present_stats_s;
+extern void vsync_get_present_stats(struct video_present_stats_s *stats);
+
 /* sleep the given amount of timer units */
 extern void vsyncarch_sleep(unsigned long delay);
 
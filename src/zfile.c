@@ -79,6 +79,22 @@ enum compression_type {
     COMPR_TZX
 };
 
+/* Uncompressed files kept in memory.  */
+struct zfile_memory_s {
+    char *name;                  /* Complete path of the original file.  */
+    uint8_t *data;
+    size_t size;
+    enum compression_type type;  /* How the original file is compressed.  */
+    int added;                   /* Handed over by zfile_memory_add().  */
+    unsigned int compressed_len; /* Length of the original file.  */
+    unsigned long mtime;         /* When the original file was changed.  */
+    unsigned int open_count;     /* Streams open on `data'.  */
+    int unlinked;                /* Free when the last stream is closed.  */
+    unsigned long last_used;
+    struct zfile_memory_s *next;
+};
+typedef struct zfile_memory_s zfile_memory_t;
+
 /* This defines a linked list of all the compressed files that have been
    opened.  */
 struct zfile_s {
@@ -91,6 +107,8 @@ struct zfile_s {
     struct zfile_s *prev, *next; /* Link to the previous and next nodes.  */
     zfile_action_t action;       /* action on close */
     char *request_string;        /* ui string for action=ZFILE_REQUEST */
+    zfile_memory_t *memory;      /* Buffer the stream is open on, if any.  */
+    unsigned long memory_crc;    /* CRC of the buffer when it was opened.  */
 };
 typedef struct zfile_s zfile_t;
 
@@ -175,6 +193,8 @@ static void zfile_list_add(const char *tmp_name,
     new_zfile->type = type;
     new_zfile->action = ZFILE_KEEP;
     new_zfile->request_string = NULL;
+    new_zfile->memory = NULL;
+    new_zfile->memory_crc = 0;
     new_zfile->next = zfile_list;
     new_zfile->prev = NULL;
     if (zfile_list != NULL) {
@@ -183,9 +203,16 @@ static void zfile_list_add(const char *tmp_name,
     zfile_list = new_zfile;
 }
 
+#ifdef HAVE_FMEMOPEN
+static void zfile_memory_shutdown(void);
+#endif
+
 void zfile_shutdown(void)
 {
     zfile_list_destroy();
+#ifdef HAVE_FMEMOPEN
+    zfile_memory_shutdown();
+#endif
 }
 
 /* ------------------------------------------------------------------------ */
@@ -815,12 +842,12 @@ static int compress_with_gzip(const char *src, const char *dest)
     gzFile fddest;
     size_t len;
 
-    fdsrc = fopen(dest, MODE_READ);
+    fdsrc = fopen(src, MODE_READ);
     if (fdsrc == NULL) {
         return -1;
     }
 
-    fddest = gzopen(src, MODE_WRITE "9");
+    fddest = gzopen(dest, MODE_WRITE "9");
     if (fddest == NULL) {
         fclose(fdsrc);
         return -1;
@@ -828,7 +855,7 @@ static int compress_with_gzip(const char *src, const char *dest)
 
     do {
         char buf[256];
-        len = fread((void *)buf, 256, 1, fdsrc);
+        len = fread((void *)buf, 1, 256, fdsrc);
         if (len > 0) {
             gzwrite(fddest, (void *)buf, (unsigned int)len);
         }
@@ -872,6 +899,32 @@ static int compress_with_gzip(const char *src, const char *dest)
 #endif
 }
 
+#ifdef HAVE_ZLIB
+/* Compress `size' bytes at `data' into `dest' using zlib.  */
+static int compress_memory_with_gzip(const uint8_t *data, size_t size,
+                                     const char *dest)
+{
+    gzFile fddest;
+    int retval = 0;
+
+    fddest = gzopen(dest, MODE_WRITE "9");
+    if (fddest == NULL) {
+        return -1;
+    }
+
+    if (size > 0 && gzwrite(fddest, (voidpc)data, (unsigned int)size) != (int)size) {
+        retval = -1;
+    }
+    if (gzclose(fddest) != Z_OK) {
+        retval = -1;
+    }
+
+    ZDEBUG(("compress from memory with zlib: %s.", retval ? "failed" : "OK"));
+
+    return retval;
+}
+#endif
+
 /* Compress `src' into `dest' using bzip.  */
 static int compress_with_bzip(const char *src, const char *dest)
 {
@@ -905,9 +958,10 @@ static int compress_with_bzip(const char *src, const char *dest)
     }
 }
 
-/* Compress `src' into `dest' using algorithm `type'.  */
-static int zfile_compress(const char *src, const char *dest,
-                          enum compression_type type)
+/* Compress `src', or the buffer `memory' if it is not NULL, into `dest'
+   using algorithm `type'.  */
+static int zfile_compress(const char *src, const zfile_memory_t *memory,
+                          const char *dest, enum compression_type type)
 {
     char *dest_backup_name;
     int retval;
@@ -970,10 +1024,16 @@ static int zfile_compress(const char *src, const char *dest,
 
     switch (type) {
         case COMPR_GZIP:
-            retval = compress_with_gzip(src, dest);
+#ifdef HAVE_ZLIB
+            if (memory != NULL) {
+                retval = compress_memory_with_gzip(memory->data, memory->size, dest);
+                break;
+            }
+#endif
+            retval = memory ? -1 : compress_with_gzip(src, dest);
             break;
         case COMPR_BZIP:
-            retval = compress_with_bzip(src, dest);
+            retval = memory ? -1 : compress_with_bzip(src, dest);
             break;
         default:
             retval = -1;
@@ -1001,6 +1061,410 @@ static int zfile_compress(const char *src, const char *dest,
     return retval;
 }
 
+/* ------------------------------------------------------------------------- */
+
+/* Files in memory.
+
+   A gzip file is uncompressed into a buffer instead of a temporary file
+   and the stream is opened on the buffer with fmemopen().  Whatever else
+   was uncompressed into a temporary file for reading is loaded into a
+   buffer and the temporary file removed right away.  The buffer stays
+   after the stream is closed, so opening the same file again (the drive
+   does that when it falls back to read-only, autostart when it attaches
+   the image it has just looked at) costs nothing as long as the file has
+   the same length and modification time.  Ports that unpack archives themselves hand the files
+   over with zfile_memory_add().
+
+   Buffers no stream is open on are freed, least recently used first, once
+   all of them take more than `memory_limit' bytes.  Added buffers are the
+   only copy of their file, they are never freed that way.  */
+
+#ifdef HAVE_FMEMOPEN
+
+static zfile_memory_t *memory_list = NULL;
+static size_t memory_limit = ZFILE_MEMORY_LIMIT_DEFAULT;
+static unsigned long memory_clock = 0;
+static zfile_memory_stats_t memory_stats;
+
+static void zfile_memory_free(zfile_memory_t *m)
+{
+    zfile_memory_t **p;
+
+    for (p = &memory_list; *p != NULL; p = &(*p)->next) {
+        if (*p == m) {
+            *p = m->next;
+            break;
+        }
+    }
+    memory_stats.entries--;
+    memory_stats.bytes -= m->size;
+
+    lib_free(m->name);
+    lib_free(m->data);
+    lib_free(m);
+}
+
+/* Forget `m'; it is freed as soon as no stream is open on it.  */
+static void zfile_memory_unlink(zfile_memory_t *m)
+{
+    if (m->open_count == 0) {
+        zfile_memory_free(m);
+    } else {
+        m->unlinked = 1;
+    }
+}
+
+static void zfile_memory_trim(void)
+{
+    while (memory_stats.bytes > memory_limit) {
+        zfile_memory_t *m, *lru = NULL;
+
+        for (m = memory_list; m != NULL; m = m->next) {
+            if (m->open_count == 0 && !m->added
+                && (lru == NULL || m->last_used < lru->last_used)) {
+                lru = m;
+            }
+        }
+        if (lru == NULL) {
+            break;
+        }
+        ZDEBUG(("zfile_memory_trim: dropping `%s'", lru->name));
+        zfile_memory_free(lru);
+        memory_stats.evicted++;
+    }
+}
+
+static zfile_memory_t *zfile_memory_new(const char *fullname, uint8_t *data,
+                                        size_t size, enum compression_type type)
+{
+    zfile_memory_t *m = lib_calloc(1, sizeof(zfile_memory_t));
+
+    m->name = lib_stralloc(fullname);
+    m->data = data;
+    m->size = size;
+    m->type = type;
+    m->last_used = ++memory_clock;
+    m->next = memory_list;
+    memory_list = m;
+    memory_stats.entries++;
+    memory_stats.bytes += size;
+
+    return m;
+}
+
+/* The buffer for `fullname', unless the file has changed since.  */
+static zfile_memory_t *zfile_memory_find(const char *fullname)
+{
+    zfile_memory_t *m;
+    unsigned int len, isdir;
+    unsigned long mtime;
+
+    for (m = memory_list; m != NULL; m = m->next) {
+        if (!m->unlinked && strcmp(m->name, fullname) == 0) {
+            break;
+        }
+    }
+    if (m != NULL && !m->added
+        && (ioutil_stat(fullname, &len, &isdir) < 0 || len != m->compressed_len
+            || ioutil_mtime(fullname, &mtime) < 0 || mtime != m->mtime)) {
+        zfile_memory_unlink(m);
+        m = NULL;
+    }
+    return m;
+}
+
+static FILE *zfile_memory_open(zfile_memory_t *m, int write_mode)
+{
+    FILE *stream;
+
+    stream = fmemopen(m->data, m->size, write_mode ? MODE_READ_WRITE : MODE_READ);
+    if (stream == NULL) {
+        return NULL;
+    }
+    m->open_count++;
+    m->last_used = ++memory_clock;
+    zfile_list_add(NULL, m->name, m->type, write_mode, stream, NULL);
+    zfile_list->memory = m;
+#ifdef HAVE_ZLIB
+    /* Drives open images for writing whether they write or not.  */
+    if (write_mode && m->type == COMPR_GZIP) {
+        zfile_list->memory_crc = crc32(0L, m->data, (uInt)m->size);
+    }
+#endif
+
+    zfile_memory_trim();
+
+    return stream;
+}
+
+#ifdef HAVE_ZLIB
+/* `.tar.gz' and friends go to the archive programs first.  */
+static int file_is_archive(const char *name)
+{
+    size_t l = strlen(name), len;
+    int i;
+
+    for (i = 0; valid_archives[i].program; i++) {
+        len = strlen(valid_archives[i].extension);
+        if (l > len && strcasecmp(name + l - len, valid_archives[i].extension) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static uint8_t *zfile_memory_gunzip(const char *name, size_t *size)
+{
+    gzFile fdsrc;
+    uint8_t *data = NULL;
+    size_t alloc = 0;
+    int len;
+
+    fdsrc = gzopen(name, MODE_READ);
+    if (fdsrc == NULL) {
+        return NULL;
+    }
+
+    *size = 0;
+    do {
+        if (*size == alloc) {
+            alloc = alloc ? alloc * 2 : 0x10000;
+            data = lib_realloc(data, alloc);
+        }
+        len = gzread(fdsrc, data + *size, (unsigned int)(alloc - *size));
+        if (len > 0) {
+            *size += (size_t)len;
+        }
+    } while (len > 0);
+
+    gzclose(fdsrc);
+
+    if (len < 0 || *size == 0) {
+        lib_free(data);
+        return NULL;
+    }
+    return data;
+}
+#endif
+
+/* Open `name' from memory if it is there, or uncompress it into memory if
+   it is a gzip file.  Returns NULL if it has to be opened the usual way.  */
+static FILE *zfile_memory_fopen(const char *name, int write_mode)
+{
+    zfile_memory_t *m;
+    char *fullname = NULL;
+    FILE *stream = NULL;
+
+    archdep_expand_path(&fullname, name);
+
+    m = zfile_memory_find(fullname);
+    if (m != NULL) {
+        /* Only gzip files are written back from memory, and that takes
+           zlib.  */
+#ifdef HAVE_ZLIB
+        if (write_mode && !m->added
+            && (m->type != COMPR_GZIP || ioutil_access(name, IOUTIL_ACCESS_W_OK) < 0)) {
+#else
+        if (write_mode && !m->added) {
+#endif
+            m = NULL;
+        } else {
+            memory_stats.hits++;
+        }
+    }
+#ifdef HAVE_ZLIB
+    else if (file_is_gzip(name) && !file_is_archive(name)
+             && (!write_mode || ioutil_access(name, IOUTIL_ACCESS_W_OK) == 0)) {
+        unsigned int len, isdir;
+        unsigned long mtime;
+        uint8_t *data;
+        size_t size;
+
+        if (ioutil_stat(name, &len, &isdir) == 0 && !isdir
+            && ioutil_mtime(name, &mtime) == 0
+            && (data = zfile_memory_gunzip(name, &size)) != NULL) {
+            m = zfile_memory_new(fullname, data, size, COMPR_GZIP);
+            m->compressed_len = len;
+            m->mtime = mtime;
+            memory_stats.misses++;
+        }
+    }
+#endif
+
+    if (m != NULL) {
+        stream = zfile_memory_open(m, write_mode);
+    }
+    lib_free(fullname);
+
+    return stream;
+}
+
+/* Move what `try_uncompress()' left in `tmp_name' into memory and open it
+   there.  Returns NULL, and leaves the file alone, if that fails.  */
+static FILE *zfile_memory_keep(const char *tmp_name, const char *name,
+                               enum compression_type type)
+{
+    zfile_memory_t *m;
+    char *fullname = NULL;
+    unsigned int len, isdir;
+    unsigned long mtime;
+    uint8_t *data;
+    size_t size;
+    FILE *fd, *stream;
+
+    if (ioutil_stat(name, &len, &isdir) < 0 || ioutil_mtime(name, &mtime) < 0) {
+        return NULL;
+    }
+    fd = fopen(tmp_name, MODE_READ);
+    if (fd == NULL) {
+        return NULL;
+    }
+    size = util_file_length(fd);
+    if (size == 0 || size > memory_limit) {
+        fclose(fd);
+        return NULL;
+    }
+    data = lib_malloc(size);
+    if (fread(data, 1, size, fd) != size) {
+        fclose(fd);
+        lib_free(data);
+        return NULL;
+    }
+    fclose(fd);
+
+    archdep_expand_path(&fullname, name);
+    m = zfile_memory_new(fullname, data, size, type);
+    m->compressed_len = len;
+    m->mtime = mtime;
+    memory_stats.misses++;
+    lib_free(fullname);
+
+    stream = zfile_memory_open(m, 0);
+    if (stream == NULL) {
+        zfile_memory_free(m);
+        return NULL;
+    }
+    if (ioutil_remove(tmp_name) < 0) {
+        log_error(zlog, "Cannot unlink `%s': %s", tmp_name, strerror(errno));
+    }
+    return stream;
+}
+
+/* Done with the stream on `m'.  */
+static void zfile_memory_release(zfile_memory_t *m)
+{
+    m->open_count--;
+    if (m->unlinked && m->open_count == 0) {
+        zfile_memory_free(m);
+    }
+    zfile_memory_trim();
+}
+
+int zfile_memory_add(const char *name, uint8_t *data, size_t size)
+{
+    zfile_memory_t *m;
+    char *fullname = NULL;
+
+    if (!zinit_done) {
+        zinit();
+    }
+
+    if (name == NULL || data == NULL || size == 0 || size > memory_limit) {
+        return -1;
+    }
+
+    archdep_expand_path(&fullname, name);
+    zfile_memory_remove(fullname);
+    m = zfile_memory_new(fullname, data, size, COMPR_NONE);
+    m->added = 1;
+    lib_free(fullname);
+
+    zfile_memory_trim();
+
+    return 0;
+}
+
+int zfile_memory_remove(const char *name)
+{
+    zfile_memory_t *m, *next;
+    char *fullname = NULL;
+    int retval = -1;
+
+    archdep_expand_path(&fullname, name);
+    for (m = memory_list; m != NULL; m = next) {
+        next = m->next;
+        if (!m->unlinked && strcmp(m->name, fullname) == 0) {
+            zfile_memory_unlink(m);
+            retval = 0;
+        }
+    }
+    lib_free(fullname);
+
+    return retval;
+}
+
+int zfile_memory_exists(const char *name)
+{
+    char *fullname = NULL;
+    int retval;
+
+    if (memory_list == NULL) {
+        return 0;
+    }
+    archdep_expand_path(&fullname, name);
+    retval = zfile_memory_find(fullname) != NULL;
+    lib_free(fullname);
+
+    return retval;
+}
+
+void zfile_memory_set_limit(size_t limit)
+{
+    memory_limit = limit;
+    zfile_memory_trim();
+}
+
+void zfile_memory_get_stats(zfile_memory_stats_t *stats)
+{
+    *stats = memory_stats;
+    stats->limit = memory_limit;
+}
+
+static void zfile_memory_shutdown(void)
+{
+    while (memory_list != NULL) {
+        zfile_memory_free(memory_list);
+    }
+}
+
+#else /* !HAVE_FMEMOPEN */
+
+int zfile_memory_add(const char *name, uint8_t *data, size_t size)
+{
+    return -1;
+}
+
+int zfile_memory_remove(const char *name)
+{
+    return -1;
+}
+
+int zfile_memory_exists(const char *name)
+{
+    return 0;
+}
+
+void zfile_memory_set_limit(size_t limit)
+{
+}
+
+void zfile_memory_get_stats(zfile_memory_stats_t *stats)
+{
+    memset(stats, 0, sizeof(zfile_memory_stats_t));
+}
+
+#endif
+
 /* ------------------------------------------------------------------------ */
 
 /* Here we have the actual fopen and fclose wrappers.
@@ -1033,6 +1497,15 @@ FILE *zfile_fopen(const char *name, const char *mode)
         write_mode = 1;
     }
 
+#ifdef HAVE_FMEMOPEN
+    if (memory_limit > 0) {
+        stream = zfile_memory_fopen(name, write_mode);
+        if (stream != NULL) {
+            return stream;
+        }
+    }
+#endif
+
     /* Check for write permissions.  */
     if (write_mode && ioutil_access(name, IOUTIL_ACCESS_W_OK) < 0) {
         return NULL;
@@ -1051,6 +1524,16 @@ FILE *zfile_fopen(const char *name, const char *mode)
         return NULL;
     }
 
+#ifdef HAVE_FMEMOPEN
+    if (!write_mode && memory_limit > 0) {
+        stream = zfile_memory_keep(tmp_name, name, type);
+        if (stream != NULL) {
+            lib_free(tmp_name);
+            return stream;
+        }
+    }
+#endif
+
     /* Open the uncompressed version of the file.  */
     stream = fopen(tmp_name, mode);
     if (stream == NULL) {
@@ -1093,15 +1576,38 @@ static int handle_close_action(zfile_t *ptr)
 /* Handle close of a (compressed file). `ptr' points to the zfile to close.  */
 static int handle_close(zfile_t *ptr)
 {
+    int retval = 0;
+
     ZDEBUG(("handle_close: closing `%s' (`%s'), write_mode = %d",
             ptr->tmp_name ? ptr->tmp_name : "(null)",
             ptr->orig_name, ptr->write_mode));
 
+#ifdef HAVE_FMEMOPEN
+    if (ptr->memory) {
+        zfile_memory_t *m = ptr->memory;
+#ifdef HAVE_ZLIB
+        unsigned int isdir;
+
+        /* Recompress the buffer into the original file if it changed.  */
+        if (ptr->write_mode && ptr->type == COMPR_GZIP && !m->unlinked
+            && crc32(0L, m->data, (uInt)m->size) != ptr->memory_crc) {
+            if (zfile_compress(NULL, m, ptr->orig_name, ptr->type) < 0
+                || ioutil_stat(ptr->orig_name, &m->compressed_len, &isdir) < 0
+                || ioutil_mtime(ptr->orig_name, &m->mtime) < 0) {
+                zfile_memory_unlink(m);
+                retval = -1;
+            }
+        }
+#endif
+        zfile_memory_release(m);
+    }
+#endif
+
     if (ptr->tmp_name) {
         /* Recompress into the original file.  */
         if (ptr->orig_name
             && ptr->write_mode
-            && zfile_compress(ptr->tmp_name, ptr->orig_name, ptr->type)) {
+            && zfile_compress(ptr->tmp_name, NULL, ptr->orig_name, ptr->type)) {
             return -1;
         }
 
@@ -1136,7 +1642,7 @@ static int handle_close(zfile_t *ptr)
 
     lib_free(ptr);
 
-    return 0;
+    return retval;
 }
 
 /* `fclose()' wrapper.  */
@@ -30,6 +30,8 @@
 
 #include <stdio.h>
 
+#include "types.h"
+
 /* actions to be done when a zfile is closed */
 typedef enum {
     ZFILE_KEEP,         /* Nothing, keep original file (default).  */
@@ -45,6 +47,36 @@ extern void zfile_shutdown(void);
 extern int zfile_close_action(const char *filename, zfile_action_t action,
                               const char *request_string);
 
+/* Uncompressed files are kept in memory up to this many bytes.  */
+#define ZFILE_MEMORY_LIMIT_DEFAULT (32 * 1024 * 1024)
+
+typedef struct zfile_memory_stats_s {
+    unsigned int entries;       /* files in memory */
+    size_t bytes;               /* what they take */
+    size_t limit;
+    unsigned long hits;         /* opened without uncompressing */
+    unsigned long misses;       /* uncompressed into memory */
+    unsigned long evicted;      /* freed to stay under the limit */
+} zfile_memory_stats_t;
+
+/* Make `size' bytes at `data' (from lib_malloc()) the contents of the file
+   `name' for zfile_fopen(), which looks there before the file system.  On
+   success zfile owns `data' and keeps it, as the only copy of the file,
+   until zfile_memory_remove().  It counts against the limit, the other
+   files in memory go first.  Writes only change the buffer.
+   Returns -1, and leaves `data' to the caller, without fmemopen() or if
+   the file is over the limit.  */
+extern int zfile_memory_add(const char *name, uint8_t *data, size_t size);
+
+/* Forget `name'; streams still open on it keep working.  */
+extern int zfile_memory_remove(const char *name);
+
+extern int zfile_memory_exists(const char *name);
+
+/* 0 keeps nothing in memory and uncompresses into temporary files.  */
+extern void zfile_memory_set_limit(size_t limit);
+extern void zfile_memory_get_stats(zfile_memory_stats_t *stats);
+
 #if 0
 
 /*